@@ -277,7 +277,8 @@ void HostBridge::decodeDMRAudioFrame(uint8_t* ambe, uint32_t srcId, uint32_t dst
         }
         else {
 #endif // defined(_WIN32)
-            m_decoder->decode(ambePartial, samples);
+            if (m_vocoderDecodeClient == nullptr || !m_vocoderDecodeClient->decode(ambePartial, samples))
+                m_decoder->decode(ambePartial, samples);
 #if defined(_WIN32)
         }
 #endif // defined(_WIN32)
@@ -465,7 +466,8 @@ void HostBridge::encodeDMRAudioFrame(uint8_t* pcm, uint32_t forcedSrcId, uint32_
     }
     else {
 #endif // defined(_WIN32)
-        m_encoder->encode(samples, ambe);
+        if (m_vocoderEncodeClient == nullptr || !m_vocoderEncodeClient->encode(samples, ambe))
+            m_encoder->encode(samples, ambe);
 #if defined(_WIN32)
     }
 #endif // defined(_WIN32)
@@ -479,7 +479,8 @@ void HostBridge::decodeP25AudioFrame(uint8_t* ldu, uint32_t srcId, uint32_t dstI
         }
         else {
 #endif // defined(_WIN32)
-            m_decoder->decode(imbe, samples);
+            if (m_vocoderDecodeClient == nullptr || !m_vocoderDecodeClient->decode(imbe, samples))
+                m_decoder->decode(imbe, samples);
 #if defined(_WIN32)
         }
 #endif // defined(_WIN32)
@@ -556,7 +557,8 @@ void HostBridge::encodeP25AudioFrame(uint8_t* pcm, uint32_t forcedSrcId, uint32_
     }
     else {
 #endif // defined(_WIN32)
-        m_encoder->encode(samples, imbe);
+        if (m_vocoderEncodeClient == nullptr || !m_vocoderEncodeClient->encode(samples, imbe))
+            m_encoder->encode(samples, imbe);
 #if defined(_WIN32)
     }
 #endif // defined(_WIN32)
@@ -180,6 +180,7 @@ HostBridge::HostBridge(const std::string& confFile) :
     m_vocoderDecoderAutoGain(false),
     m_txAudioGain(1.0f),
     m_vocoderEncoderAudioGain(3.0),
+    m_vocoderService(),
     m_trace(false),
     m_debug(false),
     m_tekAlgoId(P25DEF::ALGO_UNENCRYPT),
@@ -205,6 +206,8 @@ HostBridge::HostBridge(const std::string& confFile) :
     m_udpPackets(),
     m_decoder(nullptr),
     m_encoder(nullptr),
+    m_vocoderDecodeClient(nullptr),
+    m_vocoderEncodeClient(nullptr),
     m_mdcDecoder(nullptr),
     m_udpAudio(false),
     m_udpMetadata(false),
@@ -506,6 +509,14 @@ int HostBridge::run()
         m_decoder->setGainAdjust(m_vocoderDecoderAudioGain);
         m_decoder->setAutoGain(m_vocoderDecoderAutoGain);
         m_encoder->setGainAdjust(m_vocoderEncoderAudioGain);
+
+        // local vocoders remain as the fallback if the shared vocoder service stops responding; network audio
+        // is decoded and local audio is encoded on different threads, so each direction claims its own channel
+        if (!m_vocoderService.empty()) {
+            vocoder::shm::CHANNEL_TYPE type = (m_txMode == TX_MODE_P25) ? vocoder::shm::CHANNEL_IMBE : vocoder::shm::CHANNEL_DMR_AMBE;
+            m_vocoderDecodeClient = openVocoderClient(type, "decode");
+            m_vocoderEncodeClient = openVocoderClient(type, "encode");
+        }
     }
 
 #if defined(_WIN32)
@@ -715,6 +726,8 @@ int HostBridge::run()
         delete m_decoder;
     if (m_encoder != nullptr)
         delete m_encoder;
+    closeVocoderClient(m_vocoderDecodeClient, "decode");
+    closeVocoderClient(m_vocoderEncodeClient, "encode");
 
     delete m_mdcDecoder;
 
@@ -998,6 +1011,9 @@ bool HostBridge::readParams()
     m_vocoderDecoderAutoGain = systemConf["vocoderDecoderAutoGain"].as<bool>(false);
     m_txAudioGain = systemConf["txAudioGain"].as<float>(1.0f);
     m_vocoderEncoderAudioGain = systemConf["vocoderEncoderAudioGain"].as<float>(3.0f);
+#if !defined(_WIN32)
+    m_vocoderService = systemConf["vocoderService"].as<std::string>("");
+#endif // !defined(_WIN32)
     
     m_txMode = (uint8_t)systemConf["txMode"].as<uint32_t>(1U);
     if (m_txMode < TX_MODE_DMR)
@@ -1137,6 +1153,7 @@ bool HostBridge::readParams()
     LogInfo("    Vocoder Decoder Auto Gain: %s", m_vocoderDecoderAutoGain ? "yes" : "no");
     LogInfo("    Tx Audio Gain: %.1f", m_txAudioGain);
     LogInfo("    Vocoder Encoder Audio Gain: %.1f", m_vocoderEncoderAudioGain);
+    LogInfo("    Shared Vocoder Service: %s", m_vocoderService.empty() ? "disabled" : m_vocoderService.c_str());
     LogInfo("    Transmit Mode: %s", txModeStr.c_str());
     LogInfo("    VOX Sample Level: %.1f", m_voxSampleLevel);
     LogInfo("    Drop Time: %ums", m_dropTimeMS);
@@ -1364,6 +1381,37 @@ bool HostBridge::createNetwork()
     return true;
 }
 
+/* Helper to claim a channel on the shared vocoder service. */
+
+vocoder::VocoderClient* HostBridge::openVocoderClient(vocoder::shm::CHANNEL_TYPE type, const char* direction)
+{
+    vocoder::VocoderClient* client = new vocoder::VocoderClient(m_vocoderService);
+    if (!client->open(type, m_vocoderDecoderAudioGain, m_vocoderDecoderAutoGain, m_vocoderEncoderAudioGain)) {
+        ::LogWarning(LOG_HOST, "Shared vocoder service %s is unavailable, using local vocoder to %s", m_vocoderService.c_str(), direction);
+        delete client;
+        return nullptr;
+    }
+
+    ::LogInfoEx(LOG_HOST, "Using shared vocoder service %s to %s, channel %u", m_vocoderService.c_str(), direction, client->getChannelNo());
+    return client;
+}
+
+/* Helper to release a channel on the shared vocoder service. */
+
+void HostBridge::closeVocoderClient(vocoder::VocoderClient*& client, const char* direction)
+{
+    if (client == nullptr)
+        return;
+
+    if (client->getFrames() > 0U)
+        ::LogInfoEx(LOG_HOST, "Shared vocoder service (%s), frames = %llu, timeouts = %llu, latency avg = %uus, max = %uus", direction,
+            (unsigned long long)client->getFrames(), (unsigned long long)client->getTimeouts(),
+            client->getLatencyAvg(), client->getLatencyMax());
+
+    delete client;
+    client = nullptr;
+}
+
 /* Helper to process UDP audio. */
 
 void HostBridge::processUDPAudio()
@@ -30,6 +30,7 @@
 #include "common/Clock.h"
 #include "vocoder/MBEDecoder.h"
 #include "vocoder/MBEEncoder.h"
+#include "vocoder/VocoderClient.h"
 #define MINIAUDIO_IMPLEMENTATION
 #include "audio/miniaudio.h"
 #include "mdc/mdc_decode.h"
@@ -175,6 +176,7 @@ private:
 
     float m_txAudioGain;
     float m_vocoderEncoderAudioGain;
+    std::string m_vocoderService;
 
     bool m_trace;
     bool m_debug;
@@ -213,6 +215,8 @@ private:
 
     vocoder::MBEDecoder* m_decoder;
     vocoder::MBEEncoder* m_encoder;
+    vocoder::VocoderClient* m_vocoderDecodeClient;
+    vocoder::VocoderClient* m_vocoderEncodeClient;
 
     mdc_decoder_t* m_mdcDecoder;
     
@@ -447,6 +451,19 @@ private:
      * @returns bool True, if network connectivity was initialized, otherwise false.
      */
     bool createNetwork();
+    /**
+     * @brief Helper to claim a channel on the shared vocoder service.
+     * @param type Vocoder channel type.
+     * @param direction Textual name of the direction the channel is used for.
+     * @returns vocoder::VocoderClient* Vocoder client, or nullptr if the service is unavailable.
+     */
+    vocoder::VocoderClient* openVocoderClient(vocoder::shm::CHANNEL_TYPE type, const char* direction);
+    /**
+     * @brief Helper to release a channel on the shared vocoder service.
+     * @param client Vocoder client.
+     * @param direction Textual name of the direction the channel is used for.
+     */
+    void closeVocoderClient(vocoder::VocoderClient*& client, const char* direction);
 
     /**
      * @brief Helper to process UDP audio.
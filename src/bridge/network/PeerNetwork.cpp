@@ -190,6 +190,7 @@ bool PeerNetwork::writeConfig()
     config["rcon"].set<json::object>(rcon);
 
     config["software"].set<std::string>(std::string(software));                 // Software ID
+    writeResumeProof(config);
 
     json::value v = json::value(config);
     std::string json = v.serialize();
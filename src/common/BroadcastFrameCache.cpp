@@ -0,0 +1,123 @@
+// SPDX-License-Identifier: GPL-2.0-only
+/*
+ * Digital Voice Modem - Common Library
+ * GPLv2 Open Source. Use is subject to license terms.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ *  Copyright (C) 2026 Bryan Biedenkapp, N2PLL
+ *
+ */
+#include "Defines.h"
+#include "BroadcastFrameCache.h"
+
+#include <cassert>
+#include <cstring>
+
+// ---------------------------------------------------------------------------
+//  Constants
+// ---------------------------------------------------------------------------
+
+const uint64_t FNV_PRIME = 0x100000001B3ULL;
+
+// ---------------------------------------------------------------------------
+//  Public Class Members
+// ---------------------------------------------------------------------------
+
+/* Initializes a new instance of the BroadcastFrameCache class. */
+
+BroadcastFrameCache::BroadcastFrameCache(uint32_t length) :
+    m_length(length),
+    m_version(0U),
+    m_valid(false),
+    m_index(),
+    m_frames(),
+    m_hits(0U),
+    m_misses(0U)
+{
+    assert(length > 0U);
+}
+
+/* Finalizes a instance of the BroadcastFrameCache class. */
+
+BroadcastFrameCache::~BroadcastFrameCache() = default;
+
+/* Validates the cache against the given version, flushing all cached frames if the version has changed. */
+
+bool BroadcastFrameCache::validate(uint64_t version)
+{
+    if (m_valid && version == m_version)
+        return false;
+
+    clear();
+
+    m_version = version;
+    m_valid = true;
+    return true;
+}
+
+/* Finds a cached frame. */
+
+bool BroadcastFrameCache::find(uint64_t key, uint8_t* data)
+{
+    assert(data != nullptr);
+
+    auto it = m_index.find(key);
+    if (it == m_index.end()) {
+        m_misses++;
+        return false;
+    }
+
+    ::memcpy(data, m_frames.data() + it->second, m_length);
+    m_hits++;
+    return true;
+}
+
+/* Adds (or replaces) a cached frame. */
+
+void BroadcastFrameCache::insert(uint64_t key, const uint8_t* data)
+{
+    assert(data != nullptr);
+
+    auto it = m_index.find(key);
+    if (it != m_index.end()) {
+        ::memcpy(m_frames.data() + it->second, data, m_length);
+        return;
+    }
+
+    uint32_t offset = (uint32_t)m_frames.size();
+    m_frames.insert(m_frames.end(), data, data + m_length);
+    m_index[key] = offset;
+}
+
+/* Flushes all cached frames. */
+
+void BroadcastFrameCache::clear()
+{
+    m_index.clear();
+    m_frames.clear();
+    m_valid = false;
+}
+
+/* Helper to fold a value into a cache version. */
+
+uint64_t BroadcastFrameCache::hash(uint64_t version, uint64_t value)
+{
+    for (uint8_t i = 0U; i < 8U; i++) {
+        version ^= (value >> (i * 8U)) & 0xFFU;
+        version *= FNV_PRIME;
+    }
+
+    return version;
+}
+
+/* Helper to fold a string into a cache version. */
+
+uint64_t BroadcastFrameCache::hash(uint64_t version, const std::string& value)
+{
+    for (char c : value) {
+        version ^= (uint8_t)c;
+        version *= FNV_PRIME;
+    }
+
+    return hash(version, value.length());
+}
@@ -0,0 +1,134 @@
+// SPDX-License-Identifier: GPL-2.0-only
+/*
+ * Digital Voice Modem - Common Library
+ * GPLv2 Open Source. Use is subject to license terms.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ *  Copyright (C) 2026 Bryan Biedenkapp, N2PLL
+ *
+ */
+/**
+ * @file BroadcastFrameCache.h
+ * @ingroup common
+ * @file BroadcastFrameCache.cpp
+ * @ingroup common
+ */
+#if !defined(__BROADCAST_FRAME_CACHE_H__)
+#define __BROADCAST_FRAME_CACHE_H__
+
+#include "common/Defines.h"
+
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+// ---------------------------------------------------------------------------
+//  Class Declaration
+// ---------------------------------------------------------------------------
+
+/**
+ * @brief Implements a versioned cache of fully encoded control channel broadcast frames.
+ *
+ *  Control channel site broadcasts only change when the site configuration, bandplan or adjacent
+ *  site data changes; rather than re-running CRC, FEC and interleaving on every broadcast cycle,
+ *  the encoded frames are cached by a caller defined key. The caller derives a version from every
+ *  input the cached frames depend on, and the cache is flushed whenever that version changes.
+ *
+ *  This class is not thread-safe; it is intended to be owned by a single protocol control instance.
+ * @ingroup common
+ */
+class HOST_SW_API BroadcastFrameCache {
+public:
+    /**
+     * @brief Initializes a new instance of the BroadcastFrameCache class.
+     * @param length Length of a cached frame in bytes.
+     */
+    BroadcastFrameCache(uint32_t length);
+    /**
+     * @brief Finalizes a instance of the BroadcastFrameCache class.
+     */
+    ~BroadcastFrameCache();
+
+    /**
+     * @brief Validates the cache against the given version, flushing all cached frames if the
+     *  version has changed.
+     * @param version Version of the inputs the cached frames are encoded from.
+     * @returns bool True, if the cache was flushed, otherwise false.
+     */
+    bool validate(uint64_t version);
+
+    /**
+     * @brief Finds a cached frame.
+     * @param key Frame key.
+     * @param[out] data Buffer to copy the cached frame to.
+     * @returns bool True, if the frame was cached, otherwise false.
+     */
+    bool find(uint64_t key, uint8_t* data);
+    /**
+     * @brief Adds (or replaces) a cached frame.
+     * @param key Frame key.
+     * @param data Encoded frame.
+     */
+    void insert(uint64_t key, const uint8_t* data);
+
+    /**
+     * @brief Flushes all cached frames.
+     */
+    void clear();
+
+    /**
+     * @brief Gets the number of cached frames.
+     * @returns size_t Number of cached frames.
+     */
+    size_t size() const { return m_index.size(); }
+    /**
+     * @brief Gets the length of a cached frame in bytes.
+     * @returns uint32_t Length of a cached frame in bytes.
+     */
+    uint32_t length() const { return m_length; }
+
+    /**
+     * @brief Gets the number of cache hits.
+     * @returns uint64_t Number of cache hits.
+     */
+    uint64_t hits() const { return m_hits; }
+    /**
+     * @brief Gets the number of cache misses.
+     * @returns uint64_t Number of cache misses.
+     */
+    uint64_t misses() const { return m_misses; }
+
+    /**
+     * @brief Helper to fold a value into a cache version.
+     * @param version Version to fold the value into.
+     * @param value Value.
+     * @returns uint64_t Version.
+     */
+    static uint64_t hash(uint64_t version, uint64_t value);
+    /**
+     * @brief Helper to fold a string into a cache version.
+     * @param version Version to fold the string into.
+     * @param value String.
+     * @returns uint64_t Version.
+     */
+    static uint64_t hash(uint64_t version, const std::string& value);
+
+    /**
+     * @brief Initial cache version (FNV-1a offset basis).
+     */
+    static const uint64_t INITIAL_VERSION = 0xCBF29CE484222325ULL;
+
+private:
+    uint32_t m_length;
+
+    uint64_t m_version;
+    bool m_valid;
+
+    std::unordered_map<uint64_t, uint32_t> m_index;
+    std::vector<uint8_t> m_frames;
+
+    uint64_t m_hits;
+    uint64_t m_misses;
+};
+
+#endif // __BROADCAST_FRAME_CACHE_H__
@@ -0,0 +1,236 @@
+// SPDX-License-Identifier: GPL-2.0-only
+/*
+ * Digital Voice Modem - Common Library
+ * GPLv2 Open Source. Use is subject to license terms.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ *  Copyright (C) 2026 Bryan Biedenkapp, N2PLL
+ *
+ */
+#include "Defines.h"
+#include "EventTrace.h"
+
+#include <cstdio>
+#include <sstream>
+#if !defined(_WIN32)
+#include <pthread.h>
+#include <unistd.h>
+#endif // !defined(_WIN32)
+
+// ---------------------------------------------------------------------------
+//  Constants
+// ---------------------------------------------------------------------------
+
+const char* EVENT_NAMES[TRACE_EVENT::EVENT_COUNT] = {
+    "fne.dmr.frame",
+    "fne.p25.frame",
+    "fne.nxdn.frame",
+    "fne.analog.frame",
+    "fne.peer_permitted",
+    "fne.write_peer_queue",
+
+    "modem.clock",
+    "dmr.frame",
+    "dmr.network",
+    "p25.frame",
+    "p25.network",
+    "nxdn.frame",
+    "nxdn.network",
+
+    "rpc.request",
+    "rpc.handler"
+};
+
+// ---------------------------------------------------------------------------
+//  Static Class Members
+// ---------------------------------------------------------------------------
+
+std::atomic<bool> EventTrace::s_enabled(false);
+
+std::mutex EventTrace::s_mutex;
+std::vector<std::unique_ptr<EventTrace::Ring>> EventTrace::s_rings;
+std::atomic<uint64_t> EventTrace::s_clearTick(0U);
+
+thread_local EventTrace::RingOwner EventTrace::t_owner;
+
+// ---------------------------------------------------------------------------
+//  Public Class Members
+// ---------------------------------------------------------------------------
+
+/* Records an event with a duration. */
+
+void EventTrace::complete(TRACE_EVENT::ENUM id, uint64_t start, uint32_t streamId, uint32_t peerId, uint32_t dstId, uint32_t arg)
+{
+    if (!isEnabled())
+        return;
+
+    uint64_t duration = now() - start;
+    if (duration > UINT32_MAX)
+        duration = UINT32_MAX;
+
+    record(id, 'X', start, (uint32_t)duration, streamId, peerId, dstId, arg);
+}
+
+/* Formats the events of all threads in the Chrome trace-event JSON format. */
+
+std::string EventTrace::chromeTrace()
+{
+#if defined(_WIN32)
+    uint32_t pid = 1U;
+#else
+    uint32_t pid = (uint32_t)::getpid();
+#endif // defined(_WIN32)
+    uint64_t clearTick = s_clearTick.load(std::memory_order_relaxed);
+
+    std::stringstream ss;
+    ss << "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[";
+
+    bool first = true;
+    char buffer[384U];
+
+    std::lock_guard<std::mutex> lock(s_mutex);
+    for (auto& ring : s_rings) {
+        // escape the thread name for JSON
+        std::string name;
+        for (char c : ring->threadName) {
+            if (c == '"' || c == '\\')
+                name += '\\';
+            if ((uint8_t)c >= 0x20U)
+                name += c;
+        }
+
+        ::snprintf(buffer, sizeof(buffer), "%s{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":%u,\"tid\":%u,\"args\":{\"name\":\"%s\"}}",
+            first ? "" : ",", pid, ring->tid, name.c_str());
+        ss << buffer;
+        first = false;
+
+        // copy the ring; the owning thread keeps writing, so any event it may have overwritten while it
+        // was being copied is discarded afterwards
+        uint64_t head = ring->head.load(std::memory_order_acquire);
+        uint64_t start = (head > TRACE_RING_EVENTS) ? head - TRACE_RING_EVENTS : 0U;
+
+        std::vector<Event> events;
+        events.reserve((size_t)(head - start));
+        for (uint64_t i = start; i < head; i++)
+            events.push_back(ring->events[i & (TRACE_RING_EVENTS - 1U)]);
+
+        std::atomic_thread_fence(std::memory_order_acquire);
+        uint64_t after = ring->head.load(std::memory_order_relaxed);
+        uint64_t valid = (after >= TRACE_RING_EVENTS) ? after - TRACE_RING_EVENTS + 1U : 0U;
+
+        for (uint64_t i = start; i < head; i++) {
+            if (i < valid)
+                continue;
+
+            const Event& e = events[(size_t)(i - start)];
+            if (e.timestamp < clearTick || e.id >= TRACE_EVENT::EVENT_COUNT)
+                continue;
+
+            int len = ::snprintf(buffer, sizeof(buffer), ",{\"name\":\"%s\",\"cat\":\"dvm\",\"ph\":\"%c\",\"ts\":%llu.%03u,",
+                EVENT_NAMES[e.id], (char)e.phase, (unsigned long long)(e.timestamp / 1000U), (uint32_t)(e.timestamp % 1000U));
+            if (e.phase == 'X')
+                len += ::snprintf(buffer + len, sizeof(buffer) - len, "\"dur\":%u.%03u,", e.duration / 1000U, e.duration % 1000U);
+            else
+                len += ::snprintf(buffer + len, sizeof(buffer) - len, "\"s\":\"t\",");
+            ::snprintf(buffer + len, sizeof(buffer) - len, "\"pid\":%u,\"tid\":%u,\"args\":{\"streamId\":%u,\"peerId\":%u,\"dstId\":%u,\"arg\":%u}}",
+                pid, ring->tid, e.streamId, e.peerId, e.dstId, e.arg);
+            ss << buffer;
+        }
+    }
+
+    ss << "]}";
+    return ss.str();
+}
+
+/* Discards the events of all threads. */
+
+void EventTrace::clear()
+{
+    // events are never removed from the rings, older events are only skipped when formatting
+    s_clearTick.store(now(), std::memory_order_relaxed);
+}
+
+/* Helper to get the name of an event. */
+
+const char* EventTrace::eventName(uint16_t id)
+{
+    if (id >= TRACE_EVENT::EVENT_COUNT)
+        return "unknown";
+    return EVENT_NAMES[id];
+}
+
+// ---------------------------------------------------------------------------
+//  Private Class Members
+// ---------------------------------------------------------------------------
+
+/* Helper to release the ring of a thread when the thread exits. */
+
+EventTrace::RingOwner::~RingOwner()
+{
+    if (ring != nullptr)
+        ring->inUse.store(false, std::memory_order_release);
+}
+
+/* Helper to record an event into the ring of the calling thread. */
+
+void EventTrace::record(uint16_t id, uint8_t phase, uint64_t timestamp, uint32_t duration, uint32_t streamId, uint32_t peerId,
+    uint32_t dstId, uint32_t arg)
+{
+    Ring* r = ring();
+
+    // only the owning thread writes the ring, the head is published after the event is written
+    uint64_t head = r->head.load(std::memory_order_relaxed);
+    Event& e = r->events[head & (TRACE_RING_EVENTS - 1U)];
+    e.timestamp = timestamp;
+    e.duration = duration;
+    e.id = id;
+    e.phase = phase;
+    e.reserved = 0U;
+    e.streamId = streamId;
+    e.peerId = peerId;
+    e.dstId = dstId;
+    e.arg = arg;
+    r->head.store(head + 1U, std::memory_order_release);
+}
+
+/* Helper to get (or claim) the ring of the calling thread. */
+
+EventTrace::Ring* EventTrace::ring()
+{
+    if (t_owner.ring != nullptr)
+        return t_owner.ring;
+
+    std::string threadName = "thread";
+#if !defined(_WIN32)
+    char name[16U];
+    if (::pthread_getname_np(::pthread_self(), name, sizeof(name)) == 0)
+        threadName = name;
+#endif // !defined(_WIN32)
+
+    std::lock_guard<std::mutex> lock(s_mutex);
+
+    Ring* r = nullptr;
+    for (auto& ring : s_rings) {
+        bool inUse = false;
+        if (ring->inUse.compare_exchange_strong(inUse, true, std::memory_order_acquire)) {
+            r = ring.get();
+            break;
+        }
+    }
+
+    if (r == nullptr) {
+        std::unique_ptr<Ring> ring(new Ring());
+        ring->tid = (uint32_t)s_rings.size() + 1U;
+        ring->inUse.store(true, std::memory_order_relaxed);
+        ring->events.reset(new Event[TRACE_RING_EVENTS]);
+
+        r = ring.get();
+        s_rings.push_back(std::move(ring));
+    }
+
+    // the events of the previous owner are kept, and are reported under the name of the new owner
+    r->threadName = threadName;
+
+    t_owner.ring = r;
+    return r;
+}
@@ -0,0 +1,266 @@
+// SPDX-License-Identifier: GPL-2.0-only
+/*
+ * Digital Voice Modem - Common Library
+ * GPLv2 Open Source. Use is subject to license terms.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ *  Copyright (C) 2026 Bryan Biedenkapp, N2PLL
+ *
+ */
+/**
+ * @file EventTrace.h
+ * @ingroup common
+ * @file EventTrace.cpp
+ * @ingroup common
+ */
+#if !defined(__EVENT_TRACE_H__)
+#define __EVENT_TRACE_H__
+
+#include "common/Defines.h"
+
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+// ---------------------------------------------------------------------------
+//  Constants
+// ---------------------------------------------------------------------------
+
+/**
+ * @brief Number of events held by a thread's trace ring (must be a power of two).
+ */
+const uint32_t TRACE_RING_EVENTS = 8192U;
+
+/**
+ * @brief Trace Events
+ */
+namespace TRACE_EVENT {
+    /** @brief Trace Events */
+    enum ENUM : uint16_t {
+        FNE_DMR_FRAME = 0U,             //!< FNE DMR Frame (TagDMRData::processFrame)
+        FNE_P25_FRAME,                  //!< FNE P25 Frame (TagP25Data::processFrame)
+        FNE_NXDN_FRAME,                 //!< FNE NXDN Frame (TagNXDNData::processFrame)
+        FNE_ANALOG_FRAME,               //!< FNE Analog Frame (TagAnalogData::processFrame)
+        FNE_PEER_PERMITTED,             //!< FNE Peer Permitted Check (Tag*Data::isPeerPermitted)
+        FNE_WRITE_PEER_QUEUE,           //!< FNE Peer Queue Write (TrafficNetwork::writePeerQueue)
+
+        MODEM_CLOCK,                    //!< Modem Clock (Modem::clock)
+        DMR_FRAME,                      //!< DMR RF Frame (dmr::Control::processFrame)
+        DMR_NETWORK,                    //!< DMR Network Frame (dmr::Control::processNetwork)
+        P25_FRAME,                      //!< P25 RF Frame (p25::Control::processFrame)
+        P25_NETWORK,                    //!< P25 Network Frame (p25::Control::processNetwork)
+        NXDN_FRAME,                     //!< NXDN RF Frame (nxdn::Control::processFrame)
+        NXDN_NETWORK,                   //!< NXDN Network Frame (nxdn::Control::processNetwork)
+
+        RPC_REQUEST,                    //!< RPC Request (NetRPC::req)
+        RPC_HANDLER,                    //!< RPC Handler (NetRPC::clock)
+
+        EVENT_COUNT
+    };
+}
+
+// ---------------------------------------------------------------------------
+//  Class Declaration
+// ---------------------------------------------------------------------------
+
+/**
+ * @brief Implements low-overhead binary event tracing, exported in the Chrome trace-event JSON format
+ *  (which Perfetto and chrome://tracing load).
+ *
+ *  Each thread records fixed-size events into its own ring, so recording never takes a lock; the ring
+ *  overwrites its oldest events when full. A thread only gets a ring the first time it records an event
+ *  while tracing is enabled. Rings of exited threads are reused by new threads (the events of the exited thread are kept).
+ * @ingroup common
+ */
+class HOST_SW_API EventTrace {
+public:
+    /**
+     * @brief Enables or disables event tracing.
+     * @param enabled Flag indicating whether or not event tracing is enabled.
+     */
+    static void setEnabled(bool enabled) { s_enabled.store(enabled, std::memory_order_relaxed); }
+    /**
+     * @brief Flag indicating whether or not event tracing is enabled.
+     * @returns bool True, if event tracing is enabled, otherwise false.
+     */
+    static bool isEnabled() { return s_enabled.load(std::memory_order_relaxed); }
+
+    /**
+     * @brief Gets the current monotonic time (ns).
+     * @returns uint64_t Current monotonic time.
+     */
+    static uint64_t now()
+    {
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+    }
+
+    /**
+     * @brief Records an instant event.
+     * @param id Event ID.
+     * @param streamId Stream ID.
+     * @param peerId Peer ID.
+     * @param dstId Destination ID.
+     * @param arg Event argument.
+     */
+    static void instant(TRACE_EVENT::ENUM id, uint32_t streamId, uint32_t peerId, uint32_t dstId, uint32_t arg = 0U)
+    {
+        if (!isEnabled())
+            return;
+        record(id, 'i', now(), 0U, streamId, peerId, dstId, arg);
+    }
+    /**
+     * @brief Records an event with a duration.
+     * @param id Event ID.
+     * @param start Time the event started.
+     * @param streamId Stream ID.
+     * @param peerId Peer ID.
+     * @param dstId Destination ID.
+     * @param arg Event argument.
+     */
+    static void complete(TRACE_EVENT::ENUM id, uint64_t start, uint32_t streamId, uint32_t peerId, uint32_t dstId, uint32_t arg = 0U);
+
+    /**
+     * @brief Formats the events of all threads in the Chrome trace-event JSON format.
+     * @returns std::string Chrome trace-event JSON.
+     */
+    static std::string chromeTrace();
+    /**
+     * @brief Discards the events of all threads.
+     */
+    static void clear();
+
+    /**
+     * @brief Helper to get the name of an event.
+     * @param id Event ID.
+     * @returns const char* Event name.
+     */
+    static const char* eventName(uint16_t id);
+
+private:
+    /**
+     * @brief Represents a trace event.
+     */
+    struct Event {
+        uint64_t timestamp;             //!< Time the event started (ns).
+        uint32_t duration;              //!< Duration of the event (ns).
+        uint16_t id;                    //!< Event ID.
+        uint8_t phase;                  //!< Chrome trace-event phase.
+        uint8_t reserved;               //!< Reserved.
+        uint32_t streamId;              //!< Stream ID.
+        uint32_t peerId;                //!< Peer ID.
+        uint32_t dstId;                 //!< Destination ID.
+        uint32_t arg;                   //!< Event argument.
+    };
+    /**
+     * @brief Represents the trace ring of a thread.
+     */
+    struct Ring {
+        uint32_t tid;                                   //!< Ring index (reported as the thread ID).
+        std::string threadName;                         //!< Name of the owning thread.
+        std::atomic<bool> inUse;                        //!< Flag indicating the ring is owned by a thread.
+        std::atomic<uint64_t> head;                     //!< Number of events written.
+        std::unique_ptr<Event[]> events;                //!< Events.
+    };
+    /**
+     * @brief Helper to release the ring of a thread when the thread exits.
+     */
+    struct RingOwner {
+        Ring* ring = nullptr;                           //!< Ring owned by the thread.
+        ~RingOwner();
+    };
+
+    static std::atomic<bool> s_enabled;
+
+    static std::mutex s_mutex;
+    static std::vector<std::unique_ptr<Ring>> s_rings;
+    static std::atomic<uint64_t> s_clearTick;
+
+    static thread_local RingOwner t_owner;
+
+    /**
+     * @brief Helper to record an event into the ring of the calling thread.
+     * @param id Event ID.
+     * @param phase Chrome trace-event phase.
+     * @param timestamp Time the event started.
+     * @param duration Duration of the event.
+     * @param streamId Stream ID.
+     * @param peerId Peer ID.
+     * @param dstId Destination ID.
+     * @param arg Event argument.
+     */
+    static void record(uint16_t id, uint8_t phase, uint64_t timestamp, uint32_t duration, uint32_t streamId, uint32_t peerId,
+        uint32_t dstId, uint32_t arg);
+    /**
+     * @brief Helper to get (or claim) the ring of the calling thread.
+     * @returns Ring* Ring of the calling thread.
+     */
+    static Ring* ring();
+};
+
+// ---------------------------------------------------------------------------
+//  Class Declaration
+// ---------------------------------------------------------------------------
+
+/**
+ * @brief Helper to record an event covering the lifetime of the scope it is declared in.
+ * @ingroup common
+ */
+class HOST_SW_API EventTraceScope {
+public:
+    /**
+     * @brief Initializes a new instance of the EventTraceScope class.
+     * @param id Event ID.
+     * @param streamId Stream ID.
+     * @param peerId Peer ID.
+     * @param dstId Destination ID.
+     */
+    EventTraceScope(TRACE_EVENT::ENUM id, uint32_t streamId = 0U, uint32_t peerId = 0U, uint32_t dstId = 0U) :
+        m_id(id),
+        m_start(EventTrace::isEnabled() ? EventTrace::now() : 0U),
+        m_streamId(streamId),
+        m_peerId(peerId),
+        m_dstId(dstId),
+        m_arg(0U)
+    {
+        /* stub */
+    }
+    /**
+     * @brief Finalizes a instance of the EventTraceScope class.
+     */
+    ~EventTraceScope()
+    {
+        if (m_start != 0U)
+            EventTrace::complete(m_id, m_start, m_streamId, m_peerId, m_dstId, m_arg);
+    }
+
+    /**
+     * @brief Sets the identifiers of the event (once they have been decoded).
+     * @param streamId Stream ID.
+     * @param peerId Peer ID.
+     * @param dstId Destination ID.
+     */
+    void set(uint32_t streamId, uint32_t peerId, uint32_t dstId)
+    {
+        m_streamId = streamId;
+        m_peerId = peerId;
+        m_dstId = dstId;
+    }
+    /**
+     * @brief Sets the event argument.
+     * @param arg Event argument.
+     */
+    void setArg(uint32_t arg) { m_arg = arg; }
+
+private:
+    TRACE_EVENT::ENUM m_id;
+    uint64_t m_start;
+    uint32_t m_streamId;
+    uint32_t m_peerId;
+    uint32_t m_dstId;
+    uint32_t m_arg;
+};
+
+#endif // __EVENT_TRACE_H__
@@ -0,0 +1,179 @@
+// SPDX-License-Identifier: GPL-2.0-only
+/*
+ * Digital Voice Modem - Common Library
+ * GPLv2 Open Source. Use is subject to license terms.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ *  Copyright (C) 2026 Bryan Biedenkapp, N2PLL
+ *
+ */
+#include "Defines.h"
+#include "ExpiryQueue.h"
+
+#include <functional>
+#include <limits>
+
+// ---------------------------------------------------------------------------
+//  Constants
+// ---------------------------------------------------------------------------
+
+const uint64_t NEVER = std::numeric_limits<uint64_t>::max();
+
+// ---------------------------------------------------------------------------
+//  Public Class Members
+// ---------------------------------------------------------------------------
+
+/* Initializes a new instance of the ExpiryQueue class. */
+
+ExpiryQueue::ExpiryQueue() :
+    m_mutex(),
+    m_now(0U),
+    m_entries(),
+    m_heap()
+{
+    /* stub */
+}
+
+/* Finalizes a instance of the ExpiryQueue class. */
+
+ExpiryQueue::~ExpiryQueue() = default;
+
+/* Starts (or restarts) the timeout for the given key. */
+
+void ExpiryQueue::start(uint32_t key, uint32_t timeout)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    // like Timer, a zero timeout never expires
+    uint64_t deadline = (timeout > 0U) ? m_now + timeout : NEVER;
+
+    auto it = m_entries.find(key);
+    if (it != m_entries.end()) {
+        it->second.start = m_now;
+        it->second.timeout = timeout;
+
+        // the existing heap node is rescheduled when it is reached, only push a new node if the
+        // deadline moved earlier
+        if (deadline >= it->second.scheduled)
+            return;
+
+        it->second.scheduled = deadline;
+    }
+    else {
+        m_entries[key] = Entry { m_now, timeout, deadline };
+    }
+
+    if (deadline != NEVER)
+        m_heap.push(Node { deadline, key });
+}
+
+/* Restarts the timeout for the given key, if the key exists. */
+
+bool ExpiryQueue::touch(uint32_t key)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    auto it = m_entries.find(key);
+    if (it == m_entries.end())
+        return false;
+
+    it->second.start = m_now;
+    return true;
+}
+
+/* Stops and removes the timeout for the given key. */
+
+void ExpiryQueue::stop(uint32_t key)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    // the heap node becomes stale and is discarded when it is reached
+    m_entries.erase(key);
+}
+
+/* Stops and removes all timeouts. */
+
+void ExpiryQueue::clear()
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    m_entries.clear();
+    m_heap = std::priority_queue<Node, std::vector<Node>, std::greater<Node>>();
+}
+
+/* Helper to determine if the timeout for the given key is running. */
+
+bool ExpiryQueue::isRunning(uint32_t key) const
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_entries.find(key) != m_entries.end();
+}
+
+/* Gets the timeout for the given key. */
+
+uint32_t ExpiryQueue::getTimeout(uint32_t key) const
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    auto it = m_entries.find(key);
+    if (it == m_entries.end())
+        return 0U;
+
+    return it->second.timeout;
+}
+
+/* Gets the elapsed time for the given key. */
+
+uint32_t ExpiryQueue::getElapsed(uint32_t key) const
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    auto it = m_entries.find(key);
+    if (it == m_entries.end())
+        return 0U;
+
+    return (uint32_t)(m_now - it->second.start);
+}
+
+/* Gets the number of running timeouts. */
+
+size_t ExpiryQueue::size() const
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_entries.size();
+}
+
+/* Updates the queue by the passed number of milliseconds, and returns the keys that have expired. */
+
+void ExpiryQueue::clock(uint32_t ms, std::vector<uint32_t>& expired)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    m_now += ms;
+
+    while (!m_heap.empty() && m_heap.top().deadline <= m_now) {
+        Node node = m_heap.top();
+        m_heap.pop();
+
+        // discard stale nodes (stopped, or superseded by an earlier deadline)
+        auto it = m_entries.find(node.key);
+        if (it == m_entries.end() || it->second.scheduled != node.deadline)
+            continue;
+
+        // the entry was restarted since this node was scheduled, reschedule to its current deadline
+        if (it->second.timeout == 0U) {
+            it->second.scheduled = NEVER;
+            continue;
+        }
+
+        uint64_t deadline = it->second.start + it->second.timeout;
+        if (deadline > m_now) {
+            it->second.scheduled = deadline;
+            m_heap.push(Node { deadline, node.key });
+            continue;
+        }
+
+        expired.push_back(node.key);
+        m_entries.erase(it);
+    }
+}
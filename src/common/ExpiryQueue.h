@@ -0,0 +1,138 @@
+// SPDX-License-Identifier: GPL-2.0-only
+/*
+ * Digital Voice Modem - Common Library
+ * GPLv2 Open Source. Use is subject to license terms.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ *  Copyright (C) 2026 Bryan Biedenkapp, N2PLL
+ *
+ */
+/**
+ * @file ExpiryQueue.h
+ * @ingroup timers
+ * @file ExpiryQueue.cpp
+ * @ingroup timers
+ */
+#if !defined(__EXPIRY_QUEUE_H__)
+#define __EXPIRY_QUEUE_H__
+
+#include "common/Defines.h"
+
+#include <mutex>
+#include <queue>
+#include <unordered_map>
+#include <vector>
+
+// ---------------------------------------------------------------------------
+//  Class Declaration
+// ---------------------------------------------------------------------------
+
+/**
+ * @brief Implements a deadline ordered queue of keyed timeouts.
+ *
+ *  This replaces a set of individually clocked Timer instances; rather than clocking every timer on
+ *  every tick, entries are held in a min-heap ordered by deadline, and a tick only examines entries
+ *  that are due. Restarting (touching) an entry is O(1); the entry's heap node is lazily rescheduled
+ *  when its old deadline is reached.
+ *
+ *  Time only advances by calls to clock(), so timeouts behave exactly as a Timer clocked by the same
+ *  calls would.
+ * @ingroup timers
+ */
+class HOST_SW_API ExpiryQueue {
+public:
+    /**
+     * @brief Initializes a new instance of the ExpiryQueue class.
+     */
+    ExpiryQueue();
+    /**
+     * @brief Finalizes a instance of the ExpiryQueue class.
+     */
+    ~ExpiryQueue();
+
+    /**
+     * @brief Starts (or restarts) the timeout for the given key.
+     * @param key Key.
+     * @param timeout Timeout in milliseconds (0 never expires).
+     */
+    void start(uint32_t key, uint32_t timeout);
+    /**
+     * @brief Restarts the timeout for the given key, if the key exists.
+     * @param key Key.
+     * @returns bool True, if the key exists and was restarted, otherwise false.
+     */
+    bool touch(uint32_t key);
+    /**
+     * @brief Stops and removes the timeout for the given key.
+     * @param key Key.
+     */
+    void stop(uint32_t key);
+    /**
+     * @brief Stops and removes all timeouts.
+     */
+    void clear();
+
+    /**
+     * @brief Helper to determine if the timeout for the given key is running.
+     * @param key Key.
+     * @returns bool True, if the timeout for the key is running, otherwise false.
+     */
+    bool isRunning(uint32_t key) const;
+    /**
+     * @brief Gets the timeout for the given key.
+     * @param key Key.
+     * @returns uint32_t Timeout in milliseconds, or 0 if the key does not exist.
+     */
+    uint32_t getTimeout(uint32_t key) const;
+    /**
+     * @brief Gets the elapsed time for the given key.
+     * @param key Key.
+     * @returns uint32_t Elapsed time in milliseconds, or 0 if the key does not exist.
+     */
+    uint32_t getElapsed(uint32_t key) const;
+    /**
+     * @brief Gets the number of running timeouts.
+     * @returns size_t Number of running timeouts.
+     */
+    size_t size() const;
+
+    /**
+     * @brief Updates the queue by the passed number of milliseconds, and returns the keys that have expired.
+     *  Expired keys are removed from the queue.
+     * @param ms Number of milliseconds.
+     * @param[out] expired List of keys that have expired.
+     */
+    void clock(uint32_t ms, std::vector<uint32_t>& expired);
+
+private:
+    /**
+     * @brief Represents a running timeout.
+     */
+    struct Entry {
+        uint64_t start;         //!< Time the timeout was (re)started.
+        uint32_t timeout;       //!< Timeout in milliseconds.
+        uint64_t scheduled;     //!< Deadline of the entry's live heap node.
+    };
+    /**
+     * @brief Represents a heap node.
+     */
+    struct Node {
+        uint64_t deadline;      //!< Deadline.
+        uint32_t key;           //!< Key.
+
+        /**
+         * @brief Greater than operator (makes std::priority_queue a min-heap).
+         * @param other Node to compare to.
+         * @returns bool True, if this node has a later deadline.
+         */
+        bool operator>(const Node& other) const { return deadline > other.deadline; }
+    };
+
+    mutable std::mutex m_mutex;
+
+    uint64_t m_now;
+    std::unordered_map<uint32_t, Entry> m_entries;
+    std::priority_queue<Node, std::vector<Node>, std::greater<Node>> m_heap;
+};
+
+#endif // __EXPIRY_QUEUE_H__
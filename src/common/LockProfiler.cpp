@@ -0,0 +1,343 @@
+// SPDX-License-Identifier: GPL-2.0-only
+/*
+ * Digital Voice Modem - Common Library
+ * GPLv2 Open Source. Use is subject to license terms.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ *  Copyright (C) 2026 Bryan Biedenkapp, N2PLL
+ *
+ */
+#include "Defines.h"
+#include "LockProfiler.h"
+#include "Log.h"
+
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <tuple>
+#if !defined(_WIN32)
+#include <execinfo.h>
+#endif // !defined(_WIN32)
+
+// ---------------------------------------------------------------------------
+//  Constants
+// ---------------------------------------------------------------------------
+
+const uint64_t LOCK_MIN_NS = 64U;
+const uint64_t LOCK_MAX_NS = 17179869184U; // ~17s
+const uint32_t LOCK_SUB_BUCKETS = 4U;
+
+const uint32_t LOCK_STATUS_SITES = 5U;
+const uint32_t LOCK_DUMP_SITES = 3U;
+
+// ---------------------------------------------------------------------------
+//  LockProfile Class Members
+// ---------------------------------------------------------------------------
+
+/* Initializes a new instance of the LockProfile class. */
+
+LockProfile::LockProfile(const std::string& name) :
+    m_name(name),
+    m_acquisitions(0U),
+    m_contended(0U),
+    m_wait(metrics::Histogram::logLinearBounds(LOCK_MIN_NS, LOCK_MAX_NS, LOCK_SUB_BUCKETS)),
+    m_hold(metrics::Histogram::logLinearBounds(LOCK_MIN_NS, LOCK_MAX_NS, LOCK_SUB_BUCKETS)),
+    m_siteMutex(),
+    m_sites()
+{
+    /* stub */
+}
+
+/* Gets the call sites that waited the longest in total for the lock. */
+
+std::vector<LockProfile::Site> LockProfile::topSites(uint32_t n) const
+{
+    std::vector<std::pair<std::vector<void*>, std::pair<uint64_t, uint64_t>>> sites;
+    {
+        std::lock_guard<std::mutex> lock(m_siteMutex);
+        for (auto& entry : m_sites) {
+            uint64_t count = entry.second.count.load(std::memory_order_relaxed);
+            if (count == 0U)
+                continue;
+
+            sites.push_back(std::make_pair(entry.first, std::make_pair(count, entry.second.wait.load(std::memory_order_relaxed))));
+        }
+    }
+
+    std::sort(sites.begin(), sites.end(), [](const std::pair<std::vector<void*>, std::pair<uint64_t, uint64_t>>& a,
+        const std::pair<std::vector<void*>, std::pair<uint64_t, uint64_t>>& b) {
+        return a.second.second > b.second.second;
+    });
+    if (sites.size() > n)
+        sites.resize(n);
+
+    std::vector<Site> ret;
+    for (auto& entry : sites) {
+        Site site;
+        site.count = entry.second.first;
+        site.wait = entry.second.second;
+
+        // frames are reported as module(+offset), which resolves with addr2line even without exported symbols
+#if !defined(_WIN32)
+        char** symbols = ::backtrace_symbols(entry.first.data(), (int)entry.first.size());
+        for (uint32_t i = 0U; i < entry.first.size(); i++) {
+            std::string frame = (symbols != nullptr) ? symbols[i] : "?";
+            size_t pos = frame.find(" [");
+            if (pos != std::string::npos)
+                frame = frame.substr(0U, pos);
+            pos = frame.find_last_of('/');
+            if (pos != std::string::npos)
+                frame = frame.substr(pos + 1U);
+
+            if (!site.stack.empty())
+                site.stack += " < ";
+            site.stack += frame;
+        }
+        if (symbols != nullptr)
+            ::free(symbols);
+#endif // !defined(_WIN32)
+        ret.push_back(site);
+    }
+
+    return ret;
+}
+
+/* Resets the statistics. */
+
+void LockProfile::reset()
+{
+    m_acquisitions.store(0U, std::memory_order_relaxed);
+    m_contended.store(0U, std::memory_order_relaxed);
+    m_wait.reset();
+    m_hold.reset();
+
+    // waiting threads may hold a pointer to a site, so sites are cleared rather than removed
+    std::lock_guard<std::mutex> lock(m_siteMutex);
+    for (auto& entry : m_sites) {
+        entry.second.count.store(0U, std::memory_order_relaxed);
+        entry.second.wait.store(0U, std::memory_order_relaxed);
+    }
+}
+
+// ---------------------------------------------------------------------------
+//  LockProfiler Static Class Members
+// ---------------------------------------------------------------------------
+
+std::atomic<bool> LockProfiler::s_enabled(false);
+
+std::mutex LockProfiler::s_mutex;
+std::vector<std::unique_ptr<LockProfile>> LockProfiler::s_profiles;
+
+thread_local LockProfiler::Hold LockProfiler::t_holds[LockProfiler::MAX_HOLDS];
+thread_local uint32_t LockProfiler::t_holdCnt = 0U;
+
+// ---------------------------------------------------------------------------
+//  LockProfiler Class Members
+// ---------------------------------------------------------------------------
+
+/* Registers (or finds) the profile of a named lock. */
+
+LockProfile* LockProfiler::profile(const std::string& name)
+{
+    std::lock_guard<std::mutex> lock(s_mutex);
+    for (auto& profile : s_profiles) {
+        if (profile->name() == name)
+            return profile.get();
+    }
+
+    s_profiles.push_back(std::unique_ptr<LockProfile>(new LockProfile(name)));
+    return s_profiles.back().get();
+}
+
+/* Records that the calling thread is about to wait for a profiled lock. */
+
+void LockProfiler::waiting(LockProfile* profile, Wait& wait)
+{
+    wait.start = now();
+    wait.siteWait = nullptr;
+
+#if !defined(_WIN32)
+    // the thread is about to block on the lock, so capturing the waiting call site is cheap by comparison;
+    // the innermost frame is this function and is skipped
+    void* frames[LOCK_SITE_DEPTH + 1U];
+    int depth = ::backtrace(frames, LOCK_SITE_DEPTH + 1U);
+    if (depth > 1) {
+        std::vector<void*> stack(frames + 1, frames + depth);
+
+        std::lock_guard<std::mutex> lock(profile->m_siteMutex);
+        auto it = profile->m_sites.find(stack);
+        if (it == profile->m_sites.end() && profile->m_sites.size() < LOCK_MAX_SITES)
+            it = profile->m_sites.emplace(std::piecewise_construct, std::forward_as_tuple(stack), std::forward_as_tuple()).first;
+
+        if (it != profile->m_sites.end()) {
+            it->second.count.fetch_add(1U, std::memory_order_relaxed);
+            wait.siteWait = &it->second.wait;
+        }
+    }
+#endif // !defined(_WIN32)
+}
+
+/* Records an acquisition of a profiled lock by the calling thread. */
+
+void LockProfiler::acquired(LockProfile* profile, const Wait* wait)
+{
+    uint64_t tick = now();
+
+    profile->m_acquisitions.fetch_add(1U, std::memory_order_relaxed);
+    if (wait != nullptr) {
+        uint64_t waitTime = (tick > wait->start) ? tick - wait->start : 0U;
+        profile->m_contended.fetch_add(1U, std::memory_order_relaxed);
+        profile->m_wait.observe(waitTime);
+
+        if (wait->siteWait != nullptr)
+            wait->siteWait->fetch_add(waitTime, std::memory_order_relaxed);
+    }
+    else {
+        profile->m_wait.observe(0U);
+    }
+
+    // a lock that was acquired while profiling was enabled, and released after it was disabled, leaves a stale
+    // hold behind; when the hold stack is full the oldest hold is dropped
+    if (t_holdCnt == MAX_HOLDS) {
+        for (uint32_t i = 1U; i < MAX_HOLDS; i++)
+            t_holds[i - 1U] = t_holds[i];
+        t_holdCnt--;
+    }
+
+    t_holds[t_holdCnt].profile = profile;
+    t_holds[t_holdCnt].tick = tick;
+    t_holdCnt++;
+}
+
+/* Records a release of a profiled lock by the calling thread. */
+
+void LockProfiler::released(LockProfile* profile)
+{
+    for (uint32_t i = t_holdCnt; i > 0U; i--) {
+        Hold& hold = t_holds[i - 1U];
+        if (hold.profile != profile)
+            continue;
+
+        uint64_t tick = now();
+        profile->m_hold.observe((tick > hold.tick) ? tick - hold.tick : 0U);
+
+        // locks are not always released in the reverse order they were taken
+        for (uint32_t j = i; j < t_holdCnt; j++)
+            t_holds[j - 1U] = t_holds[j];
+        t_holdCnt--;
+        return;
+    }
+}
+
+/* Gets the statistics of all profiled locks, ordered by total wait time. */
+
+json::object LockProfiler::status()
+{
+    json::object status = json::object();
+    bool enabled = isEnabled();
+    status["enabled"].set<bool>(enabled);
+
+    json::array locks = json::array();
+    for (LockProfile* profile : sorted()) {
+        json::object lockObj = json::object();
+        std::string name = profile->name();
+        lockObj["name"].set<std::string>(name);
+        uint64_t acquisitions = profile->acquisitions();
+        lockObj["acquisitions"].set<uint64_t>(acquisitions);
+        uint64_t contended = profile->contended();
+        lockObj["contended"].set<uint64_t>(contended);
+
+        const metrics::Histogram* histograms[2] = { &profile->waitTime(), &profile->holdTime() };
+        const char* keys[2] = { "waitNs", "holdNs" };
+        for (uint32_t i = 0U; i < 2U; i++) {
+            json::object histObj = json::object();
+            uint64_t total = histograms[i]->sum();
+            histObj["total"].set<uint64_t>(total);
+            uint64_t p50 = histograms[i]->percentile(0.5);
+            histObj["p50"].set<uint64_t>(p50);
+            uint64_t p99 = histograms[i]->percentile(0.99);
+            histObj["p99"].set<uint64_t>(p99);
+            uint64_t max = histograms[i]->max();
+            histObj["max"].set<uint64_t>(max);
+            lockObj[keys[i]].set<json::object>(histObj);
+        }
+
+        json::array sites = json::array();
+        for (LockProfile::Site& site : profile->topSites(LOCK_STATUS_SITES)) {
+            json::object siteObj = json::object();
+            siteObj["stack"].set<std::string>(site.stack);
+            siteObj["count"].set<uint64_t>(site.count);
+            siteObj["waitNs"].set<uint64_t>(site.wait);
+            sites.push_back(json::value(siteObj));
+        }
+        lockObj["waiters"].set<json::array>(sites);
+
+        locks.push_back(json::value(lockObj));
+    }
+    status["locks"].set<json::array>(locks);
+
+    return status;
+}
+
+/* Resets the statistics of all profiled locks. */
+
+void LockProfiler::reset()
+{
+    std::lock_guard<std::mutex> lock(s_mutex);
+    for (auto& profile : s_profiles)
+        profile->reset();
+}
+
+/* Writes the statistics of all profiled locks to the log. */
+
+void LockProfiler::dump()
+{
+    std::vector<LockProfile*> profiles = sorted();
+    if (profiles.empty()) {
+        LogInfoEx(LOG_HOST, "Lock profiling %s, no locks profiled", isEnabled() ? "enabled" : "disabled");
+        return;
+    }
+
+    LogInfoEx(LOG_HOST, "Lock profiling %s, %u locks profiled (ordered by total wait time)", isEnabled() ? "enabled" : "disabled",
+        (uint32_t)profiles.size());
+    for (LockProfile* profile : profiles) {
+        const metrics::Histogram& wait = profile->waitTime();
+        const metrics::Histogram& hold = profile->holdTime();
+        LogInfoEx(LOG_HOST, "    %s: acquisitions = %llu, contended = %llu, wait total = %lluus p99 = %lluns max = %lluns, hold p50 = %lluns p99 = %lluns max = %lluns",
+            profile->name().c_str(), (unsigned long long)profile->acquisitions(), (unsigned long long)profile->contended(),
+            (unsigned long long)(wait.sum() / 1000U), (unsigned long long)wait.percentile(0.99), (unsigned long long)wait.max(),
+            (unsigned long long)hold.percentile(0.5), (unsigned long long)hold.percentile(0.99), (unsigned long long)hold.max());
+
+        for (LockProfile::Site& site : profile->topSites(LOCK_DUMP_SITES)) {
+            LogInfoEx(LOG_HOST, "        waiter: count = %llu, wait total = %lluus, %s", (unsigned long long)site.count,
+                (unsigned long long)(site.wait / 1000U), site.stack.c_str());
+        }
+    }
+}
+
+// ---------------------------------------------------------------------------
+//  LockProfiler Private Class Members
+// ---------------------------------------------------------------------------
+
+/* Helper to get the profiled locks, ordered by total wait time. */
+
+std::vector<LockProfile*> LockProfiler::sorted()
+{
+    // the wait totals are sampled once, they keep changing while the locks are in use
+    std::vector<std::pair<uint64_t, LockProfile*>> entries;
+    {
+        std::lock_guard<std::mutex> lock(s_mutex);
+        for (auto& profile : s_profiles)
+            entries.push_back(std::make_pair(profile->waitTime().sum(), profile.get()));
+    }
+
+    std::stable_sort(entries.begin(), entries.end(), [](const std::pair<uint64_t, LockProfile*>& a, const std::pair<uint64_t, LockProfile*>& b) {
+        return a.first > b.first;
+    });
+
+    std::vector<LockProfile*> profiles;
+    for (auto& entry : entries)
+        profiles.push_back(entry.second);
+
+    return profiles;
+}
@@ -0,0 +1,377 @@
+// SPDX-License-Identifier: GPL-2.0-only
+/*
+ * Digital Voice Modem - Common Library
+ * GPLv2 Open Source. Use is subject to license terms.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ *  Copyright (C) 2026 Bryan Biedenkapp, N2PLL
+ *
+ */
+/**
+ * @file LockProfiler.h
+ * @ingroup concurrency
+ * @file LockProfiler.cpp
+ * @ingroup concurrency
+ */
+#if !defined(__LOCK_PROFILER_H__)
+#define __LOCK_PROFILER_H__
+
+#include "common/Defines.h"
+#include "common/json/json.h"
+#include "common/Metrics.h"
+
+#include <atomic>
+#include <chrono>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+// ---------------------------------------------------------------------------
+//  Constants
+// ---------------------------------------------------------------------------
+
+/**
+ * @brief Number of stack frames recorded for a contended acquisition call site.
+ */
+const uint32_t LOCK_SITE_DEPTH = 4U;
+/**
+ * @brief Maximum number of distinct call sites recorded per lock.
+ */
+const uint32_t LOCK_MAX_SITES = 64U;
+
+// ---------------------------------------------------------------------------
+//  Class Declaration
+// ---------------------------------------------------------------------------
+
+/**
+ * @brief Represents the contention statistics of a named lock.
+ * @ingroup concurrency
+ */
+class HOST_SW_API LockProfile {
+public:
+    /**
+     * @brief Initializes a new instance of the LockProfile class.
+     * @param name Lock name.
+     */
+    LockProfile(const std::string& name);
+
+    /**
+     * @brief Gets the lock name.
+     * @returns std::string Lock name.
+     */
+    const std::string& name() const { return m_name; }
+    /**
+     * @brief Gets the number of acquisitions.
+     * @returns uint64_t Number of acquisitions.
+     */
+    uint64_t acquisitions() const { return m_acquisitions.load(std::memory_order_relaxed); }
+    /**
+     * @brief Gets the number of acquisitions that had to wait for the lock.
+     * @returns uint64_t Number of contended acquisitions.
+     */
+    uint64_t contended() const { return m_contended.load(std::memory_order_relaxed); }
+    /**
+     * @brief Gets the histogram of the time spent waiting for the lock (ns).
+     * @returns metrics::Histogram Wait time histogram.
+     */
+    const metrics::Histogram& waitTime() const { return m_wait; }
+    /**
+     * @brief Gets the histogram of the time the lock was held (ns).
+     * @returns metrics::Histogram Hold time histogram.
+     */
+    const metrics::Histogram& holdTime() const { return m_hold; }
+
+    /**
+     * @brief Represents a call site that waited for the lock.
+     */
+    struct Site {
+        std::string stack;              //!< Call site stack (innermost first).
+        uint64_t count;                 //!< Number of contended acquisitions.
+        uint64_t wait;                  //!< Total wait time (ns).
+    };
+
+    /**
+     * @brief Gets the call sites that waited the longest in total for the lock.
+     * @param n Maximum number of call sites.
+     * @returns std::vector<Site> Call sites, ordered by total wait time.
+     */
+    std::vector<Site> topSites(uint32_t n) const;
+
+    /**
+     * @brief Resets the statistics.
+     */
+    void reset();
+
+private:
+    friend class LockProfiler;
+
+    /**
+     * @brief Represents the statistics of a call site that waited for the lock.
+     */
+    struct SiteCount {
+        SiteCount() : count(0U), wait(0U) { /* stub */ }
+
+        std::atomic<uint64_t> count;    //!< Number of contended acquisitions.
+        std::atomic<uint64_t> wait;     //!< Total wait time (ns).
+    };
+
+    std::string m_name;
+
+    std::atomic<uint64_t> m_acquisitions;
+    std::atomic<uint64_t> m_contended;
+    metrics::Histogram m_wait;
+    metrics::Histogram m_hold;
+
+    // call sites are never removed, a waiting thread adds its wait time to its site after acquiring the lock
+    mutable std::mutex m_siteMutex;
+    std::map<std::vector<void*>, SiteCount> m_sites;
+};
+
+// ---------------------------------------------------------------------------
+//  Class Declaration
+// ---------------------------------------------------------------------------
+
+/**
+ * @brief Implements the optional instrumented-lock mode, in which named locks record their acquisitions,
+ *  contended acquisitions, wait and hold time histograms, and the call sites that waited for them.
+ *
+ *  Profiling is toggled at runtime. While disabled, an instrumented lock costs a relaxed load when it is locked
+ *  and another when it is unlocked, over the plain lock. A lock only gets a profile the first time it is
+ *  acquired while profiling is enabled; profiles are never freed. Call sites are only recorded (as a short
+ *  stack) for contended acquisitions; the stack is captured after the uncontended attempt fails and before
+ *  the thread blocks, so it is never captured while the profiled lock is held.
+ * @ingroup concurrency
+ */
+class HOST_SW_API LockProfiler {
+public:
+    /**
+     * @brief Enables or disables lock profiling.
+     * @param enabled Flag indicating whether or not lock profiling is enabled.
+     */
+    static void setEnabled(bool enabled) { s_enabled.store(enabled, std::memory_order_relaxed); }
+    /**
+     * @brief Flag indicating whether or not lock profiling is enabled.
+     * @returns bool True, if lock profiling is enabled, otherwise false.
+     */
+    static bool isEnabled() { return s_enabled.load(std::memory_order_relaxed); }
+
+    /**
+     * @brief Helper to get the profile of a named lock, if lock profiling is enabled.
+     * @param name Lock name (null for an unnamed lock, which is never profiled).
+     * @param profile Profile cached by the lock.
+     * @returns LockProfile* Lock profile, or null if the lock is not being profiled.
+     */
+    static LockProfile* resolve(const char* name, std::atomic<LockProfile*>& profile)
+    {
+        if (name == nullptr || !isEnabled())
+            return nullptr;
+
+        LockProfile* p = profile.load(std::memory_order_acquire);
+        if (p == nullptr) {
+            p = LockProfiler::profile(name);
+            profile.store(p, std::memory_order_release);
+        }
+
+        return p;
+    }
+    /**
+     * @brief Registers (or finds) the profile of a named lock.
+     * @param name Lock name.
+     * @returns LockProfile* Lock profile.
+     */
+    static LockProfile* profile(const std::string& name);
+    /**
+     * @brief Helper to get the profile cached by a lock being released, if lock profiling is enabled.
+     * @param profile Profile cached by the lock.
+     * @returns LockProfile* Lock profile, or null if the lock is not being profiled.
+     */
+    static LockProfile* cached(const std::atomic<LockProfile*>& profile)
+    {
+        if (!isEnabled())
+            return nullptr;
+
+        return profile.load(std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Gets the current monotonic time (ns).
+     * @returns uint64_t Current monotonic time.
+     */
+    static uint64_t now()
+    {
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+    }
+
+    /**
+     * @brief Represents a thread waiting for a profiled lock.
+     */
+    struct Wait {
+        uint64_t start;                     //!< Time the thread started waiting for the lock.
+        std::atomic<uint64_t>* siteWait;    //!< Total wait time of the waiting call site, or null if not recorded.
+    };
+
+    /**
+     * @brief Records that the calling thread is about to wait for a profiled lock. This captures the waiting
+     *  call site, and must be called after the uncontended attempt fails and before the thread blocks.
+     * @param profile Lock profile.
+     * @param[out] wait Wait state, passed to acquired() once the lock is acquired.
+     */
+    static void waiting(LockProfile* profile, Wait& wait);
+    /**
+     * @brief Records an acquisition of a profiled lock by the calling thread.
+     * @param profile Lock profile.
+     * @param[in] wait Wait state from waiting(), or null if the lock was not contended.
+     */
+    static void acquired(LockProfile* profile, const Wait* wait = nullptr);
+    /**
+     * @brief Records a release of a profiled lock by the calling thread.
+     * @param profile Lock profile.
+     */
+    static void released(LockProfile* profile);
+
+    /**
+     * @brief Gets the statistics of all profiled locks, ordered by total wait time.
+     * @returns json::object JSON object describing the lock statistics.
+     */
+    static json::object status();
+    /**
+     * @brief Resets the statistics of all profiled locks.
+     */
+    static void reset();
+    /**
+     * @brief Writes the statistics of all profiled locks to the log.
+     */
+    static void dump();
+
+private:
+    /**
+     * @brief Represents a lock held by a thread.
+     */
+    struct Hold {
+        LockProfile* profile;           //!< Lock profile.
+        uint64_t tick;                  //!< Time the lock was acquired.
+    };
+
+    static const uint32_t MAX_HOLDS = 16U;
+
+    static std::atomic<bool> s_enabled;
+
+    static std::mutex s_mutex;
+    static std::vector<std::unique_ptr<LockProfile>> s_profiles;
+
+    static thread_local Hold t_holds[MAX_HOLDS];
+    static thread_local uint32_t t_holdCnt;
+
+    /**
+     * @brief Helper to get the profiled locks, ordered by total wait time.
+     * @returns std::vector<LockProfile*> Profiled locks.
+     */
+    static std::vector<LockProfile*> sorted();
+};
+
+// ---------------------------------------------------------------------------
+//  Class Declaration
+// ---------------------------------------------------------------------------
+
+/**
+ * @brief Implements a named mutex that is profiled while lock profiling is enabled.
+ * @tparam MUTEX Underlying mutex type (std::mutex or std::timed_mutex).
+ * @ingroup concurrency
+ */
+template <typename MUTEX = std::mutex>
+class ProfiledMutex {
+public:
+    /**
+     * @brief Initializes a new instance of the ProfiledMutex class.
+     * @param name Lock name.
+     */
+    explicit ProfiledMutex(const char* name) :
+        m_mutex(),
+        m_name(name),
+        m_profile(nullptr)
+    {
+        /* stub */
+    }
+    ProfiledMutex(const ProfiledMutex&) = delete;
+    ProfiledMutex& operator=(const ProfiledMutex&) = delete;
+
+    /**
+     * @brief Locks the mutex.
+     */
+    void lock()
+    {
+        LockProfile* profile = LockProfiler::resolve(m_name, m_profile);
+        if (profile == nullptr) {
+            m_mutex.lock();
+            return;
+        }
+
+        if (m_mutex.try_lock()) {
+            LockProfiler::acquired(profile);
+            return;
+        }
+
+        LockProfiler::Wait wait;
+        LockProfiler::waiting(profile, wait);
+        m_mutex.lock();
+        LockProfiler::acquired(profile, &wait);
+    }
+    /**
+     * @brief Attempts to lock the mutex, without waiting.
+     * @returns bool True, if the mutex was locked, otherwise false.
+     */
+    bool try_lock()
+    {
+        if (!m_mutex.try_lock())
+            return false;
+
+        LockProfile* profile = LockProfiler::resolve(m_name, m_profile);
+        if (profile != nullptr)
+            LockProfiler::acquired(profile);
+        return true;
+    }
+    /**
+     * @brief Attempts to lock the mutex, waiting up to the given duration.
+     * @param timeout Maximum amount of time to wait.
+     * @returns bool True, if the mutex was locked, otherwise false.
+     */
+    template <typename REP, typename PERIOD>
+    bool try_lock_for(const std::chrono::duration<REP, PERIOD>& timeout)
+    {
+        LockProfile* profile = LockProfiler::resolve(m_name, m_profile);
+        if (profile == nullptr)
+            return m_mutex.try_lock_for(timeout);
+
+        if (m_mutex.try_lock()) {
+            LockProfiler::acquired(profile);
+            return true;
+        }
+
+        LockProfiler::Wait wait;
+        LockProfiler::waiting(profile, wait);
+        if (!m_mutex.try_lock_for(timeout))
+            return false;
+
+        LockProfiler::acquired(profile, &wait);
+        return true;
+    }
+    /**
+     * @brief Unlocks the mutex.
+     */
+    void unlock()
+    {
+        LockProfile* profile = LockProfiler::cached(m_profile);
+        if (profile != nullptr)
+            LockProfiler::released(profile);
+        m_mutex.unlock();
+    }
+
+private:
+    MUTEX m_mutex;
+    const char* m_name;
+    std::atomic<LockProfile*> m_profile;
+};
+
+#endif // __LOCK_PROFILER_H__
@@ -0,0 +1,344 @@
+// SPDX-License-Identifier: GPL-2.0-only
+/*
+ * Digital Voice Modem - Common Library
+ * GPLv2 Open Source. Use is subject to license terms.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ *  Copyright (C) 2026 Bryan Biedenkapp, N2PLL
+ *
+ */
+#include "Defines.h"
+#include "Log.h"
+#include "Metrics.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cstdlib>
+#include <new>
+#include <sstream>
+
+using namespace metrics;
+
+// ---------------------------------------------------------------------------
+//  Counter Class Members
+// ---------------------------------------------------------------------------
+
+/* Initializes a new instance of the Counter class. */
+
+Counter::Counter()
+{
+    for (uint32_t i = 0U; i < COUNTER_SHARDS; i++)
+        m_shards[i].value.store(0U, std::memory_order_relaxed);
+}
+
+/* Allocates storage for a counter, aligned to a cache line. */
+
+void* Counter::operator new(size_t size)
+{
+    void* ptr = nullptr;
+#if defined(_WIN32)
+    ptr = ::_aligned_malloc(size, alignof(Counter));
+#else
+    if (::posix_memalign(&ptr, alignof(Counter), size) != 0)
+        ptr = nullptr;
+#endif // defined(_WIN32)
+    if (ptr == nullptr)
+        throw std::bad_alloc();
+
+    return ptr;
+}
+
+/* Releases storage allocated for a counter. */
+
+void Counter::operator delete(void* ptr)
+{
+#if defined(_WIN32)
+    ::_aligned_free(ptr);
+#else
+    ::free(ptr);
+#endif // defined(_WIN32)
+}
+
+/* Gets the current value of the counter. */
+
+uint64_t Counter::value() const
+{
+    uint64_t value = 0U;
+    for (uint32_t i = 0U; i < COUNTER_SHARDS; i++)
+        value += m_shards[i].value.load(std::memory_order_relaxed);
+
+    return value;
+}
+
+/* Resets the counter to zero. */
+
+void Counter::reset()
+{
+    for (uint32_t i = 0U; i < COUNTER_SHARDS; i++)
+        m_shards[i].value.store(0U, std::memory_order_relaxed);
+}
+
+/* Helper to get the counter shard of the calling thread. */
+
+uint32_t Counter::shard()
+{
+    static std::atomic<uint32_t> next(0U);
+
+    // threads are assigned shards round-robin the first time they increment any counter
+    thread_local uint32_t shard = next.fetch_add(1U, std::memory_order_relaxed) % COUNTER_SHARDS;
+    return shard;
+}
+
+// ---------------------------------------------------------------------------
+//  Histogram Class Members
+// ---------------------------------------------------------------------------
+
+/* Initializes a new instance of the Histogram class. */
+
+Histogram::Histogram(const std::vector<uint64_t>& bounds) :
+    m_bounds(bounds),
+    m_buckets(new std::atomic<uint64_t>[bounds.size() + 1U]),
+    m_count(0U),
+    m_sum(0U),
+    m_max(0U)
+{
+    for (uint32_t i = 0U; i <= m_bounds.size(); i++)
+        m_buckets[i].store(0U, std::memory_order_relaxed);
+}
+
+/* Records an observation. */
+
+void Histogram::observe(uint64_t value)
+{
+    uint32_t n = (uint32_t)(std::lower_bound(m_bounds.begin(), m_bounds.end(), value) - m_bounds.begin());
+
+    m_buckets[n].fetch_add(1U, std::memory_order_relaxed);
+    m_count.fetch_add(1U, std::memory_order_relaxed);
+    m_sum.fetch_add(value, std::memory_order_relaxed);
+
+    uint64_t max = m_max.load(std::memory_order_relaxed);
+    while (value > max && !m_max.compare_exchange_weak(max, value, std::memory_order_relaxed))
+        ;
+}
+
+/* Gets the value at the given quantile. */
+
+uint64_t Histogram::percentile(double q) const
+{
+    uint64_t count = 0U;
+    for (uint32_t i = 0U; i <= m_bounds.size(); i++)
+        count += bucket(i);
+    if (count == 0U)
+        return 0U;
+
+    uint64_t max = this->max();
+    uint64_t rank = (uint64_t)(q * (double)count + 0.5);
+    if (rank < 1U)
+        rank = 1U;
+
+    uint64_t cumulative = 0U;
+    for (uint32_t i = 0U; i < m_bounds.size(); i++) {
+        cumulative += bucket(i);
+        if (cumulative >= rank)
+            return (m_bounds[i] < max) ? m_bounds[i] : max;
+    }
+
+    return max;
+}
+
+/* Resets the histogram. */
+
+void Histogram::reset()
+{
+    for (uint32_t i = 0U; i <= m_bounds.size(); i++)
+        m_buckets[i].store(0U, std::memory_order_relaxed);
+    m_count.store(0U, std::memory_order_relaxed);
+    m_sum.store(0U, std::memory_order_relaxed);
+    m_max.store(0U, std::memory_order_relaxed);
+}
+
+/* Helper to generate log-linear bucket bounds. */
+
+std::vector<uint64_t> Histogram::logLinearBounds(uint64_t min, uint64_t max, uint32_t subBuckets)
+{
+    assert(subBuckets > 0U);
+
+    uint64_t base = 1U;
+    while (base < min)
+        base <<= 1;
+
+    std::vector<uint64_t> bounds;
+    bounds.push_back(base);
+    while (base < max) {
+        uint64_t step = base / subBuckets;
+        if (step == 0U)
+            step = 1U;
+
+        for (uint64_t bound = base + step; bound <= base * 2U; bound += step) {
+            if (bound > bounds.back())
+                bounds.push_back(bound);
+        }
+
+        base <<= 1;
+    }
+
+    return bounds;
+}
+
+// ---------------------------------------------------------------------------
+//  Registry Static Class Members
+// ---------------------------------------------------------------------------
+
+std::mutex Registry::s_mutex;
+std::vector<std::unique_ptr<Registry::Family>> Registry::s_families;
+std::unordered_map<std::string, Registry::Family*> Registry::s_familyIndex;
+
+// ---------------------------------------------------------------------------
+//  Registry Class Members
+// ---------------------------------------------------------------------------
+
+/* Registers (or finds) a counter. */
+
+Counter* Registry::counter(const std::string& name, const std::string& help, const std::string& labels)
+{
+    std::lock_guard<std::mutex> lock(s_mutex);
+    Metric* metric = lookup(name, help, COUNTER, labels);
+    if (metric == nullptr)
+        return new Counter();
+    if (metric->metric == nullptr)
+        metric->metric = new Counter();
+
+    return (Counter*)metric->metric;
+}
+
+/* Registers (or finds) a gauge. */
+
+Gauge* Registry::gauge(const std::string& name, const std::string& help, const std::string& labels)
+{
+    std::lock_guard<std::mutex> lock(s_mutex);
+    Metric* metric = lookup(name, help, GAUGE, labels);
+    if (metric == nullptr)
+        return new Gauge();
+    if (metric->metric == nullptr)
+        metric->metric = new Gauge();
+
+    return (Gauge*)metric->metric;
+}
+
+/* Registers (or finds) a histogram. */
+
+Histogram* Registry::histogram(const std::string& name, const std::string& help, const std::vector<uint64_t>& bounds,
+    const std::string& labels)
+{
+    std::lock_guard<std::mutex> lock(s_mutex);
+    Metric* metric = lookup(name, help, HISTOGRAM, labels);
+    if (metric == nullptr)
+        return new Histogram(bounds);
+    if (metric->metric == nullptr)
+        metric->metric = new Histogram(bounds);
+
+    return (Histogram*)metric->metric;
+}
+
+/* Formats all registered metrics in the OpenMetrics text exposition format. */
+
+std::string Registry::expose()
+{
+    std::lock_guard<std::mutex> lock(s_mutex);
+
+    std::stringstream ss;
+    for (auto& family : s_families) {
+        switch (family->type) {
+        case COUNTER:
+            ss << "# TYPE " << family->name << " counter\n";
+            break;
+        case GAUGE:
+            ss << "# TYPE " << family->name << " gauge\n";
+            break;
+        case HISTOGRAM:
+            ss << "# TYPE " << family->name << " histogram\n";
+            break;
+        }
+        if (!family->help.empty())
+            ss << "# HELP " << family->name << " " << family->help << "\n";
+
+        for (Metric& entry : family->metrics) {
+            std::string labels = entry.labels.empty() ? "" : "{" + entry.labels + "}";
+
+            switch (family->type) {
+            case COUNTER:
+                ss << family->name << "_total" << labels << " " << ((Counter*)entry.metric)->value() << "\n";
+                break;
+            case GAUGE:
+                ss << family->name << labels << " " << ((Gauge*)entry.metric)->value() << "\n";
+                break;
+            case HISTOGRAM:
+                {
+                    Histogram* histogram = (Histogram*)entry.metric;
+                    std::string prefix = entry.labels.empty() ? "{" : "{" + entry.labels + ",";
+
+                    // read the count first, observations racing the scrape may then only make the buckets
+                    // larger than the count, never smaller
+                    uint64_t count = histogram->count();
+                    uint64_t sum = histogram->sum();
+
+                    // OpenMetrics buckets are cumulative
+                    uint64_t cumulative = 0U;
+                    const std::vector<uint64_t>& bounds = histogram->bounds();
+                    for (uint32_t i = 0U; i < bounds.size(); i++) {
+                        cumulative += histogram->bucket(i);
+                        ss << family->name << "_bucket" << prefix << "le=\"" << bounds[i] << "\"} " << cumulative << "\n";
+                    }
+                    cumulative += histogram->bucket((uint32_t)bounds.size());
+                    if (cumulative < count)
+                        cumulative = count;
+
+                    ss << family->name << "_bucket" << prefix << "le=\"+Inf\"} " << cumulative << "\n";
+                    ss << family->name << "_sum" << labels << " " << sum << "\n";
+                    ss << family->name << "_count" << labels << " " << cumulative << "\n";
+                }
+                break;
+            }
+        }
+    }
+
+    ss << "# EOF\n";
+    return ss.str();
+}
+
+// ---------------------------------------------------------------------------
+//  Registry Private Class Members
+// ---------------------------------------------------------------------------
+
+/* Helper to find a registered metric, or add a new (empty) metric to its family. */
+
+Registry::Metric* Registry::lookup(const std::string& name, const std::string& help, TYPE type, const std::string& labels)
+{
+    Family* family = nullptr;
+    auto it = s_familyIndex.find(name);
+    if (it != s_familyIndex.end()) {
+        family = it->second;
+        if (family->type != type) {
+            LogError(LOG_HOST, "Metric %s is already registered as another metric type, it will not be exposed", name.c_str());
+            return nullptr;
+        }
+    }
+    else {
+        std::unique_ptr<Family> newFamily(new Family());
+        newFamily->name = name;
+        newFamily->help = help;
+        newFamily->type = type;
+
+        family = newFamily.get();
+        s_families.push_back(std::move(newFamily));
+        s_familyIndex[name] = family;
+    }
+
+    for (Metric& metric : family->metrics) {
+        if (metric.labels == labels)
+            return &metric;
+    }
+
+    family->metrics.push_back(Metric { labels, nullptr });
+    return &family->metrics.back();
+}
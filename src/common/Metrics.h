@@ -0,0 +1,327 @@
+// SPDX-License-Identifier: GPL-2.0-only
+/*
+ * Digital Voice Modem - Common Library
+ * GPLv2 Open Source. Use is subject to license terms.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ *  Copyright (C) 2026 Bryan Biedenkapp, N2PLL
+ *
+ */
+/**
+ * @file Metrics.h
+ * @ingroup common
+ * @file Metrics.cpp
+ * @ingroup common
+ */
+#if !defined(__METRICS_H__)
+#define __METRICS_H__
+
+#include "common/Defines.h"
+
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace metrics
+{
+    // ---------------------------------------------------------------------------
+    //  Constants
+    // ---------------------------------------------------------------------------
+
+    /**
+     * @brief Number of per-thread shards of a counter.
+     */
+    const uint32_t COUNTER_SHARDS = 16U;
+
+    /**
+     * @brief HTTP content type of the OpenMetrics text exposition format.
+     */
+    const char* const CONTENT_TYPE = "application/openmetrics-text; version=1.0.0; charset=utf-8";
+
+    // ---------------------------------------------------------------------------
+    //  Class Declaration
+    // ---------------------------------------------------------------------------
+
+    /**
+     * @brief Implements a monotonically increasing counter. The count is sharded across cache lines, and
+     *  each thread increments its own shard, so concurrent increments do not contend.
+     * @ingroup common
+     */
+    class HOST_SW_API Counter {
+    public:
+        /**
+         * @brief Initializes a new instance of the Counter class.
+         */
+        Counter();
+
+        /**
+         * @brief Allocates storage for a counter, aligned to a cache line.
+         *  (NOTE: C++14 operator new does not honor the extended alignment of the shards.)
+         * @param size Size of the storage.
+         * @returns void* Allocated storage.
+         */
+        static void* operator new(size_t size);
+        /**
+         * @brief Releases storage allocated for a counter.
+         * @param ptr Allocated storage.
+         */
+        static void operator delete(void* ptr);
+
+        /**
+         * @brief Increments the counter.
+         * @param n Amount to increment by.
+         */
+        void inc(uint64_t n = 1U)
+        {
+            m_shards[shard()].value.fetch_add(n, std::memory_order_relaxed);
+        }
+
+        /**
+         * @brief Gets the current value of the counter.
+         * @returns uint64_t Current value of the counter.
+         */
+        uint64_t value() const;
+        /**
+         * @brief Resets the counter to zero.
+         */
+        void reset();
+
+        /**
+         * @brief Helper to get the counter shard of the calling thread.
+         * @returns uint32_t Counter shard index.
+         */
+        static uint32_t shard();
+
+    private:
+        /**
+         * @brief Represents a counter shard, aligned to (and so occupying) a whole cache line.
+         */
+        struct alignas(64) Shard {
+            std::atomic<uint64_t> value;    //!< Shard value.
+        };
+
+        Shard m_shards[COUNTER_SHARDS];
+    };
+
+    // ---------------------------------------------------------------------------
+    //  Class Declaration
+    // ---------------------------------------------------------------------------
+
+    /**
+     * @brief Implements a gauge, a value that can go up and down.
+     * @ingroup common
+     */
+    class HOST_SW_API Gauge {
+    public:
+        /**
+         * @brief Initializes a new instance of the Gauge class.
+         */
+        Gauge() : m_value(0) { /* stub */ }
+
+        /**
+         * @brief Sets the gauge value.
+         * @param value Value.
+         */
+        void set(int64_t value) { m_value.store(value, std::memory_order_relaxed); }
+        /**
+         * @brief Increments the gauge.
+         * @param n Amount to increment by.
+         */
+        void inc(int64_t n = 1) { m_value.fetch_add(n, std::memory_order_relaxed); }
+        /**
+         * @brief Decrements the gauge.
+         * @param n Amount to decrement by.
+         */
+        void dec(int64_t n = 1) { m_value.fetch_sub(n, std::memory_order_relaxed); }
+
+        /**
+         * @brief Gets the current value of the gauge.
+         * @returns int64_t Current value of the gauge.
+         */
+        int64_t value() const { return m_value.load(std::memory_order_relaxed); }
+
+    private:
+        std::atomic<int64_t> m_value;
+    };
+
+    // ---------------------------------------------------------------------------
+    //  Class Declaration
+    // ---------------------------------------------------------------------------
+
+    /**
+     * @brief Implements a histogram of integer observations, counted into fixed buckets. Buckets are single
+     *  atomics (unlike counters they are not sharded), so a histogram stays small enough to keep one per peer.
+     * @ingroup common
+     */
+    class HOST_SW_API Histogram {
+    public:
+        /**
+         * @brief Initializes a new instance of the Histogram class.
+         * @param bounds Inclusive upper bounds of the buckets, in ascending order. Observations greater than
+         *  the last bound are counted in the implicit +Inf bucket.
+         */
+        Histogram(const std::vector<uint64_t>& bounds);
+
+        /**
+         * @brief Records an observation.
+         * @param value Observed value.
+         */
+        void observe(uint64_t value);
+
+        /**
+         * @brief Gets the bucket upper bounds.
+         * @returns std::vector<uint64_t> Bucket upper bounds.
+         */
+        const std::vector<uint64_t>& bounds() const { return m_bounds; }
+        /**
+         * @brief Gets the number of observations in the given bucket (not cumulative).
+         * @param n Bucket index (bounds().size() is the +Inf bucket).
+         * @returns uint64_t Number of observations in the bucket.
+         */
+        uint64_t bucket(uint32_t n) const { return m_buckets[n].load(std::memory_order_relaxed); }
+        /**
+         * @brief Gets the total number of observations.
+         * @returns uint64_t Total number of observations.
+         */
+        uint64_t count() const { return m_count.load(std::memory_order_relaxed); }
+        /**
+         * @brief Gets the sum of all observations.
+         * @returns uint64_t Sum of all observations.
+         */
+        uint64_t sum() const { return m_sum.load(std::memory_order_relaxed); }
+        /**
+         * @brief Gets the largest observation.
+         * @returns uint64_t Largest observation.
+         */
+        uint64_t max() const { return m_max.load(std::memory_order_relaxed); }
+        /**
+         * @brief Gets the value at the given quantile. The result is the upper bound of the bucket holding the
+         *  quantile (so it is accurate to the bucket resolution), clamped to the largest observation.
+         * @param q Quantile (0.0 - 1.0).
+         * @returns uint64_t Value at the quantile.
+         */
+        uint64_t percentile(double q) const;
+
+        /**
+         * @brief Resets the histogram.
+         */
+        void reset();
+
+        /**
+         * @brief Helper to generate log-linear bucket bounds (as used by HDR histograms); each power of two
+         *  between min and max is split into the given number of linear sub-buckets.
+         * @param min Smallest bucket bound (rounded up to a power of two).
+         * @param max Largest bucket bound.
+         * @param subBuckets Number of linear sub-buckets per power of two.
+         * @returns std::vector<uint64_t> Bucket upper bounds.
+         */
+        static std::vector<uint64_t> logLinearBounds(uint64_t min, uint64_t max, uint32_t subBuckets);
+
+    private:
+        std::vector<uint64_t> m_bounds;
+        std::unique_ptr<std::atomic<uint64_t>[]> m_buckets;
+        std::atomic<uint64_t> m_count;
+        std::atomic<uint64_t> m_sum;
+        std::atomic<uint64_t> m_max;
+    };
+
+    // ---------------------------------------------------------------------------
+    //  Class Declaration
+    // ---------------------------------------------------------------------------
+
+    /**
+     * @brief Implements the process wide registry of metrics, and the OpenMetrics text exposition of them.
+     *
+     *  Metrics are registered once (usually at construction of the owning object) and the returned pointer
+     *  is kept and used directly on the hot path; registered metrics are never freed. Registering the same
+     *  name and labels again returns the existing metric. Exposition only takes the registration lock, it
+     *  never blocks the threads updating the metrics.
+     * @ingroup common
+     */
+    class HOST_SW_API Registry {
+    public:
+        /**
+         * @brief Registers (or finds) a counter.
+         * @param name Metric family name (without the "_total" suffix).
+         * @param help Metric family help text.
+         * @param labels Metric labels (e.g. "peer=\"1234\""), or empty for none.
+         * @returns Counter* Registered counter. If the name is registered as another metric type, the
+         *  error is logged and an unregistered counter is returned.
+         */
+        static Counter* counter(const std::string& name, const std::string& help, const std::string& labels = "");
+        /**
+         * @brief Registers (or finds) a gauge.
+         * @param name Metric family name.
+         * @param help Metric family help text.
+         * @param labels Metric labels (e.g. "peer=\"1234\""), or empty for none.
+         * @returns Gauge* Registered gauge. If the name is registered as another metric type, the
+         *  error is logged and an unregistered gauge is returned.
+         */
+        static Gauge* gauge(const std::string& name, const std::string& help, const std::string& labels = "");
+        /**
+         * @brief Registers (or finds) a histogram.
+         * @param name Metric family name.
+         * @param help Metric family help text.
+         * @param bounds Inclusive upper bounds of the buckets, in ascending order.
+         * @param labels Metric labels (e.g. "peer=\"1234\""), or empty for none.
+         * @returns Histogram* Registered histogram. If the name is registered as another metric type, the
+         *  error is logged and an unregistered histogram is returned.
+         */
+        static Histogram* histogram(const std::string& name, const std::string& help, const std::vector<uint64_t>& bounds,
+            const std::string& labels = "");
+
+        /**
+         * @brief Formats all registered metrics in the OpenMetrics text exposition format.
+         * @returns std::string OpenMetrics text.
+         */
+        static std::string expose();
+
+    private:
+        /**
+         * @brief Metric Types
+         */
+        enum TYPE {
+            COUNTER,                        //!< Counter
+            GAUGE,                          //!< Gauge
+            HISTOGRAM                       //!< Histogram
+        };
+
+        /**
+         * @brief Represents a single labeled metric of a family.
+         */
+        struct Metric {
+            std::string labels;             //!< Metric labels.
+            void* metric;                   //!< Counter, Gauge or Histogram instance.
+        };
+        /**
+         * @brief Represents a metric family.
+         */
+        struct Family {
+            std::string name;               //!< Family name.
+            std::string help;               //!< Family help text.
+            TYPE type;                      //!< Family metric type.
+            std::vector<Metric> metrics;    //!< Labeled metrics.
+        };
+
+        static std::mutex s_mutex;
+        static std::vector<std::unique_ptr<Family>> s_families;
+        static std::unordered_map<std::string, Family*> s_familyIndex;
+
+        /**
+         * @brief Helper to find a registered metric, or add a new (empty) metric to its family. The
+         *  registration lock must be held.
+         * @param name Metric family name.
+         * @param help Metric family help text.
+         * @param type Metric type.
+         * @param labels Metric labels.
+         * @returns Metric* Registered metric (with a null instance, if newly added), or nullptr if the family
+         *  is registered with another metric type.
+         */
+        static Metric* lookup(const std::string& name, const std::string& help, TYPE type, const std::string& labels);
+    };
+} // namespace metrics
+
+#endif // __METRICS_H__
@@ -0,0 +1,353 @@
+// SPDX-License-Identifier: GPL-2.0-only
+/*
+ * Digital Voice Modem - Common Library
+ * GPLv2 Open Source. Use is subject to license terms.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ *  Copyright (C) 2026 Bryan Biedenkapp, N2PLL
+ *
+ */
+#include "Defines.h"
+#include "edac/CRC.h"
+#include "Log.h"
+#include "StateSnapshot.h"
+
+#include <cassert>
+#include <cerrno>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <sys/types.h>
+#include <sys/stat.h>
+#if !defined(_WIN32)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#endif // !defined(_WIN32)
+
+// ---------------------------------------------------------------------------
+//  Public Class Members
+// ---------------------------------------------------------------------------
+
+/* Initializes a new instance of the StateSnapshot class. */
+
+StateSnapshot::StateSnapshot(const char* tag, uint32_t version) :
+    m_version(version),
+    m_timestamp(0U),
+    m_data(),
+    m_readPos(0U)
+{
+    assert(tag != nullptr);
+    ::memcpy(m_tag, tag, 4U);
+}
+
+/* Clears the snapshot payload. */
+
+void StateSnapshot::clear()
+{
+    m_data.clear();
+    m_readPos = 0U;
+    m_timestamp = 0U;
+}
+
+/* Saves the snapshot to the given file. */
+
+bool StateSnapshot::save(const std::string& filename)
+{
+    m_timestamp = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::system_clock::now().time_since_epoch()).count();
+
+    uint32_t length = (uint32_t)m_data.size();
+    size_t total = HEADER_LEN + length + 4U;
+
+    uint8_t header[HEADER_LEN];
+    ::memcpy(header + 0U, m_tag, 4U);                                               // Tag
+    SET_UINT32(m_version, header, 4U);                                              // Version
+    SET_UINT32((uint32_t)(m_timestamp >> 32), header, 8U);                          // Timestamp
+    SET_UINT32((uint32_t)(m_timestamp & 0xFFFFFFFFU), header, 12U);
+    SET_UINT32(length, header, 16U);                                                // Payload Length
+
+    // write to a temporary file, and replace the snapshot file with it once complete
+    std::string tmpFilename = filename + ".tmp";
+    bool written = false;
+
+#if !defined(_WIN32)
+    int fd = ::open(tmpFilename.c_str(), O_RDWR | O_CREAT | O_TRUNC, 0644);
+    if (fd < 0) {
+        LogError(LOG_HOST, "Cannot open the state snapshot file, %s, err: %d", tmpFilename.c_str(), errno);
+        return false;
+    }
+
+    if (::ftruncate(fd, (off_t)total) == 0) {
+        void* p = ::mmap(nullptr, total, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+        if (p != MAP_FAILED) {
+            uint8_t* image = (uint8_t*)p;
+            ::memcpy(image, header, HEADER_LEN);
+            if (length > 0U)
+                ::memcpy(image + HEADER_LEN, m_data.data(), length);
+            edac::CRC::addCRC32(image, (uint32_t)total);
+
+            written = (::msync(p, total, MS_SYNC) == 0);
+            ::munmap(p, total);
+        }
+    }
+
+    ::close(fd);
+#else
+    std::vector<uint8_t> image(total);
+    ::memcpy(image.data(), header, HEADER_LEN);
+    if (length > 0U)
+        ::memcpy(image.data() + HEADER_LEN, m_data.data(), length);
+    edac::CRC::addCRC32(image.data(), (uint32_t)total);
+
+    std::ofstream file(tmpFilename, std::ofstream::out | std::ofstream::binary | std::ofstream::trunc);
+    if (!file.fail()) {
+        file.write((const char*)image.data(), total);
+        file.close();
+        written = !file.fail();
+    }
+#endif // !defined(_WIN32)
+
+    if (!written) {
+        LogError(LOG_HOST, "Cannot write the state snapshot file, %s", tmpFilename.c_str());
+        ::remove(tmpFilename.c_str());
+        return false;
+    }
+
+#if defined(_WIN32)
+    ::remove(filename.c_str());
+#endif // defined(_WIN32)
+    if (::rename(tmpFilename.c_str(), filename.c_str()) != 0) {
+        LogError(LOG_HOST, "Cannot replace the state snapshot file, %s, err: %d", filename.c_str(), errno);
+        ::remove(tmpFilename.c_str());
+        return false;
+    }
+
+    return true;
+}
+
+/* Loads the snapshot from the given file. */
+
+bool StateSnapshot::load(const std::string& filename)
+{
+    clear();
+
+    struct stat st;
+    if (::stat(filename.c_str(), &st) != 0)
+        return false;
+
+    size_t total = (size_t)st.st_size;
+    if (total < HEADER_LEN + 4U) {
+        LogWarning(LOG_HOST, "State snapshot file, %s, is truncated", filename.c_str());
+        return false;
+    }
+
+    const uint8_t* image = nullptr;
+    std::vector<uint8_t> buffer;
+    bool mapped = false;
+
+#if !defined(_WIN32)
+    int fd = ::open(filename.c_str(), O_RDONLY);
+    if (fd < 0)
+        return false;
+
+    void* p = ::mmap(nullptr, total, PROT_READ, MAP_PRIVATE, fd, 0);
+    if (p != MAP_FAILED) {
+        image = (const uint8_t*)p;
+        mapped = true;
+    }
+    ::close(fd);
+#endif // !defined(_WIN32)
+
+    // fall back to reading the whole file
+    if (!mapped) {
+        std::ifstream file(filename, std::ifstream::in | std::ifstream::binary);
+        if (file.fail())
+            return false;
+
+        buffer.resize(total);
+        file.read((char*)buffer.data(), total);
+        if ((size_t)file.gcount() != total)
+            return false;
+        image = buffer.data();
+    }
+
+    bool ret = false;
+    do {
+        if (::memcmp(image, m_tag, 4U) != 0) {
+            LogWarning(LOG_HOST, "State snapshot file, %s, is not a valid snapshot", filename.c_str());
+            break;
+        }
+
+        uint32_t version = GET_UINT32(image, 4U);
+        if (version != m_version) {
+            LogWarning(LOG_HOST, "State snapshot file, %s, has version %u, expected version %u", filename.c_str(), version, m_version);
+            break;
+        }
+
+        uint32_t length = GET_UINT32(image, 16U);
+        if ((size_t)HEADER_LEN + length + 4U != total) {
+            LogWarning(LOG_HOST, "State snapshot file, %s, is truncated", filename.c_str());
+            break;
+        }
+
+        if (!edac::CRC::checkCRC32(image, (uint32_t)total)) {
+            LogWarning(LOG_HOST, "State snapshot file, %s, failed CRC-32 check", filename.c_str());
+            break;
+        }
+
+        uint32_t timestampHi = GET_UINT32(image, 8U);
+        uint32_t timestampLo = GET_UINT32(image, 12U);
+        m_timestamp = ((uint64_t)timestampHi << 32) | timestampLo;
+
+        m_data.assign(image + HEADER_LEN, image + HEADER_LEN + length);
+        ret = true;
+    } while (false);
+
+#if !defined(_WIN32)
+    if (mapped)
+        ::munmap((void*)image, total);
+#endif // !defined(_WIN32)
+
+    return ret;
+}
+
+/* Writes a uint8_t value to the payload. */
+
+void StateSnapshot::writeUInt8(uint8_t value)
+{
+    m_data.push_back(value);
+}
+
+/* Writes a uint16_t value to the payload. */
+
+void StateSnapshot::writeUInt16(uint16_t value)
+{
+    m_data.push_back((uint8_t)((value >> 8) & 0xFFU));
+    m_data.push_back((uint8_t)((value >> 0) & 0xFFU));
+}
+
+/* Writes a uint32_t value to the payload. */
+
+void StateSnapshot::writeUInt32(uint32_t value)
+{
+    uint8_t buffer[4U];
+    SET_UINT32(value, buffer, 0U);
+    m_data.insert(m_data.end(), buffer, buffer + 4U);
+}
+
+/* Writes a uint64_t value to the payload. */
+
+void StateSnapshot::writeUInt64(uint64_t value)
+{
+    writeUInt32((uint32_t)(value >> 32));
+    writeUInt32((uint32_t)(value & 0xFFFFFFFFU));
+}
+
+/* Writes a string value to the payload. */
+
+void StateSnapshot::writeString(const std::string& value)
+{
+    uint32_t length = (uint32_t)value.length();
+    if (length > MAX_STRING_LEN)
+        length = MAX_STRING_LEN;
+
+    writeUInt16((uint16_t)length);
+    m_data.insert(m_data.end(), value.begin(), value.begin() + length);
+}
+
+/* Writes raw bytes to the payload. */
+
+void StateSnapshot::writeBytes(const uint8_t* data, uint32_t length)
+{
+    assert(data != nullptr || length == 0U);
+    m_data.insert(m_data.end(), data, data + length);
+}
+
+/* Reads a uint8_t value from the payload. */
+
+bool StateSnapshot::readUInt8(uint8_t& value)
+{
+    if (m_readPos + 1U > m_data.size())
+        return false;
+
+    value = m_data[m_readPos++];
+    return true;
+}
+
+/* Reads a uint16_t value from the payload. */
+
+bool StateSnapshot::readUInt16(uint16_t& value)
+{
+    if (m_readPos + 2U > m_data.size())
+        return false;
+
+    value = (uint16_t)((m_data[m_readPos] << 8) | m_data[m_readPos + 1U]);
+    m_readPos += 2U;
+    return true;
+}
+
+/* Reads a uint32_t value from the payload. */
+
+bool StateSnapshot::readUInt32(uint32_t& value)
+{
+    if (m_readPos + 4U > m_data.size())
+        return false;
+
+    value = GET_UINT32(m_data, m_readPos);
+    m_readPos += 4U;
+    return true;
+}
+
+/* Reads a uint64_t value from the payload. */
+
+bool StateSnapshot::readUInt64(uint64_t& value)
+{
+    uint32_t hi = 0U, lo = 0U;
+    if (!readUInt32(hi) || !readUInt32(lo))
+        return false;
+
+    value = ((uint64_t)hi << 32) | lo;
+    return true;
+}
+
+/* Reads a boolean value from the payload. */
+
+bool StateSnapshot::readBool(bool& value)
+{
+    uint8_t b = 0U;
+    if (!readUInt8(b))
+        return false;
+
+    value = (b != 0U);
+    return true;
+}
+
+/* Reads a string value from the payload. */
+
+bool StateSnapshot::readString(std::string& value)
+{
+    uint16_t length = 0U;
+    if (!readUInt16(length))
+        return false;
+    if (m_readPos + length > m_data.size())
+        return false;
+
+    value.assign((const char*)m_data.data() + m_readPos, length);
+    m_readPos += length;
+    return true;
+}
+
+/* Reads raw bytes from the payload. */
+
+bool StateSnapshot::readBytes(uint8_t* data, uint32_t length)
+{
+    assert(data != nullptr || length == 0U);
+    if (m_readPos + length > m_data.size())
+        return false;
+
+    if (length > 0U)
+        ::memcpy(data, m_data.data() + m_readPos, length);
+    m_readPos += length;
+    return true;
+}
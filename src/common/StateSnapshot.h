@@ -0,0 +1,204 @@
+// SPDX-License-Identifier: GPL-2.0-only
+/*
+ * Digital Voice Modem - Common Library
+ * GPLv2 Open Source. Use is subject to license terms.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ *  Copyright (C) 2026 Bryan Biedenkapp, N2PLL
+ *
+ */
+/**
+ * @file StateSnapshot.h
+ * @ingroup common
+ * @file StateSnapshot.cpp
+ * @ingroup common
+ */
+#if !defined(__STATE_SNAPSHOT_H__)
+#define __STATE_SNAPSHOT_H__
+
+#include "common/Defines.h"
+
+#include <string>
+#include <vector>
+
+// ---------------------------------------------------------------------------
+//  Class Declaration
+// ---------------------------------------------------------------------------
+
+/**
+ * @brief Implements a compact binary snapshot of runtime state, saved to and loaded from a file.
+ * \code{.unparsed}
+ *  Below is the representation of the snapshot file layout. All values are big endian.
+ *
+ *  Byte 0               1               2               3
+ *  Bit  0 1 2 3 4 5 6 7 0 1 2 3 4 5 6 7 0 1 2 3 4 5 6 7 0 1 2 3 4 5 6 7
+ *      +-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+
+ *      | Tag                                                           |
+ *      +-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+
+ *      | Version                                                       |
+ *      +-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+
+ *      | Timestamp (ms since epoch)                                    |
+ *      +                                                               +
+ *      |                                                               |
+ *      +-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+
+ *      | Payload Length                                                |
+ *      +-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+
+ *      | Payload ...                                                   |
+ *      +-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+
+ *      | CRC-32 (over all preceding bytes)                             |
+ *      +-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+
+ * \endcode
+ *
+ *  The payload is a sequence of values written with the write*() methods, and read back in the same
+ *  order with the read*() methods. The file is written through a memory mapping to a temporary file,
+ *  which then replaces the snapshot file, so a snapshot file is never partially written.
+ * @ingroup common
+ */
+class HOST_SW_API StateSnapshot {
+public:
+    /**
+     * @brief Length of the snapshot file header.
+     */
+    static const uint32_t HEADER_LEN = 20U;
+    /**
+     * @brief Maximum length of a string value.
+     */
+    static const uint32_t MAX_STRING_LEN = 65535U;
+
+    /**
+     * @brief Initializes a new instance of the StateSnapshot class.
+     * @param tag 4 character tag identifying the snapshot file.
+     * @param version Version of the snapshot payload layout.
+     */
+    StateSnapshot(const char* tag, uint32_t version);
+
+    /**
+     * @brief Clears the snapshot payload.
+     */
+    void clear();
+
+    /**
+     * @brief Saves the snapshot to the given file.
+     * @param filename Snapshot file.
+     * @returns bool True, if the snapshot was saved, otherwise false.
+     */
+    bool save(const std::string& filename);
+    /**
+     * @brief Loads the snapshot from the given file. The tag, version, length and CRC-32 of the file are
+     *  validated.
+     * @param filename Snapshot file.
+     * @returns bool True, if the snapshot was loaded, otherwise false.
+     */
+    bool load(const std::string& filename);
+
+    /**
+     * @brief Gets the time the snapshot was saved (ms since epoch).
+     * @returns uint64_t Time the snapshot was saved.
+     */
+    uint64_t timestamp() const { return m_timestamp; }
+    /**
+     * @brief Gets the length of the snapshot payload.
+     * @returns uint32_t Length of the snapshot payload.
+     */
+    uint32_t size() const { return (uint32_t)m_data.size(); }
+    /**
+     * @brief Flag indicating whether or not the whole payload has been read.
+     * @returns bool True, if the whole payload has been read, otherwise false.
+     */
+    bool eof() const { return m_readPos >= m_data.size(); }
+
+    /** @name Writing */
+    /**
+     * @brief Writes a uint8_t value to the payload.
+     * @param value Value.
+     */
+    void writeUInt8(uint8_t value);
+    /**
+     * @brief Writes a uint16_t value to the payload.
+     * @param value Value.
+     */
+    void writeUInt16(uint16_t value);
+    /**
+     * @brief Writes a uint32_t value to the payload.
+     * @param value Value.
+     */
+    void writeUInt32(uint32_t value);
+    /**
+     * @brief Writes a uint64_t value to the payload.
+     * @param value Value.
+     */
+    void writeUInt64(uint64_t value);
+    /**
+     * @brief Writes a boolean value to the payload.
+     * @param value Value.
+     */
+    void writeBool(bool value) { writeUInt8(value ? 1U : 0U); }
+    /**
+     * @brief Writes a string value to the payload. Strings are truncated to MAX_STRING_LEN.
+     * @param value Value.
+     */
+    void writeString(const std::string& value);
+    /**
+     * @brief Writes raw bytes to the payload.
+     * @param[in] data Bytes to write.
+     * @param length Number of bytes to write.
+     */
+    void writeBytes(const uint8_t* data, uint32_t length);
+    /** @} */
+
+    /** @name Reading */
+    /**
+     * @brief Reads a uint8_t value from the payload.
+     * @param[out] value Value.
+     * @returns bool True, if the value was read, otherwise false.
+     */
+    bool readUInt8(uint8_t& value);
+    /**
+     * @brief Reads a uint16_t value from the payload.
+     * @param[out] value Value.
+     * @returns bool True, if the value was read, otherwise false.
+     */
+    bool readUInt16(uint16_t& value);
+    /**
+     * @brief Reads a uint32_t value from the payload.
+     * @param[out] value Value.
+     * @returns bool True, if the value was read, otherwise false.
+     */
+    bool readUInt32(uint32_t& value);
+    /**
+     * @brief Reads a uint64_t value from the payload.
+     * @param[out] value Value.
+     * @returns bool True, if the value was read, otherwise false.
+     */
+    bool readUInt64(uint64_t& value);
+    /**
+     * @brief Reads a boolean value from the payload.
+     * @param[out] value Value.
+     * @returns bool True, if the value was read, otherwise false.
+     */
+    bool readBool(bool& value);
+    /**
+     * @brief Reads a string value from the payload.
+     * @param[out] value Value.
+     * @returns bool True, if the value was read, otherwise false.
+     */
+    bool readString(std::string& value);
+    /**
+     * @brief Reads raw bytes from the payload.
+     * @param[out] data Buffer to read bytes into.
+     * @param length Number of bytes to read.
+     * @returns bool True, if the bytes were read, otherwise false.
+     */
+    bool readBytes(uint8_t* data, uint32_t length);
+    /** @} */
+
+private:
+    char m_tag[4U];
+    uint32_t m_version;
+    uint64_t m_timestamp;
+
+    std::vector<uint8_t> m_data;
+    size_t m_readPos;
+};
+
+#endif // __STATE_SNAPSHOT_H__
@@ -9,6 +9,7 @@
  *
  */
 #include "Thread.h"
+#include "ThreadPolicy.h"
 #include "Log.h"
 
 #include <cerrno>
@@ -84,9 +85,8 @@ void Thread::setName(std::string name)
 #else
     if (pthread_kill(m_thread, 0) != 0)
         return;
-#ifdef _GNU_SOURCE
-    ::pthread_setname_np(m_thread, name.c_str());
-#endif // _GNU_SOURCE
+
+    ThreadPolicy::apply(m_thread, name);
 #endif // defined(_WIN32)
 }
 
@@ -87,7 +87,8 @@ public:
     virtual void wait();
 
     /**
-     * @brief Set thread name visible in the kernel and its interfaces.
+     * @brief Set thread name visible in the kernel and its interfaces, and applies the scheduling
+     *  policy configured for that name (see ThreadPolicy).
      * @param name Textual name for thread.
      */
     virtual void setName(std::string name);
@@ -0,0 +1,339 @@
+// SPDX-License-Identifier: GPL-2.0-only
+/*
+ * Digital Voice Modem - Common Library
+ * GPLv2 Open Source. Use is subject to license terms.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ *  Copyright (C) 2026 Bryan Biedenkapp, N2PLL
+ *
+ */
+#include "Defines.h"
+#include "ThreadPolicy.h"
+#include "Log.h"
+
+#include <algorithm>
+#include <cerrno>
+#include <cstdlib>
+#include <cstring>
+#include <sstream>
+#if !defined(_WIN32)
+#include <sched.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#endif // !defined(_WIN32)
+
+// ---------------------------------------------------------------------------
+//  Constants
+// ---------------------------------------------------------------------------
+
+#if defined(_WIN32)
+#define SCHED_OTHER 0
+#define SCHED_FIFO 1
+#define SCHED_RR 2
+#endif // defined(_WIN32)
+
+const uint32_t MAX_CPUS = 1024U;
+
+// ---------------------------------------------------------------------------
+//  Static Class Members
+// ---------------------------------------------------------------------------
+
+std::mutex ThreadPolicy::s_mutex;
+
+bool ThreadPolicy::s_lockMemory = false;
+bool ThreadPolicy::s_memoryLocked = false;
+std::vector<ThreadPolicy::Rule> ThreadPolicy::s_rules;
+std::vector<ThreadPolicy::Effective> ThreadPolicy::s_effective;
+
+// ---------------------------------------------------------------------------
+//  Public Class Members
+// ---------------------------------------------------------------------------
+
+/* Reads the thread scheduling configuration. */
+
+bool ThreadPolicy::configure(yaml::Node& conf)
+{
+    std::lock_guard<std::mutex> lock(s_mutex);
+    s_rules.clear();
+
+    bool ret = true;
+
+    yaml::Node& policies = conf["policies"];
+    for (size_t i = 0; i < policies.size(); i++) {
+        yaml::Node& entry = policies[i];
+
+        Rule rule;
+        rule.name = entry["name"].as<std::string>();
+        if (rule.name.empty()) {
+            ::LogError(LOG_HOST, "Thread policy %u has no thread name, ignoring", (uint32_t)i);
+            ret = false;
+            continue;
+        }
+
+        std::string policy = entry["policy"].as<std::string>("other");
+        std::transform(policy.begin(), policy.end(), policy.begin(), ::tolower);
+        if (policy == "fifo") {
+            rule.policy = SCHED_FIFO;
+        } else if (policy == "rr") {
+            rule.policy = SCHED_RR;
+        } else if (policy == "other") {
+            rule.policy = SCHED_OTHER;
+        } else {
+            ::LogError(LOG_HOST, "Thread policy for %s has an invalid scheduling policy \"%s\", ignoring", rule.name.c_str(), policy.c_str());
+            ret = false;
+            continue;
+        }
+
+        rule.priority = entry["priority"].as<int>(0);
+        if (rule.policy == SCHED_OTHER) {
+            rule.priority = 0;
+        } else {
+            // clamp to the POSIX real-time priority range
+            if (rule.priority < 1)
+                rule.priority = 1;
+            if (rule.priority > 99)
+                rule.priority = 99;
+        }
+
+        std::string cpus = entry["cpus"].as<std::string>();
+        if (!parseCPUs(cpus, rule.cpus)) {
+            ::LogError(LOG_HOST, "Thread policy for %s has an invalid CPU set \"%s\", ignoring", rule.name.c_str(), cpus.c_str());
+            ret = false;
+            continue;
+        }
+
+        s_rules.push_back(rule);
+    }
+
+    s_lockMemory = conf["lockMemory"].as<bool>(false);
+
+    LogInfo("Thread Scheduling Parameters");
+    LogInfo("    Lock Memory: %s", s_lockMemory ? "yes" : "no");
+    for (auto& rule : s_rules) {
+        std::string cpus = "any";
+        if (!rule.cpus.empty()) {
+            std::stringstream ss;
+            for (size_t i = 0; i < rule.cpus.size(); i++)
+                ss << (i > 0U ? "," : "") << rule.cpus[i];
+            cpus = ss.str();
+        }
+
+        LogInfo("    Thread %s: %s, priority %d, cpus %s", rule.name.c_str(), policyToString(rule.policy).c_str(), rule.priority, cpus.c_str());
+    }
+
+#if !defined(_WIN32)
+    if (s_lockMemory && !s_memoryLocked) {
+        if (::mlockall(MCL_CURRENT | MCL_FUTURE) != 0) {
+            ::LogError(LOG_HOST, "Failed to lock process memory, err: %d (%s)", errno, ::strerror(errno));
+            ret = false;
+        } else {
+            s_memoryLocked = true;
+        }
+    }
+#else
+    if (s_lockMemory) {
+        ::LogWarning(LOG_HOST, "Locking process memory is not supported on this platform");
+    }
+#endif // !defined(_WIN32)
+
+    return ret;
+}
+
+/* Sets the thread name visible in the kernel and applies the scheduling policy configured for that name. */
+
+void ThreadPolicy::apply(pthread_t thread, const std::string& name)
+{
+#if !defined(_WIN32)
+#ifdef _GNU_SOURCE
+    ::pthread_setname_np(thread, name.c_str());
+#endif // _GNU_SOURCE
+
+    std::lock_guard<std::mutex> lock(s_mutex);
+
+    const Rule* rule = nullptr;
+    for (auto& r : s_rules) {
+        if (matches(r.name, name)) {
+            rule = &r;
+            break;
+        }
+    }
+
+    bool failed = false;
+    if (rule != nullptr) {
+#if defined(__linux__)
+        if (!rule->cpus.empty()) {
+            cpu_set_t set;
+            CPU_ZERO(&set);
+            for (uint32_t cpu : rule->cpus)
+                CPU_SET(cpu, &set);
+
+            int err = ::pthread_setaffinity_np(thread, sizeof(cpu_set_t), &set);
+            if (err != 0) {
+                ::LogError(LOG_HOST, "Failed to set CPU affinity for thread %s, err: %d (%s)", name.c_str(), err, ::strerror(err));
+                failed = true;
+            }
+        }
+#endif // defined(__linux__)
+
+        sched_param param;
+        ::memset(&param, 0x00U, sizeof(param));
+        param.sched_priority = rule->priority;
+
+        int err = ::pthread_setschedparam(thread, rule->policy, &param);
+        if (err != 0) {
+            ::LogError(LOG_HOST, "Failed to set scheduling policy %s priority %d for thread %s, err: %d (%s)",
+                policyToString(rule->policy).c_str(), rule->priority, name.c_str(), err, ::strerror(err));
+            failed = true;
+        }
+    }
+
+    // read back what the kernel actually applied
+    Effective effective;
+    effective.name = name;
+    effective.rule = (rule != nullptr) ? rule->name : "";
+    effective.policy = SCHED_OTHER;
+    effective.priority = 0;
+    effective.count = 1U;
+    effective.failed = failed;
+
+    int policy = SCHED_OTHER;
+    sched_param param;
+    if (::pthread_getschedparam(thread, &policy, &param) == 0) {
+        effective.policy = policy;
+        effective.priority = param.sched_priority;
+    }
+
+    effective.cpus = "any";
+#if defined(__linux__)
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    if (::pthread_getaffinity_np(thread, sizeof(cpu_set_t), &set) == 0) {
+        std::stringstream ss;
+        uint32_t cnt = 0U;
+        for (uint32_t cpu = 0U; cpu < CPU_SETSIZE; cpu++) {
+            if (CPU_ISSET(cpu, &set)) {
+                ss << (cnt > 0U ? "," : "") << cpu;
+                cnt++;
+            }
+        }
+
+        // a thread allowed on every online CPU has no affinity
+        if (cnt > 0U && cnt != (uint32_t)::sysconf(_SC_NPROCESSORS_ONLN))
+            effective.cpus = ss.str();
+    }
+#endif // defined(__linux__)
+
+    if (rule != nullptr) {
+        LogInfoEx(LOG_HOST, "Thread %s, %s priority %d, cpus %s%s", name.c_str(), policyToString(effective.policy).c_str(),
+            effective.priority, effective.cpus.c_str(), failed ? " (policy not fully applied)" : "");
+    }
+
+    // thread pools name all their workers the same
+    for (auto& e : s_effective) {
+        if (e.name == name) {
+            effective.count = e.count + 1U;
+            effective.failed = effective.failed || e.failed;
+            e = effective;
+            return;
+        }
+    }
+
+    s_effective.push_back(effective);
+#endif // !defined(_WIN32)
+}
+
+/* Gets the effective scheduling policy of all named threads. */
+
+json::object ThreadPolicy::status()
+{
+    std::lock_guard<std::mutex> lock(s_mutex);
+
+    json::object status = json::object();
+    status["lockMemory"].set<bool>(s_lockMemory);
+    status["memoryLocked"].set<bool>(s_memoryLocked);
+
+    json::array threads = json::array();
+    for (auto& e : s_effective) {
+        json::object thread = json::object();
+        thread["name"].set<std::string>(e.name);
+        thread["rule"].set<std::string>(e.rule);
+        std::string policy = policyToString(e.policy);
+        thread["policy"].set<std::string>(policy);
+        thread["priority"].set<int>(e.priority);
+        thread["cpus"].set<std::string>(e.cpus);
+        thread["count"].set<uint32_t>(e.count);
+        thread["failed"].set<bool>(e.failed);
+
+        threads.push_back(json::value(thread));
+    }
+
+    status["threads"].set<json::array>(threads);
+    return status;
+}
+
+/* Helper to parse a CPU set list (e.g. "0,2-3"). */
+
+bool ThreadPolicy::parseCPUs(const std::string& cpus, std::vector<uint32_t>& set)
+{
+    set.clear();
+
+    std::stringstream ss(cpus);
+    std::string item;
+    while (std::getline(ss, item, ',')) {
+        item.erase(std::remove_if(item.begin(), item.end(), ::isspace), item.end());
+        if (item.empty())
+            continue;
+
+        size_t dash = item.find('-');
+        std::string first = item.substr(0, dash);
+        std::string last = (dash == std::string::npos) ? first : item.substr(dash + 1U);
+        if (first.empty() || last.empty() ||
+            first.find_first_not_of("0123456789") != std::string::npos ||
+            last.find_first_not_of("0123456789") != std::string::npos)
+            return false;
+
+        // range check before narrowing, so an oversized index cannot wrap into range
+        unsigned long long lo = ::strtoull(first.c_str(), nullptr, 10);
+        unsigned long long hi = ::strtoull(last.c_str(), nullptr, 10);
+        if (lo > hi || hi >= MAX_CPUS)
+            return false;
+
+        for (uint32_t cpu = (uint32_t)lo; cpu <= (uint32_t)hi; cpu++) {
+            if (std::find(set.begin(), set.end(), cpu) == set.end())
+                set.push_back(cpu);
+        }
+    }
+
+    std::sort(set.begin(), set.end());
+    return true;
+}
+
+/* Helper to determine if a rule name matches a thread name. */
+
+bool ThreadPolicy::matches(const std::string& rule, const std::string& name)
+{
+    if (!rule.empty() && rule.back() == '*')
+        return name.compare(0, rule.length() - 1U, rule, 0, rule.length() - 1U) == 0;
+
+    return rule == name;
+}
+
+// ---------------------------------------------------------------------------
+//  Private Class Members
+// ---------------------------------------------------------------------------
+
+/* Helper to convert a scheduling policy to a string. */
+
+std::string ThreadPolicy::policyToString(int policy)
+{
+    switch (policy) {
+    case SCHED_FIFO:
+        return "SCHED_FIFO";
+    case SCHED_RR:
+        return "SCHED_RR";
+    case SCHED_OTHER:
+        return "SCHED_OTHER";
+    default:
+        return "SCHED_" + std::to_string(policy);
+    }
+}
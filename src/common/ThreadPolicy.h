@@ -0,0 +1,118 @@
+// SPDX-License-Identifier: GPL-2.0-only
+/*
+ * Digital Voice Modem - Common Library
+ * GPLv2 Open Source. Use is subject to license terms.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ *  Copyright (C) 2026 Bryan Biedenkapp, N2PLL
+ *
+ */
+/**
+ * @file ThreadPolicy.h
+ * @ingroup threading
+ * @file ThreadPolicy.cpp
+ * @ingroup threading
+ */
+#if !defined(__THREAD_POLICY_H__)
+#define __THREAD_POLICY_H__
+
+#include "common/Defines.h"
+#include "common/json/json.h"
+#include "common/yaml/Yaml.h"
+#include "common/Thread.h"
+
+#include <mutex>
+#include <string>
+#include <vector>
+
+// ---------------------------------------------------------------------------
+//  Class Declaration
+// ---------------------------------------------------------------------------
+
+/**
+ * @brief Implements per-thread name scheduling policy (CPU affinity, real-time scheduling class and
+ *  priority) and process memory locking.
+ *
+ *  Rules are matched by the thread name given to apply(); a rule name ending in '*' matches any thread
+ *  name with that prefix. The first matching rule wins. Threads with no matching rule are left as the
+ *  kernel created them, but are still recorded so their effective policy can be reported.
+ * @ingroup threading
+ */
+class HOST_SW_API ThreadPolicy {
+public:
+    /**
+     * @brief Reads the thread scheduling configuration.
+     * @param conf Thread scheduling configuration block.
+     * @returns bool True, if the configuration was applied, otherwise false.
+     */
+    static bool configure(yaml::Node& conf);
+
+    /**
+     * @brief Sets the thread name visible in the kernel and applies the scheduling policy configured
+     *  for that name.
+     * @param thread Thread handle.
+     * @param name Textual name for thread.
+     */
+    static void apply(pthread_t thread, const std::string& name);
+
+    /**
+     * @brief Gets the effective scheduling policy of all named threads.
+     * @returns json::object JSON object describing the effective thread scheduling policies.
+     */
+    static json::object status();
+
+    /**
+     * @brief Helper to parse a CPU set list (e.g. "0,2-3").
+     * @param cpus CPU set list.
+     * @param[out] set List of CPU cores.
+     * @returns bool True, if the CPU set list was parsed, otherwise false.
+     */
+    static bool parseCPUs(const std::string& cpus, std::vector<uint32_t>& set);
+
+    /**
+     * @brief Helper to determine if a rule name matches a thread name.
+     * @param rule Rule name (a trailing '*' matches a prefix).
+     * @param name Thread name.
+     * @returns bool True, if the rule matches the thread name, otherwise false.
+     */
+    static bool matches(const std::string& rule, const std::string& name);
+
+private:
+    /**
+     * @brief Represents a configured thread scheduling rule.
+     */
+    struct Rule {
+        std::string name;               //!< Thread name (or prefix ending in '*').
+        int policy;                     //!< Scheduling policy (SCHED_OTHER, SCHED_FIFO or SCHED_RR).
+        int priority;                   //!< Scheduling priority.
+        std::vector<uint32_t> cpus;     //!< CPU cores (empty for no affinity).
+    };
+    /**
+     * @brief Represents the effective scheduling policy of a named thread.
+     */
+    struct Effective {
+        std::string name;               //!< Thread name.
+        std::string rule;               //!< Name of the matched rule (empty if none).
+        int policy;                     //!< Effective scheduling policy.
+        int priority;                   //!< Effective scheduling priority.
+        std::string cpus;               //!< Effective CPU cores.
+        uint32_t count;                 //!< Number of threads with this name.
+        bool failed;                    //!< Flag indicating the configured policy could not be fully applied.
+    };
+
+    static std::mutex s_mutex;
+
+    static bool s_lockMemory;
+    static bool s_memoryLocked;
+    static std::vector<Rule> s_rules;
+    static std::vector<Effective> s_effective;
+
+    /**
+     * @brief Helper to convert a scheduling policy to a string.
+     * @param policy Scheduling policy.
+     * @returns std::string Textual name of the scheduling policy.
+     */
+    static std::string policyToString(int policy);
+};
+
+#endif // __THREAD_POLICY_H__
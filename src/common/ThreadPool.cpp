@@ -8,6 +8,7 @@
  *
  */
 #include "ThreadPool.h"
+#include "ThreadPolicy.h"
 #include "Log.h"
 
 #include <cerrno>
@@ -198,9 +199,7 @@ void* ThreadPool::worker(void* arg)
 
     std::stringstream threadName;
     threadName << threadPool->m_name << ":worker";
-#ifdef _GNU_SOURCE
-    ::pthread_setname_np(thread->thread, threadName.str().c_str());
-#endif // _GNU_SOURCE
+    ThreadPolicy::apply(thread->thread, threadName.str());
 
     ThreadPoolTask* task = nullptr;
     while (threadPool->m_poolState != STOP) {
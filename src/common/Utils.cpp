@@ -360,6 +360,45 @@ void Utils::hex2Bin(const uint8_t input, uint8_t* output, uint32_t offset)
     WRITE_BIT(output, offset + 5U, input & 0x01U);
 }
 
+/* Helper to convert a binary input buffer into an array of representative 6-bit bytes. */
+
+void Utils::bin2HexArray(const uint8_t* input, uint8_t* output, uint32_t count)
+{
+    assert(input != nullptr);
+    assert(output != nullptr);
+
+    uint32_t i = 0U;
+    for (; i + 4U <= count; i += 4U, input += 3U) {
+        output[i + 0U] = input[0U] >> 2;
+        output[i + 1U] = ((input[0U] & 0x03U) << 4) | (input[1U] >> 4);
+        output[i + 2U] = ((input[1U] & 0x0FU) << 2) | (input[2U] >> 6);
+        output[i + 3U] = input[2U] & 0x3FU;
+    }
+
+    // handle trailing symbols that do not fill a 3 byte group
+    for (uint32_t j = 0U; i < count; i++, j += 6U)
+        output[i] = bin2Hex(input, j);
+}
+
+/* Helper to convert an array of 6-bit input bytes into representative binary buffer. */
+
+void Utils::hex2BinArray(const uint8_t* input, uint8_t* output, uint32_t count)
+{
+    assert(input != nullptr);
+    assert(output != nullptr);
+
+    uint32_t i = 0U;
+    for (; i + 4U <= count; i += 4U, output += 3U) {
+        output[0U] = (input[i + 0U] << 2) | ((input[i + 1U] >> 4) & 0x03U);
+        output[1U] = (input[i + 1U] << 4) | ((input[i + 2U] >> 2) & 0x0FU);
+        output[2U] = (input[i + 2U] << 6) | (input[i + 3U] & 0x3FU);
+    }
+
+    // handle trailing symbols that do not fill a 3 byte group
+    for (uint32_t j = 0U; i < count; i++, j += 6U)
+        hex2Bin(input[i], output, j);
+}
+
 /* Returns the count of bits in the passed 8 byte value. */
 
 uint8_t Utils::countBits8(uint8_t bits)
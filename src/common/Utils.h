@@ -306,6 +306,23 @@ public:
      * @param offset Buffer offset.
      */
     static void hex2Bin(const uint8_t input, uint8_t* output, uint32_t offset);
+    /**
+     * @brief Helper to convert a binary input buffer into an array of representative 6-bit bytes.
+     *  (NOTE: This unpacks 4 symbols from every 3 bytes, starting at bit offset 0 of the input buffer.)
+     * @param input Input buffer.
+     * @param output Output array of 6-bit bytes.
+     * @param count Number of 6-bit bytes to convert.
+     */
+    static void bin2HexArray(const uint8_t* input, uint8_t* output, uint32_t count);
+    /**
+     * @brief Helper to convert an array of 6-bit input bytes into representative binary buffer.
+     *  (NOTE: This packs 4 symbols into every 3 bytes, starting at bit offset 0 of the output buffer;
+     *  bits beyond the last symbol are left unchanged.)
+     * @param input Input array of 6-bit bytes.
+     * @param output Output buffer.
+     * @param count Number of 6-bit bytes to convert.
+     */
+    static void hex2BinArray(const uint8_t* input, uint8_t* output, uint32_t count);
 
     /**
      * @brief Returns the count of bits in the passed 8 byte value.
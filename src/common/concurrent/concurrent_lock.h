@@ -14,10 +14,11 @@
 #if !defined(__CONCURRENCY_CONCURRENT_LOCK_H__)
 #define __CONCURRENCY_CONCURRENT_LOCK_H__
 
+#include "common/concurrent/reader_gate.h"
+#include "common/LockProfiler.h"
 #include "common/Thread.h"
 
 #include <mutex>
-#include <condition_variable>
 
 namespace concurrent
 {
@@ -27,6 +28,10 @@ namespace concurrent
 
     /**
      * @brief Base class for a concurrently locked container.
+     *
+     *  Changes are serialized by a mutex; a change that takes the read lock also closes the
+     *  container's reader gate, which waits for in-flight lookups to finish and holds off new
+     *  ones until the object is unlocked.
      * @ingroup concurrency
      */
     class concurrent_lock
@@ -37,7 +42,9 @@ namespace concurrent
          */
         concurrent_lock() :
             m_mutex(),
-            m_locked(false)
+            m_gate(),
+            m_lockName(nullptr),
+            m_profile(nullptr)
         {
             /* stub */
         }
@@ -55,15 +62,24 @@ namespace concurrent
          * @brief Flag indicating whether or not the object is read locked.
          * @return bool True if the object is read locked, false otherwise.
          */
-        bool isReadLocked() const { return m_locked; }
+        bool isReadLocked() const { return m_gate.isClosed(); }
         /**
-         * @brief Spins until the object is unlocked.
+         * @brief Waits until the object is read unlocked.
          */
         void spinlock() const { __spinlock(); }
 
+        /**
+         * @brief Sets the name the object's lock is profiled by, while lock profiling is enabled.
+         * @param name Lock name (must remain valid for the lifetime of the object).
+         */
+        void setLockName(const char* name) { m_lockName = name; }
+
     protected:
         mutable std::mutex m_mutex;     //!< Mutex used for change locking.
-        mutable bool m_locked = false;  //!< Flag used for read locking (prevents find lookups), should be used when atomic operations (add/erase/etc) are being used.
+        reader_gate m_gate;             //!< Gate used for read locking (prevents find lookups), should be used when atomic operations (add/erase/etc) are being used.
+
+        const char* m_lockName;                             //!< Lock profiling name.
+        mutable std::atomic<LockProfile*> m_profile;        //!< Lock profile.
 
         /**
          * @brief Lock the object.
@@ -71,9 +87,20 @@ namespace concurrent
          */
         inline void __lock(bool readLock = true) const
         {
-            m_mutex.lock();
+            LockProfile* profile = LockProfiler::resolve(m_lockName, m_profile);
+            if (profile == nullptr)
+                m_mutex.lock();
+            else if (m_mutex.try_lock())
+                LockProfiler::acquired(profile);
+            else {
+                LockProfiler::Wait wait;
+                LockProfiler::waiting(profile, wait);
+                m_mutex.lock();
+                LockProfiler::acquired(profile, &wait);
+            }
+
             if (readLock)
-                m_locked = true;
+                m_gate.close();
         }
 
         /**
@@ -81,20 +108,18 @@ namespace concurrent
          */
         inline void __unlock() const
         {
+            m_gate.open();
+
+            LockProfile* profile = LockProfiler::cached(m_profile);
+            if (profile != nullptr)
+                LockProfiler::released(profile);
             m_mutex.unlock();
-            m_locked = false;
         }
 
         /**
-         * @brief Spins until the object is read unlocked.
+         * @brief Waits until the object is read unlocked.
          */
-        inline void __spinlock() const
-        {
-            if (m_locked) {
-                while (m_locked)
-                    Thread::sleep(1U);
-            }
-        }
+        inline void __spinlock() const { m_gate.wait(); }
     };
 } // namespace concurrent
 
@@ -14,6 +14,8 @@
 #if !defined(__CONCURRENCY_CONCURRENT_SHARED_LOCK_H__)
 #define __CONCURRENCY_CONCURRENT_SHARED_LOCK_H__
 
+#include "common/concurrent/reader_gate.h"
+#include "common/LockProfiler.h"
 #include "common/Thread.h"
 
 #include <shared_mutex>
@@ -27,6 +29,9 @@ namespace concurrent
 
     /**
      * @brief Base class for a concurrently shared locked container.
+     *
+     *  Locking briefly spins on try_lock()/try_lock_shared() before blocking on the mutex, so
+     *  short critical sections do not put the waiting thread to sleep.
      * @ingroup concurrency
      */
     class concurrent_shared_lock
@@ -36,7 +41,9 @@ namespace concurrent
          * @brief Initializes a new instance of the concurrent_shared_lock class.
          */
         concurrent_shared_lock() :
-            m_mutex()
+            m_mutex(),
+            m_lockName(nullptr),
+            m_profile(nullptr)
         {
             /* stub */
         }
@@ -59,26 +66,96 @@ namespace concurrent
          */
         void shared_unlock() const { __shared_unlock(); }
 
+        /**
+         * @brief Sets the name the object's lock is profiled by, while lock profiling is enabled. Exclusive and
+         *  shared acquisitions are profiled together.
+         * @param name Lock name (must remain valid for the lifetime of the object).
+         */
+        void setLockName(const char* name) { m_lockName = name; }
+
     protected:
         mutable std::shared_timed_mutex m_mutex;    //!< Mutex used for locking.
 
+        const char* m_lockName;                             //!< Lock profiling name.
+        mutable std::atomic<LockProfile*> m_profile;        //!< Lock profile.
+
+        static const uint32_t SPIN_COUNT = 64U;
+
         /**
          * @brief Lock the object.
          */
-        inline void __lock() const { m_mutex.lock(); }
+        inline void __lock() const
+        {
+            LockProfile* profile = LockProfiler::resolve(m_lockName, m_profile);
+            if (profile != nullptr && m_mutex.try_lock()) {
+                LockProfiler::acquired(profile);
+                return;
+            }
+
+            LockProfiler::Wait wait;
+            if (profile != nullptr)
+                LockProfiler::waiting(profile, wait);
+            for (uint32_t i = 0U; i < SPIN_COUNT; i++) {
+                if (m_mutex.try_lock()) {
+                    if (profile != nullptr)
+                        LockProfiler::acquired(profile, &wait);
+                    return;
+                }
+                spin_pause();
+            }
+
+            m_mutex.lock();
+            if (profile != nullptr)
+                LockProfiler::acquired(profile, &wait);
+        }
         /**
          * @brief Lock the object.
          */
-        inline void __shared_lock() const { m_mutex.lock_shared(); }
+        inline void __shared_lock() const
+        {
+            LockProfile* profile = LockProfiler::resolve(m_lockName, m_profile);
+            if (profile != nullptr && m_mutex.try_lock_shared()) {
+                LockProfiler::acquired(profile);
+                return;
+            }
+
+            LockProfiler::Wait wait;
+            if (profile != nullptr)
+                LockProfiler::waiting(profile, wait);
+            for (uint32_t i = 0U; i < SPIN_COUNT; i++) {
+                if (m_mutex.try_lock_shared()) {
+                    if (profile != nullptr)
+                        LockProfiler::acquired(profile, &wait);
+                    return;
+                }
+                spin_pause();
+            }
+
+            m_mutex.lock_shared();
+            if (profile != nullptr)
+                LockProfiler::acquired(profile, &wait);
+        }
 
         /**
          * @brief Unlock the object.
          */
-        inline void __unlock() const { m_mutex.unlock(); }
+        inline void __unlock() const
+        {
+            LockProfile* profile = LockProfiler::cached(m_profile);
+            if (profile != nullptr)
+                LockProfiler::released(profile);
+            m_mutex.unlock();
+        }
         /**
          * @brief Unlock the object.
          */
-        inline void __shared_unlock() const { m_mutex.unlock_shared(); }
+        inline void __shared_unlock() const
+        {
+            LockProfile* profile = LockProfiler::cached(m_profile);
+            if (profile != nullptr)
+                LockProfiler::released(profile);
+            m_mutex.unlock_shared();
+        }
     };
 } // namespace concurrent
 
@@ -128,7 +128,7 @@ namespace concurrent
          */
         iterator begin()
         {
-            __spinlock();
+            reader_guard guard(m_gate);
             return m_deque.begin();
         }
         /**
@@ -139,7 +139,7 @@ namespace concurrent
          */
         const_iterator begin() const
         {
-            __spinlock();
+            reader_guard guard(m_gate);
             return m_deque.begin();
         }
         /**
@@ -150,7 +150,7 @@ namespace concurrent
          */
         iterator end()
         {
-            __spinlock();
+            reader_guard guard(m_gate);
             return m_deque.end();
         }
         /**
@@ -161,7 +161,7 @@ namespace concurrent
          */
         const_iterator end() const
         {
-            __spinlock();
+            reader_guard guard(m_gate);
             return m_deque.end();
         }
 
@@ -173,7 +173,7 @@ namespace concurrent
          */
         const_iterator cbegin() const
         {
-            __spinlock();
+            reader_guard guard(m_gate);
             return m_deque.cbegin();
         }
         /**
@@ -184,7 +184,7 @@ namespace concurrent
          */
         const_iterator cend() const
         {
-            __spinlock();
+            reader_guard guard(m_gate);
             return m_deque.cend();
         }
 
@@ -194,7 +194,7 @@ namespace concurrent
          */
         size_t size() const
         {
-            __spinlock();
+            reader_guard guard(m_gate);
             return m_deque.size();
         }
         /**
@@ -215,7 +215,7 @@ namespace concurrent
          */
         size_t capacity() const
         {
-            __spinlock();
+            reader_guard guard(m_gate);
             return m_deque.capacity();
         }
 
@@ -225,7 +225,7 @@ namespace concurrent
          */
         bool empty() const
         {
-            __spinlock();
+            reader_guard guard(m_gate);
             return m_deque.empty();
         }
 
@@ -236,7 +236,7 @@ namespace concurrent
          */
         T& operator[](size_t index)
         {
-            __spinlock();
+            reader_guard guard(m_gate);
             return m_deque[index];
         }
         /**
@@ -246,7 +246,7 @@ namespace concurrent
          */
         const T& operator[](size_t index) const
         {
-            __spinlock();
+            reader_guard guard(m_gate);
             return m_deque[index];
         }
 
@@ -257,7 +257,7 @@ namespace concurrent
          */
         T& at(size_t index)
         {
-            __spinlock();
+            reader_guard guard(m_gate);
             return m_deque.at(index);
         }
         /**
@@ -267,7 +267,7 @@ namespace concurrent
          */
         const T& at(size_t index) const
         {
-            __spinlock();
+            reader_guard guard(m_gate);
             return m_deque.at(index);
         }
 
@@ -316,7 +316,7 @@ namespace concurrent
          */
         T& front()
         {
-            __spinlock();
+            reader_guard guard(m_gate);
             return m_deque.front();
         }
         /**
@@ -325,7 +325,7 @@ namespace concurrent
          */
         const T& front() const
         {
-            __spinlock();
+            reader_guard guard(m_gate);
             return m_deque.front();
         }
         /**
@@ -334,7 +334,7 @@ namespace concurrent
          */
         T& back()
         {
-            __spinlock();
+            reader_guard guard(m_gate);
             return m_deque.back();
         }
         /**
@@ -343,7 +343,7 @@ namespace concurrent
          */
         const T& back() const
         {
-            __spinlock();
+            reader_guard guard(m_gate);
             return m_deque.back();
         }
 
@@ -406,7 +406,7 @@ namespace concurrent
          */
         std::deque<T>& get()
         {
-            __spinlock();
+            reader_guard guard(m_gate);
             return m_deque;
         }
         /**
@@ -415,7 +415,7 @@ namespace concurrent
          */
         const std::deque<T>& get() const
         {
-            __spinlock();
+            reader_guard guard(m_gate);
             return m_deque;
         }
 
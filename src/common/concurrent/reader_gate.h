@@ -0,0 +1,227 @@
+// SPDX-License-Identifier: GPL-2.0-only
+/*
+ * Digital Voice Modem - Common Library
+ * GPLv2 Open Source. Use is subject to license terms.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ *  Copyright (C) 2026 Bryan Biedenkapp, N2PLL
+ *
+ */
+/**
+ * @file reader_gate.h
+ * @ingroup concurrency
+ */
+#if !defined(__CONCURRENCY_READER_GATE_H__)
+#define __CONCURRENCY_READER_GATE_H__
+
+#include <atomic>
+#include <cstdint>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif // defined(_MSC_VER)
+
+namespace concurrent
+{
+    // ---------------------------------------------------------------------------
+    //  Global Functions
+    // ---------------------------------------------------------------------------
+
+    /**
+     * @brief Helper to pause the CPU inside a spin loop.
+     * @ingroup concurrency
+     */
+    inline void spin_pause()
+    {
+#if defined(_MSC_VER)
+        _mm_pause();
+#elif defined(__i386__) || defined(__x86_64__)
+        __builtin_ia32_pause();
+#elif defined(__aarch64__) || defined(__arm__)
+        __asm__ __volatile__("yield");
+#endif
+    }
+
+    // ---------------------------------------------------------------------------
+    //  Class Declaration
+    // ---------------------------------------------------------------------------
+
+    /**
+     * @brief Implements a gate that excludes readers while a writer has it closed.
+     *
+     *  Readers announce themselves with enter()/leave(); closing the gate stops new readers from
+     *  entering and waits for the readers already inside to leave. Waiting (on either side) spins
+     *  briefly, then yields, then parks the thread on a condition variable; the fast path for a
+     *  reader with the gate open is a pair of atomic operations.
+     *
+     *  The gate does not provide writer-writer exclusion; writers are expected to hold their own
+     *  mutex while the gate is closed. A thread inside the gate must not close it (or wait for it)
+     *  and must not enter it again.
+     * @ingroup concurrency
+     */
+    class reader_gate
+    {
+    public:
+        /**
+         * @brief Initializes a new instance of the reader_gate class.
+         */
+        reader_gate() :
+            m_closed(false),
+            m_readers(0U),
+            m_waiters(0U),
+            m_parkMutex(),
+            m_park()
+        {
+            /* stub */
+        }
+
+        /**
+         * @brief Closes the gate; blocks until all readers have left.
+         */
+        void close() const
+        {
+            m_closed.store(true);
+            if (m_readers.load() != 0U)
+                wait([this]() { return m_readers.load() == 0U; });
+        }
+        /**
+         * @brief Opens the gate, releasing any waiting readers.
+         */
+        void open() const
+        {
+            if (m_closed.exchange(false))
+                wake();
+        }
+        /**
+         * @brief Flag indicating whether or not the gate is closed.
+         * @return bool True if the gate is closed, false otherwise.
+         */
+        bool isClosed() const { return m_closed.load(); }
+
+        /**
+         * @brief Enters the gate as a reader; blocks while the gate is closed.
+         */
+        void enter() const
+        {
+            while (true) {
+                m_readers.fetch_add(1U);
+                if (!m_closed.load())
+                    return;
+
+                // back out and let the writer through
+                if (m_readers.fetch_sub(1U) == 1U)
+                    wake();
+                wait([this]() { return !m_closed.load(); });
+            }
+        }
+        /**
+         * @brief Leaves the gate as a reader.
+         */
+        void leave() const
+        {
+            if (m_readers.fetch_sub(1U) == 1U && m_closed.load())
+                wake();
+        }
+
+        /**
+         * @brief Blocks until the gate is open, without entering it.
+         */
+        void wait() const
+        {
+            if (m_closed.load())
+                wait([this]() { return !m_closed.load(); });
+        }
+
+    private:
+        mutable std::atomic<bool> m_closed;
+        mutable std::atomic<uint32_t> m_readers;
+        mutable std::atomic<uint32_t> m_waiters;
+
+        mutable std::mutex m_parkMutex;
+        mutable std::condition_variable m_park;
+
+        static const uint32_t SPIN_COUNT = 128U;
+        static const uint32_t YIELD_COUNT = 16U;
+
+        /**
+         * @brief Helper to spin, then yield, then park until the given condition is met.
+         * @tparam P Predicate type; bool().
+         * @param ready Predicate.
+         */
+        template <typename P>
+        void wait(P ready) const
+        {
+            for (uint32_t i = 0U; i < SPIN_COUNT; i++) {
+                if (ready())
+                    return;
+                spin_pause();
+            }
+
+            for (uint32_t i = 0U; i < YIELD_COUNT; i++) {
+                if (ready())
+                    return;
+                std::this_thread::yield();
+            }
+
+            // the waiter count is raised before the condition is checked under the park mutex and
+            // the condition is changed before the count is checked by wake(), so either the waiter
+            // sees the change or wake() sees the waiter
+            std::unique_lock<std::mutex> lock(m_parkMutex);
+            m_waiters.fetch_add(1U);
+            m_park.wait(lock, ready);
+            m_waiters.fetch_sub(1U);
+        }
+
+        /**
+         * @brief Helper to wake any parked threads.
+         */
+        void wake() const
+        {
+            if (m_waiters.load() == 0U)
+                return;
+
+            std::lock_guard<std::mutex> lock(m_parkMutex);
+            m_park.notify_all();
+        }
+    };
+
+    // ---------------------------------------------------------------------------
+    //  Class Declaration
+    // ---------------------------------------------------------------------------
+
+    /**
+     * @brief Enters a reader_gate for the lifetime of the object.
+     * @ingroup concurrency
+     */
+    class reader_guard
+    {
+    public:
+        /**
+         * @brief Initializes a new instance of the reader_guard class.
+         * @param gate Gate to enter.
+         */
+        explicit reader_guard(const reader_gate& gate) :
+            m_gate(gate)
+        {
+            m_gate.enter();
+        }
+        /**
+         * @brief Finalizes a instance of the reader_guard class.
+         */
+        ~reader_guard()
+        {
+            m_gate.leave();
+        }
+
+        reader_guard(const reader_guard&) = delete;
+        reader_guard& operator=(const reader_guard&) = delete;
+
+    private:
+        const reader_gate& m_gate;
+    };
+} // namespace concurrent
+
+#endif // __CONCURRENCY_READER_GATE_H__
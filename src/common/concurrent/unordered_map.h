@@ -128,7 +128,7 @@ namespace concurrent
          */
         iterator begin()
         {
-            __spinlock();
+            reader_guard guard(m_gate);
             return m_map.begin();
         }
         /**
@@ -139,7 +139,7 @@ namespace concurrent
          */
         const_iterator begin() const
         {
-            __spinlock();
+            reader_guard guard(m_gate);
             return m_map.begin();
         }
         /**
@@ -150,7 +150,7 @@ namespace concurrent
          */
         iterator end()
         {
-            __spinlock();
+            reader_guard guard(m_gate);
             return m_map.end();
         }
         /**
@@ -161,7 +161,7 @@ namespace concurrent
          */
         const_iterator end() const
         {
-            __spinlock();
+            reader_guard guard(m_gate);
             return m_map.end();
         }
 
@@ -173,7 +173,7 @@ namespace concurrent
          */
         const_iterator cbegin() const
         {
-            __spinlock();
+            reader_guard guard(m_gate);
             return m_map.cbegin();
         }
         /**
@@ -184,7 +184,7 @@ namespace concurrent
          */
         const_iterator cend() const
         {
-            __spinlock();
+            reader_guard guard(m_gate);
             return m_map.cend();
         }
 
@@ -195,7 +195,7 @@ namespace concurrent
          */
         T& operator[](const Key& key)
         {
-            __spinlock();
+            reader_guard guard(m_gate);
             return m_map[key];
         }
         /**
@@ -205,7 +205,7 @@ namespace concurrent
          */
         const T& operator[](const Key& key) const
         {
-            __spinlock();
+            reader_guard guard(m_gate);
             return m_map[key];
         }
 
@@ -216,7 +216,7 @@ namespace concurrent
          */
         T& at(const Key& key)
         {
-            __spinlock();
+            reader_guard guard(m_gate);
             return m_map.at(key);
         }
         /**
@@ -226,7 +226,7 @@ namespace concurrent
          */
         const T& at(const Key& key) const
         {
-            __spinlock();
+            reader_guard guard(m_gate);
             return m_map.at(key);
         }
 
@@ -236,7 +236,7 @@ namespace concurrent
          */
         size_t size() const
         {
-            __spinlock();
+            reader_guard guard(m_gate);
             return m_map.size();
         }
 
@@ -246,7 +246,7 @@ namespace concurrent
          */
         bool empty() const
         {
-            __spinlock();
+            reader_guard guard(m_gate);
             return m_map.empty();
         }
 
@@ -257,7 +257,7 @@ namespace concurrent
          */
         bool contains(const Key& key) const
         {
-            __spinlock();
+            reader_guard guard(m_gate);
             return m_map.contains(key);
         }
 
@@ -323,7 +323,7 @@ namespace concurrent
          */
         iterator find(const Key& key)
         {
-            __spinlock();
+            reader_guard guard(m_gate);
             return m_map.find(key);
         }
         /**
@@ -334,7 +334,7 @@ namespace concurrent
          */
         const_iterator find(const Key& key) const
         {
-            __spinlock();
+            reader_guard guard(m_gate);
             return m_map.find(key);
         }
 
@@ -345,7 +345,7 @@ namespace concurrent
          */
         size_t count(const Key& key) const
         {
-            __spinlock();
+            reader_guard guard(m_gate);
             return m_map.count(key);
         }
 
@@ -355,7 +355,7 @@ namespace concurrent
          */
         std::unordered_map<Key, T>& get()
         {
-            __spinlock();
+            reader_guard guard(m_gate);
             return m_map;
         }
         /**
@@ -364,7 +364,7 @@ namespace concurrent
          */
         const std::unordered_map<Key, T>& get() const
         {
-            __spinlock();
+            reader_guard guard(m_gate);
             return m_map;
         }
 
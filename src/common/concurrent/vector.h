@@ -132,7 +132,7 @@ namespace concurrent
          */
         iterator begin()
         {
-            __spinlock();
+            reader_guard guard(m_gate);
             return m_vector.begin();
         }
         /**
@@ -143,7 +143,7 @@ namespace concurrent
          */
         const_iterator begin() const
         {
-            __spinlock();
+            reader_guard guard(m_gate);
             return m_vector.begin();
         }
         /**
@@ -154,7 +154,7 @@ namespace concurrent
          */
         iterator end()
         {
-            __spinlock();
+            reader_guard guard(m_gate);
             return m_vector.end();
         }
         /**
@@ -165,7 +165,7 @@ namespace concurrent
          */
         const_iterator end() const
         {
-            __spinlock();
+            reader_guard guard(m_gate);
             return m_vector.end();
         }
 
@@ -177,7 +177,7 @@ namespace concurrent
          */
         const_iterator cbegin() const
         {
-            __spinlock();
+            reader_guard guard(m_gate);
             return m_vector.cbegin();
         }
         /**
@@ -188,7 +188,7 @@ namespace concurrent
          */
         const_iterator cend() const
         {
-            __spinlock();
+            reader_guard guard(m_gate);
             return m_vector.cend();
         }
 
@@ -198,7 +198,7 @@ namespace concurrent
          */
         size_t size() const
         {
-            __spinlock();
+            reader_guard guard(m_gate);
             return m_vector.size();
         }
         /**
@@ -219,7 +219,7 @@ namespace concurrent
          */
         size_t capacity() const
         {
-            __spinlock();
+            reader_guard guard(m_gate);
             return m_vector.capacity();
         }
 
@@ -229,7 +229,7 @@ namespace concurrent
          */
         bool empty() const
         {
-            __spinlock();
+            reader_guard guard(m_gate);
             return m_vector.empty();
         }
 
@@ -240,7 +240,7 @@ namespace concurrent
          */
         T& operator[](size_t index)
         {
-            __spinlock();
+            reader_guard guard(m_gate);
             return m_vector[index];
         }
         /**
@@ -250,7 +250,7 @@ namespace concurrent
          */
         const T& operator[](size_t index) const
         {
-            __spinlock();
+            reader_guard guard(m_gate);
             return m_vector[index];
         }
 
@@ -261,7 +261,7 @@ namespace concurrent
          */
         T& at(size_t index)
         {
-            __spinlock();
+            reader_guard guard(m_gate);
             return m_vector.at(index);
         }
         /**
@@ -271,7 +271,7 @@ namespace concurrent
          */
         const T& at(size_t index) const
         {
-            __spinlock();
+            reader_guard guard(m_gate);
             return m_vector.at(index);
         }
 
@@ -281,7 +281,7 @@ namespace concurrent
          */
         T& front()
         {
-            __spinlock();
+            reader_guard guard(m_gate);
             return m_vector.front();
         }
         /**
@@ -290,7 +290,7 @@ namespace concurrent
          */
         const T& front() const
         {
-            __spinlock();
+            reader_guard guard(m_gate);
             return m_vector.front();
         }
 
@@ -300,7 +300,7 @@ namespace concurrent
          */
         T& back()
         {
-            __spinlock();
+            reader_guard guard(m_gate);
             return m_vector.back();
         }
         /**
@@ -309,7 +309,7 @@ namespace concurrent
          */
         const T& back() const
         {
-            __spinlock();
+            reader_guard guard(m_gate);
             return m_vector.back();
         }
 
@@ -417,7 +417,7 @@ namespace concurrent
          */
         std::vector<T>& get()
         {
-            __spinlock();
+            reader_guard guard(m_gate);
             return m_vector;
         }
         /**
@@ -426,7 +426,7 @@ namespace concurrent
          */
         const std::vector<T>& get() const
         {
-            __spinlock();
+            reader_guard guard(m_gate);
             return m_vector;
         }
 
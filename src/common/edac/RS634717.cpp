@@ -17,7 +17,8 @@
 using namespace edac;
 
 #include <cassert>
-#include <vector>
+#include <cstring>
+#include <utility>
 
 // ---------------------------------------------------------------------------
 //  Constants
@@ -286,6 +287,86 @@ public:
 };
 RS6335 rs633529;     // 28 bit / 14 bit corrections max / 4 bytes total
 
+/**
+ * @brief GF(2^6) log/antilog tables for the zero-syndrome fast path.
+ */
+struct GF64Tables {
+    uint8_t exp[128U];
+    uint8_t log[64U];
+
+    GF64Tables()
+    {
+        // exp[] is doubled so log(a) + log(b) never needs a modulo
+        uint8_t x = 1U;
+        for (uint32_t i = 0U; i < 63U; i++) {
+            exp[i] = x;
+            exp[i + 63U] = x;
+            log[x] = (uint8_t)i;
+
+            x <<= 1;
+            if ((x & 0x40U) == 0x40U)
+                x ^= 0x43U;        // primitive polynomial : x ^ 6 + x + 1
+        }
+
+        exp[126U] = exp[0U];
+        exp[127U] = exp[1U];
+        log[0U] = 0U;              // log(0) is undefined; never used
+    }
+};
+static const GF64Tables gf64;
+
+// ---------------------------------------------------------------------------
+//  Global Functions
+// ---------------------------------------------------------------------------
+
+/**
+ * @brief Helper to determine whether all syndromes of a RS(63,k) codeword are zero.
+ *  (FCR = 1, PRIM = 1; leading zero symbols of shortened codes do not affect the syndromes
+ *  and are skipped.)
+ * @param codeword 63 symbol codeword.
+ * @param start First symbol that may be non-zero.
+ * @param nroots Number of parity symbols.
+ * @returns bool True, if all syndromes are zero, otherwise false.
+ */
+static bool rsSyndromesZero(const uint8_t* codeword, uint32_t start, uint32_t nroots)
+{
+    uint8_t syn[28U];
+    ::memset(syn, 0x00U, nroots);
+
+    // evaluate the codeword at each root of the generator polynomial (Horner's method)
+    for (uint32_t j = start; j < 63U; j++) {
+        uint8_t c = codeword[j];
+        for (uint32_t i = 0U; i < nroots; i++) {
+            uint8_t sy = syn[i];
+            syn[i] = (sy == 0U) ? c : (c ^ gf64.exp[gf64.log[sy] + i + 1U]);
+        }
+    }
+
+    uint8_t err = 0U;
+    for (uint32_t i = 0U; i < nroots; i++)
+        err |= syn[i];
+
+    return err == 0U;
+}
+
+/**
+ * @brief Helper to decode a RS(63,k) codeword held on the stack.
+ * @tparam RS Reed-Solomon codec type.
+ * @param rs Reed-Solomon codec.
+ * @param codeword 63 symbol codeword.
+ * @param start First symbol that may be non-zero.
+ * @returns int Number of symbols corrected, or -1 if the codeword is uncorrectable.
+ */
+template <typename RS>
+static int rsDecode(const RS& rs, uint8_t* codeword, uint32_t start)
+{
+    // the overwhelmingly common case is a clean codeword; avoid the full BM/Chien/Forney decode
+    if (rsSyndromesZero(codeword, start, RS::NROOTS))
+        return 0;
+
+    return rs.decode(std::pair<uint8_t*, uint8_t*>(codeword, codeword + 63U));
+}
+
 // ---------------------------------------------------------------------------
 //  Public Class Members
 // ---------------------------------------------------------------------------
@@ -304,19 +385,17 @@ bool RS634717::decode241213(uint8_t* data)
 {
     assert(data != nullptr);
 
-    std::vector<uint8_t> codeword(63, 0);
+    uint8_t codeword[63U];
+    ::memset(codeword, 0x00U, sizeof(codeword));
 
-    uint32_t offset = 0U;
-    for (uint32_t i = 0U; i < 24U; i++, offset += 6)
-        codeword[39 + i] = Utils::bin2Hex(data, offset);
+    Utils::bin2HexArray(data, codeword + 39U, 24U);
 
-    int ec = rs241213.decode(codeword);
+    int ec = rsDecode(rs241213, codeword, 39U);
 #if DEBUG_RS
     LogDebugEx(LOG_HOST, "RS634717::decode241213()", "errors = %d", ec);
 #endif
-    offset = 0U;
-    for (uint32_t i = 0U; i < 12U; i++, offset += 6)
-        Utils::hex2Bin(codeword[39 + i], data, offset);
+    if (ec > 0)
+        Utils::hex2BinArray(codeword + 39U, data, 12U);
 
     if ((ec == -1) || (ec > 6)) {
         return false;
@@ -331,21 +410,19 @@ void RS634717::encode241213(uint8_t* data)
 {
     assert(data != nullptr);
 
+    uint8_t hexbits[12U];
+    Utils::bin2HexArray(data, hexbits, 12U);
+
     uint8_t codeword[24U];
 
     for (uint32_t i = 0U; i < 24U; i++) {
         codeword[i] = 0x00U;
 
-        uint32_t offset = 0U;
-        for (uint32_t j = 0U; j < 12U; j++, offset += 6U) {
-            uint8_t hexbit = Utils::bin2Hex(data, offset);
-            codeword[i] ^= gf6Mult(hexbit, ENCODE_MATRIX[j][i]);
-        }
+        for (uint32_t j = 0U; j < 12U; j++)
+            codeword[i] ^= gf6Mult(hexbits[j], ENCODE_MATRIX[j][i]);
     }
 
-    uint32_t offset = 0U;
-    for (uint32_t i = 0U; i < 24U; i++, offset += 6U)
-        Utils::hex2Bin(codeword[i], data, offset);
+    Utils::hex2BinArray(codeword, data, 24U);
 }
 
 /* Decode RS (24,16,9) FEC. */
@@ -354,19 +431,17 @@ bool RS634717::decode24169(uint8_t* data)
 {
     assert(data != nullptr);
 
-    std::vector<uint8_t> codeword(63, 0);
+    uint8_t codeword[63U];
+    ::memset(codeword, 0x00U, sizeof(codeword));
 
-    uint32_t offset = 0U;
-    for (uint32_t i = 0U; i < 24U; i++, offset += 6)
-        codeword[39 + i] = Utils::bin2Hex(data, offset);
+    Utils::bin2HexArray(data, codeword + 39U, 24U);
 
-    int ec = rs24169.decode(codeword);
+    int ec = rsDecode(rs24169, codeword, 39U);
 #if DEBUG_RS
     LogDebugEx(LOG_HOST, "RS634717::decode24169()", "errors = %d", ec);
 #endif
-    offset = 0U;
-    for (uint32_t i = 0U; i < 16U; i++, offset += 6)
-        Utils::hex2Bin(codeword[39 + i], data, offset);
+    if (ec > 0)
+        Utils::hex2BinArray(codeword + 39U, data, 16U);
 
     if ((ec == -1) || (ec > 4)) {
         return false;
@@ -381,21 +456,19 @@ void RS634717::encode24169(uint8_t* data)
 {
     assert(data != nullptr);
 
+    uint8_t hexbits[16U];
+    Utils::bin2HexArray(data, hexbits, 16U);
+
     uint8_t codeword[24U];
 
     for (uint32_t i = 0U; i < 24U; i++) {
         codeword[i] = 0x00U;
 
-        uint32_t offset = 0U;
-        for (uint32_t j = 0U; j < 16U; j++, offset += 6U) {
-            uint8_t hexbit = Utils::bin2Hex(data, offset);
-            codeword[i] ^= gf6Mult(hexbit, ENCODE_MATRIX_24169[j][i]);
-        }
+        for (uint32_t j = 0U; j < 16U; j++)
+            codeword[i] ^= gf6Mult(hexbits[j], ENCODE_MATRIX_24169[j][i]);
     }
 
-    uint32_t offset = 0U;
-    for (uint32_t i = 0U; i < 24U; i++, offset += 6U)
-        Utils::hex2Bin(codeword[i], data, offset);
+    Utils::hex2BinArray(codeword, data, 24U);
 }
 
 /* Decode RS (36,20,17) FEC. */
@@ -404,19 +477,17 @@ bool RS634717::decode362017(uint8_t* data)
 {
     assert(data != nullptr);
 
-    std::vector<uint8_t> codeword(63, 0);
+    uint8_t codeword[63U];
+    ::memset(codeword, 0x00U, sizeof(codeword));
 
-    uint32_t offset = 0U;
-    for (uint32_t i = 0U; i < 36U; i++, offset += 6)
-        codeword[27 + i] = Utils::bin2Hex(data, offset);
+    Utils::bin2HexArray(data, codeword + 27U, 36U);
 
-    int ec = rs634717.decode(codeword);
+    int ec = rsDecode(rs634717, codeword, 27U);
 #if DEBUG_RS
     LogDebugEx(LOG_HOST, "RS634717::decode362017()", "errors = %d", ec);
 #endif
-    offset = 0U;
-    for (uint32_t i = 0U; i < 20U; i++, offset += 6)
-        Utils::hex2Bin(codeword[27 + i], data, offset);
+    if (ec > 0)
+        Utils::hex2BinArray(codeword + 27U, data, 20U);
 
     if ((ec == -1) || (ec > 8)) {
         return false;
@@ -431,21 +502,19 @@ void RS634717::encode362017(uint8_t* data)
 {
     assert(data != nullptr);
 
+    uint8_t hexbits[20U];
+    Utils::bin2HexArray(data, hexbits, 20U);
+
     uint8_t codeword[36U];
 
     for (uint32_t i = 0U; i < 36U; i++) {
         codeword[i] = 0x00U;
 
-        uint32_t offset = 0U;
-        for (uint32_t j = 0U; j < 20U; j++, offset += 6U) {
-            uint8_t hexbit = Utils::bin2Hex(data, offset);
-            codeword[i] ^= gf6Mult(hexbit, ENCODE_MATRIX_362017[j][i]);
-        }
+        for (uint32_t j = 0U; j < 20U; j++)
+            codeword[i] ^= gf6Mult(hexbits[j], ENCODE_MATRIX_362017[j][i]);
     }
 
-    uint32_t offset = 0U;
-    for (uint32_t i = 0U; i < 36U; i++, offset += 6U)
-        Utils::hex2Bin(codeword[i], data, offset);
+    Utils::hex2BinArray(codeword, data, 36U);
 }
 
 /* Decode RS (52,30,23) FEC. */
@@ -454,20 +523,18 @@ bool RS634717::decode523023(uint8_t* data)
 {
     assert(data != nullptr);
 
-    std::vector<uint8_t> codeword(63, 0);
+    uint8_t codeword[63U];
+    ::memset(codeword, 0x00U, sizeof(codeword));
 
-    uint32_t offset = 0U;
-    for (uint32_t i = 0U; i < 52U; i++, offset += 6)
-        codeword[11 + i] = Utils::bin2Hex(data, offset);
+    Utils::bin2HexArray(data, codeword + 11U, 52U);
 
-    int ec = rs633529.decode(codeword);
+    int ec = rsDecode(rs633529, codeword, 11U);
 #if DEBUG_RS
     LogDebugEx(LOG_HOST, "RS634717::decode523023()", "errors = %d\n", ec);
 #endif
 
-    offset = 0U;
-    for (uint32_t i = 0U; i < 30U; i++, offset += 6)
-        Utils::hex2Bin(codeword[11 + i], data, offset);
+    if (ec > 0)
+        Utils::hex2BinArray(codeword + 11U, data, 30U);
 
     if ((ec == -1) || (ec >= 11)) {
         return false;
@@ -482,21 +549,19 @@ void RS634717::encode523023(uint8_t* data)
 {
     assert(data != nullptr);
 
+    uint8_t hexbits[30U];
+    Utils::bin2HexArray(data, hexbits, 30U);
+
     uint8_t codeword[52U];
 
     for (uint32_t i = 0U; i < 52U; i++) {
         codeword[i] = 0x00U;
 
-        uint32_t offset = 0U;
-        for (uint32_t j = 0U; j < 30U; j++, offset += 6U) {
-            uint8_t hexbit = Utils::bin2Hex(data, offset);
-            codeword[i] ^= gf6Mult(hexbit, ENCODE_MATRIX_523023[j][i]);
-        }
+        for (uint32_t j = 0U; j < 30U; j++)
+            codeword[i] ^= gf6Mult(hexbits[j], ENCODE_MATRIX_523023[j][i]);
     }
 
-    uint32_t offset = 0U;
-    for (uint32_t i = 0U; i < 52U; i++, offset += 6U)
-        Utils::hex2Bin(codeword[i], data, offset);
+    Utils::hex2BinArray(codeword, data, 52U);
 }
 
 /* Decode RS (46,26,21) FEC. */
@@ -505,23 +570,19 @@ bool RS634717::decode462621(uint8_t* data)
 {
     assert(data != nullptr);
 
-    std::vector<uint8_t> codeword(63, 0);
+    uint8_t codeword[63U];
+    ::memset(codeword, 0x00U, sizeof(codeword));
 
     // RS(46,26,21) from RS(63,35,29): S=9 shortening, U=8 puncturing
     // Layout: [9 zeros | 26 data | 20 parity | 8 zeros]
-    uint32_t offset = 0U;
-    for (uint32_t i = 0U; i < 26U; i++, offset += 6)
-        codeword[9 + i] = Utils::bin2Hex(data, offset);  // Data at positions 9-34
-    for (uint32_t i = 0U; i < 20U; i++, offset += 6)
-        codeword[35 + i] = Utils::bin2Hex(data, offset); // Parity at positions 35-54 (8 zeros at 55-62)
+    Utils::bin2HexArray(data, codeword + 9U, 46U); // Data at positions 9-34, parity at positions 35-54 (8 zeros at 55-62)
 
-    int ec = rs633529.decode(codeword);
+    int ec = rsDecode(rs633529, codeword, 9U);
 #if DEBUG_RS
     LogDebugEx(LOG_HOST, "RS634717::decode462621()", "errors = %d\n", ec);
 #endif
-    offset = 0U;
-    for (uint32_t i = 0U; i < 26U; i++, offset += 6)
-        Utils::hex2Bin(codeword[9 + i], data, offset);
+    if (ec > 0)
+        Utils::hex2BinArray(codeword + 9U, data, 26U);
 
     if ((ec == -1) || (ec > 10)) {
         return false;
@@ -536,21 +597,19 @@ void RS634717::encode462621(uint8_t* data)
 {
     assert(data != nullptr);
 
+    uint8_t hexbits[26U];
+    Utils::bin2HexArray(data, hexbits, 26U);
+
     uint8_t codeword[46U];
 
     for (uint32_t i = 0U; i < 46U; i++) {
         codeword[i] = 0x00U;
 
-        uint32_t offset = 0U;
-        for (uint32_t j = 0U; j < 26U; j++, offset += 6U) {
-            uint8_t hexbit = Utils::bin2Hex(data, offset);
-            codeword[i] ^= gf6Mult(hexbit, ENCODE_MATRIX_462621[j][i]);
-        }
+        for (uint32_t j = 0U; j < 26U; j++)
+            codeword[i] ^= gf6Mult(hexbits[j], ENCODE_MATRIX_462621[j][i]);
     }
 
-    uint32_t offset = 0U;
-    for (uint32_t i = 0U; i < 46U; i++, offset += 6U)
-        Utils::hex2Bin(codeword[i], data, offset);
+    Utils::hex2BinArray(codeword, data, 46U);
 }
 
 /* Decode RS (45,26,20) FEC. */
@@ -559,23 +618,19 @@ bool RS634717::decode452620(uint8_t* data)
 {
     assert(data != nullptr);
 
-    std::vector<uint8_t> codeword(63, 0);
+    uint8_t codeword[63U];
+    ::memset(codeword, 0x00U, sizeof(codeword));
 
     // RS(45,26,20) from RS(63,35,29): S=9 shortening, U=9 puncturing
     // Layout: [9 zeros | 26 data | 19 parity | 9 zeros]
-    uint32_t offset = 0U;
-    for (uint32_t i = 0U; i < 26U; i++, offset += 6)
-        codeword[9 + i] = Utils::bin2Hex(data, offset);  // Data at positions 9-34
-    for (uint32_t i = 0U; i < 19U; i++, offset += 6)
-        codeword[35 + i] = Utils::bin2Hex(data, offset); // Parity at positions 35-53 (9 zeros at 54-62)
+    Utils::bin2HexArray(data, codeword + 9U, 45U); // Data at positions 9-34, parity at positions 35-53 (9 zeros at 54-62)
 
-    int ec = rs633529.decode(codeword);
+    int ec = rsDecode(rs633529, codeword, 9U);
 #if DEBUG_RS
     LogDebugEx(LOG_HOST, "RS634717::decode452620()", "errors = %d\n", ec);
 #endif
-    offset = 0U;
-    for (uint32_t i = 0U; i < 26U; i++, offset += 6)
-        Utils::hex2Bin(codeword[9 + i], data, offset);
+    if (ec > 0)
+        Utils::hex2BinArray(codeword + 9U, data, 26U);
 
     if ((ec == -1) || (ec > 9)) {
         return false;
@@ -590,21 +645,19 @@ void RS634717::encode452620(uint8_t* data)
 {
     assert(data != nullptr);
 
+    uint8_t hexbits[26U];
+    Utils::bin2HexArray(data, hexbits, 26U);
+
     uint8_t codeword[45U];
 
     for (uint32_t i = 0U; i < 45U; i++) {
         codeword[i] = 0x00U;
 
-        uint32_t offset = 0U;
-        for (uint32_t j = 0U; j < 26U; j++, offset += 6U) {
-            uint8_t hexbit = Utils::bin2Hex(data, offset);
-            codeword[i] ^= gf6Mult(hexbit, ENCODE_MATRIX_452620[j][i]);
-        }
+        for (uint32_t j = 0U; j < 26U; j++)
+            codeword[i] ^= gf6Mult(hexbits[j], ENCODE_MATRIX_452620[j][i]);
     }
 
-    uint32_t offset = 0U;
-    for (uint32_t i = 0U; i < 45U; i++, offset += 6U)
-        Utils::hex2Bin(codeword[i], data, offset);
+    Utils::hex2BinArray(codeword, data, 45U);
 }
 
 /* Decode RS (44,16,29) FEC. */
@@ -613,23 +666,19 @@ bool RS634717::decode441629(uint8_t* data)
 {
     assert(data != nullptr);
 
-    std::vector<uint8_t> codeword(63, 0);
+    uint8_t codeword[63U];
+    ::memset(codeword, 0x00U, sizeof(codeword));
 
     // RS(44,16,29) from RS(63,35,29): S=19 shortening, U=0 puncturing (no puncturing!)
     // Layout: [19 zeros | 16 data | 28 parity]
-    uint32_t offset = 0U;
-    for (uint32_t i = 0U; i < 16U; i++, offset += 6)
-        codeword[19 + i] = Utils::bin2Hex(data, offset);  // Data at positions 19-34
-    for (uint32_t i = 0U; i < 28U; i++, offset += 6)
-        codeword[35 + i] = Utils::bin2Hex(data, offset); // Parity at positions 35-62 (no puncturing)
+    Utils::bin2HexArray(data, codeword + 19U, 44U); // Data at positions 19-34, parity at positions 35-62 (no puncturing)
 
-    int ec = rs633529.decode(codeword);
+    int ec = rsDecode(rs633529, codeword, 19U);
 #if DEBUG_RS
     LogDebugEx(LOG_HOST, "RS634717::decode441629()", "errors = %d\n", ec);
 #endif
-    offset = 0U;
-    for (uint32_t i = 0U; i < 16U; i++, offset += 6)
-        Utils::hex2Bin(codeword[19 + i], data, offset);
+    if (ec > 0)
+        Utils::hex2BinArray(codeword + 19U, data, 16U);
 
     if ((ec == -1) || (ec > 14)) {
         return false;
@@ -644,21 +693,19 @@ void RS634717::encode441629(uint8_t* data)
 {
     assert(data != nullptr);
 
+    uint8_t hexbits[16U];
+    Utils::bin2HexArray(data, hexbits, 16U);
+
     uint8_t codeword[44U];
 
     for (uint32_t i = 0U; i < 44U; i++) {
         codeword[i] = 0x00U;
 
-        uint32_t offset = 0U;
-        for (uint32_t j = 0U; j < 16U; j++, offset += 6U) {
-            uint8_t hexbit = Utils::bin2Hex(data, offset);
-            codeword[i] ^= gf6Mult(hexbit, ENCODE_MATRIX_441629[j][i]);
-        }
+        for (uint32_t j = 0U; j < 16U; j++)
+            codeword[i] ^= gf6Mult(hexbits[j], ENCODE_MATRIX_441629[j][i]);
     }
 
-    uint32_t offset = 0U;
-    for (uint32_t i = 0U; i < 44U; i++, offset += 6U)
-        Utils::hex2Bin(codeword[i], data, offset);
+    Utils::hex2BinArray(codeword, data, 44U);
 }
 
 // ---------------------------------------------------------------------------
@@ -669,19 +716,10 @@ void RS634717::encode441629(uint8_t* data)
 
 uint8_t RS634717::gf6Mult(uint8_t a, uint8_t b) const
 {
-    uint8_t p = 0x00U;
-
-    for (uint32_t i = 0U; i < 6U; i++) {
-        if ((b & 0x01U) == 0x01U)
-            p ^= a;
-
-        a <<= 1;
-
-        if ((a & 0x40U) == 0x40U)
-            a ^= 0x43U;            // primitive polynomial : x ^ 6 + x + 1
-
-        b >>= 1;
-    }
+    a &= 0x3FU;
+    b &= 0x3FU;
+    if (a == 0U || b == 0U)
+        return 0x00U;
 
-    return p;
+    return gf64.exp[gf64.log[a] + gf64.log[b]];
 }
@@ -16,6 +16,15 @@ using namespace edac;
 #include <cstring>
 #include <cassert>
 
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define SHA256_HW_X86 1
+#include <cpuid.h>
+#include <immintrin.h>
+#elif defined(__aarch64__) && (defined(__ARM_FEATURE_SHA2) || defined(__ARM_FEATURE_CRYPTO))
+#define SHA256_HW_ARM 1
+#include <arm_neon.h>
+#endif
+
 // ---------------------------------------------------------------------------
 //  Macros
 // ---------------------------------------------------------------------------
@@ -69,6 +78,12 @@ static const uint32_t roundConstants[64] = {
     0x90befffaUL, 0xa4506cebUL, 0xbef9a3f7UL, 0xc67178f2UL,
 };
 
+// ---------------------------------------------------------------------------
+//  Static Class Members
+// ---------------------------------------------------------------------------
+
+bool SHA256::s_useHardware = SHA256::isHardwareSupported();
+
 // ---------------------------------------------------------------------------
 //  Global Functions
 // ---------------------------------------------------------------------------
@@ -84,6 +99,96 @@ static inline void set_uint32(uint8_t* cp, uint32_t v)
     ::memcpy(cp, &v, sizeof v);
 }
 
+#if defined(SHA256_HW_X86)
+/* Helper to process 64 byte blocks using the x86 SHA extensions. */
+
+__attribute__((target("sha,sse4.1")))
+static void processBlocksX86(uint32_t* state, const uint8_t* data, uint32_t blocks)
+{
+    const __m128i mask = _mm_set_epi64x(0x0c0d0e0f08090a0bULL, 0x0405060700010203ULL);
+
+    // the SHA instructions operate on the state as ABEF and CDGH
+    __m128i tmp = _mm_loadu_si128((const __m128i*)&state[0]);                   // DCBA
+    __m128i state1 = _mm_loadu_si128((const __m128i*)&state[4]);                // HGFE
+    tmp = _mm_shuffle_epi32(tmp, 0xB1);                                         // CDAB
+    state1 = _mm_shuffle_epi32(state1, 0x1B);                                   // EFGH
+    __m128i state0 = _mm_alignr_epi8(tmp, state1, 8);                           // ABEF
+    state1 = _mm_blend_epi16(state1, tmp, 0xF0);                                // CDGH
+
+    while (blocks-- > 0U) {
+        __m128i abefSave = state0;
+        __m128i cdghSave = state1;
+
+        __m128i w[4];
+        for (uint32_t i = 0U; i < 4U; i++)
+            w[i] = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i*)(data + (i * 16U))), mask);
+
+        // 16 groups of 4 rounds; the message schedule is extended 4 words at a time
+        for (uint32_t j = 0U; j < 16U; j++) {
+            if (j >= 4U) {
+                __m128i t = _mm_sha256msg1_epu32(w[j & 3U], w[(j + 1U) & 3U]);
+                t = _mm_add_epi32(t, _mm_alignr_epi8(w[(j + 3U) & 3U], w[(j + 2U) & 3U], 4));
+                w[j & 3U] = _mm_sha256msg2_epu32(t, w[(j + 3U) & 3U]);
+            }
+
+            __m128i msg = _mm_add_epi32(w[j & 3U], _mm_loadu_si128((const __m128i*)&roundConstants[j * 4U]));
+            state1 = _mm_sha256rnds2_epu32(state1, state0, msg);
+            msg = _mm_shuffle_epi32(msg, 0x0E);
+            state0 = _mm_sha256rnds2_epu32(state0, state1, msg);
+        }
+
+        state0 = _mm_add_epi32(state0, abefSave);
+        state1 = _mm_add_epi32(state1, cdghSave);
+        data += 64U;
+    }
+
+    tmp = _mm_shuffle_epi32(state0, 0x1B);                                      // FEBA
+    state1 = _mm_shuffle_epi32(state1, 0xB1);                                   // DCHG
+    state0 = _mm_blend_epi16(tmp, state1, 0xF0);                                // DCBA
+    state1 = _mm_alignr_epi8(state1, tmp, 8);                                   // HGFE
+
+    _mm_storeu_si128((__m128i*)&state[0], state0);
+    _mm_storeu_si128((__m128i*)&state[4], state1);
+}
+#endif // defined(SHA256_HW_X86)
+
+#if defined(SHA256_HW_ARM)
+/* Helper to process 64 byte blocks using the ARMv8 cryptographic extensions. */
+
+static void processBlocksARM(uint32_t* state, const uint8_t* data, uint32_t blocks)
+{
+    uint32x4_t state0 = vld1q_u32(&state[0]);                                   // ABCD
+    uint32x4_t state1 = vld1q_u32(&state[4]);                                   // EFGH
+
+    while (blocks-- > 0U) {
+        uint32x4_t abcdSave = state0;
+        uint32x4_t efghSave = state1;
+
+        uint32x4_t w[4];
+        for (uint32_t i = 0U; i < 4U; i++)
+            w[i] = vreinterpretq_u32_u8(vrev32q_u8(vld1q_u8(data + (i * 16U))));
+
+        // 16 groups of 4 rounds; the message schedule is extended 4 words at a time
+        for (uint32_t j = 0U; j < 16U; j++) {
+            if (j >= 4U)
+                w[j & 3U] = vsha256su1q_u32(vsha256su0q_u32(w[j & 3U], w[(j + 1U) & 3U]), w[(j + 2U) & 3U], w[(j + 3U) & 3U]);
+
+            uint32x4_t msg = vaddq_u32(w[j & 3U], vld1q_u32(&roundConstants[j * 4U]));
+            uint32x4_t tmp = state0;
+            state0 = vsha256hq_u32(state0, state1, msg);
+            state1 = vsha256h2q_u32(state1, tmp, msg);
+        }
+
+        state0 = vaddq_u32(state0, abcdSave);
+        state1 = vaddq_u32(state1, efghSave);
+        data += 64U;
+    }
+
+    vst1q_u32(&state[0], state0);
+    vst1q_u32(&state[4], state1);
+}
+#endif // defined(SHA256_HW_ARM)
+
 // ---------------------------------------------------------------------------
 //  Public Class Members
 // ---------------------------------------------------------------------------
@@ -145,6 +250,18 @@ void SHA256::processBlock(const uint8_t* buffer, uint32_t len)
     if (m_total[0] < len)
         ++m_total[1];
 
+#if defined(SHA256_HW_X86)
+    if (s_useHardware) {
+        processBlocksX86(m_state, buffer, len / 64U);
+        return;
+    }
+#elif defined(SHA256_HW_ARM)
+    if (s_useHardware) {
+        processBlocksARM(m_state, buffer, len / 64U);
+        return;
+    }
+#endif
+
 #define rol(x, n) (((x) << (n)) | ((x) >> (32 - (n))))
 #define S0(x) (rol(x, 25) ^ rol(x, 14) ^ (x >> 3))
 #define S1(x) (rol(x, 15) ^ rol(x, 13) ^ (x >> 10))
@@ -243,6 +360,31 @@ void SHA256::processBlock(const uint8_t* buffer, uint32_t len)
     }
 }
 
+/* Flag indicating whether or not the CPU supports the SHA-256 instruction set extensions. */
+
+bool SHA256::isHardwareSupported()
+{
+#if defined(SHA256_HW_X86)
+    uint32_t eax = 0U, ebx = 0U, ecx = 0U, edx = 0U;
+    if (__get_cpuid(1U, &eax, &ebx, &ecx, &edx) == 0 || (ecx & bit_SSE4_1) == 0U)
+        return false;
+    if (__get_cpuid_count(7U, 0U, &eax, &ebx, &ecx, &edx) == 0)
+        return false;
+    return (ebx & (1U << 29)) != 0U; // SHA
+#elif defined(SHA256_HW_ARM)
+    return true; // the compiler was told the target has the extensions
+#else
+    return false;
+#endif
+}
+
+/* Sets whether or not the SHA-256 instruction set extensions are used (when supported by the CPU). */
+
+void SHA256::setHardwareAcceleration(bool enable)
+{
+    s_useHardware = enable && isHardwareSupported();
+}
+
 /* Starting with the result of former calls of this function (or the initialization function update 
    the context for the next LEN bytes starting at BUFFER. It is NOT required that LEN is a multiple of
    64. */
@@ -343,6 +485,46 @@ uint8_t* SHA256::buffer(const uint8_t* buffer, uint32_t len, uint8_t* resblock)
     return finish(resblock);
 }
 
+/* Compute the HMAC-SHA256 (RFC 2104) message authentication code for the length bytes beginning at buffer. */
+
+uint8_t* SHA256::hmac(const uint8_t* key, uint32_t keyLen, const uint8_t* buffer, uint32_t len, uint8_t* resblock)
+{
+    assert(key != nullptr || keyLen == 0U);
+    assert(buffer != nullptr || len == 0U);
+    assert(resblock != nullptr);
+
+    const uint32_t BLOCK_SIZE = 64U;
+
+    // keys longer than the block size are hashed first
+    uint8_t k[BLOCK_SIZE];
+    ::memset(k, 0x00U, BLOCK_SIZE);
+    if (keyLen > BLOCK_SIZE) {
+        SHA256 sha256;
+        sha256.buffer(key, keyLen, k);
+    } else if (keyLen > 0U) {
+        ::memcpy(k, key, keyLen);
+    }
+
+    uint8_t pad[BLOCK_SIZE];
+    for (uint32_t i = 0U; i < BLOCK_SIZE; i++)
+        pad[i] = k[i] ^ 0x36U;
+
+    uint8_t inner[SHA256_DIGEST_SIZE];
+    SHA256 innerHash;
+    innerHash.processBytes(pad, BLOCK_SIZE);
+    if (len > 0U)
+        innerHash.processBytes(buffer, len);
+    innerHash.finish(inner);
+
+    for (uint32_t i = 0U; i < BLOCK_SIZE; i++)
+        pad[i] = k[i] ^ 0x5CU;
+
+    SHA256 outerHash;
+    outerHash.processBytes(pad, BLOCK_SIZE);
+    outerHash.processBytes(inner, SHA256_DIGEST_SIZE);
+    return outerHash.finish(resblock);
+}
+
 // ---------------------------------------------------------------------------
 //  Private Class Members
 // ---------------------------------------------------------------------------
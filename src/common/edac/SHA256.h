@@ -105,7 +105,38 @@ namespace edac
          */
         uint8_t* buffer(const uint8_t* buffer, uint32_t len, uint8_t* resblock);
 
+        /**
+         * @brief Compute the HMAC-SHA256 (RFC 2104) message authentication code for the length bytes
+         *  beginning at buffer.
+         * @param[in] key Key.
+         * @param keyLen Length of key.
+         * @param[in] buffer Buffer to authenticate.
+         * @param len Length of buffer.
+         * @param[out] resblock Resulting HMAC-SHA256 (SHA256_DIGEST_SIZE bytes).
+         */
+        static uint8_t* hmac(const uint8_t* key, uint32_t keyLen, const uint8_t* buffer, uint32_t len, uint8_t* resblock);
+
+        /**
+         * @brief Flag indicating whether or not the CPU supports the SHA-256 instruction set extensions
+         *  (x86 SHA extensions, or the ARMv8 cryptographic extensions when the build targets them).
+         * @returns bool True, if the SHA-256 instruction set extensions are supported, otherwise false.
+         */
+        static bool isHardwareSupported();
+        /**
+         * @brief Flag indicating whether or not the SHA-256 instruction set extensions are in use.
+         * @returns bool True, if the SHA-256 instruction set extensions are in use, otherwise false.
+         */
+        static bool isHardwareAccelerated() { return s_useHardware; }
+        /**
+         * @brief Sets whether or not the SHA-256 instruction set extensions are used (when supported
+         *  by the CPU). They are used by default when supported.
+         * @param enable Flag indicating whether or not to use the SHA-256 instruction set extensions.
+         */
+        static void setHardwareAcceleration(bool enable);
+
     private:
+        static bool s_useHardware;
+
         uint32_t* m_state;
         uint32_t* m_total;
         uint32_t m_buflen;
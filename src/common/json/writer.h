@@ -0,0 +1,339 @@
+// SPDX-License-Identifier: GPL-2.0-only
+/*
+ * Digital Voice Modem - Common Library
+ * GPLv2 Open Source. Use is subject to license terms.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ *  Copyright (C) 2025 Bryan Biedenkapp, N2PLL
+ *
+ */
+/**
+ * @file writer.h
+ * @ingroup common
+ */
+#if !defined(__JSON_WRITER_H__)
+#define __JSON_WRITER_H__
+
+#include "common/Defines.h"
+#include "common/json/json.h"
+
+#include <cstring>
+#include <string>
+#include <vector>
+
+namespace json
+{
+    // ---------------------------------------------------------------------------
+    //  Class Declaration
+    // ---------------------------------------------------------------------------
+
+    /**
+     * @brief Implements a forward-only streaming JSON writer.
+     *
+     *  Unlike building a json::object/json::array DOM and serializing it, the writer appends
+     *  JSON text directly into a single contiguous buffer as values are written; no intermediate
+     *  tree nodes are allocated. This is intended for large REST responses (lookup table and
+     *  affiliation dumps, etc.) where building a DOM would allocate for every node.
+     *
+     *  Existing json::value/json::object/json::array instances can be written inline, which
+     *  allows incremental porting of code that produces DOM fragments.
+     * @ingroup common
+     */
+    class writer {
+    public:
+        /**
+         * @brief Initializes a new instance of the writer class.
+         * @param reserve Initial number of bytes to reserve in the output buffer.
+         */
+        writer(size_t reserve = 0U) :
+            buf_(),
+            first_(),
+            afterKey_(false)
+        {
+            if (reserve > 0U)
+                buf_.reserve(reserve);
+            first_.reserve(8U);
+        }
+
+        /**
+         * @brief Begins a JSON object.
+         * @returns writer& Reference to this writer.
+         */
+        writer& beginObject() { prefix(); buf_.push_back('{'); first_.push_back(true); return *this; }
+        /**
+         * @brief Ends the current JSON object.
+         * @returns writer& Reference to this writer.
+         */
+        writer& endObject() { buf_.push_back('}'); pop(); return *this; }
+        /**
+         * @brief Begins a JSON array.
+         * @returns writer& Reference to this writer.
+         */
+        writer& beginArray() { prefix(); buf_.push_back('['); first_.push_back(true); return *this; }
+        /**
+         * @brief Ends the current JSON array.
+         * @returns writer& Reference to this writer.
+         */
+        writer& endArray() { buf_.push_back(']'); pop(); return *this; }
+
+        /**
+         * @brief Writes a JSON object key. The next write will be the value for this key.
+         * @param k Key name.
+         * @param len Length of key name.
+         * @returns writer& Reference to this writer.
+         */
+        writer& key(const char* k, size_t len)
+        {
+            prefix();
+            writeString(k, len);
+            buf_.push_back(':');
+            afterKey_ = true;
+            return *this;
+        }
+        /**
+         * @brief Writes a JSON object key. The next write will be the value for this key.
+         * @param k Key name.
+         * @returns writer& Reference to this writer.
+         */
+        writer& key(const char* k) { return key(k, ::strlen(k)); }
+        /**
+         * @brief Writes a JSON object key. The next write will be the value for this key.
+         * @param k Key name.
+         * @returns writer& Reference to this writer.
+         */
+        writer& key(const std::string& k) { return key(k.c_str(), k.size()); }
+
+        /**
+         * @brief Writes a JSON null.
+         * @returns writer& Reference to this writer.
+         */
+        writer& writeNull() { prefix(); buf_.append("null", 4U); return *this; }
+        /**
+         * @brief Writes a JSON boolean.
+         * @param b Value.
+         * @returns writer& Reference to this writer.
+         */
+        writer& write(bool b)
+        {
+            prefix();
+            if (b)
+                buf_.append("true", 4U);
+            else
+                buf_.append("false", 5U);
+            return *this;
+        }
+        /**
+         * @brief Writes a JSON number from a signed 32-bit integer.
+         * @param n Value.
+         * @returns writer& Reference to this writer.
+         */
+        writer& write(int n)
+        {
+            prefix();
+            if (n < 0) {
+                buf_.push_back('-');
+                writeUnsigned((uint64_t)(-(int64_t)n));
+            }
+            else {
+                writeUnsigned((uint64_t)n);
+            }
+            return *this;
+        }
+        /**
+         * @brief Writes a JSON number from a unsigned 32-bit integer.
+         * @param n Value.
+         * @returns writer& Reference to this writer.
+         */
+        writer& write(uint32_t n) { prefix(); writeUnsigned(n); return *this; }
+        /**
+         * @brief Writes a JSON number from a unsigned 64-bit integer.
+         * @param n Value.
+         * @returns writer& Reference to this writer.
+         */
+        writer& write(uint64_t n) { prefix(); writeUnsigned(n); return *this; }
+        /**
+         * @brief Writes a JSON number from a double.
+         * @param n Value.
+         * @returns writer& Reference to this writer.
+         */
+        writer& write(double n) { return write(json::value(n)); }
+        /**
+         * @brief Writes a JSON string.
+         * @param s String.
+         * @returns writer& Reference to this writer.
+         */
+        writer& write(const char* s) { prefix(); writeString(s, ::strlen(s)); return *this; }
+        /**
+         * @brief Writes a JSON string.
+         * @param s String.
+         * @returns writer& Reference to this writer.
+         */
+        writer& write(const std::string& s) { prefix(); writeString(s.c_str(), s.size()); return *this; }
+        /**
+         * @brief Writes an existing JSON value (of any type) inline.
+         * @param v JSON value.
+         * @returns writer& Reference to this writer.
+         */
+        writer& write(const json::value& v)
+        {
+            prefix();
+            v.serialize(std::back_inserter(buf_));
+            return *this;
+        }
+        /**
+         * @brief Writes an existing JSON object inline.
+         * @param o JSON object.
+         * @returns writer& Reference to this writer.
+         */
+        writer& write(const json::object& o)
+        {
+            beginObject();
+            for (auto& entry : o) {
+                key(entry.first);
+                write(entry.second);
+            }
+            return endObject();
+        }
+        /**
+         * @brief Writes an existing JSON array inline.
+         * @param a JSON array.
+         * @returns writer& Reference to this writer.
+         */
+        writer& write(const json::array& a)
+        {
+            beginArray();
+            for (auto& entry : a)
+                write(entry);
+            return endArray();
+        }
+
+        /**
+         * @brief Helper to write a key and value pair.
+         * @tparam T Value type.
+         * @param k Key name.
+         * @param v Value.
+         * @returns writer& Reference to this writer.
+         */
+        template <typename T>
+        writer& member(const char* k, const T& v) { key(k); return write(v); }
+
+        /**
+         * @brief Returns the number of bytes currently written.
+         * @returns size_t Number of bytes written.
+         */
+        size_t size() const { return buf_.size(); }
+        /**
+         * @brief Returns the written JSON text.
+         * @returns const std::string& Written JSON text.
+         */
+        const std::string& str() const { return buf_; }
+        /**
+         * @brief Swaps the written JSON text into the given string, without copying. After this
+         *  call the writer is reset and may be reused.
+         * @param out String to receive the written JSON text.
+         */
+        void swap(std::string& out)
+        {
+            out.swap(buf_);
+            buf_.clear();
+            first_.clear();
+            afterKey_ = false;
+        }
+
+    private:
+        std::string buf_;
+        std::vector<bool> first_;
+        bool afterKey_;
+
+        /**
+         * @brief Internal helper to emit a value separator, if required.
+         */
+        void prefix()
+        {
+            if (afterKey_) {
+                afterKey_ = false;
+                return;
+            }
+
+            if (!first_.empty()) {
+                if (!first_.back())
+                    buf_.push_back(',');
+                first_.back() = false;
+            }
+        }
+
+        /**
+         * @brief Internal helper to pop the current container.
+         */
+        void pop()
+        {
+            if (!first_.empty())
+                first_.pop_back();
+        }
+
+        /**
+         * @brief Internal helper to write a unsigned integer.
+         * @param n Value.
+         */
+        void writeUnsigned(uint64_t n)
+        {
+            char tmp[20U];
+            size_t len = 0U;
+            do {
+                tmp[len++] = (char)('0' + (n % 10U));
+                n /= 10U;
+            } while (n > 0U);
+
+            while (len > 0U)
+                buf_.push_back(tmp[--len]);
+        }
+
+        /**
+         * @brief Internal helper to write a escaped JSON string.
+         * @param s String.
+         * @param len Length of string.
+         */
+        void writeString(const char* s, size_t len)
+        {
+            buf_.push_back('"');
+
+            // copy runs of characters that do not require escaping in a single append
+            size_t run = 0U;
+            for (size_t i = 0U; i < len; i++) {
+                char c = s[i];
+                const char* esc = nullptr;
+                switch (c) {
+                case '"':   esc = "\\\""; break;
+                case '\\':  esc = "\\\\"; break;
+                case '/':   esc = "\\/"; break;
+                case '\b':  esc = "\\b"; break;
+                case '\f':  esc = "\\f"; break;
+                case '\n':  esc = "\\n"; break;
+                case '\r':  esc = "\\r"; break;
+                case '\t':  esc = "\\t"; break;
+                default:
+                    if (static_cast<unsigned char>(c) >= 0x20 && c != 0x7f)
+                        continue;
+                    break;
+                }
+
+                buf_.append(s + run, i - run);
+                run = i + 1U;
+
+                if (esc != nullptr) {
+                    buf_.append(esc);
+                }
+                else {
+                    char hex[7U];
+                    SNPRINTF(hex, sizeof(hex), "\\u%04x", c & 0xff);
+                    buf_.append(hex, 6U);
+                }
+            }
+
+            buf_.append(s + run, len - run);
+            buf_.push_back('"');
+        }
+    };
+} // namespace json
+
+#endif // __JSON_WRITER_H__
@@ -22,7 +22,7 @@ using namespace lookups;
 // ---------------------------------------------------------------------------
 
 std::mutex AdjSiteMapLookup::s_mutex;
-bool AdjSiteMapLookup::s_locked = false;
+concurrent::reader_gate AdjSiteMapLookup::s_gate;
 
 // ---------------------------------------------------------------------------
 //  Macros
@@ -31,17 +31,13 @@ bool AdjSiteMapLookup::s_locked = false;
 // Lock the table.
 #define __LOCK_TABLE()                          \
     std::lock_guard<std::mutex> lock(s_mutex);  \
-    s_locked = true;
+    s_gate.close();
 
 // Unlock the table.
-#define __UNLOCK_TABLE() s_locked = false;
+#define __UNLOCK_TABLE() s_gate.open();
 
-// Spinlock wait for table to be read unlocked.
-#define __SPINLOCK()                            \
-    if (s_locked) {                             \
-        while (s_locked)                        \
-            Thread::sleep(2U);                  \
-    }
+// Wait for table to be read unlocked.
+#define __SPINLOCK() s_gate.wait();
 
 // ---------------------------------------------------------------------------
 //  Public Class Members
@@ -226,7 +222,7 @@ bool AdjSiteMapLookup::load()
 
     if (peerList.size() == 0U) {
         ::LogError(LOG_HOST, "No adj site map peer list defined!");
-        s_locked = false;
+        __UNLOCK_TABLE();
         return false;
     }
 
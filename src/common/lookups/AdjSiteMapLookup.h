@@ -21,6 +21,7 @@
 #define __ADJ_SITE_MAP_LOOKUP_H__
 
 #include "common/Defines.h"
+#include "common/concurrent/reader_gate.h"
 #include "common/lookups/LookupTable.h"
 #include "common/yaml/Yaml.h"
 #include "common/Utils.h"
@@ -242,7 +243,7 @@ namespace lookups
         bool m_stop;
 
         static std::mutex s_mutex;  //!< Mutex used for change locking.
-        static bool s_locked;       //!< Flag used for read locking (prevents find lookups), should be used when atomic operations (add/erase/etc) are being used.
+        static concurrent::reader_gate s_gate;  //!< Gate used for read locking (prevents find lookups), should be used when atomic operations (add/erase/etc) are being used.
 
         /**
          * @brief Loads the table from the passed lookup table file.
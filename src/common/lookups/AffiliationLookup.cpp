@@ -29,13 +29,15 @@ const uint32_t UNIT_REG_TIMEOUT = 43200U; // 12 hours
 AffiliationLookup::AffiliationLookup(const std::string name, ChannelLookup* channelLookup, bool verbose) :
     m_rfGrantChCnt(0U),
     m_unitRegTable(),
-    m_unitRegTimers(),
+    m_unitRegExpiry(),
     m_grpAffTable(),
+    m_grpAffVersion(0U),
+    m_grpAffChanges(nullptr),
     m_grantChTable(),
     m_grantSrcIdTable(),
     m_uuGrantedTable(),
     m_netGrantedTable(),
-    m_grantTimers(),
+    m_grantExpiry(),
     m_releaseGrant(nullptr),
     m_name(),
     m_chLookup(channelLookup),
@@ -47,12 +49,12 @@ AffiliationLookup::AffiliationLookup(const std::string name, ChannelLookup* chan
     m_name = name;
 
     m_unitRegTable.clear();
-    m_unitRegTimers.clear();
+    m_unitRegExpiry.clear();
     m_grpAffTable.clear();
 
     m_grantChTable.clear();
     m_grantSrcIdTable.clear();
-    m_grantTimers.clear();
+    m_grantExpiry.clear();
 }
 
 /* Finalizes a instance of the AffiliationLookup class. */
@@ -71,8 +73,7 @@ void AffiliationLookup::unitReg(uint32_t srcId)
 
     m_unitRegTable.push_back(srcId);
 
-    m_unitRegTimers[srcId] = Timer(1000U, UNIT_REG_TIMEOUT);
-    m_unitRegTimers[srcId].start();
+    m_unitRegExpiry.start(srcId, UNIT_REG_TIMEOUT * 1000U);
 
     if (m_verbose) {
         LogInfoEx(LOG_HOST, "%s, unit registration, srcId = %u",
@@ -101,17 +102,19 @@ bool AffiliationLookup::unitDereg(uint32_t srcId, bool automatic)
             m_name.c_str(), srcId);
     }
 
-    m_unitRegTimers[srcId].stop();
+    m_unitRegExpiry.stop(srcId);
 
     // remove dynamic unit registration table entry
     m_unitRegTable.lock(false);
-    if (std::find(m_unitRegTable.begin(), m_unitRegTable.end(), srcId) != m_unitRegTable.end()) {
-        auto it = std::find(m_unitRegTable.begin(), m_unitRegTable.end(), srcId);
+    auto it = std::find(m_unitRegTable.begin(), m_unitRegTable.end(), srcId);
+    if (it != m_unitRegTable.end()) {
         m_unitRegTable.unlock();
         m_unitRegTable.erase(it);
         ret = true;
     }
-    m_unitRegTable.unlock();
+    else {
+        m_unitRegTable.unlock();
+    }
 
     if (ret) {
         if (m_unitDereg != nullptr) {
@@ -135,7 +138,7 @@ void AffiliationLookup::touchUnitReg(uint32_t srcId)
     __spinlock();
 
     if (isUnitReg(srcId)) {
-        m_unitRegTimers[srcId].start();
+        m_unitRegExpiry.touch(srcId);
     }
 }
 
@@ -150,7 +153,7 @@ uint32_t AffiliationLookup::unitRegTimeout(uint32_t srcId)
     __spinlock();
 
     if (isUnitReg(srcId)) {
-        return m_unitRegTimers[srcId].getTimeout();
+        return m_unitRegExpiry.getTimeout(srcId) / 1000U;
     }
 
     return 0U;
@@ -167,7 +170,7 @@ uint32_t AffiliationLookup::unitRegTimer(uint32_t srcId)
     __spinlock();
 
     if (isUnitReg(srcId)) {
-        return m_unitRegTimers[srcId].getTimer();
+        return m_unitRegExpiry.getElapsed(srcId) / 1000U;
     }
 
     return 0U;
@@ -211,6 +214,7 @@ void AffiliationLookup::groupAff(uint32_t srcId, uint32_t dstId)
 
         // update dynamic affiliation table
         m_grpAffTable[srcId] = dstId;
+        grpAffChanged();
 
         if (m_verbose) {
             LogInfoEx(LOG_HOST, "%s, group affiliation, srcId = %u, dstId = %u",
@@ -244,6 +248,7 @@ bool AffiliationLookup::groupUnaff(uint32_t srcId)
         uint32_t entry = m_grpAffTable.at(srcId); // this value will get discarded
         (void)entry;                              // but some variants of C++ mark the unordered_map<>::at as nodiscard
         m_grpAffTable.erase(srcId);
+        grpAffChanged();
         __unlock();
         return true;
     }
@@ -325,6 +330,9 @@ std::vector<uint32_t> AffiliationLookup::clearGroupAff(uint32_t dstId, bool rele
         m_grpAffTable.erase(srcId);
     }
 
+    if (srcToRel.size() > 0U)
+        grpAffChanged();
+
     __unlock();
 
     return srcToRel;
@@ -356,8 +364,7 @@ bool AffiliationLookup::grantCh(uint32_t dstId, uint32_t srcId, uint32_t grantTi
     m_uuGrantedTable[dstId] = !grp;
     m_netGrantedTable[dstId] = netGranted;
 
-    m_grantTimers[dstId] = Timer(1000U, grantTimeout);
-    m_grantTimers[dstId].start();
+    m_grantExpiry.start(dstId, grantTimeout * 1000U);
 
     if (m_verbose) {
         LogInfoEx(LOG_HOST, "%s, granting channel, chNo = %u, dstId = %u, srcId = %u, group = %u",
@@ -383,11 +390,7 @@ void AffiliationLookup::touchGrant(uint32_t dstId)
     **  used in an audio processing chain
     */
 
-    m_grantTimers.lock(false);
-    if (isGranted(dstId)) {
-        m_grantTimers[dstId].start();
-    }
-    m_grantTimers.unlock();
+    m_grantExpiry.touch(dstId);
 }
 
 /* Helper to release the channel grant for the destination ID. */
@@ -455,7 +458,7 @@ bool AffiliationLookup::releaseGrant(uint32_t dstId, bool releaseAll)
             m_rfGrantChCnt = 0U;
         }
 
-        m_grantTimers[dstId].stop();
+        m_grantExpiry.stop(dstId);
 
         __unlock();
 
@@ -664,23 +667,9 @@ uint32_t AffiliationLookup::getGrantedSrcId(uint32_t dstId)
 
 void AffiliationLookup::clock(uint32_t ms)
 {
-    m_grantChTable.spinlock();
-
-    // clock all the grant timers
-    m_grantChTable.lock(false);
+    // clock the grant timeouts; only grants that are due are examined
     std::vector<uint32_t> gntsToRel = std::vector<uint32_t>();
-    for (auto entry : m_grantChTable) {
-        uint32_t dstId = entry.first;
-
-        auto it = m_grantTimers.find(dstId);
-        if (it != m_grantTimers.end()) {
-            it->second.clock(ms);
-            if (it->second.isRunning() && it->second.hasExpired()) {
-                gntsToRel.push_back(dstId);
-            }
-        }
-    }
-    m_grantChTable.unlock();
+    m_grantExpiry.clock(ms, gntsToRel);
 
     // release grants that have timed out
     for (uint32_t dstId : gntsToRel) {
@@ -688,21 +677,9 @@ void AffiliationLookup::clock(uint32_t ms)
     }
 
     if (!m_disableUnitRegTimeout) {
-        m_unitRegTable.spinlock();
-
-        // clock all the unit registration timers
-        m_unitRegTable.lock(false);
+        // clock the unit registration timeouts
         std::vector<uint32_t> unitsToDereg = std::vector<uint32_t>();
-        for (uint32_t srcId : m_unitRegTable) {
-            auto it = m_unitRegTimers.find(srcId);
-            if (it != m_unitRegTimers.end()) {
-                it->second.clock(ms);
-                if (it->second.isRunning() && it->second.hasExpired()) {
-                    unitsToDereg.push_back(srcId);
-                }
-            }
-        }
-        m_unitRegTable.unlock();
+        m_unitRegExpiry.clock(ms, unitsToDereg);
 
         // release units registrations that have timed out
         for (uint32_t srcId : unitsToDereg) {
@@ -710,3 +687,16 @@ void AffiliationLookup::clock(uint32_t ms)
         }
     }
 }
+
+// ---------------------------------------------------------------------------
+//  Protected Class Members
+// ---------------------------------------------------------------------------
+
+/* Helper to record a change to the group affiliation table. */
+
+void AffiliationLookup::grpAffChanged()
+{
+    m_grpAffVersion++;
+    if (m_grpAffChanges != nullptr)
+        (*m_grpAffChanges)++;
+}
@@ -25,10 +25,12 @@
 #include "common/concurrent/vector.h"
 #include "common/concurrent/unordered_map.h"
 #include "common/lookups/ChannelLookup.h"
+#include "common/ExpiryQueue.h"
 #include "common/Timer.h"
 
 #include <cstdio>
 #include <algorithm>
+#include <atomic>
 #include <functional>
 
 namespace lookups
@@ -119,6 +121,12 @@ namespace lookups
          * @returns std::unordered_map<uint32_t, uint32_t> Group Affiliation Table.
          */
         std::unordered_map<uint32_t, uint32_t> grpAffTable() const { return m_grpAffTable.get(); }
+        /**
+         * @brief Gets the version of the group affiliation table. The version is incremented whenever
+         *  a group affiliation is added or removed.
+         * @returns uint32_t Group affiliation table version.
+         */
+        uint32_t grpAffVersion() const { return m_grpAffVersion.load(); }
         /**
          * @brief Helper to group affiliate a source ID.
          * @param srcId Source Radio ID.
@@ -278,19 +286,27 @@ namespace lookups
          * @param callback Unit deregistration function callback.
          */
         void setUnitDeregCallback(std::function<void(uint32_t, bool)>&& callback) { m_unitDereg = callback; }
+        /**
+         * @brief Helper to set an external change counter, which is incremented alongside the group
+         *  affiliation table version (i.e. a counter shared by many affiliation lookups).
+         * @param counter Change counter (must outlive this lookup).
+         */
+        void setGrpAffChangeCounter(std::atomic<uint32_t>* counter) { m_grpAffChanges = counter; }
 
     protected:
         uint8_t m_rfGrantChCnt;
 
         concurrent::vector<uint32_t> m_unitRegTable;
-        concurrent::unordered_map<uint32_t, Timer> m_unitRegTimers;
+        ExpiryQueue m_unitRegExpiry;
         concurrent::unordered_map<uint32_t, uint32_t> m_grpAffTable;
+        std::atomic<uint32_t> m_grpAffVersion;
+        std::atomic<uint32_t>* m_grpAffChanges;
 
         concurrent::unordered_map<uint32_t, uint32_t> m_grantChTable;
         concurrent::unordered_map<uint32_t, uint32_t> m_grantSrcIdTable;
         concurrent::unordered_map<uint32_t, bool> m_uuGrantedTable;
         concurrent::unordered_map<uint32_t, bool> m_netGrantedTable;
-        concurrent::unordered_map<uint32_t, Timer> m_grantTimers;
+        ExpiryQueue m_grantExpiry;
 
         //                 chNo      srcId     dstId     slot
         std::function<void(uint32_t, uint32_t, uint32_t, uint8_t)> m_releaseGrant;
@@ -303,6 +319,11 @@ namespace lookups
         bool m_disableUnitRegTimeout;
 
         bool m_verbose;
+
+        /**
+         * @brief Helper to record a change to the group affiliation table.
+         */
+        void grpAffChanged();
     };
 } // namespace lookups
 
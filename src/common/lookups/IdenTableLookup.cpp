@@ -41,6 +41,7 @@ void IdenTableLookup::clear()
 {
     std::lock_guard<std::mutex> lock(s_mutex);
     m_table.clear();
+    m_version++;
 }
 
 /* Finds a table entry in this lookup table. */
@@ -94,70 +95,65 @@ bool IdenTableLookup::load()
         return false;
     }
 
-    std::ifstream file (m_filename, std::ifstream::in);
-    if (file.fail()) {
+    TableFileReader reader(m_filename);
+    if (!reader.open()) {
         LogError(LOG_HOST, "Cannot open the identity table lookup file - %s", m_filename.c_str());
         return false;
     }
 
-    // clear table
-    clear();
-
-    std::lock_guard<std::mutex> lock(s_mutex);
+    if (isFileUnchanged(reader)) {
+        LogInfoEx(LOG_HOST, "Identity table lookup file %s is unchanged, skipping reload", m_filename.c_str());
+        return true;
+    }
 
-    // read lines from file
-    std::string line;
-    while (std::getline(file, line)) {
-        if (line.length() > 0) {
-            if (line.at(0) == '#')
-                continue;
-
-            // tokenize line
-            std::vector<std::string> parsed;
-            std::stringstream ss(line);
-            std::string field;
-            char delim = ',';
-
-            while (std::getline(ss, field, delim))
-                parsed.push_back(field);
-
-            // ensure we have at least 5 fields
-            if (parsed.size() < 5) {
-                LogError(LOG_HOST, "Invalid entry in identity table lookup file - %s", line.c_str());
-                continue;
-            }
-
-            // parse tokenized line
-            uint8_t channelId = (uint8_t)::atoi(parsed[0].c_str());
-            uint32_t baseFrequency = (uint32_t)::atoi(parsed[1].c_str());
-            float chSpaceKhz = float(::atof(parsed[2].c_str()));
-            float txOffsetMhz = float(::atof(parsed[3].c_str()));
-            float chBandwidthKhz = float(::atof(parsed[4].c_str()));
-
-            if (chSpaceKhz == 0.0F)
-                chSpaceKhz = chBandwidthKhz / 2;
-            if (chSpaceKhz < 0.125F)    // clamp to 125 Hz
-                chSpaceKhz = 0.125F;
-            if (chSpaceKhz > 125000.0F)   // clamp to 125 kHz
-                chSpaceKhz = 125000.0F;
-
-            IdenTable entry = IdenTable(channelId, baseFrequency, chSpaceKhz, txOffsetMhz, chBandwidthKhz);
+    // parse into per-chunk entry lists; the table is built off to the side so lookups continue against
+    // the current table until the new one is swapped in
+    std::vector<std::vector<IdenTable>> chunks(reader.chunks());
+    reader.forEachLine([&](uint32_t chunk, const TableFileReader::Line& line) {
+        // ensure we have at least 5 fields
+        if (line.count < 5U) {
+            LogError(LOG_HOST, "Invalid entry in identity table lookup file - %s", line.str().c_str());
+            return;
+        }
 
+        // parse tokenized line
+        uint8_t channelId = (uint8_t)line.fields[0U].toInt();
+        uint32_t baseFrequency = (uint32_t)line.fields[1U].toInt();
+        float chSpaceKhz = line.fields[2U].toFloat();
+        float txOffsetMhz = line.fields[3U].toFloat();
+        float chBandwidthKhz = line.fields[4U].toFloat();
+
+        if (chSpaceKhz == 0.0F)
+            chSpaceKhz = chBandwidthKhz / 2;
+        if (chSpaceKhz < 0.125F)    // clamp to 125 Hz
+            chSpaceKhz = 0.125F;
+        if (chSpaceKhz > 125000.0F)   // clamp to 125 kHz
+            chSpaceKhz = 125000.0F;
+
+        chunks[chunk].push_back(IdenTable(channelId, baseFrequency, chSpaceKhz, txOffsetMhz, chBandwidthKhz));
+    });
+
+    std::unordered_map<uint32_t, IdenTable> table;
+    for (auto& chunk : chunks) {
+        for (auto& entry : chunk) {
             LogInfoEx(LOG_HOST, "Channel Id %u: BaseFrequency = %uHz, TXOffsetMhz = %fMHz, BandwidthKhz = %fKHz, SpaceKhz = %fKHz",
                 entry.channelId(), entry.baseFrequency(), entry.txOffsetMhz(), entry.chBandwidthKhz(), entry.chSpaceKhz());
 
-            m_table[channelId] = entry;
+            table[entry.channelId()] = entry;
         }
     }
 
-    file.close();
+    {
+        std::lock_guard<std::mutex> lock(s_mutex);
+        m_table.swap(table);
+        m_version++;
+    }
 
     size_t size = m_table.size();
     if (size == 0U)
         return false;
 
-    uint64_t now = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::system_clock::now().time_since_epoch()).count();
-    m_lastLoadTime = now;
+    setFileLoaded(reader);
 
     LogInfoEx(LOG_HOST, "Loaded %u entries into lookup table", size);
 
@@ -20,6 +20,7 @@
 #define __LOOKUP_TABLE_H__
 
 #include "common/Defines.h"
+#include "common/lookups/TableFileReader.h"
 #include "common/Thread.h"
 #include "common/Timer.h"
 
@@ -27,8 +28,13 @@
 #include <cstdlib>
 #include <cstring>
 #include <cctype>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
 #include <mutex>
 #include <unordered_map>
+#include <utility>
+#include <vector>
 
 namespace lookups
 {
@@ -56,7 +62,11 @@ namespace lookups
             m_reloadTime(reloadTime),
             m_table(),
             m_stop(false),
-            m_lastLoadTime(0U)
+            m_lastLoadTime(0U),
+            m_version(0U),
+            m_fileSignature(),
+            m_fileVersion(0U),
+            m_fileLoaded(false)
         {
             /* stub */
         }
@@ -192,6 +202,14 @@ namespace lookups
          */
         const uint64_t lastLoadTime() const { return m_lastLoadTime; }
 
+        /**
+         * @brief Returns the version of this lookup table. The version is incremented whenever the
+         *  table is changed (loaded, cleared, entries added or erased), and can be used to cheaply
+         *  determine if the table contents have changed.
+         * @return uint32_t Table version.
+         */
+        uint32_t tableVersion() const { return m_version.load(); }
+
     protected:
         std::string m_filename;
         uint32_t m_reloadTime;
@@ -200,6 +218,87 @@ namespace lookups
 
         uint64_t m_lastLoadTime;
 
+        std::atomic<uint32_t> m_version;
+
+        TableFileReader::Signature m_fileSignature;
+        uint32_t m_fileVersion;
+        bool m_fileLoaded;
+
+        /**
+         * @brief Helper to determine if reloading the lookup table file can be skipped; the file is
+         *  unchanged since it was last loaded, and the table has not been changed in memory since.
+         * @param reader Opened lookup table file.
+         * @returns bool True, if the reload can be skipped, otherwise false.
+         */
+        bool isFileUnchanged(TableFileReader& reader)
+        {
+            return m_fileLoaded && m_fileVersion == m_version.load() && reader.matches(m_fileSignature);
+        }
+
+        /**
+         * @brief Helper to record the lookup table file that the table was loaded from.
+         * @param reader Opened lookup table file.
+         */
+        void setFileLoaded(TableFileReader& reader)
+        {
+            m_fileSignature = reader.signature();
+            m_fileVersion = m_version.load();
+            m_fileLoaded = true;
+
+            m_lastLoadTime = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::system_clock::now().time_since_epoch()).count();
+        }
+
+        /**
+         * @brief Helper to return a filtered page of the given table, ordered by unique ID.
+         *  (NOTE: This does not lock the table, the caller is expected to hold the table lock.)
+         * @tparam Filter Predicate type; bool(uint32_t id, const T& entry).
+         * @param table Table to page.
+         * @param cursor Unique ID to return entries after (0 to begin at the start of the table).
+         * @param limit Maximum number of entries to return (0 for no limit).
+         * @param filter Predicate used to filter table entries.
+         * @param[out] matched Total number of table entries matching the filter.
+         * @param[out] nextCursor Cursor to use to fetch the next page, 0 if there are no further entries.
+         * @returns std::vector<std::pair<uint32_t, T>> Page of table entries.
+         */
+        template <typename Filter>
+        static std::vector<std::pair<uint32_t, T>> pageTable(const std::unordered_map<uint32_t, T>& table, uint32_t cursor,
+            uint32_t limit, Filter filter, uint32_t& matched, uint32_t& nextCursor)
+        {
+            matched = 0U;
+            nextCursor = 0U;
+
+            // only the IDs are gathered here, entries are only copied for the returned page
+            std::vector<uint32_t> ids;
+            for (auto& entry : table) {
+                if (!filter(entry.first, entry.second))
+                    continue;
+
+                matched++;
+                if (entry.first > cursor)
+                    ids.push_back(entry.first);
+            }
+
+            if (limit > 0U && ids.size() > limit) {
+                std::nth_element(ids.begin(), ids.begin() + limit, ids.end());
+                ids.resize(limit);
+                std::sort(ids.begin(), ids.end());
+                nextCursor = ids.back();
+            }
+            else {
+                std::sort(ids.begin(), ids.end());
+            }
+
+            std::vector<std::pair<uint32_t, T>> page;
+            page.reserve(ids.size());
+            for (uint32_t id : ids) {
+                auto it = table.find(id);
+                if (it != table.end())
+                    page.push_back(*it);
+            }
+
+            return page;
+        }
+
         /**
          * @brief Loads the table from the passed lookup table file.
          * @returns bool True, if lookup table was loaded, otherwise false.
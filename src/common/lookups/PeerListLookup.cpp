@@ -23,7 +23,7 @@ using namespace lookups;
 // ---------------------------------------------------------------------------
 
 std::mutex PeerListLookup::s_mutex;
-bool PeerListLookup::s_locked = false;
+concurrent::reader_gate PeerListLookup::s_gate;
 
 // ---------------------------------------------------------------------------
 //  Macros
@@ -32,17 +32,13 @@ bool PeerListLookup::s_locked = false;
 // Lock the table.
 #define __LOCK_TABLE()                          \
     std::lock_guard<std::mutex> lock(s_mutex);  \
-    s_locked = true;
+    s_gate.close();
 
 // Unlock the table.
-#define __UNLOCK_TABLE() s_locked = false;
+#define __UNLOCK_TABLE() s_gate.open();
 
-// Spinlock wait for table to be read unlocked.
-#define __SPINLOCK()                            \
-    if (s_locked) {                             \
-        while (s_locked)                        \
-            Thread::sleep(2U);                  \
-    }
+// Read lock the table for the rest of the scope.
+#define __READ_LOCK_TABLE() concurrent::reader_guard readLock(s_gate);
 
 // ---------------------------------------------------------------------------
 //  Public Class Members
@@ -63,6 +59,7 @@ void PeerListLookup::clear()
     __LOCK_TABLE();
 
     m_table.clear();
+    m_version++;
 
     __UNLOCK_TABLE();
 }
@@ -79,9 +76,11 @@ void PeerListLookup::addEntry(uint32_t id, PeerId entry)
         if (_entry.peerId() == id) {
             _entry = entry;
             m_table[id] = _entry;
+            m_version++;
         }
     } catch (...) {
         m_table[id] = entry;
+        m_version++;
     }
 
     __UNLOCK_TABLE();
@@ -97,6 +96,7 @@ void PeerListLookup::eraseEntry(uint32_t id)
         PeerId entry = m_table.at(id);  // this value will get discarded
         (void)entry;                    // but some variants of C++ mark the unordered_map<>::at as nodiscard
         m_table.erase(id);
+        m_version++;
     } catch (...) {
         /* stub */
     }
@@ -110,7 +110,7 @@ PeerId PeerListLookup::find(uint32_t id)
 {
     PeerId entry;
 
-    __SPINLOCK();
+    __READ_LOCK_TABLE();
 
     try {
         entry = m_table.at(id);
@@ -121,6 +121,15 @@ PeerId PeerListLookup::find(uint32_t id)
     return entry;
 }
 
+/* Helper to return a filtered page of the lookup table, ordered by peer ID. */
+
+std::vector<std::pair<uint32_t, PeerId>> PeerListLookup::page(uint32_t cursor, uint32_t limit,
+    std::function<bool(uint32_t, const PeerId&)> filter, uint32_t& matched, uint32_t& nextCursor)
+{
+    std::lock_guard<std::mutex> lock(s_mutex);
+    return pageTable(m_table, cursor, limit, filter, matched, nextCursor);
+}
+
 /* Commit the table. */
 
 void PeerListLookup::commit(bool quiet)
@@ -139,7 +148,7 @@ bool PeerListLookup::getACL() const
 
 bool PeerListLookup::isPeerInList(uint32_t id) const
 {
-    __SPINLOCK();
+    __READ_LOCK_TABLE();
 
     if (m_table.find(id) != m_table.end()) {
         return true;
@@ -187,114 +196,110 @@ bool PeerListLookup::load()
         return false;
     }
 
-    std::ifstream file(m_filename, std::ifstream::in);
-    if (file.fail()) {
+    TableFileReader reader(m_filename);
+    if (!reader.open()) {
         LogError(LOG_HOST, "Cannot open the peer ID lookup file - %s", m_filename.c_str());
         return false;
     }
 
-    clear();
-
-    __LOCK_TABLE();
+    if (isFileUnchanged(reader)) {
+        LogInfoEx(LOG_HOST, "Peer ID lookup file %s is unchanged, skipping reload", m_filename.c_str());
+        return true;
+    }
 
-    // read lines from file
-    std::string line;
-    while (std::getline(file, line)) {
-        if (line.length() > 0) {
-            // Skip comments with #
-            if (line.at(0) == '#')
-                continue;
-
-            // tokenize line
-            std::vector<std::string> parsed;
-            std::stringstream ss(line);
-            std::string field;
-            char delim = ',';
-
-            while (std::getline(ss, field, delim))
-                parsed.push_back(field);
-
-            // parse tokenized line
-            uint32_t id = ::atoi(parsed[0].c_str());
-
-            // parse optional alias field (at end of line to avoid breaking change with existing lists)
-            std::string alias = "";
-            if (parsed.size() >= 4)
-                alias = parsed[3].c_str();
-
-            // parse peer link flag
-            bool peerReplica = false;
-            if (parsed.size() >= 3)
-                peerReplica = ::atoi(parsed[2].c_str()) == 1;
-
-            // parse can request keys flag
-            bool canRequestKeys = false;
-            if (parsed.size() >= 5)
-                canRequestKeys = ::atoi(parsed[4].c_str()) == 1;
-
-            // parse can issue inhibit flag
-            bool canIssueInhibit = false;
-            if (parsed.size() >= 6)
-                canIssueInhibit = ::atoi(parsed[5].c_str()) == 1;
-
-            // parse can issue inhibit flag
-            bool hasCallPriority = false;
-            if (parsed.size() >= 7)
-                hasCallPriority = ::atoi(parsed[6].c_str()) == 1;
-
-            // parse jitter buffer enabled flag
-            bool jitterBufferEnabled = false;
-            if (parsed.size() >= 8)
-                jitterBufferEnabled = ::atoi(parsed[7].c_str()) == 1;
-
-            // parse jitter buffer max size
-            uint16_t jitterBufferMaxSize = DEFAULT_JITTER_MAX_SIZE;
-            if (parsed.size() >= 9)
-                jitterBufferMaxSize = (uint16_t)::atoi(parsed[8].c_str());
-
-            // parse jitter buffer max wait time
-            uint32_t jitterBufferMaxWait = DEFAULT_JITTER_MAX_WAIT;
-            if (parsed.size() >= 10)
-                jitterBufferMaxWait = (uint32_t)::atoi(parsed[9].c_str());
-
-            // parse optional password
-            std::string password = "";
-            if (parsed.size() >= 2)
-                password = parsed[1].c_str();
-
-            // load into table
-            PeerId entry = PeerId(id, alias, password, false);
-            entry.peerReplica(peerReplica);
-            entry.canRequestKeys(canRequestKeys);
-            entry.canIssueInhibit(canIssueInhibit);
-            entry.hasCallPriority(hasCallPriority);
-            entry.jitterBufferEnabled(jitterBufferEnabled);
-            entry.jitterBufferMaxSize(jitterBufferMaxSize);
-            entry.jitterBufferMaxWait(jitterBufferMaxWait);
-
-            m_table[id] = entry;
+    // parse into per-chunk entry lists; the table is built off to the side so lookups continue against
+    // the current table until the new one is swapped in
+    std::vector<std::vector<PeerId>> chunks(reader.chunks());
+    reader.forEachLine([&](uint32_t chunk, const TableFileReader::Line& line) {
+        // parse tokenized line
+        uint32_t id = (uint32_t)line.fields[0U].toInt();
+
+        // parse optional alias field (at end of line to avoid breaking change with existing lists)
+        std::string alias = "";
+        if (line.count >= 4U)
+            alias = line.fields[3U].str();
+
+        // parse peer link flag
+        bool peerReplica = false;
+        if (line.count >= 3U)
+            peerReplica = line.fields[2U].toInt() == 1;
+
+        // parse can request keys flag
+        bool canRequestKeys = false;
+        if (line.count >= 5U)
+            canRequestKeys = line.fields[4U].toInt() == 1;
+
+        // parse can issue inhibit flag
+        bool canIssueInhibit = false;
+        if (line.count >= 6U)
+            canIssueInhibit = line.fields[5U].toInt() == 1;
+
+        // parse can issue inhibit flag
+        bool hasCallPriority = false;
+        if (line.count >= 7U)
+            hasCallPriority = line.fields[6U].toInt() == 1;
+
+        // parse jitter buffer enabled flag
+        bool jitterBufferEnabled = false;
+        if (line.count >= 8U)
+            jitterBufferEnabled = line.fields[7U].toInt() == 1;
+
+        // parse jitter buffer max size
+        uint16_t jitterBufferMaxSize = DEFAULT_JITTER_MAX_SIZE;
+        if (line.count >= 9U)
+            jitterBufferMaxSize = (uint16_t)line.fields[8U].toInt();
+
+        // parse jitter buffer max wait time
+        uint32_t jitterBufferMaxWait = DEFAULT_JITTER_MAX_WAIT;
+        if (line.count >= 10U)
+            jitterBufferMaxWait = (uint32_t)line.fields[9U].toInt();
+
+        // parse optional password
+        std::string password = "";
+        if (line.count >= 2U)
+            password = line.fields[1U].str();
+
+        PeerId entry = PeerId(id, alias, password, false);
+        entry.peerReplica(peerReplica);
+        entry.canRequestKeys(canRequestKeys);
+        entry.canIssueInhibit(canIssueInhibit);
+        entry.hasCallPriority(hasCallPriority);
+        entry.jitterBufferEnabled(jitterBufferEnabled);
+        entry.jitterBufferMaxSize(jitterBufferMaxSize);
+        entry.jitterBufferMaxWait(jitterBufferMaxWait);
+
+        chunks[chunk].push_back(entry);
+    });
+
+    std::unordered_map<uint32_t, PeerId> table;
+    for (auto& chunk : chunks) {
+        for (auto& entry : chunk) {
+            table[entry.peerId()] = entry;
 
             // log depending on what was loaded
-            LogInfoEx(LOG_HOST, "Loaded peer ID %u%s into peer ID lookup table, %s%s%s%s%s%s", id,
-                (!alias.empty() ? (" (" + alias + ")").c_str() : ""),
-                (!password.empty() ? "using unique peer password" : "using master password"),
-                (peerReplica) ? ", Replication Enabled" : "",
-                (canRequestKeys) ? ", Can Request Keys" : "",
-                (canIssueInhibit) ? ", Can Issue Inhibit" : "",
-                (hasCallPriority) ? ", Has Call Priority" : "",
-                (jitterBufferEnabled) ? ", Jitter Buffer Enabled" : "");
+            LogInfoEx(LOG_HOST, "Loaded peer ID %u%s into peer ID lookup table, %s%s%s%s%s%s", entry.peerId(),
+                (!entry.peerAlias().empty() ? (" (" + entry.peerAlias() + ")").c_str() : ""),
+                (!entry.peerPassword().empty() ? "using unique peer password" : "using master password"),
+                (entry.peerReplica()) ? ", Replication Enabled" : "",
+                (entry.canRequestKeys()) ? ", Can Request Keys" : "",
+                (entry.canIssueInhibit()) ? ", Can Issue Inhibit" : "",
+                (entry.hasCallPriority()) ? ", Has Call Priority" : "",
+                (entry.jitterBufferEnabled()) ? ", Jitter Buffer Enabled" : "");
         }
     }
 
-    file.close();
-    __UNLOCK_TABLE();
+    {
+        __LOCK_TABLE();
+        m_table.swap(table);
+        m_version++;
+        __UNLOCK_TABLE();
+    }
 
     size_t size = m_table.size();
     if (size == 0U)
         return false;
 
-    uint64_t now = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::system_clock::now().time_since_epoch()).count();
-    m_lastLoadTime = now;
+    setFileLoaded(reader);
 
     LogInfoEx(LOG_HOST, "Loaded %lu entries into peer list lookup table", size);
     return true;
@@ -24,9 +24,11 @@
 #define __PEER_LIST_LOOKUP_H__
 
 #include "common/Defines.h"
+#include "common/concurrent/reader_gate.h"
 #include "common/lookups/LookupTable.h"
 #include "common/network/AdaptiveJitterBuffer.h"
 
+#include <functional>
 #include <string>
 #include <vector>
 #include <mutex>
@@ -279,6 +281,18 @@ namespace lookups
          * @returns std::vector<PeerId> 
          */
         std::vector<PeerId> tableAsList() const;
+        /**
+         * @brief Helper to return a filtered page of the peer ID table, ordered by peer ID, without
+         *  copying the entire table.
+         * @param cursor Peer ID to return entries after (0 to begin at the start of the table).
+         * @param limit Maximum number of entries to return (0 for no limit).
+         * @param filter Predicate used to filter table entries.
+         * @param[out] matched Total number of table entries matching the filter.
+         * @param[out] nextCursor Cursor to use to fetch the next page, 0 if there are no further entries.
+         * @returns std::vector<std::pair<uint32_t, PeerId>> Page of table entries.
+         */
+        std::vector<std::pair<uint32_t, PeerId>> page(uint32_t cursor, uint32_t limit,
+            std::function<bool(uint32_t, const PeerId&)> filter, uint32_t& matched, uint32_t& nextCursor);
 
     protected:
         bool m_acl;
@@ -298,7 +312,7 @@ namespace lookups
 
     private:
         static std::mutex s_mutex;  //!< Mutex used for change locking.
-        static bool s_locked;       //!< Flag used for read locking (prevents find lookups), should be used when atomic operations (add/erase/etc) are being used.
+        static concurrent::reader_gate s_gate;  //!< Gate used for read locking (prevents find lookups), should be used when atomic operations (add/erase/etc) are being used.
     };
 } // namespace lookups
 
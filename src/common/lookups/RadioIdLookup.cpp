@@ -25,7 +25,7 @@ using namespace lookups;
 // ---------------------------------------------------------------------------
 
 std::mutex RadioIdLookup::s_mutex;
-bool RadioIdLookup::s_locked = false;
+concurrent::reader_gate RadioIdLookup::s_gate;
 
 // ---------------------------------------------------------------------------
 //  Macros
@@ -34,17 +34,13 @@ bool RadioIdLookup::s_locked = false;
 // Lock the table.
 #define __LOCK_TABLE()                          \
     std::lock_guard<std::mutex> lock(s_mutex);  \
-    s_locked = true;
+    s_gate.close();
 
 // Unlock the table.
-#define __UNLOCK_TABLE() s_locked = false;
+#define __UNLOCK_TABLE() s_gate.open();
 
-// Spinlock wait for table to be read unlocked.
-#define __SPINLOCK()                            \
-    if (s_locked) {                             \
-        while (s_locked)                        \
-            Thread::sleep(2U);                  \
-    }
+// Read lock the table for the rest of the scope.
+#define __READ_LOCK_TABLE() concurrent::reader_guard readLock(s_gate);
 
 // ---------------------------------------------------------------------------
 //  Public Class Members
@@ -65,6 +61,7 @@ void RadioIdLookup::clear()
     __LOCK_TABLE();
 
     m_table.clear();
+    m_version++;
 
     __UNLOCK_TABLE();
 }
@@ -96,12 +93,14 @@ void RadioIdLookup::addEntry(uint32_t id, bool enabled, const std::string& alias
             //LogDebug(LOG_HOST, "Updating existing RID %d (%s) in ACL", id, alias.c_str());
             _entry = RadioId(enabled, false, alias, ipAddress);
             m_table[id] = _entry;
+            m_version++;
         } else {
             //LogDebug(LOG_HOST, "No changes made to RID %d (%s) in ACL", id, alias.c_str());
         }
     } catch (...) {
         //LogDebug(LOG_HOST, "Adding new RID %d (%s) to ACL", id, alias.c_str());
         m_table[id] = entry;
+        m_version++;
     }
 
     __UNLOCK_TABLE();
@@ -117,6 +116,7 @@ void RadioIdLookup::eraseEntry(uint32_t id)
         RadioId entry = m_table.at(id); // this value will get discarded
         (void)entry;                    // but some variants of C++ mark the unordered_map<>::at as nodiscard
         m_table.erase(id);
+        m_version++;
     }
     catch (...) {
         /* stub */
@@ -135,7 +135,7 @@ RadioId RadioIdLookup::find(uint32_t id)
         return RadioId(true, false);
     }
 
-    __SPINLOCK();
+    __READ_LOCK_TABLE();
 
     try {
         entry = m_table.at(id);
@@ -146,6 +146,15 @@ RadioId RadioIdLookup::find(uint32_t id)
     return entry;
 }
 
+/* Helper to return a filtered page of the lookup table, ordered by radio ID. */
+
+std::vector<std::pair<uint32_t, RadioId>> RadioIdLookup::page(uint32_t cursor, uint32_t limit,
+    std::function<bool(uint32_t, const RadioId&)> filter, uint32_t& matched, uint32_t& nextCursor)
+{
+    std::lock_guard<std::mutex> lock(s_mutex);
+    return pageTable(m_table, cursor, limit, filter, matched, nextCursor);
+}
+
 /* Saves loaded talkgroup rules. */
 
 void RadioIdLookup::commit(bool quiet)
@@ -172,70 +181,70 @@ bool RadioIdLookup::load()
         return false;
     }
 
-    std::ifstream file (m_filename, std::ifstream::in);
-    if (file.fail()) {
+    TableFileReader reader(m_filename);
+    if (!reader.open()) {
         LogError(LOG_HOST, "Cannot open the radio ID lookup file - %s", m_filename.c_str());
         return false;
     }
 
-    // clear table
-    clear();
+    if (isFileUnchanged(reader)) {
+        LogInfoEx(LOG_HOST, "Radio ID lookup file %s is unchanged, skipping reload", m_filename.c_str());
+        return true;
+    }
 
-    __LOCK_TABLE();
+    // parse into per-chunk entry lists; the table is built off to the side so lookups continue against
+    // the current table until the new one is swapped in
+    std::vector<std::vector<std::pair<uint32_t, RadioId>>> chunks(reader.chunks());
+    reader.forEachLine([&](uint32_t chunk, const TableFileReader::Line& line) {
+        // ensure we have at least 2 fields
+        if (line.count < 2U) {
+            LogError(LOG_HOST, "Invalid entry in radio ID lookup table - %s", line.str().c_str());
+            return;
+        }
 
-    // read lines from file
-    std::string line;
-    while (std::getline(file, line)) {
-        if (line.length() > 0) {
-            // Skip comments with #
-            if (line.at(0) == '#')
-                continue;
-
-            // tokenize line
-            std::vector<std::string> parsed;
-            std::stringstream ss(line);
-            std::string field;
-            char delim = ',';
-
-            while (std::getline(ss, field, delim))
-                parsed.push_back(field);
-
-            // ensure we have at least 2 fields
-            if (parsed.size() < 2) {
-                LogError(LOG_HOST, "Invalid entry in radio ID lookup table - %s", line.c_str());
-                continue;
-            }
-
-            // parse tokenized line
-            uint32_t id = ::atoi(parsed[0].c_str());
-            bool radioEnabled = ::atoi(parsed[1].c_str()) == 1;
-            std::string alias = "";
-            std::string ipAddress = "";
-
-            // check for an optional alias field
-            if (parsed.size() >= 3) {
-                alias = parsed[2];
-            }
-
-            // check for an optional IP address field
-            if (parsed.size() >= 4) {
-                ipAddress = parsed[3];
-            }
-
-            m_table[id] = RadioId(radioEnabled, false, alias, ipAddress);
-            //::LogInfoEx(LOG_HOST, "Radio NAME: %s RID: %u ENABLED: %u IPADDR: %s", alias.c_str(), id, radioEnabled, ipAddress.c_str());
+        // parse tokenized line
+        uint32_t id = (uint32_t)line.fields[0U].toInt();
+        bool radioEnabled = line.fields[1U].toInt() == 1;
+        std::string alias = "";
+        std::string ipAddress = "";
+
+        // check for an optional alias field
+        if (line.count >= 3U) {
+            alias = line.fields[2U].str();
         }
+
+        // check for an optional IP address field
+        if (line.count >= 4U) {
+            ipAddress = line.fields[3U].str();
+        }
+
+        chunks[chunk].emplace_back(id, RadioId(radioEnabled, false, alias, ipAddress));
+    });
+
+    size_t entries = 0U;
+    for (auto& chunk : chunks)
+        entries += chunk.size();
+
+    std::unordered_map<uint32_t, RadioId> table;
+    table.reserve(entries);
+    for (auto& chunk : chunks) {
+        for (auto& entry : chunk)
+            table[entry.first] = entry.second;
+        chunk.clear();
     }
 
-    file.close();
-    __UNLOCK_TABLE();
+    {
+        __LOCK_TABLE();
+        m_table.swap(table);
+        m_version++;
+        __UNLOCK_TABLE();
+    }
 
     size_t size = m_table.size();
     if (size == 0U)
         return false;
 
-    uint64_t now = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::system_clock::now().time_since_epoch()).count();
-    m_lastLoadTime = now;
+    setFileLoaded(reader);
 
     LogInfoEx(LOG_HOST, "Loaded %lu entries into radio ID lookup table", size);
 
@@ -23,10 +23,13 @@
 #define __RADIO_ID_LOOKUP_H__
 
 #include "common/Defines.h"
+#include "common/concurrent/reader_gate.h"
 #include "common/lookups/LookupTable.h"
 
+#include <functional>
 #include <string>
 #include <unordered_map>
+#include <vector>
 
 namespace lookups
 {
@@ -185,6 +188,18 @@ namespace lookups
             std::lock_guard<std::mutex> lock(s_mutex);
             return m_table;
         }
+        /**
+         * @brief Helper to return a filtered page of the lookup table, ordered by radio ID, without
+         *  copying the entire table.
+         * @param cursor Radio ID to return entries after (0 to begin at the start of the table).
+         * @param limit Maximum number of entries to return (0 for no limit).
+         * @param filter Predicate used to filter table entries.
+         * @param[out] matched Total number of table entries matching the filter.
+         * @param[out] nextCursor Cursor to use to fetch the next page, 0 if there are no further entries.
+         * @returns std::vector<std::pair<uint32_t, RadioId>> Page of table entries.
+         */
+        std::vector<std::pair<uint32_t, RadioId>> page(uint32_t cursor, uint32_t limit,
+            std::function<bool(uint32_t, const RadioId&)> filter, uint32_t& matched, uint32_t& nextCursor);
 
         /**
          * @brief Finds a table entry in this lookup table.
@@ -222,7 +237,7 @@ namespace lookups
 
     private:
         static std::mutex s_mutex;  //!< Mutex used for change locking.
-        static bool s_locked;       //!< Flag used for read locking (prevents find lookups), should be used when atomic operations (add/erase/etc) are being used.
+        static concurrent::reader_gate s_gate;  //!< Gate used for read locking (prevents find lookups), should be used when atomic operations (add/erase/etc) are being used.
     };
 } // namespace lookups
 
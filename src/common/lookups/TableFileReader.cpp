@@ -0,0 +1,250 @@
+// SPDX-License-Identifier: GPL-2.0-only
+/*
+ * Digital Voice Modem - Common Library
+ * GPLv2 Open Source. Use is subject to license terms.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ *  Copyright (C) 2026 Bryan Biedenkapp, N2PLL
+ *
+ */
+#include "lookups/TableFileReader.h"
+#include "ThreadPolicy.h"
+
+using namespace lookups;
+
+#include <cctype>
+#include <chrono>
+#include <cstdlib>
+#include <fstream>
+#include <thread>
+#include <sys/types.h>
+#include <sys/stat.h>
+
+// ---------------------------------------------------------------------------
+//  Constants
+// ---------------------------------------------------------------------------
+
+const uint64_t FNV_OFFSET = 0xCBF29CE484222325ULL;
+const uint64_t FNV_PRIME = 0x100000001B3ULL;
+
+const int64_t RACY_INTERVAL = 1000000000LL;    // 1s
+
+// ---------------------------------------------------------------------------
+//  Public Class Members
+// ---------------------------------------------------------------------------
+
+/* Gets the field as an integer (with the same leniency as ::atoi()). */
+
+int32_t TableFileReader::Field::toInt() const
+{
+    const char* p = data;
+    const char* end = data + length;
+    while (p < end && ::isspace((uint8_t)*p))
+        p++;
+
+    bool negative = false;
+    if (p < end && (*p == '-' || *p == '+')) {
+        negative = *p == '-';
+        p++;
+    }
+
+    int64_t value = 0;
+    while (p < end && *p >= '0' && *p <= '9') {
+        value = (value * 10) + (*p - '0');
+        if (value > 0xFFFFFFFFLL)
+            break;
+        p++;
+    }
+
+    return (int32_t)(negative ? -value : value);
+}
+
+/* Gets the field as a floating point number (with the same leniency as ::atof()). */
+
+float TableFileReader::Field::toFloat() const
+{
+    char buffer[64U];
+    uint32_t len = (length < sizeof(buffer) - 1U) ? length : (uint32_t)(sizeof(buffer) - 1U);
+    ::memcpy(buffer, data, len);
+    buffer[len] = '\0';
+
+    return (float)::atof(buffer);
+}
+
+/* Initializes a new instance of the TableFileReader class. */
+
+TableFileReader::TableFileReader(const std::string& filename, uint32_t threads) :
+    m_filename(filename),
+    m_threads(threads),
+    m_data(nullptr),
+    m_size(0U),
+    m_mtime(0),
+    m_buffer(),
+    m_chunks()
+{
+    if (m_threads == 0U) {
+        m_threads = std::thread::hardware_concurrency();
+        if (m_threads == 0U)
+            m_threads = 1U;
+    }
+}
+
+/* Finalizes a instance of the TableFileReader class. */
+
+TableFileReader::~TableFileReader()
+{
+    close();
+}
+
+/* Opens and reads the lookup table file. */
+
+bool TableFileReader::open()
+{
+    close();
+
+    struct stat st;
+    if (::stat(m_filename.c_str(), &st) != 0)
+        return false;
+
+    m_size = (size_t)st.st_size;
+#if defined(__linux__)
+    m_mtime = ((int64_t)st.st_mtim.tv_sec * 1000000000LL) + (int64_t)st.st_mtim.tv_nsec;
+#else
+    m_mtime = (int64_t)st.st_mtime * 1000000000LL;
+#endif // defined(__linux__)
+
+    std::ifstream file(m_filename, std::ifstream::in | std::ifstream::binary);
+    if (file.fail())
+        return false;
+
+    m_buffer.resize(m_size);
+    if (m_size > 0U) {
+        file.read(m_buffer.data(), m_size);
+        m_size = (size_t)file.gcount();
+    }
+    m_data = m_buffer.data();
+
+    // split the file into chunks on line boundaries
+    size_t chunks = m_size / MIN_CHUNK_SIZE;
+    if (chunks > m_threads)
+        chunks = m_threads;
+    if (chunks == 0U)
+        chunks = 1U;
+
+    m_chunks.clear();
+    m_chunks.push_back(0U);
+    for (size_t i = 1U; i < chunks; i++) {
+        size_t offset = (m_size / chunks) * i;
+        if (offset <= m_chunks.back())
+            continue;
+
+        const char* eol = (const char*)::memchr(m_data + offset, '\n', m_size - offset);
+        if (eol == nullptr)
+            break;
+
+        offset = (size_t)(eol - m_data) + 1U;
+        if (offset < m_size && offset > m_chunks.back())
+            m_chunks.push_back(offset);
+    }
+    m_chunks.push_back(m_size);
+
+    return true;
+}
+
+/* Closes the lookup table file. */
+
+void TableFileReader::close()
+{
+    m_data = nullptr;
+    m_size = 0U;
+    m_buffer.clear();
+    m_chunks.clear();
+}
+
+/* Helper to determine if the file matches the given signature. */
+
+bool TableFileReader::matches(const Signature& signature)
+{
+    if (signature.size != (uint64_t)m_size)
+        return false;
+    if (signature.mtime == m_mtime && signature.checked - signature.mtime >= RACY_INTERVAL)
+        return true;
+
+    return signature.hash == this->signature().hash;
+}
+
+/* Gets the signature of the file (computing the content hash). */
+
+TableFileReader::Signature TableFileReader::signature()
+{
+    Signature signature;
+    signature.size = (uint64_t)m_size;
+    signature.mtime = m_mtime;
+    signature.checked = (int64_t)std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::system_clock::now().time_since_epoch()).count();
+
+    // FNV-1a, folded a word at a time
+    uint64_t hash = FNV_OFFSET;
+    size_t i = 0U;
+    for (; i + 8U <= m_size; i += 8U) {
+        uint64_t word;
+        ::memcpy(&word, m_data + i, 8U);
+        hash ^= word;
+        hash *= FNV_PRIME;
+    }
+    for (; i < m_size; i++) {
+        hash ^= (uint8_t)m_data[i];
+        hash *= FNV_PRIME;
+    }
+
+    signature.hash = hash;
+    return signature;
+}
+
+// ---------------------------------------------------------------------------
+//  Private Class Members
+// ---------------------------------------------------------------------------
+
+/* Helper to run a parser on its own thread for each chunk, and wait for them to finish. */
+
+void TableFileReader::runChunks(uint32_t n, const std::function<void(uint32_t)>& parse)
+{
+    std::vector<std::thread> threads;
+    threads.reserve(n);
+    for (uint32_t i = 0U; i < n; i++) {
+        threads.emplace_back([&parse, i]() { parse(i); });
+        ThreadPolicy::apply(threads.back().native_handle(), "lookup:parse");
+    }
+
+    for (std::thread& t : threads)
+        t.join();
+}
+
+/* Helper to split a line into fields. */
+
+bool TableFileReader::split(const char* begin, const char* end, Line& line)
+{
+    if (end > begin && *(end - 1) == '\r')
+        end--;
+    if (begin == end || *begin == '#')
+        return false;
+
+    line.text = begin;
+    line.length = (uint32_t)(end - begin);
+    line.count = 0U;
+
+    const char* p = begin;
+    while (p < end && line.count < MAX_FIELDS) {
+        const char* delim = (const char*)::memchr(p, ',', end - p);
+        if (delim == nullptr)
+            delim = end;
+
+        line.fields[line.count].data = p;
+        line.fields[line.count].length = (uint32_t)(delim - p);
+        line.count++;
+
+        p = delim + 1;
+    }
+
+    return true;
+}
@@ -0,0 +1,227 @@
+// SPDX-License-Identifier: GPL-2.0-only
+/*
+ * Digital Voice Modem - Common Library
+ * GPLv2 Open Source. Use is subject to license terms.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ *  Copyright (C) 2026 Bryan Biedenkapp, N2PLL
+ *
+ */
+/**
+ * @file TableFileReader.h
+ * @ingroup lookups
+ * @file TableFileReader.cpp
+ * @ingroup lookups
+ */
+#if !defined(__TABLE_FILE_READER_H__)
+#define __TABLE_FILE_READER_H__
+
+#include "common/Defines.h"
+
+#include <cstring>
+#include <functional>
+#include <string>
+#include <vector>
+
+namespace lookups
+{
+    // ---------------------------------------------------------------------------
+    //  Class Declaration
+    // ---------------------------------------------------------------------------
+
+    /**
+     * @brief Implements a reader for comma delimited lookup table files (.dat).
+     *
+     *  The file is read into memory and split into chunks on line boundaries; large files are parsed with
+     *  one thread per chunk. (The file is not memory mapped; a lookup table rewritten or truncated while a
+     *  mapping is being parsed would fault the process.) Lines are split in place into fields without copying, blank lines and lines starting
+     *  with '#' are skipped. Fields are split the same way std::getline() with a ',' delimiter splits them (a
+     *  trailing delimiter does not produce an empty final field).
+     *
+     *  The reader also captures a signature of the file (size, modification time and content hash) so
+     *  callers can skip reloading a file that has not changed.
+     * @ingroup lookups
+     */
+    class HOST_SW_API TableFileReader {
+    public:
+        /**
+         * @brief Maximum number of fields split from a line; further fields are ignored.
+         */
+        static const uint32_t MAX_FIELDS = 16U;
+
+        /**
+         * @brief Represents a field of a line. The field is not null terminated.
+         */
+        struct Field {
+            const char* data;               //!< Field text.
+            uint32_t length;                //!< Length of the field text.
+
+            /**
+             * @brief Gets the field as a string.
+             * @returns std::string Field text.
+             */
+            std::string str() const { return std::string(data, length); }
+            /**
+             * @brief Gets the field as an integer (with the same leniency as ::atoi()).
+             * @returns int32_t Field value.
+             */
+            int32_t toInt() const;
+            /**
+             * @brief Gets the field as a floating point number (with the same leniency as ::atof()).
+             * @returns float Field value.
+             */
+            float toFloat() const;
+        };
+
+        /**
+         * @brief Represents a line split into fields.
+         */
+        struct Line {
+            const char* text;               //!< Line text.
+            uint32_t length;                //!< Length of the line text.
+            uint32_t count;                 //!< Number of fields.
+            Field fields[MAX_FIELDS];       //!< Fields.
+
+            /**
+             * @brief Gets the line as a string.
+             * @returns std::string Line text.
+             */
+            std::string str() const { return std::string(text, length); }
+        };
+
+        /**
+         * @brief Represents the signature of a file.
+         */
+        struct Signature {
+            uint64_t size;                  //!< File size.
+            int64_t mtime;                  //!< File modification time (nanoseconds since epoch).
+            int64_t checked;                //!< Time the signature was taken (nanoseconds since epoch).
+            uint64_t hash;                  //!< File content hash.
+
+            /**
+             * @brief Initializes a new instance of the Signature struct.
+             */
+            Signature() : size(0U), mtime(0), checked(0), hash(0U) { /* stub */ }
+        };
+
+        /**
+         * @brief Initializes a new instance of the TableFileReader class.
+         * @param filename Full-path to the lookup table file.
+         * @param threads Maximum number of parser threads (0 for the number of CPUs).
+         */
+        TableFileReader(const std::string& filename, uint32_t threads = 0U);
+        /**
+         * @brief Finalizes a instance of the TableFileReader class.
+         */
+        ~TableFileReader();
+
+        /**
+         * @brief Opens and reads the lookup table file.
+         * @returns bool True, if the file was opened, otherwise false.
+         */
+        bool open();
+        /**
+         * @brief Closes the lookup table file.
+         */
+        void close();
+
+        /**
+         * @brief Helper to determine if the file matches the given signature. The content hash is only
+         *  computed if the size and modification time alone cannot prove the file is unchanged (a file
+         *  modified within a second of the signature being taken may have been modified again without its
+         *  modification time changing).
+         * @param signature Signature of the previously loaded file.
+         * @returns bool True, if the file is unchanged, otherwise false.
+         */
+        bool matches(const Signature& signature);
+        /**
+         * @brief Gets the signature of the file (computing the content hash).
+         * @returns Signature Signature of the file.
+         */
+        Signature signature();
+
+        /**
+         * @brief Gets the number of chunks the file is parsed in. Callers that collect results per chunk
+         *  and merge them in chunk order observe lines in file order.
+         * @returns uint32_t Number of chunks.
+         */
+        uint32_t chunks() const { return (uint32_t)(m_chunks.size() - 1U); }
+
+        /**
+         * @brief Parses every line of the file. Each chunk is parsed on its own thread; the callback may be
+         *  called concurrently for different chunks, but always in file order within a chunk.
+         * @tparam F Callback type; void(uint32_t chunk, const Line& line).
+         * @param fn Callback.
+         */
+        template <typename F>
+        void forEachLine(F fn)
+        {
+            uint32_t n = chunks();
+            if (n == 1U) {
+                parseChunk(0U, fn);
+                return;
+            }
+
+            runChunks(n, [this, &fn](uint32_t i) { parseChunk(i, fn); });
+        }
+
+        /**
+         * @brief Minimum size of a chunk; files smaller than this are parsed on the calling thread.
+         */
+        static const size_t MIN_CHUNK_SIZE = 256U * 1024U;
+
+    private:
+        std::string m_filename;
+        uint32_t m_threads;
+
+        const char* m_data;
+        size_t m_size;
+        int64_t m_mtime;
+        std::vector<char> m_buffer;
+
+        std::vector<size_t> m_chunks;
+
+        /**
+         * @brief Helper to run a parser on its own thread for each chunk, and wait for them to finish.
+         * @param n Number of chunks.
+         * @param parse Chunk parser.
+         */
+        void runChunks(uint32_t n, const std::function<void(uint32_t)>& parse);
+
+        /**
+         * @brief Parses the lines of a chunk.
+         * @tparam F Callback type; void(uint32_t chunk, const Line& line).
+         * @param chunk Chunk number.
+         * @param fn Callback.
+         */
+        template <typename F>
+        void parseChunk(uint32_t chunk, F& fn)
+        {
+            const char* p = m_data + m_chunks[chunk];
+            const char* end = m_data + m_chunks[chunk + 1U];
+
+            Line line;
+            while (p < end) {
+                const char* eol = (const char*)::memchr(p, '\n', end - p);
+                if (eol == nullptr)
+                    eol = end;
+
+                if (split(p, eol, line))
+                    fn(chunk, line);
+
+                p = eol + 1;
+            }
+        }
+
+        /**
+         * @brief Helper to split a line into fields.
+         * @param begin Start of the line.
+         * @param end End of the line (excluding the line terminator).
+         * @param[out] line Line split into fields.
+         * @returns bool True, if the line has content, false if it is blank or a comment.
+         */
+        static bool split(const char* begin, const char* end, Line& line);
+    };
+} // namespace lookups
+
+#endif // __TABLE_FILE_READER_H__
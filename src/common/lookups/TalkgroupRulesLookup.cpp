@@ -22,27 +22,23 @@ using namespace lookups;
 //  Static Class Members
 // ---------------------------------------------------------------------------
 
-std::mutex TalkgroupRulesLookup::s_mutex;
-bool TalkgroupRulesLookup::s_locked = false;
+ProfiledMutex<> TalkgroupRulesLookup::s_mutex("TalkgroupRulesLookup::s_mutex");
+concurrent::reader_gate TalkgroupRulesLookup::s_gate;
 
 // ---------------------------------------------------------------------------
 //  Macros
 // ---------------------------------------------------------------------------
 
 // Lock the table.
-#define __LOCK_TABLE()                          \
-    std::lock_guard<std::mutex> lock(s_mutex);  \
-    s_locked = true;
+#define __LOCK_TABLE()                                  \
+    std::lock_guard<ProfiledMutex<>> lock(s_mutex);     \
+    s_gate.close();
 
 // Unlock the table.
-#define __UNLOCK_TABLE() s_locked = false;
+#define __UNLOCK_TABLE() s_gate.open();
 
-// Spinlock wait for table to be read unlocked.
-#define __SPINLOCK()                            \
-    if (s_locked) {                             \
-        while (s_locked)                        \
-            Thread::sleep(2U);                  \
-    }
+// Wait for table to be read unlocked.
+#define __SPINLOCK() s_gate.wait();
 
 // ---------------------------------------------------------------------------
 //  Public Class Members
@@ -55,6 +51,7 @@ TalkgroupRulesLookup::TalkgroupRulesLookup(const std::string& filename, uint32_t
     m_reloadTime(reloadTime),
     m_rules(),
     m_lastLoadTime(0U),
+    m_version(0U),
     m_acl(acl),
     m_stop(false),
     m_groupHangTime(5U),
@@ -125,6 +122,7 @@ void TalkgroupRulesLookup::clear()
     __LOCK_TABLE();
 
     m_groupVoice.clear();
+    m_version++;
 
     __UNLOCK_TABLE();
 }
@@ -175,6 +173,7 @@ void TalkgroupRulesLookup::addEntry(uint32_t id, uint8_t slot, bool enabled, boo
         m_groupVoice.push_back(entry);
     }
 
+    m_version++;
     __UNLOCK_TABLE();
 }
 
@@ -206,6 +205,7 @@ void TalkgroupRulesLookup::addEntry(TalkgroupRuleGroupVoice groupVoice)
         m_groupVoice.push_back(entry);
     }
 
+    m_version++;
     __UNLOCK_TABLE();
 }
 
@@ -221,6 +221,7 @@ void TalkgroupRulesLookup::eraseEntry(uint32_t id, uint8_t slot)
         });
     if (it != m_groupVoice.end()) {
         m_groupVoice.erase(it);
+        m_version++;
     }
 
     __UNLOCK_TABLE();
@@ -234,7 +235,7 @@ TalkgroupRuleGroupVoice TalkgroupRulesLookup::find(uint32_t id, uint8_t slot)
 
     __SPINLOCK();
 
-    std::lock_guard<std::mutex> lock(s_mutex);
+    std::lock_guard<ProfiledMutex<>> lock(s_mutex);
     auto it = std::find_if(m_groupVoice.begin(), m_groupVoice.end(),
         [&](TalkgroupRuleGroupVoice& x)
         {
@@ -261,7 +262,7 @@ TalkgroupRuleGroupVoice TalkgroupRulesLookup::findByRewrite(uint32_t peerId, uin
 
     __SPINLOCK();
 
-    std::lock_guard<std::mutex> lock(s_mutex);
+    std::lock_guard<ProfiledMutex<>> lock(s_mutex);
     auto it = std::find_if(m_groupVoice.begin(), m_groupVoice.end(),
         [&](TalkgroupRuleGroupVoice& x) {
             if (x.config().rewrite().size() == 0)
@@ -337,7 +338,7 @@ bool TalkgroupRulesLookup::load()
 
     if (groupVoiceList.size() == 0U) {
         ::LogError(LOG_HOST, "No group voice rules list defined!");
-        s_locked = false;
+        __UNLOCK_TABLE();
         return false;
     }
 
@@ -370,6 +371,7 @@ bool TalkgroupRulesLookup::load()
         ::LogInfoEx(LOG_HOST, "Talkgroup NAME: %s SRC_TGID: %u SRC_TS: %u ACTIVE: %u PARROT: %u AFFILIATED: %u INCLUSIONS: %u EXCLUSIONS: %u REWRITES: %u ALWAYS: %u PREFERRED: %u PERMITTED RIDS: %u", groupName.c_str(), tgId, tgSlot, active, parrot, affil, incCount, excCount, rewrCount, alwyCount, prefCount, permRIDCount);
     }
 
+    m_version++;
     __UNLOCK_TABLE();
 
     size_t size = m_groupVoice.size();
@@ -394,7 +396,7 @@ bool TalkgroupRulesLookup::save(bool quiet)
         return false;
     }
 
-    std::lock_guard<std::mutex> lock(s_mutex);
+    std::lock_guard<ProfiledMutex<>> lock(s_mutex);
     
     // New list for our new group voice rules
     yaml::Node groupVoiceList;
@@ -22,10 +22,13 @@
 #define __TALKGROUP_RULES_LOOKUP_H__
 
 #include "common/Defines.h"
+#include "common/concurrent/reader_gate.h"
 #include "common/lookups/LookupTable.h"
+#include "common/LockProfiler.h"
 #include "common/yaml/Yaml.h"
 #include "common/Utils.h"
 
+#include <atomic>
 #include <string>
 #include <mutex>
 #include <unordered_map>
@@ -642,18 +645,26 @@ namespace lookups
          */
         const uint64_t lastLoadTime() const { return m_lastLoadTime; }
 
+        /**
+         * @brief Returns the version of this lookup table. The version is incremented whenever the
+         *  rules are changed, and can be used to cheaply determine if the rules have changed.
+         * @return uint32_t Table version.
+         */
+        uint32_t tableVersion() const { return m_version.load(); }
+
     private:
         std::string m_rulesFile;
         uint32_t m_reloadTime;
         yaml::Node m_rules;
 
         uint64_t m_lastLoadTime;
+        std::atomic<uint32_t> m_version;
 
         bool m_acl;
         bool m_stop;
 
-        static std::mutex s_mutex;  //!< Mutex used for change locking.
-        static bool s_locked;       //!< Flag used for read locking (prevents find lookups), should be used when atomic operations (add/erase/etc) are being used.
+        static ProfiledMutex<> s_mutex;         //!< Mutex used for change locking.
+        static concurrent::reader_gate s_gate;  //!< Gate used for read locking (prevents find lookups), should be used when atomic operations (add/erase/etc) are being used.
 
         /**
          * @brief Loads the table from the passed lookup table file.
@@ -17,6 +17,7 @@
 #include "common/p25/dfsi/DFSIDefines.h"
 #include "common/p25/dfsi/LC.h"
 #include "common/p25/kmm/KMMModifyKey.h"
+#include "common/edac/SHA256.h"
 #include "network/BaseNetwork.h"
 #include "Utils.h"
 
@@ -1073,6 +1074,26 @@ uint16_t BaseNetwork::pktSeq(bool reset)
     return curr;
 }
 
+/* Helper to create the proof a peer resuming a session answers the login salt with. */
+
+std::string BaseNetwork::createResumeProof(const std::string& password, const uint8_t* ticket, const uint8_t* salt)
+{
+    assert(ticket != nullptr);
+    assert(salt != nullptr);
+
+    uint8_t secret[edac::SHA256_DIGEST_SIZE];
+    edac::SHA256::hmac((const uint8_t*)password.data(), (uint32_t)password.size(), ticket, RESUME_TICKET_LEN, secret);
+
+    uint8_t proof[edac::SHA256_DIGEST_SIZE];
+    edac::SHA256::hmac(secret, edac::SHA256_DIGEST_SIZE, salt, sizeof(uint32_t), proof);
+
+    char hex[(edac::SHA256_DIGEST_SIZE * 2U) + 1U];
+    for (uint32_t i = 0U; i < edac::SHA256_DIGEST_SIZE; i++)
+        ::snprintf(hex + (i * 2U), 3U, "%02X", proof[i]);
+
+    return std::string(hex, edac::SHA256_DIGEST_SIZE * 2U);
+}
+
 /* Creates an DMR frame message. */
 
 UInt8Array BaseNetwork::createDMR_Message(uint32_t& length, const uint32_t streamId, const dmr::data::NetData& data)
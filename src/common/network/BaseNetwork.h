@@ -98,6 +98,10 @@ namespace network
 
     const uint32_t  HA_PARAMS_ENTRY_LEN = 20U;
 
+    const uint32_t  RESUME_TICKET_LEN = 28U;        // 4 byte peer ID + 8 byte expiry + 16 byte truncated HMAC-SHA256
+    const uint8_t   RPTC_ACK_FLAG_RESUME_TICKET = 0x40U;
+    const uint8_t   RPTL_ACK_RESUMED = 0x01U;
+
     /**
      * @brief Network Peer Connection Status
      * @ingroup network_core
@@ -1005,6 +1009,17 @@ namespace network
          */
         uint32_t createStreamId() { std::uniform_int_distribution<uint32_t> dist(DVM_RAND_MIN, DVM_RAND_MAX); return dist(m_random); }
 
+        /**
+         * @brief Helper to create the proof a peer resuming a session answers the login salt with.
+         *  (NOTE: The proof is the HMAC-SHA256 of the salt, keyed with the ticket secret; the ticket secret
+         *  is the HMAC-SHA256 of the ticket, keyed with the peer password, and is never sent.)
+         * @param password Peer password.
+         * @param[in] ticket Session resumption ticket (RESUME_TICKET_LEN bytes).
+         * @param[in] salt Login salt (4 bytes).
+         * @returns std::string Proof, as a hexadecimal string.
+         */
+        static std::string createResumeProof(const std::string& password, const uint8_t* ticket, const uint8_t* salt);
+
         /**
          * @brief Creates an DMR frame message.
          * \code{.unparsed}
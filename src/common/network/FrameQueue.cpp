@@ -28,7 +28,7 @@ using namespace network::frame;
 //  Static Class Members
 // ---------------------------------------------------------------------------
 
-std::mutex FrameQueue::s_timestampMtx;
+ProfiledMutex<> FrameQueue::s_timestampMtx("FrameQueue::s_timestampMtx");
 std::unordered_map<uint32_t, uint32_t> FrameQueue::s_streamTimestamps;
 
 // ---------------------------------------------------------------------------
@@ -218,7 +218,7 @@ void FrameQueue::enqueueMessage(udp::BufferQueue* queue, const uint8_t* message,
 
 void FrameQueue::clearTimestamps()
 {
-    std::lock_guard<std::mutex> lock(s_timestampMtx);
+    std::lock_guard<ProfiledMutex<>> lock(s_timestampMtx);
     s_streamTimestamps.clear();
 }
 
@@ -230,7 +230,7 @@ void FrameQueue::clearTimestamps()
 
 uint32_t FrameQueue::findTimestamp(uint32_t streamId)
 {
-    std::lock_guard<std::mutex> lock(s_timestampMtx);
+    std::lock_guard<ProfiledMutex<>> lock(s_timestampMtx);
     auto it = s_streamTimestamps.find(streamId);
     if (it != s_streamTimestamps.end()) {
         return it->second;
@@ -243,7 +243,7 @@ uint32_t FrameQueue::findTimestamp(uint32_t streamId)
 
 void FrameQueue::setTimestamp(uint32_t streamId, uint32_t timestamp)
 {
-    std::lock_guard<std::mutex> lock(s_timestampMtx);
+    std::lock_guard<ProfiledMutex<>> lock(s_timestampMtx);
     if (streamId == 0U || timestamp == INVALID_TS) {
         LogError(LOG_NET, "FrameQueue::setTimestamp(), invalid streamId or timestamp");
         return;
@@ -256,7 +256,7 @@ void FrameQueue::setTimestamp(uint32_t streamId, uint32_t timestamp)
 
 void FrameQueue::eraseTimestamp(uint32_t streamId)
 {
-    std::lock_guard<std::mutex> lock(s_timestampMtx);
+    std::lock_guard<ProfiledMutex<>> lock(s_timestampMtx);
     s_streamTimestamps.erase(streamId);
 }
 
@@ -20,6 +20,7 @@
 #include "common/network/RTPHeader.h"
 #include "common/network/RTPFNEHeader.h"
 #include "common/network/RawFrameQueue.h"
+#include "common/LockProfiler.h"
 
 #include <mutex>
 #include <vector>
@@ -121,7 +122,7 @@ namespace network
     private:
         uint32_t m_peerId;
 
-        static std::mutex s_timestampMtx;
+        static ProfiledMutex<> s_timestampMtx;
         static std::unordered_map<uint32_t, uint32_t> s_streamTimestamps;
 
         /**
@@ -12,6 +12,7 @@
 #include "common/edac/SHA256.h"
 #include "common/json/json.h"
 #include "common/network/RPCHeader.h"
+#include "common/EventTrace.h"
 #include "common/Log.h"
 #include "common/Thread.h"
 #include "common/Utils.h"
@@ -44,7 +45,8 @@ NetRPC::NetRPC(const std::string& address, uint16_t port, uint16_t localPort, co
     m_frameQueue(nullptr),
     m_password(password),
     m_handlers(),
-    m_handlerReplied()
+    m_handlerReplied(),
+    m_handlerLock()
 {
     assert(!address.empty());
     assert(port > 0U);
@@ -139,16 +141,23 @@ void NetRPC::clock(uint32_t ms)
         json::object response;
 
         // find RPC function callback
-        if (m_handlers.find(rpcHeader.getFunction()) != m_handlers.end()) {
+        RPCType handler = nullptr;
+        if (findHandler(rpcHeader.getFunction(), handler)) {
             bool isReply = (rpcHeader.getFunction() & RPC_REPLY_FUNC) == RPC_REPLY_FUNC;
             if (isReply) {
+                std::lock_guard<std::mutex> lock(m_handlerLock);
                 m_handlerReplied[rpcHeader.getFunction()] = true;
             }
 
-            m_handlers[rpcHeader.getFunction()](request, response);
+            {
+                EventTraceScope trace(TRACE_EVENT::RPC_HANDLER);
+                trace.setArg(rpcHeader.getFunction());
+                handler(request, response);
+            }
 
             // remove the reply handler (these should be temporary)
             if (isReply) {
+                std::lock_guard<std::mutex> lock(m_handlerLock);
                 m_handlers.erase(rpcHeader.getFunction());
             } else {
                 reply(rpcHeader.getFunction(), response, address, addrLen);
@@ -156,7 +165,10 @@ void NetRPC::clock(uint32_t ms)
         } else {
             bool isReply = (rpcHeader.getFunction() & RPC_REPLY_FUNC) == RPC_REPLY_FUNC;
             if (isReply) {
-                m_handlerReplied[rpcHeader.getFunction()] = true;
+                {
+                    std::lock_guard<std::mutex> lock(m_handlerLock);
+                    m_handlerReplied[rpcHeader.getFunction()] = true;
+                }
 
                 if (!request["status"].is<int>()) {
                     ::LogError(LOG_NET, "RPC %s:%u, invalid RPC response", udp::Socket::address(address).c_str(), udp::Socket::port(address));
@@ -196,6 +208,15 @@ bool NetRPC::req(uint16_t func, const json::object& request, RPCType reply, std:
 bool NetRPC::req(uint16_t func, const json::object& request, RPCType reply, sockaddr_storage& address, uint32_t addrLen,
     bool blocking)
 {
+    // make sure we're not trying to send an RPC request to ourselves
+    if (m_address == udp::Socket::address(address) && m_port == udp::Socket::port(address)) {
+        LogError(LOG_NET, "RPC, cowardly refusing to send RPC to ourselves");
+        return false;
+    }
+
+    EventTraceScope trace(TRACE_EVENT::RPC_REQUEST);
+    trace.setArg(func);
+
     json::value v = json::value(request);
     std::string json = v.serialize();
 
@@ -204,12 +225,6 @@ bool NetRPC::req(uint16_t func, const json::object& request, RPCType reply, sock
             udp::Socket::address(address).c_str(), udp::Socket::port(address), func, json.length() + 1U);
     }
 
-    // make sure we're not trying to send an RPC request to ourselves
-    if (m_address == udp::Socket::address(address) && m_port == udp::Socket::port(address)) {
-        LogError(LOG_NET, "RPC, cowardly refusing to send RPC to ourselves");
-        return false;
-    }
-
     // generate RPC header
     RPCHeader header = RPCHeader();
     header.setFunction(func & 0x3FFFU);
@@ -235,6 +250,7 @@ bool NetRPC::req(uint16_t func, const json::object& request, RPCType reply, sock
 
     // install reply handler
     if (reply != nullptr) {
+        std::lock_guard<std::mutex> lock(m_handlerLock);
         m_handlers[func | RPC_REPLY_FUNC] = reply;
         m_handlerReplied[func | RPC_REPLY_FUNC] = false;
     }
@@ -248,9 +264,11 @@ bool NetRPC::req(uint16_t func, const json::object& request, RPCType reply, sock
             // we only block for up to 200ms -- after we we treat the call as failed and return
             int timeout = REPLY_WAIT;
             while (timeout > 0) {
-                if (m_handlerReplied.find(func | RPC_REPLY_FUNC) != m_handlerReplied.end()) {
-                    if (m_handlerReplied[func | RPC_REPLY_FUNC]) {
-                        m_handlerReplied[func | RPC_REPLY_FUNC] = false;
+                {
+                    std::lock_guard<std::mutex> lock(m_handlerLock);
+                    auto it = m_handlerReplied.find(func | RPC_REPLY_FUNC);
+                    if (it != m_handlerReplied.end() && it->second) {
+                        it->second = false;
                         break;
                     }
                 }
@@ -332,6 +350,7 @@ bool NetRPC::registerHandler(uint16_t func, RPCType handler)
     if (func > RPC_MAX_FUNC)
         return false;
 
+    std::lock_guard<std::mutex> lock(m_handlerLock);
     auto it = std::find_if(m_handlers.begin(), m_handlers.end(), [&](RPCHandlerMapPair x) { return x.first == func; });
     if (it != m_handlers.end()) {
         LogError(LOG_HOST, "NetRPC::registerHandler() can't register RPC $%04X already registered. BUGBUG.", func);
@@ -353,6 +372,7 @@ bool NetRPC::unregisterHandler(uint16_t func)
     if (func > RPC_MAX_FUNC)
         return false;
 
+    std::lock_guard<std::mutex> lock(m_handlerLock);
     auto it = std::find_if(m_handlers.begin(), m_handlers.end(), [&](RPCHandlerMapPair x) { return x.first == func; });
     if (it != m_handlers.end()) {
         if (m_debug)
@@ -369,6 +389,20 @@ bool NetRPC::unregisterHandler(uint16_t func)
 //  Private Class Members
 // ---------------------------------------------------------------------------
 
+/* Helper to find a registered handler. */
+
+bool NetRPC::findHandler(uint16_t func, RPCType& handler)
+{
+    std::lock_guard<std::mutex> lock(m_handlerLock);
+
+    auto it = m_handlers.find(func);
+    if (it == m_handlers.end())
+        return false;
+
+    handler = it->second;
+    return true;
+}
+
 /* Writes an RPC reply to the network. */
 
 bool NetRPC::reply(uint16_t func, json::object& reply, sockaddr_storage& address, uint32_t addrLen)
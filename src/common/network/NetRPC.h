@@ -28,6 +28,7 @@
 #include <string>
 #include <cstdint>
 #include <functional>
+#include <mutex>
 #include <unordered_map>
 
 namespace network
@@ -165,6 +166,16 @@ namespace network
         typedef std::pair<const uint16_t, RPCType> RPCHandlerMapPair;
         std::map<uint16_t, RPCType> m_handlers;
         std::map<uint16_t, bool> m_handlerReplied;
+        // req() installs reply handlers from the REST and RPC threads, while clock() runs them
+        std::mutex m_handlerLock;
+
+        /**
+         * @brief Helper to find a registered handler.
+         * @param func Function opcode.
+         * @param[out] handler Function handler.
+         * @returns bool True, if a handler is registered, otherwise false.
+         */
+        bool findHandler(uint16_t func, RPCType& handler);
 
         /**
          * @brief Writes an RPC reply to the network.
@@ -62,6 +62,9 @@ Network::Network(const std::string& address, uint16_t port, uint16_t localPort,
     m_ridLookup(nullptr),
     m_tidLookup(nullptr),
     m_salt(nullptr),
+    m_resumeTicket(nullptr),
+    m_hasResumeTicket(false),
+    m_resumeProof(),
     m_retryTimer(1000U, DEFAULT_RETRY_TIME),
     m_retryCount(0U),
     m_maxRetryCount(MAX_RETRY_BEFORE_RECONNECT),
@@ -72,6 +75,9 @@ Network::Network(const std::string& address, uint16_t port, uint16_t localPort,
     m_loginStreamId(0U),
     m_metadata(nullptr),
     m_mux(nullptr),
+    m_metricNAKs(nullptr),
+    m_metricLostFrames(nullptr),
+    m_metricOutOfOrder(nullptr),
     m_remotePeerId(0U),
     m_promiscuousPeer(false),
     m_userHandleProtocol(false),
@@ -89,6 +95,8 @@ Network::Network(const std::string& address, uint16_t port, uint16_t localPort,
     assert(!password.empty());
 
     m_salt = new uint8_t[sizeof(uint32_t)];
+    m_resumeTicket = new uint8_t[RESUME_TICKET_LEN];
+    ::memset(m_resumeTicket, 0x00U, RESUME_TICKET_LEN);
 
     m_rxDMRStreamId = new uint32_t[2U];
     m_rxDMRStreamId[0U] = 0U;
@@ -102,6 +110,11 @@ Network::Network(const std::string& address, uint16_t port, uint16_t localPort,
 
     m_metadata = new PeerMetadata();
     m_mux = new RTPStreamMultiplex();
+
+    std::string labels = "peer=\"" + std::to_string(peerId) + "\"";
+    m_metricNAKs = metrics::Registry::counter("dvm_net_naks", "Negative acknowledgements received from the master.", labels);
+    m_metricLostFrames = metrics::Registry::counter("dvm_net_lost_frames", "Network frames detected as lost by RTP sequence.", labels);
+    m_metricOutOfOrder = metrics::Registry::counter("dvm_net_out_of_order_frames", "Network frames received out of RTP sequence order.", labels);
 }
 
 /* Finalizes a instance of the Network class. */
@@ -109,6 +122,7 @@ Network::Network(const std::string& address, uint16_t port, uint16_t localPort,
 Network::~Network()
 {
     delete[] m_salt;
+    delete[] m_resumeTicket;
     delete[] m_rxDMRStreamId;
     delete[] m_rxP25P2StreamId;
     delete m_metadata;
@@ -366,10 +380,12 @@ void Network::clock(uint32_t ms)
 
                                 MULTIPLEX_RET_CODE ret = m_mux->verifyStream(streamId, rtpHeader.getSequence(), fneHeader.getFunction(), &lastRxSeq);
                                 if (ret == MUX_LOST_FRAMES) {
+                                    m_metricLostFrames->inc();
                                     LogError(LOG_NET, "PEER %u stream %u possible lost frames; got %u, expected %u", peerId,
                                         streamId, rtpHeader.getSequence(), lastRxSeq, rtpHeader.getSequence());
                                 }
                                 else if (ret == MUX_OUT_OF_ORDER) {
+                                    m_metricOutOfOrder->inc();
                                     LogError(LOG_NET, "PEER %u stream %u out-of-order; got %u, expected >%u", peerId,
                                         streamId, rtpHeader.getSequence(), lastRxSeq);
                                 }
@@ -451,10 +467,12 @@ void Network::clock(uint32_t ms)
 
                                 MULTIPLEX_RET_CODE ret = m_mux->verifyStream(streamId, rtpHeader.getSequence(), fneHeader.getFunction(), &lastRxSeq);
                                 if (ret == MUX_LOST_FRAMES) {
+                                    m_metricLostFrames->inc();
                                     LogError(LOG_NET, "PEER %u stream %u possible lost frames; got %u, expected %u", peerId,
                                         streamId, rtpHeader.getSequence(), lastRxSeq, rtpHeader.getSequence());
                                 }
                                 else if (ret == MUX_OUT_OF_ORDER) {
+                                    m_metricOutOfOrder->inc();
                                     LogError(LOG_NET, "PEER %u stream %u out-of-order; got %u, expected >%u", peerId,
                                         streamId, rtpHeader.getSequence(), lastRxSeq);
                                 }
@@ -547,10 +565,12 @@ void Network::clock(uint32_t ms)
 
                                 MULTIPLEX_RET_CODE ret = m_mux->verifyStream(streamId, rtpHeader.getSequence(), fneHeader.getFunction(), &lastRxSeq);
                                 if (ret == MUX_LOST_FRAMES) {
+                                    m_metricLostFrames->inc();
                                     LogError(LOG_NET, "PEER %u stream %u possible lost frames; got %u, expected %u", peerId,
                                         streamId, rtpHeader.getSequence(), lastRxSeq, rtpHeader.getSequence());
                                 }
                                 else if (ret == MUX_OUT_OF_ORDER) {
+                                    m_metricOutOfOrder->inc();
                                     LogError(LOG_NET, "PEER %u stream %u out-of-order; got %u, expected >%u", peerId,
                                         streamId, rtpHeader.getSequence(), lastRxSeq);
                                 }
@@ -632,10 +652,12 @@ void Network::clock(uint32_t ms)
 
                                 MULTIPLEX_RET_CODE ret = m_mux->verifyStream(streamId, rtpHeader.getSequence(), fneHeader.getFunction(), &lastRxSeq);
                                 if (ret == MUX_LOST_FRAMES) {
+                                    m_metricLostFrames->inc();
                                     LogError(LOG_NET, "PEER %u stream %u possible lost frames; got %u, expected %u", peerId,
                                         streamId, rtpHeader.getSequence(), lastRxSeq, rtpHeader.getSequence());
                                 }
                                 else if (ret == MUX_OUT_OF_ORDER) {
+                                    m_metricOutOfOrder->inc();
                                     LogError(LOG_NET, "PEER %u stream %u out-of-order; got %u, expected >%u", peerId,
                                         streamId, rtpHeader.getSequence(), lastRxSeq);
                                 }
@@ -717,10 +739,12 @@ void Network::clock(uint32_t ms)
 
                                 MULTIPLEX_RET_CODE ret = m_mux->verifyStream(streamId, rtpHeader.getSequence(), fneHeader.getFunction(), &lastRxSeq);
                                 if (ret == MUX_LOST_FRAMES) {
+                                    m_metricLostFrames->inc();
                                     LogError(LOG_NET, "PEER %u stream %u possible lost frames; got %u, expected %u", peerId,
                                         streamId, rtpHeader.getSequence(), lastRxSeq, rtpHeader.getSequence());
                                 }
                                 else if (ret == MUX_OUT_OF_ORDER) {
+                                    m_metricOutOfOrder->inc();
                                     LogError(LOG_NET, "PEER %u stream %u out-of-order; got %u, expected >%u", peerId,
                                         streamId, rtpHeader.getSequence(), lastRxSeq);
                                 }
@@ -1099,6 +1123,11 @@ void Network::clock(uint32_t ms)
 
         case NET_FUNC::NAK:                                             // Master Negative Ack
             {
+                m_metricNAKs->inc();
+
+                // a NAK invalidates any session resumption ticket, the next login performs the full exchange
+                m_hasResumeTicket = false;
+
                 // DVM 3.6 adds support to respond with a NAK reason, as such we just check if the NAK response is greater
                 // then 10 bytes and process the reason value
                 uint16_t reason = 0U;
@@ -1173,6 +1202,22 @@ void Network::clock(uint32_t ms)
                         LogInfoEx(LOG_NET, "PEER %u RPTL ACK, performing login exchange, remotePeerId = %u", m_peerId, rtpHeader.getSSRC());
 
                         ::memcpy(m_salt, buffer.get() + 6U, sizeof(uint32_t));
+
+                        // the master accepted our session resumption ticket, skip the challenge
+                        if (length >= 15 && buffer[10U] == RPTL_ACK_RESUMED && m_hasResumeTicket) {
+                            LogInfoEx(LOG_NET, "PEER %u RPTL ACK, session resumed, performing configuration exchange, remotePeerId = %u", m_peerId, rtpHeader.getSSRC());
+                            m_hasResumeTicket = false;
+                            m_resumeProof = createResumeProof(m_password, m_resumeTicket, m_salt);
+
+                            writeConfig();
+
+                            m_status = NET_STAT_WAITING_CONFIG;
+                            m_timeoutTimer.start();
+                            m_retryTimer.start();
+                            break;
+                        }
+
+                        m_resumeProof.clear();
                         writeAuthorisation();
 
                         m_status = NET_STAT_WAITING_AUTHORISATION;
@@ -1214,6 +1259,13 @@ void Network::clock(uint32_t ms)
                                 LogError(LOG_NET, "PEER %u RPTC ACK, master does not enable secondary port for metadata, diagnostic and activity logging are disabled, remotePeerId = %u", m_peerId, rtpHeader.getSSRC());
                                 LogError(LOG_NET, "PEER %u RPTC ACK, **please update your FNE**, secondary port for metadata, is required for all services as of R05A04, remotePeerId = %u", m_peerId, rtpHeader.getSSRC());
                             }
+
+                            // store the session resumption ticket, if the master issued one
+                            if ((buffer[6U] & RPTC_ACK_FLAG_RESUME_TICKET) == RPTC_ACK_FLAG_RESUME_TICKET && 
+                                length >= (int)(7U + RESUME_TICKET_LEN)) {
+                                ::memcpy(m_resumeTicket, buffer.get() + 7U, RESUME_TICKET_LEN);
+                                m_hasResumeTicket = true;
+                            }
                         }
                         break;
                     default:
@@ -1258,6 +1310,12 @@ void Network::clock(uint32_t ms)
                 if (dt > MAX_SERVER_DIFF)
                     LogWarning(LOG_NET, "PEER %u pong, time delay greater than %llums, now = %llu, server = %llu, dt = %llu", m_peerId, MAX_SERVER_DIFF, now, serverNow, dt);
 
+                // the master refreshes our session resumption ticket with each pong
+                if (length >= (int)(14U + RESUME_TICKET_LEN)) {
+                    ::memcpy(m_resumeTicket, buffer.get() + 14U, RESUME_TICKET_LEN);
+                    m_hasResumeTicket = true;
+                }
+
                 ++m_pingsReceived;
 
                 // if we've been connected for at least 10 PING/PONG cycles and we're flagged duplicate connection, clear the flag
@@ -1410,6 +1468,7 @@ MULTIPLEX_RET_CODE Network::verifyStream(uint16_t* lastRxSeq)
             // assume a packet was lost
             if ((m_pktSeq != 0U) && m_pktSeq > m_pktLastSeq + 1U) {
                 ret = MUX_LOST_FRAMES;
+                m_metricLostFrames->inc(m_pktSeq - m_pktLastSeq - 1U);
             }
 
             m_pktLastSeq = m_pktSeq;
@@ -1417,6 +1476,7 @@ MULTIPLEX_RET_CODE Network::verifyStream(uint16_t* lastRxSeq)
         else {
             if (m_pktSeq < m_pktLastSeq) {
                 ret = MUX_OUT_OF_ORDER;
+                m_metricOutOfOrder->inc();
             }
         }
     }
@@ -1446,16 +1506,23 @@ bool Network::writeLogin()
         m_retryTimer.stop();
     m_retryTimer.setTimeout(DEFAULT_RETRY_TIME);
 
-    uint8_t buffer[8U];
+    uint8_t buffer[8U + RESUME_TICKET_LEN];
     ::memcpy(buffer + 0U, TAG_REPEATER_LOGIN, 4U);
     SET_UINT32(m_peerId, buffer, 4U);                                               // Peer ID
 
+    // offer the session resumption ticket from our last session, if we have one
+    uint32_t len = 8U;
+    if (m_hasResumeTicket) {
+        ::memcpy(buffer + 8U, m_resumeTicket, RESUME_TICKET_LEN);                   // Resumption Ticket
+        len += RESUME_TICKET_LEN;
+    }
+
     if (m_packetDump)
-        Utils::dump(1U, "Network::writeLogin(), Message, Login", buffer, 8U);
+        Utils::dump(1U, "Network::writeLogin(), Message, Login", buffer, len);
 
     m_loginStreamId = createStreamId();
     m_remotePeerId = 0U;
-    return writeMaster({ NET_FUNC::RPTL, NET_SUBFUNC::NOP }, buffer, 8U, pktSeq(true), m_loginStreamId);
+    return writeMaster({ NET_FUNC::RPTL, NET_SUBFUNC::NOP }, buffer, len, pktSeq(true), m_loginStreamId);
 }
 
 /* Writes network authentication challenge. */
@@ -1535,6 +1602,7 @@ bool Network::writeConfig()
     config["conventionalPeer"].set<bool>(m_metadata->isConventional);               // Conventional Peer Marker
 
     config["software"].set<std::string>(std::string(software));
+    writeResumeProof(config);
 
     json::value v = json::value(config);
     std::string json = v.serialize();
@@ -1551,6 +1619,15 @@ bool Network::writeConfig()
     return writeMaster({ NET_FUNC::RPTC, NET_SUBFUNC::NOP }, (uint8_t*)buffer, json.length() + 8U, RTP_END_OF_CALL_SEQ, m_loginStreamId);
 }
 
+/* Helper to add the session resumption proof to the configuration sent to the master. */
+
+void Network::writeResumeProof(json::object& config)
+{
+    if (!m_resumeProof.empty()) {
+        config["resumeProof"].set<std::string>(m_resumeProof);                      // Session Resumption Proof
+    }
+}
+
 /* Writes a network stay-alive ping. */
 
 bool Network::writePing()
@@ -22,6 +22,7 @@
 #include "common/network/RTPFNEHeader.h"
 #include "common/lookups/RadioIdLookup.h"
 #include "common/lookups/TalkgroupRulesLookup.h"
+#include "common/Metrics.h"
 #include "common/p25/kmm/KeysetItem.h"
 
 #include <string>
@@ -323,6 +324,9 @@ namespace network
         lookups::TalkgroupRulesLookup* m_tidLookup;
 
         uint8_t* m_salt;
+        uint8_t* m_resumeTicket;
+        bool m_hasResumeTicket;
+        std::string m_resumeProof;
 
         Timer m_retryTimer;
         uint8_t m_retryCount;
@@ -344,6 +348,10 @@ namespace network
         PeerMetadata* m_metadata;
         RTPStreamMultiplex* m_mux;
 
+        metrics::Counter* m_metricNAKs;
+        metrics::Counter* m_metricLostFrames;
+        metrics::Counter* m_metricOutOfOrder;
+
         uint32_t m_remotePeerId;
 
         /**
@@ -495,6 +503,7 @@ namespace network
          *          "channelNo": <Channel Number from the IDEN channel bandplan>,
          *      },
          *      "software": "<Textual hardcoded string containing software watermark>",
+         *      "resumeProof": "<Session resumption proof, only sent when resuming a session>",
          *  }
          * 
          * These are extra parameters used in the root of the above JSON.
@@ -510,6 +519,12 @@ namespace network
          * @returns bool True, if configuration response was sent, otherwise false.
          */
         virtual bool writeConfig();
+        /**
+         * @brief Helper to add the session resumption proof to the configuration sent to the master.
+         *  (NOTE: Overrides of writeConfig() must call this, or a session resumption fails.)
+         * @param config Configuration JSON object.
+         */
+        void writeResumeProof(json::object& config);
         /**
          * @brief Writes a network stay-alive ping.
          * \code{.unparsed}
@@ -120,7 +120,12 @@ bool PacketBuffer::decode(const uint8_t* data, uint8_t** message, uint32_t* outL
         uint32_t compressedLen = fragments[0]->compressedSize;
         uint32_t len = fragments[0]->size;
 
-        DECLARE_UINT8_ARRAY(buffer, len + 1U);
+        // every block is copied whole (including the partial last block), so the buffer must hold all of them
+        uint32_t bufferLen = len + 1U;
+        if (bufferLen < fragments.size() * FRAG_BLOCK_SIZE)
+            bufferLen = fragments.size() * FRAG_BLOCK_SIZE;
+
+        DECLARE_UINT8_ARRAY(buffer, bufferLen);
         if (fragments.size() == 1U) {
             ::memcpy(buffer, fragments[0U]->data, len);
         } else {
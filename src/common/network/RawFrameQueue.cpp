@@ -23,7 +23,7 @@ using namespace network;
 //  Static Class Members
 // ---------------------------------------------------------------------------
 
-std::mutex RawFrameQueue::s_flushMtx;
+ProfiledMutex<> RawFrameQueue::s_flushMtx("RawFrameQueue::s_flushMtx");
 
 // ---------------------------------------------------------------------------
 //  Public Class Members
@@ -165,7 +165,7 @@ bool RawFrameQueue::flushQueue(udp::BufferQueue* queue)
         return false;
     }
 
-    std::lock_guard<std::mutex> lock(s_flushMtx);
+    std::lock_guard<ProfiledMutex<>> lock(s_flushMtx);
 
     if (queue->empty()) {
         return false;
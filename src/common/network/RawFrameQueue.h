@@ -18,6 +18,7 @@
 
 #include "common/Defines.h"
 #include "common/network/udp/Socket.h"
+#include "common/LockProfiler.h"
 #include "common/Utils.h"
 
 #include <mutex>
@@ -103,7 +104,7 @@ namespace network
         uint32_t m_addrLen;
         udp::Socket* m_socket;
 
-        static std::mutex s_flushMtx;
+        static ProfiledMutex<> s_flushMtx;
 
         uint32_t m_failedReadCnt;
 
@@ -0,0 +1,553 @@
+// SPDX-License-Identifier: GPL-2.0-only
+/*
+ * Digital Voice Modem - Common Library
+ * GPLv2 Open Source. Use is subject to license terms.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ *  Copyright (C) 2026 Bryan Biedenkapp, N2PLL
+ *
+ */
+#include "Defines.h"
+#include "network/udp/IoUring.h"
+#include "Log.h"
+
+#if defined(HAVE_IO_URING)
+
+using namespace network;
+using namespace network::udp;
+
+#include <cassert>
+#include <cerrno>
+#include <cstring>
+
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+// ---------------------------------------------------------------------------
+//  Constants
+// ---------------------------------------------------------------------------
+
+const uint64_t RECV_TAG = 0xFFFFFFFFFFFFFFFFULL;
+const uint16_t RECV_BUFFER_GROUP = 0U;
+
+const uint32_t RX_SQ_ENTRIES = 4U;
+
+// ---------------------------------------------------------------------------
+//  Global Functions
+// ---------------------------------------------------------------------------
+
+/* Helper to call io_uring_setup(). */
+
+static int sysSetup(uint32_t entries, io_uring_params* params)
+{
+    return (int)::syscall(__NR_io_uring_setup, entries, params);
+}
+
+/* Helper to call io_uring_enter(). */
+
+static int sysEnter(int fd, uint32_t toSubmit, uint32_t minComplete, uint32_t flags)
+{
+    return (int)::syscall(__NR_io_uring_enter, fd, toSubmit, minComplete, flags, nullptr, 0);
+}
+
+/* Helper to call io_uring_register(). */
+
+static int sysRegister(int fd, uint32_t opcode, void* arg, uint32_t nrArgs)
+{
+    return (int)::syscall(__NR_io_uring_register, fd, opcode, arg, nrArgs);
+}
+
+// ---------------------------------------------------------------------------
+//  Public Class Members
+// ---------------------------------------------------------------------------
+
+/* Initializes a new instance of the IoUring class. */
+
+IoUring::IoUring(int fd) :
+    m_fd(fd),
+    m_failed(false),
+    m_rxMutex(),
+    m_rx(),
+    m_armed(false),
+    m_recvMsg(),
+    m_bufRing(nullptr),
+    m_bufRingSize(0U),
+    m_bufs(nullptr),
+    m_bufTail(0U),
+    m_txMutex(),
+    m_tx(),
+    m_slots(nullptr),
+    m_freeSlots()
+{
+    assert(fd >= 0);
+
+    ::memset(&m_rx, 0x00U, sizeof(Ring));
+    ::memset(&m_tx, 0x00U, sizeof(Ring));
+    m_rx.fd = -1;
+    m_tx.fd = -1;
+}
+
+/* Finalizes a instance of the IoUring class. */
+
+IoUring::~IoUring()
+{
+    close();
+}
+
+/* Sets up the receive and send rings. */
+
+bool IoUring::open()
+{
+    close();
+
+    if (!setupRing(m_rx, RX_SQ_ENTRIES, RECV_BUFFERS * 2U))
+        return false;
+    if (!setupRing(m_tx, SEND_SLOTS, SEND_SLOTS * 2U)) {
+        close();
+        return false;
+    }
+
+    // make sure the kernel supports the operations we use
+    size_t probeLen = sizeof(io_uring_probe) + (256U * sizeof(io_uring_probe_op));
+    std::vector<uint8_t> probeBuf(probeLen, 0U);
+    io_uring_probe* probe = reinterpret_cast<io_uring_probe*>(probeBuf.data());
+    if (sysRegister(m_rx.fd, IORING_REGISTER_PROBE, probe, 256U) < 0 ||
+        probe->last_op < IORING_OP_RECVMSG || probe->last_op < IORING_OP_SENDMSG ||
+        (probe->ops[IORING_OP_RECVMSG].flags & IO_URING_OP_SUPPORTED) == 0U ||
+        (probe->ops[IORING_OP_SENDMSG].flags & IO_URING_OP_SUPPORTED) == 0U) {
+        close();
+        return false;
+    }
+
+    // register the provided receive buffers
+    m_bufRingSize = RECV_BUFFERS * sizeof(io_uring_buf);
+    void* p = ::mmap(nullptr, m_bufRingSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_ANONYMOUS | MAP_POPULATE, -1, 0);
+    if (p == MAP_FAILED) {
+        m_bufRingSize = 0U;
+        close();
+        return false;
+    }
+    m_bufRing = reinterpret_cast<io_uring_buf_ring*>(p);
+    ::memset(m_bufRing, 0x00U, m_bufRingSize);
+    m_bufs = new uint8_t[RECV_BUFFERS * RECV_BUFFER_SIZE];
+
+    io_uring_buf_reg reg;
+    ::memset(&reg, 0x00U, sizeof(reg));
+    reg.ring_addr = (uint64_t)(uintptr_t)m_bufRing;
+    reg.ring_entries = RECV_BUFFERS;
+    reg.bgid = RECV_BUFFER_GROUP;
+    if (sysRegister(m_rx.fd, IORING_REGISTER_PBUF_RING, &reg, 1U) < 0) {
+        close();
+        return false;
+    }
+
+    m_bufTail = 0U;
+    for (uint32_t i = 0U; i < RECV_BUFFERS; i++)
+        recycle((uint16_t)i);
+
+    ::memset(&m_recvMsg, 0x00U, sizeof(m_recvMsg));
+    m_recvMsg.msg_namelen = sizeof(sockaddr_storage);
+
+    // set up the send slots
+    m_slots = new SendSlot[SEND_SLOTS];
+    m_freeSlots.clear();
+    m_freeSlots.reserve(SEND_SLOTS);
+    for (uint32_t i = 0U; i < SEND_SLOTS; i++)
+        m_freeSlots.push_back(SEND_SLOTS - 1U - i);
+
+    m_failed = false;
+    m_armed = false;
+    return true;
+}
+
+/* Tears down the receive and send rings, cancelling any outstanding operations. */
+
+void IoUring::close()
+{
+    std::lock_guard<std::mutex> rxLock(m_rxMutex);
+    std::lock_guard<std::mutex> txLock(m_txMutex);
+
+    // closing the ring cancels the outstanding operations and waits for them, so the buffers are
+    // safe to release afterwards
+    teardownRing(m_rx);
+    teardownRing(m_tx);
+    m_armed = false;
+
+    if (m_bufRing != nullptr) {
+        ::munmap(m_bufRing, m_bufRingSize);
+        m_bufRing = nullptr;
+        m_bufRingSize = 0U;
+    }
+
+    if (m_bufs != nullptr) {
+        delete[] m_bufs;
+        m_bufs = nullptr;
+    }
+
+    if (m_slots != nullptr) {
+        delete[] m_slots;
+        m_slots = nullptr;
+    }
+    m_freeSlots.clear();
+}
+
+/* Reads a datagram. */
+
+ssize_t IoUring::read(uint8_t* buffer, uint32_t length, sockaddr_storage& address, socklen_t& addrLen)
+{
+    assert(buffer != nullptr);
+
+    std::lock_guard<std::mutex> lock(m_rxMutex);
+    if (m_rx.fd < 0 || m_failed)
+        return -1;
+
+    if (!m_armed && !arm())
+        return -1;
+
+    io_uring_cqe* cqe = peekCqe(m_rx);
+    if (cqe == nullptr) {
+        // completions that did not fit the completion queue are held by the kernel until we enter
+        if ((__atomic_load_n(m_rx.sqFlags, __ATOMIC_ACQUIRE) & IORING_SQ_CQ_OVERFLOW) == 0U)
+            return 0;
+
+        sysEnter(m_rx.fd, 0U, 0U, IORING_ENTER_GETEVENTS);
+        cqe = peekCqe(m_rx);
+        if (cqe == nullptr)
+            return 0;
+    }
+
+    int32_t res = cqe->res;
+    uint32_t flags = cqe->flags;
+    advanceCq(m_rx);
+
+    // the multishot receive terminated; it is re-armed on the next read
+    if ((flags & IORING_CQE_F_MORE) == 0U)
+        m_armed = false;
+
+    if (res < 0) {
+        if (res == -ENOBUFS)
+            return 0;
+
+        if (res == -EINVAL || res == -EOPNOTSUPP) {
+            LogError(LOG_NET, "Kernel does not support io_uring multishot receive, err: %d (%s)", -res, strerror(-res));
+            m_failed = true;
+        }
+        else if (res != -ECANCELED) {
+            LogError(LOG_NET, "Error returned from io_uring recvmsg, err: %d (%s)", -res, strerror(-res));
+        }
+
+        return -1;
+    }
+
+    if ((flags & IORING_CQE_F_BUFFER) == 0U)
+        return 0;
+
+    uint16_t bid = (uint16_t)(flags >> IORING_CQE_BUFFER_SHIFT);
+    uint8_t* buf = m_bufs + ((size_t)bid * RECV_BUFFER_SIZE);
+
+    // buffer layout: io_uring_recvmsg_out, name, control, payload
+    io_uring_recvmsg_out* out = reinterpret_cast<io_uring_recvmsg_out*>(buf);
+    uint32_t offset = sizeof(io_uring_recvmsg_out) + m_recvMsg.msg_namelen + (uint32_t)m_recvMsg.msg_controllen;
+    if ((uint32_t)res < offset || (out->flags & MSG_TRUNC) != 0) {
+        LogError(LOG_NET, "Discarding truncated datagram from io_uring recvmsg, len = %u", out->payloadlen);
+        recycle(bid);
+        return -1;
+    }
+
+    uint32_t nameLen = out->namelen;
+    if (nameLen > sizeof(sockaddr_storage))
+        nameLen = sizeof(sockaddr_storage);
+    ::memset(&address, 0x00U, sizeof(sockaddr_storage));
+    ::memcpy(&address, buf + sizeof(io_uring_recvmsg_out), nameLen);
+    addrLen = (socklen_t)nameLen;
+
+    uint32_t len = out->payloadlen;
+    if (len > length)
+        len = length;
+    ::memcpy(buffer, buf + offset, len);
+
+    recycle(bid);
+    return (ssize_t)len;
+}
+
+/* Writes a batch of datagrams. */
+
+ssize_t IoUring::write(const struct mmsghdr* headers, uint32_t count)
+{
+    assert(headers != nullptr);
+
+    std::lock_guard<std::mutex> lock(m_txMutex);
+    if (m_tx.fd < 0)
+        return -1;
+
+    reapSends();
+
+    ssize_t total = 0;
+    bool error = false;
+    for (uint32_t i = 0U; i < count; i++) {
+        const struct msghdr& hdr = headers[i].msg_hdr;
+        if (hdr.msg_iovlen != 1U || hdr.msg_iov == nullptr)
+            continue;
+
+        size_t len = hdr.msg_iov[0].iov_len;
+        io_uring_sqe* sqe = nullptr;
+        if (len <= SEND_SLOT_SIZE && hdr.msg_namelen <= sizeof(sockaddr_storage) && !m_freeSlots.empty())
+            sqe = getSqe(m_tx);
+
+        // too large for a send slot or no free slots; send inline
+        if (sqe == nullptr) {
+            ssize_t sent = ::sendmsg(m_fd, &hdr, 0);
+            if (sent < 0) {
+                LogError(LOG_NET, "Error returned from sendmsg, err: %d (%s)", errno, strerror(errno));
+                error = true;
+            }
+            else {
+                total += sent;
+            }
+            continue;
+        }
+
+        uint32_t slotNo = m_freeSlots.back();
+        m_freeSlots.pop_back();
+
+        SendSlot& slot = m_slots[slotNo];
+        ::memcpy(slot.data, hdr.msg_iov[0].iov_base, len);
+        ::memcpy(&slot.address, hdr.msg_name, hdr.msg_namelen);
+        slot.iov.iov_base = slot.data;
+        slot.iov.iov_len = len;
+
+        ::memset(&slot.msg, 0x00U, sizeof(slot.msg));
+        slot.msg.msg_name = &slot.address;
+        slot.msg.msg_namelen = hdr.msg_namelen;
+        slot.msg.msg_iov = &slot.iov;
+        slot.msg.msg_iovlen = 1U;
+
+        ::memset(sqe, 0x00U, sizeof(io_uring_sqe));
+        sqe->opcode = IORING_OP_SENDMSG;
+        sqe->fd = m_fd;
+        sqe->addr = (uint64_t)(uintptr_t)&slot.msg;
+        sqe->len = 1U;
+        sqe->user_data = slotNo;
+
+        total += (ssize_t)len;
+    }
+
+    if (m_tx.pending > 0U) {
+        int ret = submit(m_tx);
+        if (ret < 0) {
+            LogError(LOG_NET, "Error returned from io_uring_enter, err: %d (%s)", -ret, strerror(-ret));
+            error = true;
+        }
+    }
+
+    if (error && total == 0)
+        return -1;
+
+    return total;
+}
+
+// ---------------------------------------------------------------------------
+//  Private Class Members
+// ---------------------------------------------------------------------------
+
+/* Helper to set up and map an io_uring instance. */
+
+bool IoUring::setupRing(Ring& ring, uint32_t entries, uint32_t cqEntries)
+{
+    ::memset(&ring, 0x00U, sizeof(Ring));
+    ring.fd = -1;
+
+    io_uring_params params;
+    ::memset(&params, 0x00U, sizeof(params));
+    params.flags = IORING_SETUP_CQSIZE | IORING_SETUP_CLAMP;
+    params.cq_entries = cqEntries;
+
+    int fd = sysSetup(entries, &params);
+    if (fd < 0)
+        return false;
+
+    if ((params.features & IORING_FEAT_SINGLE_MMAP) == 0U || (params.features & IORING_FEAT_NODROP) == 0U) {
+        ::close(fd);
+        return false;
+    }
+
+    size_t sqSize = params.sq_off.array + (params.sq_entries * sizeof(uint32_t));
+    size_t cqSize = params.cq_off.cqes + (params.cq_entries * sizeof(io_uring_cqe));
+    ring.ringSize = (sqSize > cqSize) ? sqSize : cqSize;
+
+    void* p = ::mmap(nullptr, ring.ringSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, fd, IORING_OFF_SQ_RING);
+    if (p == MAP_FAILED) {
+        ::close(fd);
+        return false;
+    }
+
+    ring.sqesSize = params.sq_entries * sizeof(io_uring_sqe);
+    void* s = ::mmap(nullptr, ring.sqesSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, fd, IORING_OFF_SQES);
+    if (s == MAP_FAILED) {
+        ::munmap(p, ring.ringSize);
+        ::close(fd);
+        return false;
+    }
+
+    uint8_t* base = reinterpret_cast<uint8_t*>(p);
+    ring.fd = fd;
+    ring.ringPtr = p;
+    ring.sqes = reinterpret_cast<io_uring_sqe*>(s);
+
+    ring.sqHead = reinterpret_cast<uint32_t*>(base + params.sq_off.head);
+    ring.sqTail = reinterpret_cast<uint32_t*>(base + params.sq_off.tail);
+    ring.sqFlags = reinterpret_cast<uint32_t*>(base + params.sq_off.flags);
+    ring.sqMask = *reinterpret_cast<uint32_t*>(base + params.sq_off.ring_mask);
+    ring.sqArray = reinterpret_cast<uint32_t*>(base + params.sq_off.array);
+
+    ring.cqHead = reinterpret_cast<uint32_t*>(base + params.cq_off.head);
+    ring.cqTail = reinterpret_cast<uint32_t*>(base + params.cq_off.tail);
+    ring.cqMask = *reinterpret_cast<uint32_t*>(base + params.cq_off.ring_mask);
+    ring.cqes = reinterpret_cast<io_uring_cqe*>(base + params.cq_off.cqes);
+
+    ring.pending = 0U;
+    return true;
+}
+
+/* Helper to unmap and close an io_uring instance. */
+
+void IoUring::teardownRing(Ring& ring)
+{
+    if (ring.sqes != nullptr)
+        ::munmap(ring.sqes, ring.sqesSize);
+    if (ring.ringPtr != nullptr)
+        ::munmap(ring.ringPtr, ring.ringSize);
+    if (ring.fd >= 0)
+        ::close(ring.fd);
+
+    ::memset(&ring, 0x00U, sizeof(Ring));
+    ring.fd = -1;
+}
+
+/* Helper to get the next free submission queue entry. */
+
+io_uring_sqe* IoUring::getSqe(Ring& ring)
+{
+    uint32_t head = __atomic_load_n(ring.sqHead, __ATOMIC_ACQUIRE);
+    uint32_t tail = *ring.sqTail + ring.pending;
+    if (tail - head > ring.sqMask)
+        return nullptr;
+
+    uint32_t index = tail & ring.sqMask;
+    ring.sqArray[index] = index;
+    ring.pending++;
+    return &ring.sqes[index];
+}
+
+/* Helper to submit pending submission queue entries. */
+
+int IoUring::submit(Ring& ring, uint32_t flags)
+{
+    uint32_t toSubmit = ring.pending;
+    __atomic_store_n(ring.sqTail, *ring.sqTail + toSubmit, __ATOMIC_RELEASE);
+    ring.pending = 0U;
+
+    int submitted = 0;
+    while ((uint32_t)submitted < toSubmit) {
+        int ret = sysEnter(ring.fd, toSubmit - (uint32_t)submitted, 0U, flags);
+        if (ret < 0) {
+            if (errno == EINTR || errno == EAGAIN || errno == EBUSY)
+                continue;
+            return -errno;
+        }
+
+        submitted += ret;
+    }
+
+    return submitted;
+}
+
+/* Helper to get the next completion queue entry. */
+
+io_uring_cqe* IoUring::peekCqe(Ring& ring)
+{
+    uint32_t head = *ring.cqHead;
+    uint32_t tail = __atomic_load_n(ring.cqTail, __ATOMIC_ACQUIRE);
+    if (head == tail)
+        return nullptr;
+
+    return &ring.cqes[head & ring.cqMask];
+}
+
+/* Helper to mark the next completion queue entry as consumed. */
+
+void IoUring::advanceCq(Ring& ring)
+{
+    __atomic_store_n(ring.cqHead, *ring.cqHead + 1U, __ATOMIC_RELEASE);
+}
+
+/* Helper to arm the multishot receive. */
+
+bool IoUring::arm()
+{
+    io_uring_sqe* sqe = getSqe(m_rx);
+    if (sqe == nullptr)
+        return false;
+
+    ::memset(sqe, 0x00U, sizeof(io_uring_sqe));
+    sqe->opcode = IORING_OP_RECVMSG;
+    sqe->fd = m_fd;
+    sqe->addr = (uint64_t)(uintptr_t)&m_recvMsg;
+    sqe->len = 1U;
+    sqe->ioprio = IORING_RECV_MULTISHOT;
+    sqe->flags = IOSQE_BUFFER_SELECT;
+    sqe->buf_group = RECV_BUFFER_GROUP;
+    sqe->user_data = RECV_TAG;
+
+    int ret = submit(m_rx);
+    if (ret < 0) {
+        LogError(LOG_NET, "Error returned from io_uring_enter, err: %d (%s)", -ret, strerror(-ret));
+        return false;
+    }
+
+    m_armed = true;
+    return true;
+}
+
+/* Helper to return a receive buffer to the kernel. */
+
+void IoUring::recycle(uint16_t bid)
+{
+    // the entries are indexed from the start of the ring rather than through bufs[]; compiled as C++ the
+    // flexible array declaration in the kernel header is preceded by a (non-zero sized) empty struct
+    io_uring_buf* buf = reinterpret_cast<io_uring_buf*>(m_bufRing) + (m_bufTail & (RECV_BUFFERS - 1U));
+    buf->addr = (uint64_t)(uintptr_t)(m_bufs + ((size_t)bid * RECV_BUFFER_SIZE));
+    buf->len = RECV_BUFFER_SIZE;
+    buf->bid = bid;
+
+    m_bufTail++;
+    __atomic_store_n(&m_bufRing->tail, m_bufTail, __ATOMIC_RELEASE);
+}
+
+/* Helper to process send completions (returning their send slots). */
+
+void IoUring::reapSends()
+{
+    io_uring_cqe* cqe = nullptr;
+    while ((cqe = peekCqe(m_tx)) != nullptr) {
+        uint32_t slotNo = (uint32_t)cqe->user_data;
+        int32_t res = cqe->res;
+        advanceCq(m_tx);
+
+        if (slotNo < SEND_SLOTS)
+            m_freeSlots.push_back(slotNo);
+
+        if (res < 0) {
+            if (res == -ENETUNREACH || res == -EHOSTUNREACH) {
+                // if we were not able to send a frame and the network logging is enabled -- disable network logging
+                if (!g_disableNetworkLog)
+                    g_disableNetworkLog = true;
+            }
+
+            LogError(LOG_NET, "Error returned from io_uring sendmsg, err: %d (%s)", -res, strerror(-res));
+        }
+    }
+}
+
+#endif // defined(HAVE_IO_URING)
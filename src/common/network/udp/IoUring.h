@@ -0,0 +1,234 @@
+// SPDX-License-Identifier: GPL-2.0-only
+/*
+ * Digital Voice Modem - Common Library
+ * GPLv2 Open Source. Use is subject to license terms.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ *  Copyright (C) 2026 Bryan Biedenkapp, N2PLL
+ *
+ */
+/**
+ * @file IoUring.h
+ * @ingroup udp_socket
+ * @file IoUring.cpp
+ * @ingroup udp_socket
+ */
+#if !defined(__UDP_IO_URING_H__)
+#define __UDP_IO_URING_H__
+
+#include "common/Defines.h"
+
+#if defined(__linux__) && defined(__has_include)
+#if __has_include(<linux/io_uring.h>)
+#include <linux/io_uring.h>
+#if defined(IORING_RECV_MULTISHOT)
+#define HAVE_IO_URING 1
+#endif // defined(IORING_RECV_MULTISHOT)
+#endif // __has_include(<linux/io_uring.h>)
+#endif // defined(__linux__) && defined(__has_include)
+
+#if defined(HAVE_IO_URING)
+
+#include <mutex>
+#include <vector>
+
+#include <sys/socket.h>
+#include <sys/types.h>
+
+namespace network
+{
+    namespace udp
+    {
+        // ---------------------------------------------------------------------------
+        //  Class Declaration
+        // ---------------------------------------------------------------------------
+
+        /**
+         * @brief Implements an io_uring transport for a UDP socket.
+         *
+         *  Datagrams are received by a multishot IORING_OP_RECVMSG into a ring of kernel registered
+         *  (provided) buffers; once armed, reading a datagram that has already arrived does not require
+         *  a system call. Datagrams are sent by IORING_OP_SENDMSG from a fixed set of send slots, a batch
+         *  of datagrams is submitted with a single system call.
+         *
+         *  Receive and send use separate rings (each with its own lock) so the receive completion queue
+         *  is only ever consumed by readers and the send completion queue only by writers.
+         * @ingroup udp_socket
+         */
+        class HOST_SW_API IoUring {
+        public:
+            /**
+             * @brief Initializes a new instance of the IoUring class.
+             * @param fd UDP socket file descriptor.
+             */
+            IoUring(int fd);
+            /**
+             * @brief Finalizes a instance of the IoUring class.
+             */
+            ~IoUring();
+
+            /**
+             * @brief Sets up the receive and send rings.
+             * @returns bool True, if the rings were set up, false if the kernel lacks io_uring support.
+             */
+            bool open();
+            /**
+             * @brief Tears down the receive and send rings, cancelling any outstanding operations.
+             */
+            void close();
+
+            /**
+             * @brief Flag indicating the receive ring failed in a way that the transport cannot recover
+             *  from (i.e. the kernel does not support multishot receive); the caller should fall back to
+             *  the socket API.
+             * @returns bool True, if the transport has failed, otherwise false.
+             */
+            bool isFailed() const { return m_failed; }
+
+            /**
+             * @brief Reads a datagram.
+             * @param[out] buffer Buffer to read data into.
+             * @param length Length of the buffer.
+             * @param[out] address IP address data read from.
+             * @param[out] addrLen Length of the address.
+             * @returns ssize_t Length of the datagram, 0 if no datagram is waiting, -1 on error.
+             */
+            ssize_t read(uint8_t* buffer, uint32_t length, sockaddr_storage& address, socklen_t& addrLen);
+            /**
+             * @brief Writes a batch of datagrams. Datagrams that do not fit in a send slot (or when no
+             *  send slot is free) are sent synchronously.
+             * @param headers Message headers (one iovec each) to send.
+             * @param count Number of message headers.
+             * @returns ssize_t Total number of bytes queued or sent, -1 on error.
+             */
+            ssize_t write(const struct mmsghdr* headers, uint32_t count);
+
+            /**
+             * @brief Size of a receive buffer (maximum datagram length).
+             */
+            static const uint32_t RECV_BUFFER_SIZE = 9216U;
+            /**
+             * @brief Number of receive buffers.
+             */
+            static const uint32_t RECV_BUFFERS = 128U;
+            /**
+             * @brief Size of a send slot (maximum datagram length sent asynchronously).
+             */
+            static const uint32_t SEND_SLOT_SIZE = 2048U;
+            /**
+             * @brief Number of send slots.
+             */
+            static const uint32_t SEND_SLOTS = 256U;
+
+        private:
+            /**
+             * @brief Represents a mapped io_uring instance.
+             */
+            struct Ring {
+                int fd;
+
+                void* ringPtr;
+                size_t ringSize;
+                io_uring_sqe* sqes;
+                size_t sqesSize;
+
+                uint32_t* sqHead;
+                uint32_t* sqTail;
+                uint32_t* sqFlags;
+                uint32_t sqMask;
+                uint32_t* sqArray;
+
+                uint32_t* cqHead;
+                uint32_t* cqTail;
+                uint32_t cqMask;
+                io_uring_cqe* cqes;
+
+                uint32_t pending;
+            };
+
+            /**
+             * @brief Represents a send slot.
+             */
+            struct SendSlot {
+                struct msghdr msg;
+                struct iovec iov;
+                sockaddr_storage address;
+                uint8_t data[SEND_SLOT_SIZE];
+            };
+
+            int m_fd;
+            bool m_failed;
+
+            std::mutex m_rxMutex;
+            Ring m_rx;
+            bool m_armed;
+            struct msghdr m_recvMsg;
+            io_uring_buf_ring* m_bufRing;
+            size_t m_bufRingSize;
+            uint8_t* m_bufs;
+            uint16_t m_bufTail;
+
+            std::mutex m_txMutex;
+            Ring m_tx;
+            SendSlot* m_slots;
+            std::vector<uint32_t> m_freeSlots;
+
+            /**
+             * @brief Helper to set up and map an io_uring instance.
+             * @param ring Ring.
+             * @param entries Number of submission queue entries.
+             * @param cqEntries Number of completion queue entries.
+             * @returns bool True, if the ring was set up, otherwise false.
+             */
+            static bool setupRing(Ring& ring, uint32_t entries, uint32_t cqEntries);
+            /**
+             * @brief Helper to unmap and close an io_uring instance.
+             * @param ring Ring.
+             */
+            static void teardownRing(Ring& ring);
+            /**
+             * @brief Helper to get the next free submission queue entry.
+             * @param ring Ring.
+             * @returns io_uring_sqe* Submission queue entry, or nullptr if the submission queue is full.
+             */
+            static io_uring_sqe* getSqe(Ring& ring);
+            /**
+             * @brief Helper to submit pending submission queue entries.
+             * @param ring Ring.
+             * @param flags io_uring_enter() flags.
+             * @returns int Number of entries submitted, or -errno.
+             */
+            static int submit(Ring& ring, uint32_t flags = 0U);
+            /**
+             * @brief Helper to get the next completion queue entry.
+             * @param ring Ring.
+             * @returns io_uring_cqe* Completion queue entry, or nullptr if the completion queue is empty.
+             */
+            static io_uring_cqe* peekCqe(Ring& ring);
+            /**
+             * @brief Helper to mark the next completion queue entry as consumed.
+             * @param ring Ring.
+             */
+            static void advanceCq(Ring& ring);
+
+            /**
+             * @brief Helper to arm the multishot receive.
+             * @returns bool True, if the receive was armed, otherwise false.
+             */
+            bool arm();
+            /**
+             * @brief Helper to return a receive buffer to the kernel.
+             * @param bid Buffer ID.
+             */
+            void recycle(uint16_t bid);
+            /**
+             * @brief Helper to process send completions (returning their send slots).
+             */
+            void reapSends();
+        };
+    } // namespace udp
+} // namespace network
+
+#endif // defined(HAVE_IO_URING)
+
+#endif // __UDP_IO_URING_H__
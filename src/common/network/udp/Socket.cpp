@@ -23,6 +23,9 @@ using namespace network::udp;
 #if !defined(_WIN32)
 #include <ifaddrs.h>
 #endif // !defined(_WIN32)
+#if defined(__linux__)
+#include <linux/filter.h>
+#endif // defined(__linux__)
 
 // ---------------------------------------------------------------------------
 //  Constants
@@ -30,6 +33,12 @@ using namespace network::udp;
 
 #define MAX_BUFFER_COUNT 16384
 
+// ---------------------------------------------------------------------------
+//  Static Class Members
+// ---------------------------------------------------------------------------
+
+bool Socket::s_ioUringDefault = false;
+
 // ---------------------------------------------------------------------------
 //  Public Class Members
 // ---------------------------------------------------------------------------
@@ -48,7 +57,12 @@ Socket::Socket(const std::string& address, uint16_t port) :
     m_aes(nullptr),
     m_isCryptoWrapped(false),
     m_presharedKey(nullptr),
-    m_counter(0U)
+    m_counter(0U),
+    m_reusePort(false),
+    m_useIoUring(s_ioUringDefault)
+#if defined(HAVE_IO_URING)
+    , m_uring(nullptr)
+#endif // defined(HAVE_IO_URING)
 {
     m_aes = new crypto::AES(crypto::AESKeyLength::AES_256);
     m_presharedKey = new uint8_t[AES_WRAPPED_PCKT_KEY_LEN];
@@ -76,7 +90,12 @@ Socket::Socket(uint16_t port) :
     m_aes(nullptr),
     m_isCryptoWrapped(false),
     m_presharedKey(nullptr),
-    m_counter(0U)
+    m_counter(0U),
+    m_reusePort(false),
+    m_useIoUring(s_ioUringDefault)
+#if defined(HAVE_IO_URING)
+    , m_uring(nullptr)
+#endif // defined(HAVE_IO_URING)
 {
     m_aes = new crypto::AES(crypto::AESKeyLength::AES_256);
     m_presharedKey = new uint8_t[AES_WRAPPED_PCKT_KEY_LEN];
@@ -94,6 +113,11 @@ Socket::Socket(uint16_t port) :
 
 Socket::~Socket()
 {
+#if defined(HAVE_IO_URING)
+    if (m_uring != nullptr)
+        delete m_uring;
+#endif // defined(HAVE_IO_URING)
+
     if (m_aes != nullptr)
         delete m_aes;
     if (m_presharedKey != nullptr)
@@ -153,14 +177,105 @@ bool Socket::open(const uint32_t af, const std::string& address, const uint16_t
             return false;
         }
 
+        if (m_reusePort) {
+#if defined(SO_REUSEPORT)
+            if (::setsockopt(m_fd, SOL_SOCKET, SO_REUSEPORT, (char*)& reuse, sizeof(reuse)) == -1) {
+                LogError(LOG_NET, "Cannot set the UDP socket option, err: %d (%s)", errno, strerror(errno));
+                return false;
+            }
+#else
+            LogError(LOG_NET, "SO_REUSEPORT is not supported on this platform");
+            return false;
+#endif // defined(SO_REUSEPORT)
+        }
+
         if (!bind(address, port)) {
             return false;
         }
     }
 
+    if (m_useIoUring) {
+#if defined(HAVE_IO_URING)
+        m_uring = new IoUring(m_fd);
+        if (!m_uring->open()) {
+            LogWarning(LOG_NET, "io_uring is not available, UDP port %u will use the socket API", m_localPort);
+            delete m_uring;
+            m_uring = nullptr;
+        }
+#else
+        LogWarning(LOG_NET, "io_uring is not supported on this platform, UDP port %u will use the socket API", m_localPort);
+#endif // defined(HAVE_IO_URING)
+    }
+
     return true;
 }
 
+/* Flag indicating whether or not the socket is using the io_uring transport. */
+
+bool Socket::isIoUring() const
+{
+#if defined(HAVE_IO_URING)
+    return m_uring != nullptr && !m_uring->isFailed();
+#else
+    return false;
+#endif // defined(HAVE_IO_URING)
+}
+
+/* Attaches a steering program to the SO_REUSEPORT group this socket belongs to. */
+
+bool Socket::setReusePortSteering(uint32_t offset, uint32_t count)
+{
+#if defined(__linux__) && defined(SO_ATTACH_REUSEPORT_CBPF)
+    if (m_fd < 0 || count == 0U)
+        return false;
+
+    // for SO_REUSEPORT groups the kernel runs the program with the packet data starting at the UDP
+    // payload; the return value is the index of the receiving socket
+    struct sock_filter code[] = {
+        BPF_STMT(BPF_LD | BPF_W | BPF_ABS, offset),
+        BPF_STMT(BPF_ALU | BPF_MOD | BPF_K, count),
+        BPF_STMT(BPF_RET | BPF_A, 0U)
+    };
+
+    struct sock_fprog prog;
+    prog.len = sizeof(code) / sizeof(code[0]);
+    prog.filter = code;
+
+    if (::setsockopt(m_fd, SOL_SOCKET, SO_ATTACH_REUSEPORT_CBPF, &prog, sizeof(prog)) == -1) {
+        LogError(LOG_NET, "Cannot attach the UDP SO_REUSEPORT steering program, err: %d (%s)", errno, strerror(errno));
+        return false;
+    }
+
+    return true;
+#else
+    return false;
+#endif // defined(__linux__) && defined(SO_ATTACH_REUSEPORT_CBPF)
+}
+
+/* Detaches the steering program from the SO_REUSEPORT group this socket belongs to. */
+
+bool Socket::clearReusePortSteering()
+{
+#if defined(__linux__) && defined(SO_DETACH_REUSEPORT_BPF)
+    if (m_fd < 0)
+        return false;
+
+    int dummy = 0;
+    if (::setsockopt(m_fd, SOL_SOCKET, SO_DETACH_REUSEPORT_BPF, &dummy, sizeof(dummy)) == -1) {
+        // no program attached
+        if (errno == ENOENT)
+            return true;
+
+        LogError(LOG_NET, "Cannot detach the UDP SO_REUSEPORT steering program, err: %d (%s)", errno, strerror(errno));
+        return false;
+    }
+
+    return true;
+#else
+    return false;
+#endif // defined(__linux__) && defined(SO_DETACH_REUSEPORT_BPF)
+}
+
 /* Sets the socket receive buffer size. */
 
 bool Socket::recvBufSize(ssize_t bufSize)
@@ -245,6 +360,13 @@ bool Socket::sendBufSize(ssize_t bufSize)
 
 void Socket::close()
 {
+#if defined(HAVE_IO_URING)
+    if (m_uring != nullptr) {
+        delete m_uring;
+        m_uring = nullptr;
+    }
+#endif // defined(HAVE_IO_URING)
+
 #if defined(_WIN32)
     if (m_fd != INVALID_SOCKET) {
         ::closesocket(m_fd);
@@ -273,46 +395,57 @@ ssize_t Socket::read(uint8_t* buffer, uint32_t length, sockaddr_storage& address
         return -1;
 #endif // defined(_WIN32)
 
-    // check that the readfrom() won't block
-    struct pollfd pfd;
-    pfd.fd = m_fd;
-    pfd.events = POLLIN;
-    pfd.revents = 0;
+    ssize_t len = 0;
+    socklen_t size = sizeof(sockaddr_storage);
+#if defined(HAVE_IO_URING)
+    if (m_uring != nullptr && !m_uring->isFailed()) {
+        len = m_uring->read(buffer, length, address, size);
+        if (len <= 0)
+            return len;
+    }
+    else
+#endif // defined(HAVE_IO_URING)
+    {
+        // check that the readfrom() won't block
+        struct pollfd pfd;
+        pfd.fd = m_fd;
+        pfd.events = POLLIN;
+        pfd.revents = 0;
 
-    // return immediately
+        // return immediately
 #if defined(_WIN32)
-    int ret = WSAPoll(&pfd, 1, 0);
+        int ret = WSAPoll(&pfd, 1, 0);
 #else
-    int ret = ::poll(&pfd, 1, 0);
+        int ret = ::poll(&pfd, 1, 0);
 #endif // defined(_WIN32)
-    if (ret < 0) {
+        if (ret < 0) {
 #if defined(_WIN32)
-        LogError(LOG_NET, "Error returned from UDP poll, err: %lu", ::GetLastError());
+            LogError(LOG_NET, "Error returned from UDP poll, err: %lu", ::GetLastError());
 #else
-        LogError(LOG_NET, "Error returned from UDP poll, err: %d (%s)", errno, strerror(errno));
+            LogError(LOG_NET, "Error returned from UDP poll, err: %d (%s)", errno, strerror(errno));
 #endif // defined(_WIN32)
-        return -1;
-    }
+            return -1;
+        }
 
-    if ((pfd.revents & POLLIN) == 0)
-        return 0;
+        if ((pfd.revents & POLLIN) == 0)
+            return 0;
 
-    socklen_t size = sizeof(sockaddr_storage);
-    ssize_t len = ::recvfrom(pfd.fd, (char*)buffer, length, 0, (sockaddr*)& address, &size);
-    if (len <= 0) {
+        len = ::recvfrom(pfd.fd, (char*)buffer, length, 0, (sockaddr*)& address, &size);
+        if (len <= 0) {
 #if defined(_WIN32)
-        LogError(LOG_NET, "Error returned from recvfrom, err: %lu", ::GetLastError());
+            LogError(LOG_NET, "Error returned from recvfrom, err: %lu", ::GetLastError());
 #else
-        LogError(LOG_NET, "Error returned from recvfrom, err: %d (%s)", errno, strerror(errno));
+            LogError(LOG_NET, "Error returned from recvfrom, err: %d (%s)", errno, strerror(errno));
 #endif // defined(_WIN32)
 
-        if (len == -1 && errno == ENOTSOCK) {
-            LogInfoEx(LOG_NET, "Re-opening UDP port on %u", m_localPort);
-            close();
-            open();
-        }
+            if (len == -1 && errno == ENOTSOCK) {
+                LogInfoEx(LOG_NET, "Re-opening UDP port on %u", m_localPort);
+                close();
+                open();
+            }
 
-        return -1;
+            return -1;
+        }
     }
 
     // are we crypto wrapped?
@@ -453,7 +586,25 @@ bool Socket::write(const uint8_t* buffer, uint32_t length, const sockaddr_storag
         ::memcpy(out.get(), buffer, length);
     }
 
-    ssize_t sent = ::sendto(m_fd, (char*)out.get(), length, 0, (sockaddr*)& address, addrLen);
+    ssize_t sent = 0;
+#if defined(HAVE_IO_URING)
+    if (m_uring != nullptr) {
+        struct iovec chunk;
+        chunk.iov_base = out.get();
+        chunk.iov_len = length;
+
+        struct mmsghdr header;
+        ::memset(&header, 0x00U, sizeof(header));
+        header.msg_hdr.msg_name = (void*)&address;
+        header.msg_hdr.msg_namelen = addrLen;
+        header.msg_hdr.msg_iov = &chunk;
+        header.msg_hdr.msg_iovlen = 1;
+
+        sent = m_uring->write(&header, 1U);
+    }
+    else
+#endif // defined(HAVE_IO_URING)
+        sent = ::sendto(m_fd, (char*)out.get(), length, 0, (sockaddr*)& address, addrLen);
     if (sent < 0) {
         if (errno == ENETUNREACH || errno == EHOSTUNREACH) {
             // if we were not able to send a frame and the network logging is enabled -- disable network logging
@@ -661,7 +812,14 @@ bool Socket::write(BufferQueue* buffers, ssize_t* lenWritten) noexcept
         ++msgs;
     }
 
-    if (sendmmsg(m_fd, headers, msgs, 0) < 0) {
+    int ret = 0;
+#if defined(HAVE_IO_URING)
+    if (m_uring != nullptr)
+        ret = (m_uring->write(headers, msgs) < 0) ? -1 : 0;
+    else
+#endif // defined(HAVE_IO_URING)
+        ret = sendmmsg(m_fd, headers, msgs, 0);
+    if (ret < 0) {
 #if defined(_WIN32)
         LogError(LOG_NET, "Error returned from sendmmsg, err: %lu", ::GetLastError());
 #else
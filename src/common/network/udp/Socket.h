@@ -23,6 +23,7 @@
 
 #include "common/Defines.h"
 #include "common/AESCrypto.h"
+#include "common/network/udp/IoUring.h"
 
 #include <string>
 #include <queue>
@@ -222,6 +223,48 @@ namespace network
              */
             bool open(const uint32_t af, const std::string& address, const uint16_t port) noexcept;
 
+            /**
+             * @brief Sets whether or not this socket uses the io_uring transport. Takes effect the next time
+             *  the socket is opened; if the kernel lacks io_uring support the socket falls back to the socket API.
+             * @param enable Flag indicating whether or not to use the io_uring transport.
+             */
+            void setIoUring(bool enable) { m_useIoUring = enable; }
+            /**
+             * @brief Flag indicating whether or not the socket is using the io_uring transport.
+             * @returns bool True, if the io_uring transport is in use, otherwise false.
+             */
+            bool isIoUring() const;
+            /**
+             * @brief Sets whether or not sockets created after this call use the io_uring transport.
+             * @param enable Flag indicating whether or not to use the io_uring transport.
+             */
+            static void setIoUringDefault(bool enable) { s_ioUringDefault = enable; }
+
+            /**
+             * @brief Sets whether or not the socket is opened with SO_REUSEPORT, allowing several sockets to
+             *  share (and the kernel to spread received datagrams across) the same local address and port.
+             *  Must be set before the socket is opened.
+             * @param enable Flag indicating whether or not to set SO_REUSEPORT.
+             */
+            void setReusePort(bool enable) { m_reusePort = enable; }
+            /**
+             * @brief Attaches a steering program to the SO_REUSEPORT group this socket belongs to. The
+             *  program selects the receiving socket from a 32-bit big endian value in the datagram payload
+             *  (modulo the number of sockets in the group), so every datagram carrying the same value is
+             *  received by the same socket; sockets are numbered in the order they were bound. Datagrams
+             *  too short to contain the value are received by the first socket.
+             * @param offset Offset of the 32-bit value in the datagram payload.
+             * @param count Number of sockets in the group.
+             * @returns bool True, if the program was attached, otherwise false.
+             */
+            bool setReusePortSteering(uint32_t offset, uint32_t count);
+            /**
+             * @brief Detaches the steering program from the SO_REUSEPORT group this socket belongs to; the
+             *  kernel then selects the receiving socket by hashing the source and destination address.
+             * @returns bool True, if the program was detached, otherwise false.
+             */
+            bool clearReusePortSteering();
+
             /**
              * @brief Sets the socket receive buffer size.
              * @param bufSize Buffer size to set.
@@ -345,6 +388,15 @@ namespace network
 
             uint32_t m_counter;
 
+            bool m_reusePort;
+
+            bool m_useIoUring;
+#if defined(HAVE_IO_URING)
+            IoUring* m_uring;
+#endif // defined(HAVE_IO_URING)
+
+            static bool s_ioUringDefault;
+
             /**
              * @brief Internal helper to initialize the socket.
              * @param domain Address family type.
@@ -468,21 +468,22 @@ bool VIFace::isUp() const
 
 /* Read a packet from the virtual interface. */
 
-ssize_t VIFace::read(uint8_t* buffer)
+ssize_t VIFace::read(uint8_t* buffer, uint32_t timeout)
 {
     assert(buffer != nullptr);
     ::memset(buffer, 0x00U, m_mtu);
 
     struct epoll_event wait_event;
 
-    int ret = epoll_wait(m_epollFd, &wait_event, 1, 0);
+    int ret = epoll_wait(m_epollFd, &wait_event, 1, (int)timeout);
     if ((ret < 0) && (errno != EINTR)) {
         LogError(LOG_NET, "Error returned from epoll_wait, err: %d (%s)", errno, strerror(errno));
         return -1;
     }
 
-    if (ret == 0) {
-        return -1;
+    // timed out (or interrupted) with no packet
+    if (ret <= 0) {
+        return 0;
     }
     
     // read packet into our buffer
@@ -490,13 +491,17 @@ ssize_t VIFace::read(uint8_t* buffer)
         // Read packet into our buffer
         ssize_t len = ::read(wait_event.data.fd, buffer, m_mtu);
         if (len == -1) {
+            // another queue reader may have already taken the packet
+            if (errno == EAGAIN || errno == EWOULDBLOCK)
+                return 0;
+
             LogError(LOG_NET, "Error returned from read, err: %d (%s)", errno, strerror(errno));
         }
     
        return len;
     }
 
-    return -1;
+    return 0;
 }
 
 /* Write a packet to this virtual interface. */
@@ -107,9 +107,11 @@ namespace network
              *
              * @param[out] buffer The packet (if tun) or frame (if tap) as a binary blob
              *  (array of bytes).
-             * @returns ssize_t Actual length of data read from remote UDP socket.
+             * @param timeout Time in milliseconds to wait for a packet (0 does not wait).
+             * @returns ssize_t Actual length of data read from remote UDP socket, 0 if no packet was
+             *  available before the timeout, or -1 on error.
              */
-            ssize_t read(uint8_t* buffer);
+            ssize_t read(uint8_t* buffer, uint32_t timeout = 0U);
             /**
              * @brief Write a packet to this virtual interface.
              *
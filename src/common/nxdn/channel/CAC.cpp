@@ -186,21 +186,11 @@ bool CAC::decode(const uint8_t* data, bool longInbound)
 
         // decode convolution
         edac::Convolution conv;
-        conv.start();
-
-        n = 0U;
-        for (uint32_t i = 0U; i < (NXDN_CAC_LONG_CRC_LENGTH_BITS + 4U); i++) {
-            uint8_t s0 = puncture[n++];
-            uint8_t s1 = puncture[n++];
-
-            if (!conv.decode(s0, s1)) {
-                LogError(LOG_NXDN, "CAC::decode(longInbound), failed to decode convolution, i = %u, n = %u", i);
-                return false;
-            }
+        if (!conv.decodeBlock(puncture, NXDN_CAC_LONG_CRC_LENGTH_BITS, m_data)) {
+            LogError(LOG_NXDN, "CAC::decode(longInbound), failed to decode convolution");
+            return false;
         }
 
-        conv.chainback(m_data, NXDN_CAC_LONG_CRC_LENGTH_BITS);
-
 #if DEBUG_NXDN_CAC
         Utils::dump(2U, "NXDN, CAC::decode(), Decoded Long CAC", m_data, (NXDN_CAC_LONG_CRC_LENGTH_BITS / 8U) + 1U);
 #endif
@@ -244,21 +234,11 @@ bool CAC::decode(const uint8_t* data, bool longInbound)
 
         // decode convolution
         edac::Convolution conv;
-        conv.start();
-
-        n = 0U;
-        for (uint32_t i = 0U; i < (NXDN_CAC_SHORT_CRC_LENGTH_BITS + 4U); i++) {
-            uint8_t s0 = pass[n++];
-            uint8_t s1 = pass[n++];
-
-            if (!conv.decode(s0, s1)) {
-                LogError(LOG_NXDN, "CAC::decode(), failed to decode convolution, i = %u, n = %u", i);
-                return false;
-            }
+        if (!conv.decodeBlock(pass, NXDN_CAC_SHORT_CRC_LENGTH_BITS, m_data)) {
+            LogError(LOG_NXDN, "CAC::decode(), failed to decode convolution");
+            return false;
         }
 
-        conv.chainback(m_data, NXDN_CAC_SHORT_CRC_LENGTH_BITS);
-
 #if DEBUG_NXDN_CAC
         Utils::dump(2U, "NXDN, CAC::decode(), Decoded CAC", m_data, (NXDN_CAC_SHORT_CRC_LENGTH_BITS / 8U) + 1U);
 #endif
@@ -120,21 +120,11 @@ bool SACCH::decode(const uint8_t* data)
 
     // decode convolution
     edac::Convolution conv;
-    conv.start();
-
-    n = 0U;
-    for (uint32_t i = 0U; i < (NXDN_SACCH_CRC_LENGTH_BITS + 4U); i++) {
-        uint8_t s0 = puncture[n++];
-        uint8_t s1 = puncture[n++];
-
-        if (!conv.decode(s0, s1)) {
-            LogError(LOG_NXDN, "SACCH::decode(), failed to decode convolution, i = %u, n = %u", i);
-            return false;
-        }
+    if (!conv.decodeBlock(puncture, NXDN_SACCH_CRC_LENGTH_BITS, m_data)) {
+        LogError(LOG_NXDN, "SACCH::decode(), failed to decode convolution");
+        return false;
     }
 
-    conv.chainback(m_data, NXDN_SACCH_CRC_LENGTH_BITS);
-
 #if DEBUG_NXDN_SACCH
     Utils::dump(2U, "SACCH::decode(), Decoded SACCH", m_data, NXDN_SACCH_CRC_LENGTH_BYTES);
 #endif
@@ -145,21 +145,11 @@ bool UDCH::decode(const uint8_t* data)
 
     // decode convolution
     edac::Convolution conv;
-    conv.start();
-
-    n = 0U;
-    for (uint32_t i = 0U; i < (NXDN_UDCH_CRC_LENGTH_BITS + 4U); i++) {
-        uint8_t s0 = puncture[n++];
-        uint8_t s1 = puncture[n++];
-
-        if (!conv.decode(s0, s1)) {
-            LogError(LOG_NXDN, "UDCH::decode(), failed to decode convolution, i = %u, n = %u", i);
-            return false;
-        }
+    if (!conv.decodeBlock(puncture, NXDN_UDCH_CRC_LENGTH_BITS, m_data)) {
+        LogError(LOG_NXDN, "UDCH::decode(), failed to decode convolution");
+        return false;
     }
 
-    conv.chainback(m_data, NXDN_UDCH_CRC_LENGTH_BITS);
-
 #if DEBUG_NXDN_UDCH
     Utils::dump(2U, "NXDN, UDCH::decode(), Decoded UDCH", m_data, NXDN_UDCH_CRC_LENGTH_BYTES);
 #endif
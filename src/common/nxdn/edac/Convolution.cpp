@@ -17,6 +17,14 @@ using namespace nxdn::edac;
 #include <cstring>
 #include <cstdlib>
 
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define CONVOLUTION_SSE2
+#include <emmintrin.h>
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+#define CONVOLUTION_NEON
+#include <arm_neon.h>
+#endif
+
 // ---------------------------------------------------------------------------
 //  Constants
 // ---------------------------------------------------------------------------
@@ -29,6 +37,132 @@ const uint32_t NUM_OF_STATES = 16U;
 const uint32_t M = 4U;
 const uint32_t K = 5U;
 
+const uint32_t TAIL_LENGTH = K - 1U;
+const uint32_t MAX_DECISIONS = 300U;
+
+// ---------------------------------------------------------------------------
+//  Global Functions
+// ---------------------------------------------------------------------------
+
+#if defined(CONVOLUTION_SSE2)
+/**
+ * @brief Helper to perform the add-compare-select step for all 16 states using SSE2.
+ *  (NOTE: The metrics are unsigned 16-bit and wrap, exactly as the scalar implementation; unsigned
+ *  comparisons are performed by biasing the signed SSE2 comparisons.)
+ * @param lo Path metrics for states 0 - 7.
+ * @param hi Path metrics for states 8 - 15.
+ * @param s0 First soft symbol.
+ * @param s1 Second soft symbol.
+ * @returns uint16_t Packed decision bits for this step.
+ */
+static inline uint16_t acsStep(__m128i& lo, __m128i& hi, uint8_t s0, uint8_t s1)
+{
+    const __m128i bias = _mm_set1_epi16((short)0x8000);
+    const __m128i branch1 = _mm_setr_epi16(0, 0, 0, 0, 2, 2, 2, 2);
+    const __m128i branch2 = _mm_setr_epi16(0, 2, 2, 0, 0, 2, 2, 0);
+
+    // branch metric; |x| = max(x, -x)
+    __m128i d0 = _mm_sub_epi16(branch1, _mm_set1_epi16(s0));
+    __m128i d1 = _mm_sub_epi16(branch2, _mm_set1_epi16(s1));
+    d0 = _mm_max_epi16(d0, _mm_sub_epi16(_mm_setzero_si128(), d0));
+    d1 = _mm_max_epi16(d1, _mm_sub_epi16(_mm_setzero_si128(), d1));
+
+    __m128i metric = _mm_add_epi16(d0, d1);
+    __m128i invMetric = _mm_sub_epi16(_mm_set1_epi16(M), metric);
+
+    __m128i a0 = _mm_xor_si128(_mm_add_epi16(lo, metric), bias);
+    __m128i b0 = _mm_xor_si128(_mm_add_epi16(hi, invMetric), bias);
+    __m128i a1 = _mm_xor_si128(_mm_add_epi16(lo, invMetric), bias);
+    __m128i b1 = _mm_xor_si128(_mm_add_epi16(hi, metric), bias);
+
+    // survivor is b when a >= b; mask is set where the survivor is a (a < b)
+    __m128i notDec0 = _mm_cmpgt_epi16(b0, a0);
+    __m128i notDec1 = _mm_cmpgt_epi16(b1, a1);
+
+    __m128i even = _mm_xor_si128(_mm_min_epi16(a0, b0), bias);
+    __m128i odd = _mm_xor_si128(_mm_min_epi16(a1, b1), bias);
+
+    // new state 2i is the even butterfly output, 2i + 1 the odd
+    lo = _mm_unpacklo_epi16(even, odd);
+    hi = _mm_unpackhi_epi16(even, odd);
+
+    __m128i notDec = _mm_packs_epi16(_mm_unpacklo_epi16(notDec0, notDec1), _mm_unpackhi_epi16(notDec0, notDec1));
+    return (uint16_t)~_mm_movemask_epi8(notDec);
+}
+#elif defined(CONVOLUTION_NEON)
+/**
+ * @brief Helper to perform the add-compare-select step for all 16 states using NEON.
+ * @param lo Path metrics for states 0 - 7.
+ * @param hi Path metrics for states 8 - 15.
+ * @param s0 First soft symbol.
+ * @param s1 Second soft symbol.
+ * @returns uint16_t Packed decision bits for this step.
+ */
+static inline uint16_t acsStep(uint16x8_t& lo, uint16x8_t& hi, uint8_t s0, uint8_t s1)
+{
+    static const int16_t BRANCH1[8U] = { 0, 0, 0, 0, 2, 2, 2, 2 };
+    static const int16_t BRANCH2[8U] = { 0, 2, 2, 0, 0, 2, 2, 0 };
+    static const uint16_t BIT_WEIGHTS[8U] = { 0x01U, 0x02U, 0x04U, 0x08U, 0x10U, 0x20U, 0x40U, 0x80U };
+
+    int16x8_t d0 = vabsq_s16(vsubq_s16(vld1q_s16(BRANCH1), vdupq_n_s16(s0)));
+    int16x8_t d1 = vabsq_s16(vsubq_s16(vld1q_s16(BRANCH2), vdupq_n_s16(s1)));
+
+    uint16x8_t metric = vreinterpretq_u16_s16(vaddq_s16(d0, d1));
+    uint16x8_t invMetric = vsubq_u16(vdupq_n_u16(M), metric);
+
+    uint16x8_t a0 = vaddq_u16(lo, metric);
+    uint16x8_t b0 = vaddq_u16(hi, invMetric);
+    uint16x8_t a1 = vaddq_u16(lo, invMetric);
+    uint16x8_t b1 = vaddq_u16(hi, metric);
+
+    uint16x8x2_t metrics = vzipq_u16(vminq_u16(a0, b0), vminq_u16(a1, b1));
+    lo = metrics.val[0];
+    hi = metrics.val[1];
+
+    // survivor is b when a >= b
+    uint16x8x2_t dec = vzipq_u16(vcgeq_u16(a0, b0), vcgeq_u16(a1, b1));
+    uint16x8_t weights = vld1q_u16(BIT_WEIGHTS);
+    uint64x2_t decLo = vpaddlq_u32(vpaddlq_u16(vandq_u16(dec.val[0], weights)));
+    uint64x2_t decHi = vpaddlq_u32(vpaddlq_u16(vandq_u16(dec.val[1], weights)));
+
+    return (uint16_t)((vgetq_lane_u64(decLo, 0) + vgetq_lane_u64(decLo, 1)) |
+        ((vgetq_lane_u64(decHi, 0) + vgetq_lane_u64(decHi, 1)) << 8));
+}
+#else
+/**
+ * @brief Helper to perform the add-compare-select step for all 16 states.
+ * @param oldMetrics Path metrics for the previous step.
+ * @param[out] newMetrics Path metrics for this step.
+ * @param s0 First soft symbol.
+ * @param s1 Second soft symbol.
+ * @returns uint16_t Packed decision bits for this step.
+ */
+static inline uint16_t acsStep(const uint16_t* oldMetrics, uint16_t* newMetrics, uint8_t s0, uint8_t s1)
+{
+    uint16_t decisions = 0U;
+
+    for (uint8_t i = 0U; i < NUM_OF_STATES_D2; i++) {
+        uint8_t j = i * 2U;
+
+        uint16_t metric = std::abs(BRANCH_TABLE1[i] - s0) + std::abs(BRANCH_TABLE2[i] - s1);
+
+        uint16_t m0 = oldMetrics[i] + metric;
+        uint16_t m1 = oldMetrics[i + NUM_OF_STATES_D2] + (M - metric);
+        uint8_t decision0 = (m0 >= m1) ? 1U : 0U;
+        newMetrics[j + 0U] = decision0 != 0U ? m1 : m0;
+
+        m0 = oldMetrics[i] + (M - metric);
+        m1 = oldMetrics[i + NUM_OF_STATES_D2] + metric;
+        uint8_t decision1 = (m0 >= m1) ? 1U : 0U;
+        newMetrics[j + 1U] = decision1 != 0U ? m1 : m0;
+
+        decisions |= (decision1 << (j + 1U)) | (decision0 << (j + 0U));
+    }
+
+    return decisions;
+}
+#endif
+
 // ---------------------------------------------------------------------------
 //  Public Class Members
 // ---------------------------------------------------------------------------
@@ -36,26 +170,19 @@ const uint32_t K = 5U;
 /* Initializes a new instance of the Convolution class. */
 
 Convolution::Convolution() :
-    m_metrics1(nullptr),
-    m_metrics2(nullptr),
-    m_oldMetrics(nullptr),
-    m_newMetrics(nullptr),
-    m_decisions(nullptr),
-    m_dp(nullptr)
+    m_metrics1(),
+    m_metrics2(),
+    m_oldMetrics(m_metrics1),
+    m_newMetrics(m_metrics2),
+    m_decisions(),
+    m_dp(m_decisions)
 {
-    m_metrics1  = new uint16_t[20U];
-    m_metrics2  = new uint16_t[20U];
-    m_decisions = new uint64_t[300U];
+    /* stub */
 }
 
 /* Finalizes a instance of the Convolution class. */
 
-Convolution::~Convolution()
-{
-    delete[] m_metrics1;
-    delete[] m_metrics2;
-    delete[] m_decisions;
-}
+Convolution::~Convolution() = default;
 
 /* Starts convolution processing. */
 
@@ -74,19 +201,32 @@ void Convolution::start()
 uint32_t Convolution::chainback(uint8_t* out, uint32_t nBits)
 {
     assert(out != nullptr);
+    assert(nBits <= MAX_DECISIONS);
 
+    uint8_t bits[MAX_DECISIONS];
     uint32_t state = 0U;
 
-    while (nBits-- > 0) {
+    for (uint32_t n = nBits; n > 0U; n--) {
         --m_dp;
 
         uint32_t  i = state >> (9 - K);
         uint8_t bit = uint8_t(*m_dp >> i) & 1;
         state = (bit << 7) | (state >> 1);
 
-        WRITE_BIT(out, nBits, bit != 0U);
+        bits[n - 1U] = bit;
     }
 
+    // pack whole bytes at once, only the trailing partial byte is written bit by bit
+    uint32_t nBytes = nBits >> 3;
+    for (uint32_t i = 0U; i < nBytes; i++) {
+        const uint8_t* b = bits + (i << 3);
+        out[i] = (b[0U] << 7) | (b[1U] << 6) | (b[2U] << 5) | (b[3U] << 4) |
+            (b[4U] << 3) | (b[5U] << 2) | (b[6U] << 1) | b[7U];
+    }
+
+    for (uint32_t i = nBytes << 3; i < nBits; i++)
+        WRITE_BIT(out, i, bits[i] != 0U);
+
     uint32_t minCost = m_oldMetrics[0];
 
     for (uint32_t i = 0U; i < NUM_OF_STATES; i++) {
@@ -101,36 +241,78 @@ uint32_t Convolution::chainback(uint8_t* out, uint32_t nBits)
 
 bool Convolution::decode(uint8_t s0, uint8_t s1)
 {
-    *m_dp = 0U;
+    if ((m_dp - m_decisions) >= (ptrdiff_t)MAX_DECISIONS) {
+        return false;
+    }
 
-    for (uint8_t i = 0U; i < NUM_OF_STATES_D2; i++) {
-        uint8_t j = i * 2U;
+#if defined(CONVOLUTION_SSE2)
+    __m128i lo = _mm_loadu_si128(reinterpret_cast<const __m128i*>(m_oldMetrics));
+    __m128i hi = _mm_loadu_si128(reinterpret_cast<const __m128i*>(m_oldMetrics + NUM_OF_STATES_D2));
+    *m_dp = acsStep(lo, hi, s0, s1);
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(m_newMetrics), lo);
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(m_newMetrics + NUM_OF_STATES_D2), hi);
+#elif defined(CONVOLUTION_NEON)
+    uint16x8_t lo = vld1q_u16(m_oldMetrics);
+    uint16x8_t hi = vld1q_u16(m_oldMetrics + NUM_OF_STATES_D2);
+    *m_dp = acsStep(lo, hi, s0, s1);
+    vst1q_u16(m_newMetrics, lo);
+    vst1q_u16(m_newMetrics + NUM_OF_STATES_D2, hi);
+#else
+    *m_dp = acsStep(m_oldMetrics, m_newMetrics, s0, s1);
+#endif
 
-        uint16_t metric = std::abs(BRANCH_TABLE1[i] - s0) + std::abs(BRANCH_TABLE2[i] - s1);
+    ++m_dp;
 
-        uint16_t m0 = m_oldMetrics[i] + metric;
-        uint16_t m1 = m_oldMetrics[i + NUM_OF_STATES_D2] + (M - metric);
-        uint8_t decision0 = (m0 >= m1) ? 1U : 0U;
-        m_newMetrics[j + 0U] = decision0 != 0U ? m1 : m0;
+    uint16_t* tmp = m_oldMetrics;
+    m_oldMetrics = m_newMetrics;
+    m_newMetrics = tmp;
 
-        m0 = m_oldMetrics[i] + (M - metric);
-        m1 = m_oldMetrics[i + NUM_OF_STATES_D2] + metric;
-        uint8_t decision1 = (m0 >= m1) ? 1U : 0U;
-        m_newMetrics[j + 1U] = decision1 != 0U ? m1 : m0;
+    return true;
+}
 
-        *m_dp |= (uint64_t(decision1) << (j + 1U)) | (uint64_t(decision0) << (j + 0U));
-    }
+/* Decodes an entire convolutionally encoded block. */
 
-    ++m_dp;
+bool Convolution::decodeBlock(const uint8_t* symbols, uint32_t nBits, uint8_t* out)
+{
+    assert(symbols != nullptr);
+    assert(out != nullptr);
 
-    if ((m_dp - m_decisions) > 300) {
+    uint32_t nSteps = nBits + TAIL_LENGTH;
+    if (nSteps > MAX_DECISIONS) {
         return false;
     }
 
-    uint16_t* tmp = m_oldMetrics;
-    m_oldMetrics = m_newMetrics;
-    m_newMetrics = tmp;
+    start();
+
+#if defined(CONVOLUTION_SSE2)
+    __m128i lo = _mm_setzero_si128();
+    __m128i hi = _mm_setzero_si128();
+    for (uint32_t i = 0U; i < nSteps; i++, symbols += 2U)
+        m_decisions[i] = acsStep(lo, hi, symbols[0U], symbols[1U]);
+
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(m_oldMetrics), lo);
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(m_oldMetrics + NUM_OF_STATES_D2), hi);
+#elif defined(CONVOLUTION_NEON)
+    uint16x8_t lo = vdupq_n_u16(0U);
+    uint16x8_t hi = vdupq_n_u16(0U);
+    for (uint32_t i = 0U; i < nSteps; i++, symbols += 2U)
+        m_decisions[i] = acsStep(lo, hi, symbols[0U], symbols[1U]);
+
+    vst1q_u16(m_oldMetrics, lo);
+    vst1q_u16(m_oldMetrics + NUM_OF_STATES_D2, hi);
+#else
+    for (uint32_t i = 0U; i < nSteps; i++, symbols += 2U) {
+        m_decisions[i] = acsStep(m_oldMetrics, m_newMetrics, symbols[0U], symbols[1U]);
+
+        uint16_t* tmp = m_oldMetrics;
+        m_oldMetrics = m_newMetrics;
+        m_newMetrics = tmp;
+    }
+#endif
+
+    m_dp = m_decisions + nSteps;
 
+    chainback(out, nBits);
     return true;
 }
 
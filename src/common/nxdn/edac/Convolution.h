@@ -35,6 +35,10 @@ namespace nxdn
 
         /**
          * @brief Implements NXDN frame convolution processing.
+         *
+         *  The Viterbi add-compare-select step processes all 16 trellis states at once using SSE2
+         *  (x86) or NEON (ARM) when available, with a portable scalar fallback. Decisions for each
+         *  step are packed into a single 16-bit word.
          * @ingroup nxdn_edac
          */
         class HOST_SW_API Convolution {
@@ -48,6 +52,10 @@ namespace nxdn
              */
             ~Convolution();
 
+            // the metric and decision pointers point into this instance's own storage, so it cannot be copied
+            Convolution(const Convolution&) = delete;
+            Convolution& operator=(const Convolution&) = delete;
+
             /**
              * @brief Starts convolution processing.
              */
@@ -67,6 +75,17 @@ namespace nxdn
              * @returns bool
              */
             bool decode(uint8_t s0, uint8_t s1);
+            /**
+             * @brief Decodes an entire convolutionally encoded block.
+             *  (NOTE: This is equivalent to start(), decode() for each symbol pair and chainback(), but keeps
+             *  the path metrics in registers for the whole block.)
+             * @param[in] symbols Soft symbols (0 = 0, 1 = punctured/erased, 2 = 1); 2 * (nBits + 4) symbols,
+             *  including the tail.
+             * @param nBits Number of decoded bits (excluding the tail).
+             * @param[out] out Buffer to receive the decoded bits.
+             * @returns bool True, if the block was decoded, otherwise false.
+             */
+            bool decodeBlock(const uint8_t* symbols, uint32_t nBits, uint8_t* out);
             /**
              * @brief 
              * @param[in] in 
@@ -76,15 +95,15 @@ namespace nxdn
             void encode(const uint8_t* in, uint8_t* out, uint32_t nBits) const;
 
         private:
-            uint16_t* m_metrics1;
-            uint16_t* m_metrics2;
+            uint16_t m_metrics1[16U];
+            uint16_t m_metrics2[16U];
 
             uint16_t* m_oldMetrics;
             uint16_t* m_newMetrics;
 
-            uint64_t* m_decisions;
+            uint16_t m_decisions[300U];
 
-            uint64_t* m_dp;
+            uint16_t* m_dp;
         };
     } // namespace edac
 } // namespace nxdn
@@ -192,10 +192,6 @@ void P25Crypto::generateKeystream()
         break;
     case ALGO_ARC4:
         {
-            if (m_keystream == nullptr)
-                m_keystream = new uint8_t[469U];
-            ::memset(m_keystream, 0x00U, 469U);
-
             uint8_t padding = (uint8_t)::fmax(5U - m_tekLength, 0U);
             uint8_t adpKey[13U];
             ::memset(adpKey, 0x00U, 13U);
@@ -210,8 +206,10 @@ void P25Crypto::generateKeystream()
             for (i = 5U; i < 13U; i++)
                 adpKey[i] = m_mi[i - 5U];
 
-            // generate ARC4 keystream
+            // generate ARC4 keystream (the generated keystream replaces any previous keystream buffer)
             RC4 rc4 = RC4();
+            if (m_keystream != nullptr)
+                delete[] m_keystream;
             m_keystream = rc4.keystream(469U, adpKey, 13U);
         }
         break;
@@ -0,0 +1,75 @@
+// SPDX-License-Identifier: GPL-2.0-only
+/*
+ * Digital Voice Modem - Common Library
+ * GPLv2 Open Source. Use is subject to license terms.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ *  Copyright (C) 2026 Bryan Biedenkapp, N2PLL
+ *
+ */
+#include "Defines.h"
+#include "p25/data/LinkSequence.h"
+
+using namespace p25;
+using namespace p25::data;
+
+// ---------------------------------------------------------------------------
+//  Public Class Members
+// ---------------------------------------------------------------------------
+
+/* Initializes a new instance of the LinkSequence class. */
+
+LinkSequence::LinkSequence() :
+    m_lock(),
+    m_sendSeq(),
+    m_recvSeq()
+{
+    /* stub */
+}
+
+/* Advances V(S) and returns the N(S) for the next packet sent to the logical link. */
+
+uint8_t LinkSequence::nextSend(uint32_t llId, bool& synchronize)
+{
+    std::lock_guard<std::mutex> lock(m_lock);
+
+    synchronize = false;
+
+    uint8_t& vs = m_sendSeq[llId];
+    vs++;
+    if (vs >= 8U) {
+        vs = 0U;
+        synchronize = true;
+    }
+
+    return vs;
+}
+
+/* Validates a received N(S) against V(R), and advances V(R) if the packet is accepted. */
+
+bool LinkSequence::receive(uint32_t llId, uint8_t ns, bool synchronize, uint8_t& expectedNs)
+{
+    std::lock_guard<std::mutex> lock(m_lock);
+
+    // V(R) starts at 0 for the first packet from a logical link
+    uint8_t& vr = m_recvSeq[llId];
+    expectedNs = vr;
+
+    // the synchronize flag resets the receive window per TIA-102; otherwise accept N(S) == V(R) or
+    // V(R) + 1 (allows one-ahead windowing)
+    if (synchronize || ns == vr || ns == (vr + 1U) % 8U) {
+        vr = (ns + 1U) % 8U;
+        return true;
+    }
+
+    return false;
+}
+
+/* Removes the sequence state of a logical link. */
+
+void LinkSequence::remove(uint32_t llId)
+{
+    std::lock_guard<std::mutex> lock(m_lock);
+    m_sendSeq.erase(llId);
+    m_recvSeq.erase(llId);
+}
@@ -0,0 +1,78 @@
+// SPDX-License-Identifier: GPL-2.0-only
+/*
+ * Digital Voice Modem - Common Library
+ * GPLv2 Open Source. Use is subject to license terms.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ *  Copyright (C) 2026 Bryan Biedenkapp, N2PLL
+ *
+ */
+/**
+ * @file LinkSequence.h
+ * @ingroup p25
+ * @file LinkSequence.cpp
+ * @ingroup p25
+ */
+#if !defined(__P25_DATA__LINK_SEQUENCE_H__)
+#define __P25_DATA__LINK_SEQUENCE_H__
+
+#include "common/Defines.h"
+
+#include <mutex>
+#include <unordered_map>
+
+namespace p25
+{
+    namespace data
+    {
+        // ---------------------------------------------------------------------------
+        //  Class Declaration
+        // ---------------------------------------------------------------------------
+
+        /**
+         * @brief Implements the per logical link V(S)/V(R) state variables for confirmed PDU delivery.
+         *
+         *  The state is locked internally and no lock is held once a method returns, so a caller may
+         *  send a response (which takes the next N(S)) for a rejected packet right away.
+         * @ingroup p25
+         */
+        class HOST_SW_API LinkSequence {
+        public:
+            /**
+             * @brief Initializes a new instance of the LinkSequence class.
+             */
+            LinkSequence();
+
+            /**
+             * @brief Advances V(S) and returns the N(S) for the next packet sent to the logical link.
+             * @param llId Logical Link ID.
+             * @param[out] synchronize Flag indicating V(S) wrapped and the packet must set the synchronize flag.
+             * @returns uint8_t N(S) for the next packet.
+             */
+            uint8_t nextSend(uint32_t llId, bool& synchronize);
+            /**
+             * @brief Validates a received N(S) against V(R), and advances V(R) if the packet is accepted.
+             *  (A packet is accepted if N(S) is V(R) or V(R) + 1, or if it sets the synchronize flag.)
+             * @param llId Logical Link ID.
+             * @param ns Received N(S).
+             * @param synchronize Flag indicating the received packet sets the synchronize flag.
+             * @param[out] expectedNs V(R) before the packet was received.
+             * @returns bool True, if the packet is in sequence, otherwise false.
+             */
+            bool receive(uint32_t llId, uint8_t ns, bool synchronize, uint8_t& expectedNs);
+
+            /**
+             * @brief Removes the sequence state of a logical link.
+             * @param llId Logical Link ID.
+             */
+            void remove(uint32_t llId);
+
+        private:
+            std::mutex m_lock;
+            std::unordered_map<uint32_t, uint8_t> m_sendSeq;    // V(S) send state variable per LLId
+            std::unordered_map<uint32_t, uint8_t> m_recvSeq;    // V(R) receive state variable per LLId
+        };
+    } // namespace data
+} // namespace p25
+
+#endif // __P25_DATA__LINK_SEQUENCE_H__
@@ -24,11 +24,15 @@
 #include "common/restapi/http/HTTPPayload.h"
 #include "common/Log.h"
 
+#include <cstdlib>
+#include <cstring>
 #include <functional>
 #include <map>
 #include <string>
 #include <regex>
 #include <memory>
+#include <utility>
+#include <vector>
 
 namespace restapi
 {
@@ -38,17 +42,62 @@ namespace restapi
 
     /**
      * @brief Structure representing a REST API request match.
+     *  Group 0 is the matched path, groups 1..n are the captured path parameters. Requests matched
+     *  against a literal (non-regex) expression carry no groups.
      * @ingroup rest
      */
-    struct RequestMatch : std::smatch {
+    struct RequestMatch {
         /**
          * @brief Initializes a new instance of the RequestMatch structure.
          * @param m String matcher.
          * @param c Content.
          */
-        RequestMatch(const std::smatch& m, const std::string& c) : std::smatch(m), content(c) { /* stub */ }
+        RequestMatch(const std::smatch& m, const std::string& c) : content(c), m_groups()
+        {
+            m_groups.reserve(m.size());
+            for (auto& sub : m)
+                m_groups.push_back(sub.str());
+        }
+        /**
+         * @brief Initializes a new instance of the RequestMatch structure.
+         * @param groups Matched groups.
+         * @param c Content.
+         */
+        RequestMatch(std::vector<std::string>&& groups, const std::string& c) : content(c), m_groups(std::move(groups)) { /* stub */ }
+
+        /**
+         * @brief Gets the number of matched groups.
+         * @returns size_t Number of matched groups.
+         */
+        size_t size() const { return m_groups.size(); }
+        /**
+         * @brief Helper to determine if there are no matched groups.
+         * @returns bool True, if there are no matched groups, otherwise false.
+         */
+        bool empty() const { return m_groups.empty(); }
+        /**
+         * @brief Gets the given matched group.
+         * @param n Group index.
+         * @returns std::string Matched group, or an empty string if the group does not exist.
+         */
+        std::string str(size_t n = 0U) const { return (n < m_groups.size()) ? m_groups[n] : std::string(); }
+        /**
+         * @brief Gets the given matched group.
+         * @param n Group index.
+         * @returns std::string Matched group, or an empty string if the group does not exist.
+         */
+        std::string operator[](size_t n) const { return str(n); }
+        /**
+         * @brief Gets the given matched group as a unsigned integer path parameter.
+         * @param n Group index.
+         * @returns uint32_t Path parameter value, or 0 if the group does not exist.
+         */
+        uint32_t uintParam(size_t n) const { return (n < m_groups.size()) ? (uint32_t)::strtoul(m_groups[n].c_str(), nullptr, 10) : 0U; }
 
         std::string content;
+
+    private:
+        std::vector<std::string> m_groups;
     };
 
     // ---------------------------------------------------------------------------
@@ -67,7 +116,7 @@ namespace restapi
          * @brief Initializes a new instance of the RequestMatcher structure.
          * @param expression Matching expression.
          */
-        explicit RequestMatcher(const std::string& expression) : m_expression(expression), m_isRegEx(false) { /* stub */ }
+        explicit RequestMatcher(const std::string& expression) : m_expression(expression), m_isRegEx(false), m_isBlocking(false), m_regex(), m_handlers() { /* stub */ }
 
         /**
          * @brief Handler for GET requests.
@@ -115,16 +164,58 @@ namespace restapi
             return *this;
         }
 
+        /**
+         * @brief Marks the handlers for this request matcher as blocking. Blocking handlers are run by
+         *  the HTTP server on its blocking worker threads, and not on the IO threads.
+         * @param blocking Flag indicating whether or not the handlers are blocking.
+         * @return RequestMatcher* Instance of a RequestMatcher.
+         */
+        RequestMatcher<Request, Reply>& blocking(bool blocking = true) {
+            m_isBlocking = blocking;
+            return *this;
+        }
+
+        /**
+         * @brief Helper to determine if the request matcher handlers are blocking.
+         * @returns bool True, if the request matcher handlers are blocking, otherwise false.
+         */
+        bool isBlocking() const { return m_isBlocking; }
         /**
          * @brief Helper to determine if the request matcher is a regular expression.
          * @returns bool True, if request matcher is a regular expression, otherwise false.
          */
         bool regex() const { return m_isRegEx; }
         /**
-         * @brief Helper to set the regular expression flag.
+         * @brief Helper to set the regular expression flag. The regular expression is compiled once here,
+         *  and not on every request.
          * @param regEx Flag indicating whether or not the request matcher is a regular expression.
          */
-        void setRegEx(bool regEx) { m_isRegEx = regEx; }
+        void setRegEx(bool regEx)
+        {
+            if (regEx && (!m_isRegEx || m_regex == nullptr)) {
+                m_regex = std::unique_ptr<std::regex>(new std::regex(m_expression, std::regex::optimize));
+            }
+
+            m_isRegEx = regEx;
+        }
+
+        /**
+         * @brief Gets the matching expression.
+         * @returns const std::string& Matching expression.
+         */
+        const std::string& expression() const { return m_expression; }
+        /**
+         * @brief Helper to test the given URI against the compiled regular expression.
+         * @param uri URI.
+         * @param what What matched.
+         * @returns bool True, if the URI matched, otherwise false.
+         */
+        bool regexMatch(const std::string& uri, std::smatch& what) const
+        {
+            if (m_regex == nullptr)
+                return false;
+            return std::regex_match(uri, what, *m_regex);
+        }
 
         /**
          * @brief Helper to handle the actual request.
@@ -132,18 +223,32 @@ namespace restapi
          * @param reply HTTP reply.
          * @param what What matched.
          */
-        void handleRequest(const Request& request, Reply& reply, const std::smatch &what) {
-            // dispatching to matching based on handler
+        void handleRequest(const Request& request, Reply& reply, const std::smatch& what)
+        {
             RequestMatch match(what, request.content);
-            auto& handler = m_handlers[request.method];
-            if (handler) {
-                handler(request, reply, match);
+            handleRequest(request, reply, match);
+        }
+        /**
+         * @brief Helper to handle the actual request.
+         * @param request HTTP request.
+         * @param reply HTTP reply.
+         * @param match Request match.
+         */
+        void handleRequest(const Request& request, Reply& reply, const RequestMatch& match)
+        {
+            // dispatching to matching based on handler; the handler table is never modified
+            // while dispatching (so this may be called from multiple threads)
+            auto it = m_handlers.find(request.method);
+            if (it != m_handlers.end() && it->second) {
+                it->second(request, reply, match);
             }
         }
 
     private:
         std::string m_expression;
         bool m_isRegEx;
+        bool m_isBlocking;
+        std::unique_ptr<std::regex> m_regex;
         std::map<std::string, RequestHandlerType> m_handlers;
     };
 
@@ -163,21 +268,46 @@ namespace restapi
         /**
          * @brief Initializes a new instance of the RequestDispatcher class.
          */
-        RequestDispatcher() : m_basePath(), m_debug(false) { /* stub */ }
+        RequestDispatcher() : m_basePath(), m_matchers(), m_routes(new RouteNode()), m_debug(false) { /* stub */ }
         /**
          * @brief Initializes a new instance of the RequestDispatcher class.
          * @param debug Flag indicating whether or not verbose logging should be enabled.
          */
-        RequestDispatcher(bool debug) : m_basePath(), m_debug(debug) { /* stub */ }
+        RequestDispatcher(bool debug) : m_basePath(), m_matchers(), m_routes(new RouteNode()), m_debug(debug) { /* stub */ }
         /**
          * @brief Initializes a new instance of the RequestDispatcher class.
          * @param basePath 
          * @param debug Flag indicating whether or not verbose logging should be enabled.
          */
-        RequestDispatcher(const std::string& basePath, bool debug) : m_basePath(basePath), m_debug(debug) { /* stub */ }
+        RequestDispatcher(const std::string& basePath, bool debug) : m_basePath(basePath), m_matchers(), m_routes(new RouteNode()), m_debug(debug) { /* stub */ }
+        /**
+         * @brief Initializes a copy of the RequestDispatcher class.
+         * @param data Instance of a RequestDispatcher to copy.
+         */
+        RequestDispatcher(const RequestDispatcher& data) : m_basePath(), m_matchers(), m_routes(new RouteNode()), m_debug(false)
+        {
+            copy(data);
+        }
+
+        /**
+         * @brief Assignment operator.
+         * @param data Instance of a RequestDispatcher to copy.
+         * @returns RequestDispatcher& Reference to this RequestDispatcher.
+         */
+        RequestDispatcher& operator=(const RequestDispatcher& data)
+        {
+            if (this != &data) {
+                copy(data);
+            }
+
+            return *this;
+        }
 
         /**
          * @brief Helper to match a request patch.
+         *  Literal expressions, and regular expressions made up only of literal path segments and
+         *  numeric "(\d+)" path parameters, are compiled into the route trie. Any other regular
+         *  expression is compiled once and tested in order after the route trie.
          * @param expression Matching expression.
          * @param regex Flag indicating whether or not this match is a regular expression.
          * @returns MatcherType Instance of a request matcher.
@@ -197,9 +327,40 @@ namespace restapi
             }
 
             p->setRegEx(regex);
+            compileRoute(expression, regex, p);
             return *p;
         }
 
+        /**
+         * @brief Helper to determine if the handler for the given HTTP request is blocking.
+         * @param request HTTP request.
+         * @returns bool True, if the handler for the request is marked blocking, otherwise false.
+         */
+        bool isBlocking(const Request& request) const
+        {
+            size_t pathLen = request.uri.find('?');
+            if (pathLen == std::string::npos)
+                pathLen = request.uri.size();
+
+            RouteParams params;
+            MatcherType* routed = findRoute(m_routes.get(), request.uri.c_str(), request.uri.c_str() + pathLen, params);
+            if (routed != nullptr)
+                return routed->isBlocking();
+
+            for (const auto& matcher : m_matchers) {
+                std::smatch what;
+                if (!matcher.second->regex()) {
+                    if (request.uri.find(matcher.first) != std::string::npos)
+                        return matcher.second->isBlocking();
+                } else {
+                    if (matcher.second->regexMatch(request.uri, what))
+                        return matcher.second->isBlocking();
+                }
+            }
+
+            return false;
+        }
+
         /**
          * @brief Helper to handle HTTP request.
          * @param request HTTP request.
@@ -207,6 +368,39 @@ namespace restapi
          */
         void handleRequest(const Request& request, Reply& reply)
         {
+            // try the route trie first, the path is matched exactly (ignoring any query string)
+            size_t pathLen = request.uri.find('?');
+            if (pathLen == std::string::npos)
+                pathLen = request.uri.size();
+
+            RouteParams params;
+            MatcherType* routed = findRoute(m_routes.get(), request.uri.c_str(), request.uri.c_str() + pathLen, params);
+            if (routed != nullptr) {
+                std::vector<std::string> groups;
+                if (routed->regex()) {
+                    if (m_debug) {
+                        ::LogDebug(LOG_REST, "regex endpoint, uri = %s, expression = %s", request.uri.c_str(), routed->expression().c_str());
+                    }
+
+                    groups.reserve(params.count + 1U);
+                    groups.push_back(request.uri.substr(0U, pathLen));
+                    for (size_t i = 0U; i < params.count; i++)
+                        groups.push_back(std::string(params.begin[i], params.len[i]));
+                } else {
+                    if (m_debug) {
+                        ::LogDebug(LOG_REST, "non-regex endpoint, uri = %s, expression = %s", request.uri.c_str(), routed->expression().c_str());
+                    }
+
+                    addCORSHeaders(request, reply);
+                }
+
+                RequestMatch match(std::move(groups), request.content);
+                routed->handleRequest(request, reply, match);
+                return;
+            }
+
+            // fallback to testing each matcher in order; this preserves the original substring matching
+            // for literal expressions and handles any regular expression that could not be routed
             for (const auto& matcher : m_matchers) {
                 std::smatch what;
                 if (!matcher.second->regex()) {
@@ -215,22 +409,12 @@ namespace restapi
                             ::LogDebug(LOG_REST, "non-regex endpoint, uri = %s, expression = %s", request.uri.c_str(), matcher.first.c_str());
                         }
 
-                        //what = matcher.first;
-
-                        // ensure CORS headers are added
-                        reply.headers.add("Access-Control-Allow-Origin", "*");
-                        reply.headers.add("Access-Control-Allow-Methods", "*");
-                        reply.headers.add("Access-Control-Allow-Headers", "*");
-                        
-                        if (request.method == HTTP_OPTIONS) {
-                            reply.status = http::HTTPPayload::OK;
-                        }
-                        
+                        addCORSHeaders(request, reply);
                         matcher.second->handleRequest(request, reply, what);
                         return;
                     }
                 } else {
-                    if (std::regex_match(request.uri, what, std::regex(matcher.first))) {
+                    if (matcher.second->regexMatch(request.uri, what)) {
                         if (m_debug) {
                             ::LogDebug(LOG_REST, "regex endpoint, uri = %s, expression = %s", request.uri.c_str(), matcher.first.c_str());
                         }
@@ -248,10 +432,177 @@ namespace restapi
     private:
         typedef std::shared_ptr<MatcherType> MatcherTypePtr;
 
+        static const size_t MAX_ROUTE_PARAMS = 8U;
+
+        /**
+         * @brief Structure representing a node in the route trie (one node per path segment).
+         */
+        struct RouteNode {
+            std::vector<std::pair<std::string, std::unique_ptr<RouteNode>>> literals;
+            std::unique_ptr<RouteNode> numeric;
+            MatcherType* matcher = nullptr;
+        };
+
+        /**
+         * @brief Structure representing the path parameters captured while walking the route trie.
+         */
+        struct RouteParams {
+            const char* begin[MAX_ROUTE_PARAMS];
+            size_t len[MAX_ROUTE_PARAMS];
+            size_t count = 0U;
+        };
+
         std::string m_basePath;
         std::map<std::string, MatcherTypePtr> m_matchers;
+        std::unique_ptr<RouteNode> m_routes;
 
         bool m_debug;
+
+        /**
+         * @brief Internal helper to copy the class; the matchers are shared and the route trie is rebuilt.
+         * @param data Instance of a RequestDispatcher to copy.
+         */
+        void copy(const RequestDispatcher& data)
+        {
+            m_basePath = data.m_basePath;
+            m_matchers = data.m_matchers;
+            m_debug = data.m_debug;
+
+            m_routes = std::unique_ptr<RouteNode>(new RouteNode());
+            for (auto& matcher : m_matchers)
+                compileRoute(matcher.first, matcher.second->regex(), matcher.second);
+        }
+
+        /**
+         * @brief Helper to add the CORS headers for a literal endpoint.
+         * @param request HTTP request.
+         * @param reply HTTP reply.
+         */
+        static void addCORSHeaders(const Request& request, Reply& reply)
+        {
+            // ensure CORS headers are added
+            reply.headers.add("Access-Control-Allow-Origin", "*");
+            reply.headers.add("Access-Control-Allow-Methods", "*");
+            reply.headers.add("Access-Control-Allow-Headers", "*");
+
+            if (request.method == HTTP_OPTIONS) {
+                reply.status = http::HTTPPayload::OK;
+            }
+        }
+
+        /**
+         * @brief Helper to compile the given expression into the route trie.
+         * @param expression Matching expression.
+         * @param regex Flag indicating whether or not this match is a regular expression.
+         * @param matcher Instance of a request matcher.
+         */
+        void compileRoute(const std::string& expression, bool regex, const MatcherTypePtr& matcher)
+        {
+            if (expression.empty() || expression[0U] != '/')
+                return;
+
+            // split the expression into path segments, and validate every segment can be routed
+            std::vector<std::string> segments;
+            size_t params = 0U;
+            size_t pos = 1U;
+            while (pos <= expression.size()) {
+                size_t end = expression.find('/', pos);
+                if (end == std::string::npos)
+                    end = expression.size();
+
+                std::string segment = expression.substr(pos, end - pos);
+                if (regex) {
+                    if (segment == "(\\d+)" || segment == "([0-9]+)") {
+                        if (++params > MAX_ROUTE_PARAMS)
+                            return;
+                        segment.clear();
+                    }
+                    else if (segment.empty() || segment.find_first_of("\\^$.|?*+()[]{}") != std::string::npos) {
+                        return;
+                    }
+                }
+
+                segments.push_back(segment);
+                pos = end + 1U;
+            }
+
+            RouteNode* node = m_routes.get();
+            for (auto& segment : segments) {
+                if (segment.empty() && regex) {
+                    if (node->numeric == nullptr)
+                        node->numeric = std::unique_ptr<RouteNode>(new RouteNode());
+                    node = node->numeric.get();
+                    continue;
+                }
+
+                RouteNode* next = nullptr;
+                for (auto& child : node->literals) {
+                    if (child.first == segment) {
+                        next = child.second.get();
+                        break;
+                    }
+                }
+
+                if (next == nullptr) {
+                    node->literals.push_back(std::make_pair(segment, std::unique_ptr<RouteNode>(new RouteNode())));
+                    next = node->literals.back().second.get();
+                }
+
+                node = next;
+            }
+
+            node->matcher = matcher.get();
+        }
+
+        /**
+         * @brief Helper to walk the route trie for the given path.
+         * @param node Current route node.
+         * @param path Path (starting at a '/' path separator).
+         * @param end End of the path.
+         * @param params Captured path parameters.
+         * @returns MatcherType* Instance of a request matcher, or nullptr if no route matched.
+         */
+        static MatcherType* findRoute(const RouteNode* node, const char* path, const char* end, RouteParams& params)
+        {
+            if (path == end)
+                return node->matcher;
+            if (*path != '/')
+                return nullptr;
+
+            const char* segment = path + 1;
+            const char* next = segment;
+            while (next != end && *next != '/')
+                next++;
+            size_t len = (size_t)(next - segment);
+
+            for (auto& child : node->literals) {
+                if (child.first.size() == len && ::memcmp(child.first.c_str(), segment, len) == 0) {
+                    MatcherType* matcher = findRoute(child.second.get(), next, end, params);
+                    if (matcher != nullptr)
+                        return matcher;
+                    break;
+                }
+            }
+
+            if (node->numeric != nullptr && len > 0U && params.count < MAX_ROUTE_PARAMS) {
+                for (const char* c = segment; c != next; c++) {
+                    if (*c < '0' || *c > '9')
+                        return nullptr;
+                }
+
+                size_t idx = params.count++;
+                params.begin[idx] = segment;
+                params.len[idx] = len;
+
+                MatcherType* matcher = findRoute(node->numeric.get(), next, end, params);
+                if (matcher != nullptr)
+                    return matcher;
+
+                params.count--;
+            }
+
+            return nullptr;
+        }
     };
 
     // ---------------------------------------------------------------------------
@@ -44,6 +44,7 @@ void HTTPLexer::reset()
     }
 
     m_headers = std::vector<LexedHeader>();
+    m_consumed = 0U;
 }
 
 // ---------------------------------------------------------------------------
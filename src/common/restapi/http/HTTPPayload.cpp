@@ -15,6 +15,9 @@
 
 using namespace restapi::http;
 
+#include <algorithm>
+#include <cctype>
+#include <cstdlib>
 #include <string>
 
 namespace status_strings {
@@ -321,9 +324,19 @@ std::vector<asio::const_buffer> HTTPPayload::toBuffers()
 
 void HTTPPayload::payload(json::object& obj, HTTPPayload::StatusType s)
 {
-    json::value v = json::value(obj);
-    std::string json = std::string(v.serialize());
-    payload(json, s, "application/json");
+    // serialize the object directly, rather than deep copying it into a json::value first
+    json::writer writer;
+    writer.write(obj);
+    payload(writer, s);
+}
+
+/* Prepares payload for transmission by finalizing status and content type. */
+
+void HTTPPayload::payload(json::writer& writer, HTTPPayload::StatusType s)
+{
+    writer.swap(content);
+    status = s;
+    ensureDefaultHeaders("application/json");
 }
 
 /* Prepares payload for transmission by finalizing status and content type. */
@@ -367,6 +380,72 @@ HTTPPayload HTTPPayload::statusPayload(HTTPPayload::StatusType status, const std
 }
 
 
+/* Helper to parse the query string parameters of the request URI. */
+
+std::map<std::string, std::string> HTTPPayload::query() const
+{
+    std::map<std::string, std::string> params;
+
+    size_t pos = uri.find('?');
+    if (pos == std::string::npos) {
+        return params;
+    }
+
+    auto decode = [](const std::string& in) -> std::string {
+        std::string out;
+        out.reserve(in.size());
+        for (size_t i = 0U; i < in.size(); i++) {
+            if (in[i] == '%' && i + 2U < in.size() && ::isxdigit(in[i + 1U]) && ::isxdigit(in[i + 2U])) {
+                out.push_back((char)::strtoul(in.substr(i + 1U, 2U).c_str(), nullptr, 16));
+                i += 2U;
+            }
+            else if (in[i] == '+') {
+                out.push_back(' ');
+            }
+            else {
+                out.push_back(in[i]);
+            }
+        }
+
+        return out;
+    };
+
+    std::string queryString = uri.substr(pos + 1U);
+    queryString.erase(std::find(queryString.begin(), queryString.end(), '\0'), queryString.end());
+
+    size_t start = 0U;
+    while (start < queryString.size()) {
+        size_t end = queryString.find('&', start);
+        if (end == std::string::npos)
+            end = queryString.size();
+
+        std::string param = queryString.substr(start, end - start);
+        if (!param.empty()) {
+            size_t eq = param.find('=');
+            if (eq == std::string::npos)
+                params[decode(param)] = "";
+            else
+                params[decode(param.substr(0U, eq))] = decode(param.substr(eq + 1U));
+        }
+
+        start = end + 1U;
+    }
+
+    return params;
+}
+
+/* Helper to determine whether the connection should be kept open after replying to this request. */
+
+bool HTTPPayload::keepAlive() const
+{
+    std::string connection = ::strtolower(headers.find("Connection"));
+    if (httpVersionMajor > 1 || (httpVersionMajor == 1 && httpVersionMinor >= 1)) {
+        return connection.find("close") == std::string::npos;
+    }
+
+    return connection.find("keep-alive") != std::string::npos;
+}
+
 /* Helper to attach a host TCP stream reader. */
 
 void HTTPPayload::attachHostHeader(const asio::ip::tcp::endpoint remoteEndpoint)
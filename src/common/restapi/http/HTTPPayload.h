@@ -19,8 +19,10 @@
 
 #include "common/Defines.h"
 #include "common/json/json.h"
+#include "common/json/writer.h"
 #include "common/restapi/http/HTTPHeaders.h"
 
+#include <map>
 #include <string>
 #include <vector>
 
@@ -40,6 +42,10 @@ namespace restapi
         #define HTTP_DELETE "DELETE"
         #define HTTP_OPTIONS "OPTIONS"
 
+        #define HTTP_MAX_CONTENT_LENGTH (4U * 1024U * 1024U)
+        #define HTTP_REQUEST_TIMEOUT 30U        // seconds a client has to send a request, or to read the reply
+        #define HTTP_MAX_CONNECTIONS 64U
+
         // ---------------------------------------------------------------------------
         //  Structure Declaration
         // ---------------------------------------------------------------------------
@@ -101,6 +107,14 @@ namespace restapi
              * @param status HTTP status.
              */
             void payload(json::object& obj, StatusType status = OK);
+            /**
+             * @brief Prepares payload for transmission by finalizing status and content type.
+             *  (NOTE: The JSON text is swapped out of the writer into the payload content without
+             *  copying; the writer is reset by this call.)
+             * @param writer JSON streaming writer containing the complete JSON text.
+             * @param status HTTP status.
+             */
+            void payload(json::writer& writer, StatusType status = OK);
             /**
              * @brief Prepares payload for transmission by finalizing status and content type.
              * @param content 
@@ -122,6 +136,21 @@ namespace restapi
              */
             static HTTPPayload statusPayload(StatusType status, const std::string& contentType = "text/html");
 
+            /**
+             * @brief Helper to parse the query string parameters of the request URI.
+             *  (NOTE: Parameter names and values are URL decoded. Parameters without a value are
+             *  returned with a empty value.)
+             * @returns std::map<std::string, std::string> Map of query string parameters.
+             */
+            std::map<std::string, std::string> query() const;
+            /**
+             * @brief Helper to determine whether the connection should be kept open after replying to this
+             *  request. (HTTP/1.1 defaults to persistent connections unless "Connection: close" is given,
+             *  HTTP/1.0 requires "Connection: keep-alive".)
+             * @returns bool True, if the connection should be kept alive, otherwise false.
+             */
+            bool keepAlive() const;
+
             /**
              * @brief Helper to attach a host TCP stream reader.
              * @param remoteEndpoint Endpoint.
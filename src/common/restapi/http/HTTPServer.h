@@ -5,7 +5,7 @@
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  *  Copyright (c) 2003-2013 Christopher M. Kohlhoff
- *  Copyright (C) 2023-2024 Bryan Biedenkapp, N2PLL
+ *  Copyright (C) 2023-2025 Bryan Biedenkapp, N2PLL
  *
  */
 /**
@@ -19,12 +19,14 @@
 #include "common/restapi/http/ServerConnection.h"
 #include "common/restapi/http/ServerConnectionManager.h"
 #include "common/restapi/http/HTTPRequestHandler.h"
+#include "common/ThreadPolicy.h"
 
 #include <thread>
 #include <string>
 #include <signal.h>
 #include <utility>
 #include <memory>
+#include <vector>
 
 #include <asio.hpp>
 
@@ -57,10 +59,14 @@ namespace restapi
              */
             explicit HTTPServer(const std::string& address, uint16_t port, bool debug) :
                 m_ioService(),
-                m_acceptor(m_ioService),
+                m_acceptor(asio::make_strand(m_ioService)),
                 m_connectionManager(),
                 m_socket(m_ioService),
                 m_requestHandler(),
+                m_workers(1U),
+                m_blockingWorkers(0U),
+                m_blockingService(),
+                m_requestTimeout(HTTP_REQUEST_TIMEOUT),
                 m_debug(debug)
             {
                 // open the acceptor with the option to reuse the address (i.e. SO_REUSEADDR)
@@ -79,6 +85,26 @@ namespace restapi
                 m_requestHandler = RequestHandlerType(std::forward<Handler>(handler));
             }
 
+            /**
+             * @brief Helper to set the number of worker threads.
+             *  (NOTE: This must be called before run().)
+             * @param workers Number of threads to run the IO service on.
+             * @param blockingWorkers Number of threads to run request handlers the request handler reports
+             *  as blocking on (0 runs all request handlers on the IO threads).
+             */
+            void setWorkers(uint32_t workers, uint32_t blockingWorkers)
+            {
+                m_workers = (workers > 0U) ? workers : 1U;
+                m_blockingWorkers = blockingWorkers;
+            }
+
+            /**
+             * @brief Helper to set the number of seconds a client has to send a complete request (or to
+             *  read the reply) before its connection is closed.
+             * @param timeout Request timeout (seconds).
+             */
+            void setRequestTimeout(uint32_t timeout) { m_requestTimeout = (timeout > 0U) ? timeout : HTTP_REQUEST_TIMEOUT; }
+
             /**
              * @brief Open TCP acceptor.
              */
@@ -96,14 +122,40 @@ namespace restapi
 
             /**
              * @brief Run the servers ASIO IO service loop.
+             *  (NOTE: The calling thread is used as the first worker thread.)
              */
             void run()
             {
+                // the blocking service is kept running until the IO service has finished
+                auto blockingWork = asio::make_work_guard(m_blockingService);
+                std::vector<std::thread> blockingThreads;
+                for (uint32_t i = 0U; i < m_blockingWorkers; i++) {
+                    blockingThreads.emplace_back([this]() {
+                        applyThreadPolicy("rest:blocking");
+                        m_blockingService.run();
+                    });
+                }
+
                 // the run() call will block until all asynchronous operations
                 // have finished; while the server is running, there is always at least one
                 // asynchronous operation outstanding: the asynchronous accept call waiting
                 // for new incoming connections
+                std::vector<std::thread> threads;
+                for (uint32_t i = 1U; i < m_workers; i++) {
+                    threads.emplace_back([this]() {
+                        applyThreadPolicy("rest:worker");
+                        m_ioService.run();
+                    });
+                }
+
+                applyThreadPolicy("rest:worker");
                 m_ioService.run();
+                for (auto& thread : threads)
+                    thread.join();
+
+                blockingWork.reset();
+                for (auto& thread : blockingThreads)
+                    thread.join();
             }
 
             /**
@@ -113,12 +165,26 @@ namespace restapi
             {
                 // the server is stopped by cancelling all outstanding asynchronous
                 // operations; once all operations have finished the m_ioService::run()
-                // call will exit
-                m_acceptor.close();
-                m_connectionManager.stopAll();
+                // call will exit (the acceptor is closed on its strand, as the IO threads
+                // may be running an accept completion)
+                asio::post(m_acceptor.get_executor(), [this]() {
+                    m_acceptor.close();
+                    m_connectionManager.stopAll();
+                });
             }
 
         private:
+            /**
+             * @brief Helper to name the calling thread and apply its scheduling policy.
+             * @param name Textual name for thread.
+             */
+            static void applyThreadPolicy(const std::string& name)
+            {
+#if !defined(_WIN32)
+                ThreadPolicy::apply(::pthread_self(), name);
+#endif // !defined(_WIN32)
+            }
+
             /**
              * @brief Perform an asynchronous accept operation.
              */
@@ -131,8 +197,14 @@ namespace restapi
                         return;
                     }
 
-                    if (!ec) {
-                        m_connectionManager.start(std::make_shared<ConnectionType>(std::move(m_socket), m_connectionManager, m_requestHandler, false, m_debug));
+                    if (!ec && m_connectionManager.size() >= HTTP_MAX_CONNECTIONS) {
+                        ::LogWarning(LOG_REST, "HTTPServer::accept(), too many connections, rejecting connection");
+                        asio::error_code ignored_ec;
+                        m_socket.close(ignored_ec);
+                    }
+                    else if (!ec) {
+                        m_connectionManager.start(std::make_shared<ConnectionType>(std::move(m_socket), m_connectionManager, m_requestHandler,
+                            (m_blockingWorkers > 0U) ? &m_blockingService : nullptr, m_requestTimeout, false, m_debug));
                     }
 
                     accept();
@@ -152,6 +224,12 @@ namespace restapi
             asio::ip::tcp::socket m_socket;
 
             RequestHandlerType m_requestHandler;
+
+            uint32_t m_workers;
+            uint32_t m_blockingWorkers;
+            asio::io_service m_blockingService;
+            uint32_t m_requestTimeout;
+
             bool m_debug;
         };
     } // namespace http
@@ -21,12 +21,14 @@
 #include "common/restapi/http/SecureServerConnection.h"
 #include "common/restapi/http/ServerConnectionManager.h"
 #include "common/restapi/http/HTTPRequestHandler.h"
+#include "common/ThreadPolicy.h"
 
 #include <thread>
 #include <string>
 #include <signal.h>
 #include <utility>
 #include <memory>
+#include <vector>
 
 #include <asio.hpp>
 #include <asio/ssl.hpp>
@@ -60,11 +62,15 @@ namespace restapi
              */
             explicit SecureHTTPServer(const std::string& address, uint16_t port, bool debug) :
                 m_ioService(),
-                m_acceptor(m_ioService),
+                m_acceptor(asio::make_strand(m_ioService)),
                 m_connectionManager(),
                 m_context(asio::ssl::context::tlsv12),
                 m_socket(m_ioService),
                 m_requestHandler(),
+                m_workers(1U),
+                m_blockingWorkers(0U),
+                m_blockingService(),
+                m_requestTimeout(HTTP_REQUEST_TIMEOUT),
                 m_debug(debug)
             {
                 asio::ip::address ipAddress = asio::ip::address::from_string(address);
@@ -101,6 +107,26 @@ namespace restapi
                 m_requestHandler = RequestHandlerType(std::forward<Handler>(handler));
             }
 
+            /**
+             * @brief Helper to set the number of worker threads.
+             *  (NOTE: This must be called before run().)
+             * @param workers Number of threads to run the IO service on.
+             * @param blockingWorkers Number of threads to run request handlers the request handler reports
+             *  as blocking on (0 runs all request handlers on the IO threads).
+             */
+            void setWorkers(uint32_t workers, uint32_t blockingWorkers)
+            {
+                m_workers = (workers > 0U) ? workers : 1U;
+                m_blockingWorkers = blockingWorkers;
+            }
+
+            /**
+             * @brief Helper to set the number of seconds a client has to send a complete request (or to
+             *  read the reply) before its connection is closed.
+             * @param timeout Request timeout (seconds).
+             */
+            void setRequestTimeout(uint32_t timeout) { m_requestTimeout = (timeout > 0U) ? timeout : HTTP_REQUEST_TIMEOUT; }
+
             /**
              * @brief Open TCP acceptor.
              */
@@ -118,14 +144,40 @@ namespace restapi
 
             /**
              * @brief Run the servers ASIO IO service loop.
+             *  (NOTE: The calling thread is used as the first worker thread.)
              */
             void run()
             {
+                // the blocking service is kept running until the IO service has finished
+                auto blockingWork = asio::make_work_guard(m_blockingService);
+                std::vector<std::thread> blockingThreads;
+                for (uint32_t i = 0U; i < m_blockingWorkers; i++) {
+                    blockingThreads.emplace_back([this]() {
+                        applyThreadPolicy("rest:blocking");
+                        m_blockingService.run();
+                    });
+                }
+
                 // the run() call will block until all asynchronous operations
                 // have finished; while the server is running, there is always at least one
                 // asynchronous operation outstanding: the asynchronous accept call waiting
                 // for new incoming connections
+                std::vector<std::thread> threads;
+                for (uint32_t i = 1U; i < m_workers; i++) {
+                    threads.emplace_back([this]() {
+                        applyThreadPolicy("rest:worker");
+                        m_ioService.run();
+                    });
+                }
+
+                applyThreadPolicy("rest:worker");
                 m_ioService.run();
+                for (auto& thread : threads)
+                    thread.join();
+
+                blockingWork.reset();
+                for (auto& thread : blockingThreads)
+                    thread.join();
             }
 
             /**
@@ -135,12 +187,26 @@ namespace restapi
             {
                 // the server is stopped by cancelling all outstanding asynchronous
                 // operations; once all operations have finished the m_ioService::run()
-                // call will exit
-                m_acceptor.close();
-                m_connectionManager.stopAll();
+                // call will exit (the acceptor is closed on its strand, as the IO threads
+                // may be running an accept completion)
+                asio::post(m_acceptor.get_executor(), [this]() {
+                    m_acceptor.close();
+                    m_connectionManager.stopAll();
+                });
             }
 
         private:
+            /**
+             * @brief Helper to name the calling thread and apply its scheduling policy.
+             * @param name Textual name for thread.
+             */
+            static void applyThreadPolicy(const std::string& name)
+            {
+#if !defined(_WIN32)
+                ThreadPolicy::apply(::pthread_self(), name);
+#endif // !defined(_WIN32)
+            }
+
             /**
              * @brief Perform an asynchronous accept operation.
              */
@@ -153,8 +219,14 @@ namespace restapi
                         return;
                     }
 
-                    if (!ec) {
-                        m_connectionManager.start(std::make_shared<ConnectionType>(std::move(m_socket), m_context, m_connectionManager, m_requestHandler, false, m_debug));
+                    if (!ec && m_connectionManager.size() >= HTTP_MAX_CONNECTIONS) {
+                        ::LogWarning(LOG_REST, "SecureHTTPServer::accept(), too many connections, rejecting connection");
+                        asio::error_code ignored_ec;
+                        m_socket.close(ignored_ec);
+                    }
+                    else if (!ec) {
+                        m_connectionManager.start(std::make_shared<ConnectionType>(std::move(m_socket), m_context, m_connectionManager, m_requestHandler,
+                            (m_blockingWorkers > 0U) ? &m_blockingService : nullptr, m_requestTimeout, false, m_debug));
                     }
 
                     accept();
@@ -178,6 +250,12 @@ namespace restapi
             std::string m_keyFile;
 
             RequestHandlerType m_requestHandler;
+
+            uint32_t m_workers;
+            uint32_t m_blockingWorkers;
+            asio::io_service m_blockingService;
+            uint32_t m_requestTimeout;
+
             bool m_debug;
         };
     } // namespace http
@@ -5,7 +5,7 @@
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  *  Copyright (c) 2003-2013 Christopher M. Kohlhoff
- *  Copyright (C) 2024 Bryan Biedenkapp, N2PLL
+ *  Copyright (C) 2024-2025 Bryan Biedenkapp, N2PLL
  *
  */
 /**
@@ -24,6 +24,7 @@
 
 #include <array>
 #include <memory>
+#include <string>
 #include <utility>
 #include <iterator>
 
@@ -46,6 +47,18 @@ namespace restapi
 
         /**
          * @brief This class represents a single connection from a client.
+         *
+         *  All asynchronous operations for a connection are serialized on a per-connection strand, so
+         *  the connection may be serviced by any thread running the server IO service. HTTP/1.1
+         *  keep-alive and pipelined requests are supported; pipelined requests are answered in order,
+         *  one at a time. Request handlers run on the connection strand, so requests on different
+         *  connections are handled concurrently; the resources a handler touches do their own locking.
+         *  Requests for handlers the request handler reports as blocking are run on the blocking service
+         *  instead (if one is given), so they do not stall the IO threads.
+         *
+         *  A client must send a complete request (and read the reply) within the request timeout,
+         *  including the idle time before each request on a keep-alive connection, or the connection is
+         *  closed.
          * @tparam RequestHandlerType Type representing a request handler.
          * @ingroup http
          */
@@ -54,6 +67,7 @@ namespace restapi
             typedef SecureServerConnection<RequestHandlerType> selfType;
             typedef std::shared_ptr<selfType> selfTypePtr;
             typedef ServerConnectionManager<selfTypePtr> ConnectionManagerType;
+            typedef asio::strand<asio::ssl::stream<asio::ip::tcp::socket>::executor_type> StrandType;
         public:
             auto operator=(SecureServerConnection&) -> SecureServerConnection& = delete;
             auto operator=(SecureServerConnection&&) -> SecureServerConnection& = delete;
@@ -65,17 +79,29 @@ namespace restapi
              * @param context SSL context.
              * @param manager Connection manager for this connection.
              * @param handler Request handler for this connection.
-             * @param persistent Flag indicating whether or not the connection is persistent.
+             * @param blockingService IO service to run blocking request handlers on (or nullptr to run all
+             *  request handlers on the connection strand).
+             * @param timeout Number of seconds a client has to send a request, or to read the reply.
+             * @param persistent Flag indicating whether or not the connection is always persistent.
              * @param debug Flag indicating whether or not verbose logging should be enabled.
              */
             explicit SecureServerConnection(asio::ip::tcp::socket socket, asio::ssl::context& context, ConnectionManagerType& manager, RequestHandlerType& handler,
-                bool persistent = false, bool debug = false) :
+                asio::io_context* blockingService = nullptr, uint32_t timeout = HTTP_REQUEST_TIMEOUT, bool persistent = false, bool debug = false) :
                 m_socket(std::move(socket), context),
+                m_strand(asio::make_strand(m_socket.get_executor())),
+                m_timer(m_strand),
                 m_connectionManager(manager),
                 m_requestHandler(handler),
+                m_blockingService(blockingService),
+                m_timeout(timeout),
+                m_buffer(),
+                m_pending(),
+                m_request(),
                 m_lexer(HTTPLexer(false)),
-                m_continue(false),
-                m_contResult(HTTPLexer::INDETERMINATE),
+                m_reply(),
+                m_headerComplete(false),
+                m_contentLength(0U),
+                m_keepAlive(false),
                 m_persistent(persistent),
                 m_debug(debug)
             {
@@ -85,36 +111,67 @@ namespace restapi
             /**
              * @brief Start the first asynchronous operation for the connection.
              */
-            void start() { handshake(); }
+            void start()
+            {
+                auto self(this->shared_from_this());
+                asio::dispatch(m_strand, [this, self]() {
+                    deadline();
+                    handshake();
+                });
+            }
             /**
              * @brief Stop all asynchronous operations associated with the connection.
              */
             void stop()
             {
-                try
-                {
-                    if (m_socket.lowest_layer().is_open()) {
-                        m_socket.lowest_layer().close();
+                auto self(this->shared_from_this());
+                asio::dispatch(m_strand, [this, self]() {
+                    m_timer.cancel();
+                    try
+                    {
+                        if (m_socket.lowest_layer().is_open()) {
+                            m_socket.lowest_layer().close();
+                        }
                     }
-                }
-                catch(const std::exception&) { /* ignore */ }
+                    catch(const std::exception&) { /* ignore */ }
+                });
             }
 
         private:
+            /**
+             * @brief (Re)starts the deadline timer for the current request.
+             */
+            void deadline()
+            {
+                auto self(this->shared_from_this());
+                m_timer.expires_after(std::chrono::seconds(m_timeout));
+                m_timer.async_wait(asio::bind_executor(m_strand, [this, self](asio::error_code ec) {
+                    // a wait that completed before the timer was restarted or cancelled is stale
+                    if (ec == asio::error::operation_aborted || m_timer.expiry() > asio::steady_timer::clock_type::now()) {
+                        return;
+                    }
+
+                    if (m_debug) {
+                        ::LogDebug(LOG_REST, "SecureServerConnection::deadline(), request timed out, closing connection");
+                    }
+                    m_connectionManager.stop(this->shared_from_this());
+                }));
+            }
+
             /**
              * @brief Perform an asynchronous SSL handshake.
              */
             void handshake()
             {
-                if (!m_persistent) {
-                    auto self(this->shared_from_this());
-                }
-
-                m_socket.async_handshake(asio::ssl::stream_base::server, [this](asio::error_code ec) {
+                auto self(this->shared_from_this());
+                m_socket.async_handshake(asio::ssl::stream_base::server, asio::bind_executor(m_strand, [this, self](asio::error_code ec) {
                     if (!ec) {
                         read();
                     }
-                });
+                    else {
+                        m_connectionManager.stop(this->shared_from_this());
+                    }
+                }));
             }
 
             /**
@@ -122,99 +179,128 @@ namespace restapi
              */
             void read()
             {
-                if (!m_persistent) {
-                    auto self(this->shared_from_this());
-                }
-
-                m_socket.async_read_some(asio::buffer(m_buffer), [=](asio::error_code ec, std::size_t recvLength) {
+                auto self(this->shared_from_this());
+                m_socket.async_read_some(asio::buffer(m_buffer), asio::bind_executor(m_strand, [this, self](asio::error_code ec, std::size_t recvLength) {
                     if (!ec) {
-                        HTTPLexer::ResultType result = HTTPLexer::GOOD;
-                        char* content;
-
-                        // catch exceptions here so we don't blatently crash the system
-                        try
-                        {
-                            if (!m_continue) {
-                                std::tie(result, content) = m_lexer.parse(m_request, m_buffer.data(), m_buffer.data() + recvLength);
-
-                                m_request.content = std::string();
-                                std::string contentLength = m_request.headers.find("Content-Length");
-                                if (contentLength != "" && (::strlen(content) != 0)) {
-                                    size_t length = (size_t)::strtoul(contentLength.c_str(), NULL, 10);
-                                    m_request.contentLength = length;
-                                    m_request.content = std::string(content, length);
-                                }
-
-                                m_request.headers.add("RemoteHost", m_socket.lowest_layer().remote_endpoint().address().to_string());
-
-                                uint32_t consumed = m_lexer.consumed();
-                                if (result == HTTPLexer::GOOD && consumed == recvLength && 
-                                    ((m_request.method == HTTP_POST) || (m_request.method == HTTP_PUT))) {
-                                    if (m_debug) {
-                                        LogDebug(LOG_REST, "HTTPS Partial Request, recvLength = %u, consumed = %u, result = %u", recvLength, consumed, result);
-                                        Utils::dump(1U, "SecureServerConnection::read(), m_buffer", (uint8_t*)m_buffer.data(), recvLength);
-                                    }
-
-                                    result = HTTPLexer::INDETERMINATE;
-                                    m_continue = true;
-                                }
-                            } else {
-                                if (m_debug) {
-                                    LogDebug(LOG_REST, "HTTP Partial Request, recvLength = %u, result = %u", recvLength, result);
-                                    Utils::dump(1U, "SecureServerConnection::read(), m_buffer", (uint8_t*)m_buffer.data(), recvLength);
-                                }
-
-                                if (m_contResult == HTTPLexer::INDETERMINATE) {
-                                    m_request.content = std::string(m_buffer.data(), recvLength);
-                                } else {
-                                    m_request.content.append(std::string(m_buffer.data(), recvLength));
-                                }
-
-                                if (m_request.contentLength != 0 && recvLength < m_request.contentLength) {
-                                    m_contResult = result = HTTPLexer::CONTINUE;
-                                    m_continue = true;
-                                }
-                            }
-
-                            if (result == HTTPLexer::GOOD) {
-                                if (m_debug) {
-                                    Utils::dump(1U, "SecureServerConnection::read(), HTTPS Request Content", (uint8_t*)m_request.content.c_str(), m_request.content.length());
-                                }
-
-                                m_continue = false;
-                                m_contResult = HTTPLexer::INDETERMINATE;
-                                m_requestHandler.handleRequest(m_request, m_reply);
-
-                                if (m_debug) {
-                                    Utils::dump(1U, "SecureServerConnection::read(), HTTPS Reply Content", (uint8_t*)m_reply.content.c_str(), m_reply.content.length());
-                                }
-
-                                write();
-                            }
-                            else if (result == HTTPLexer::BAD) {
-                                m_continue = false;
-                                m_contResult = HTTPLexer::INDETERMINATE;
-                                m_reply = HTTPPayload::statusPayload(HTTPPayload::BAD_REQUEST);
-                                write();
-                            }
-                            else {
-                                read();
-                            }
-                        }
-                        catch(const std::exception& e) { 
-                            ::LogError(LOG_REST, "SecureServerConnection::read(), %s", ec.message().c_str());
-                            m_continue = false;
-                            m_contResult = HTTPLexer::INDETERMINATE;
-                        }
+                        m_pending.append(m_buffer.data(), recvLength);
+                        process();
                     }
                     else if (ec != asio::error::operation_aborted) {
-                        if (ec) {
+                        // a read started after the connection was stopped fails, as the socket is already closed
+                        if (ec != asio::error::eof && m_socket.lowest_layer().is_open()) {
                             ::LogError(LOG_REST, "SecureServerConnection::read(), %s, code = %u", ec.message().c_str(), ec.value());
                         }
                         m_connectionManager.stop(this->shared_from_this());
-                        m_continue = false;
                     }
-                });
+                }));
+            }
+
+            /**
+             * @brief Process any pending received data, and dispatch the next complete request.
+             */
+            void process()
+            {
+                // catch exceptions here so we don't blatently crash the system
+                try
+                {
+                    size_t consumed = 0U;
+                    if (!m_headerComplete) {
+                        HTTPLexer::ResultType result = HTTPLexer::INDETERMINATE;
+                        const char* end = nullptr;
+                        std::tie(result, end) = m_lexer.parse(m_request, (const char*)m_pending.data(), (const char*)m_pending.data() + m_pending.size());
+                        consumed = (size_t)(end - m_pending.data());
+
+                        if (result == HTTPLexer::BAD) {
+                            m_keepAlive = false;
+                            m_reply = HTTPPayload::statusPayload(HTTPPayload::BAD_REQUEST);
+                            write();
+                            return;
+                        }
+
+                        if (result != HTTPLexer::GOOD) {
+                            m_pending.clear();
+                            read();
+                            return;
+                        }
+
+                        m_headerComplete = true;
+                        m_contentLength = 0U;
+                        std::string contentLength = m_request.headers.find("Content-Length");
+                        if (!contentLength.empty()) {
+                            m_contentLength = (size_t)::strtoul(contentLength.c_str(), NULL, 10);
+                        }
+
+                        if (m_contentLength > HTTP_MAX_CONTENT_LENGTH) {
+                            m_keepAlive = false;
+                            m_reply = HTTPPayload::statusPayload(HTTPPayload::BAD_REQUEST);
+                            write();
+                            return;
+                        }
+                    }
+
+                    // wait for the entire request content
+                    if (m_pending.size() - consumed < m_contentLength) {
+                        if (consumed > 0U)
+                            m_pending.erase(0U, consumed);
+                        if (m_debug) {
+                            LogDebug(LOG_REST, "HTTPS Partial Request, pending = %u, contentLength = %u", m_pending.size(), m_contentLength);
+                        }
+
+                        read();
+                        return;
+                    }
+
+                    m_request.contentLength = m_contentLength;
+                    m_request.content = m_pending.substr(consumed, m_contentLength);
+                    m_pending.erase(0U, consumed + m_contentLength);
+
+                    m_request.headers.add("RemoteHost", m_socket.lowest_layer().remote_endpoint().address().to_string());
+                    m_keepAlive = m_persistent || m_request.keepAlive();
+
+                    if (m_debug) {
+                        Utils::dump(1U, "SecureServerConnection::process(), HTTPS Request Content", (uint8_t*)m_request.content.c_str(), m_request.content.length());
+                    }
+
+                    // the request is complete, the handler is not bound by the client deadline
+                    m_timer.cancel();
+
+                    // blocking request handlers are run off the IO threads, the reply is written back
+                    // on the connection strand
+                    if (m_blockingService != nullptr && m_requestHandler.isBlocking(m_request)) {
+                        auto self(this->shared_from_this());
+                        asio::post(*m_blockingService, [this, self]() {
+                            handleRequest();
+                            asio::post(m_strand, [this, self]() { write(); });
+                        });
+                        return;
+                    }
+
+                    handleRequest();
+                    write();
+                }
+                catch(const std::exception& e) {
+                    ::LogError(LOG_REST, "SecureServerConnection::process(), %s", e.what());
+                    m_connectionManager.stop(this->shared_from_this());
+                }
+            }
+
+            /**
+             * @brief Helper to dispatch the current request to the request handler.
+             */
+            void handleRequest()
+            {
+                try
+                {
+                    m_requestHandler.handleRequest(m_request, m_reply);
+                }
+                catch(const std::exception& e) {
+                    ::LogError(LOG_REST, "SecureServerConnection::handleRequest(), %s", e.what());
+                    m_reply = HTTPPayload::statusPayload(HTTPPayload::INTERNAL_SERVER_ERROR);
+                }
+
+                if (m_debug) {
+                    Utils::dump(1U, "SecureServerConnection::handleRequest(), HTTPS Reply Content", (uint8_t*)m_reply.content.c_str(), m_reply.content.length());
+                }
             }
 
             /**
@@ -222,56 +308,68 @@ namespace restapi
              */
             void write()
             {
-                if (!m_persistent) {
-                    auto self(this->shared_from_this());
-                } else {
-                    m_reply.headers.add("Connection", "keep-alive");
-                }
+                m_reply.headers.add("Connection", (m_keepAlive) ? "keep-alive" : "close");
+                deadline();
 
+                auto self(this->shared_from_this());
                 auto buffers = m_reply.toBuffers();
-                asio::async_write(m_socket, buffers, [=](asio::error_code ec, std::size_t) {
-                    if (m_persistent) {
+                asio::async_write(m_socket, buffers, asio::bind_executor(m_strand, [this, self](asio::error_code ec, std::size_t) {
+                    if (!ec && m_keepAlive) {
+                        // reset for the next request, and process any pipelined request already received
                         m_lexer.reset();
-                        m_reply.headers = HTTPHeaders();
-                        m_reply.status = HTTPPayload::OK;
-                        m_reply.content = "";
                         m_request = HTTPPayload();
-                        read();
+                        m_reply = HTTPPayload();
+                        m_headerComplete = false;
+                        m_contentLength = 0U;
+                        deadline();
+
+                        if (!m_pending.empty()) {
+                            process();
+                        } else {
+                            read();
+                        }
+                        return;
                     }
-                    else {
-                        if (!ec) {
-                            try
-                            {
-                                // initiate graceful connection closure
-                                asio::error_code ignored_ec;
-                                m_socket.lowest_layer().shutdown(asio::ip::tcp::socket::shutdown_both, ignored_ec);
-                            }
-                            catch(const std::exception& e) { ::LogError(LOG_REST, "%s", ec.message().c_str()); }
+
+                    if (!ec) {
+                        try
+                        {
+                            // initiate graceful connection closure
+                            asio::error_code ignored_ec;
+                            m_socket.lowest_layer().shutdown(asio::ip::tcp::socket::shutdown_both, ignored_ec);
                         }
+                        catch(const std::exception& e) { ::LogError(LOG_REST, "SecureServerConnection::write(), %s", e.what()); }
+                    }
 
-                        if (ec != asio::error::operation_aborted) {
-                            if (ec) {
-                                ::LogError(LOG_REST, "SecureServerConnection::write(), %s, code = %u", ec.message().c_str(), ec.value());
-                            }
-                            m_connectionManager.stop(this->shared_from_this());
+                    m_timer.cancel();
+                    if (ec != asio::error::operation_aborted) {
+                        if (ec) {
+                            ::LogError(LOG_REST, "SecureServerConnection::write(), %s, code = %u", ec.message().c_str(), ec.value());
                         }
+                        m_connectionManager.stop(this->shared_from_this());
                     }
-                });
+                }));
             }
 
             asio::ssl::stream<asio::ip::tcp::socket> m_socket;
+            StrandType m_strand;
+            asio::steady_timer m_timer;
 
             ConnectionManagerType& m_connectionManager;
             RequestHandlerType& m_requestHandler;
+            asio::io_context* m_blockingService;
+            uint32_t m_timeout;
 
             std::array<char, 8192> m_buffer;
+            std::string m_pending;
 
             HTTPPayload m_request;
             HTTPLexer m_lexer;
             HTTPPayload m_reply;
 
-            bool m_continue;
-            HTTPLexer::ResultType m_contResult;
+            bool m_headerComplete;
+            size_t m_contentLength;
+            bool m_keepAlive;
 
             bool m_persistent;
             bool m_debug;
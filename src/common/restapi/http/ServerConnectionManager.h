@@ -77,11 +77,24 @@ namespace restapi
              */
             void stopAll()
             {
-                for (auto c : m_connections)
+                std::set<ConnectionPtr> connections;
+                {
+                    std::lock_guard<std::mutex> guard(m_lock);
+                    connections.swap(m_connections);
+                }
+
+                for (auto c : connections)
                     c->stop();
+            }
 
+            /**
+             * @brief Gets the number of open connections.
+             * @returns size_t Number of open connections.
+             */
+            size_t size()
+            {
                 std::lock_guard<std::mutex> guard(m_lock);
-                m_connections.clear();
+                return m_connections.size();
             }
 
         private:
@@ -152,7 +152,7 @@ CryptoContainer::CryptoContainer(const std::string& filename, const std::string&
     m_enabled(enabled),
 #endif // !ENABLE_SSL
     m_stop(false),
-    m_keys()
+    m_store(std::make_shared<KeyStore>())
 {
     /* stub */
 }
@@ -222,7 +222,7 @@ bool CryptoContainer::read()
 void CryptoContainer::clear()
 {
     std::lock_guard<std::mutex> lock(s_mutex);
-    m_keys.clear();
+    publish(std::vector<EKCKeyItem>());
 }
 
 /* Adds a new entry to the lookup table by the specified unique ID. */
@@ -237,17 +237,20 @@ void CryptoContainer::addEntry(EKCKeyItem key)
     uint32_t kId = entry.kId();
 
     std::lock_guard<std::mutex> lock(s_mutex);
-    auto it = std::find_if(m_keys.begin(), m_keys.end(),
+    std::vector<EKCKeyItem> keys = std::atomic_load(&m_store)->keys;
+    auto it = std::find_if(keys.begin(), keys.end(),
         [&](EKCKeyItem& x)
         {
             return x.id() == id && x.kId() == kId;
         });
-    if (it != m_keys.end()) {
-        m_keys[it - m_keys.begin()] = entry;
+    if (it != keys.end()) {
+        keys[it - keys.begin()] = entry;
     }
     else {
-        m_keys.push_back(entry);
+        keys.push_back(entry);
     }
+
+    publish(std::move(keys));
 }
 
 /* Erases an existing entry from the lookup table by the specified unique ID. */
@@ -255,12 +258,14 @@ void CryptoContainer::addEntry(EKCKeyItem key)
 void CryptoContainer::eraseEntry(uint32_t id)
 {
     std::lock_guard<std::mutex> lock(s_mutex);
-    auto it = std::find_if(m_keys.begin(), m_keys.end(),
+    std::vector<EKCKeyItem> keys = std::atomic_load(&m_store)->keys;
+    auto it = std::find_if(keys.begin(), keys.end(),
         [&](EKCKeyItem& x) {
             return x.id() == id; 
         });
-    if (it != m_keys.end()) {
-        m_keys.erase(it);
+    if (it != keys.end()) {
+        keys.erase(it);
+        publish(std::move(keys));
     }
 }
 
@@ -268,58 +273,80 @@ void CryptoContainer::eraseEntry(uint32_t id)
 
 EKCKeyItem CryptoContainer::find(uint32_t kId)
 {
-    EKCKeyItem entry;
+    std::shared_ptr<const EKCKeyItem> entry = findKey(kId);
+    if (entry != nullptr)
+        return *entry;
 
-    std::lock_guard<std::mutex> lock(s_mutex);
-    auto it = std::find_if(m_keys.begin(), m_keys.end(),
-        [&](EKCKeyItem& x) {
-            return x.kId() == kId;
-        });
-    if (it != m_keys.end()) {
-        entry = *it;
-    } else {
-        entry = EKCKeyItem();
+    return EKCKeyItem();
+}
+
+/* Finds a table entry in this lookup table, without copying the entry. */
+
+std::shared_ptr<const EKCKeyItem> CryptoContainer::findKey(uint32_t kId, uint8_t algId) const
+{
+    std::shared_ptr<const KeyStore> store = std::atomic_load(&m_store);
+
+    size_t idx = 0U;
+    if (algId != 0U) {
+        auto it = store->byAlgKId.find(((uint64_t)algId << 32) | kId);
+        if (it == store->byAlgKId.end())
+            return nullptr;
+        idx = it->second;
+    }
+    else {
+        auto it = store->byKId.find(kId);
+        if (it == store->byKId.end())
+            return nullptr;
+        idx = it->second;
     }
 
-    return entry;
+    // alias the entry into the snapshot, so it stays alive across a reload
+    return std::shared_ptr<const EKCKeyItem>(store, &store->keys[idx]);
 }
 
 /* Finds a table entry in this lookup table. */
 
 EKCKeyItem CryptoContainer::findUKEK(uint32_t rsi)
 {
-    EKCKeyItem entry;
-
-    std::lock_guard<std::mutex> lock(s_mutex);
-
     /*
     ** TODO TODO TODO
     */
-    entry = EKCKeyItem();
-
-    return entry;
+    return EKCKeyItem();
 }
 
 /* Finds a table entry in this lookup table. */
 
 EKCKeyItem CryptoContainer::findLLA(uint32_t rsi)
 {
-    EKCKeyItem entry;
-
-    std::lock_guard<std::mutex> lock(s_mutex);
-
     /*
     ** TODO TODO TODO
     */
-    entry = EKCKeyItem();
-
-    return entry;
+    return EKCKeyItem();
 }
 
 // ---------------------------------------------------------------------------
 //  Private Class Members
 // ---------------------------------------------------------------------------
 
+/* Helper to build the lookup indexes for the given list of keys and publish it. */
+
+void CryptoContainer::publish(std::vector<EKCKeyItem>&& keys)
+{
+    std::shared_ptr<KeyStore> store = std::make_shared<KeyStore>();
+    store->keys = std::move(keys);
+    store->byKId.reserve(store->keys.size());
+    store->byAlgKId.reserve(store->keys.size());
+
+    // the first entry in file order wins, matching the previous linear search
+    for (size_t i = 0U; i < store->keys.size(); i++) {
+        const EKCKeyItem& key = store->keys[i];
+        store->byKId.emplace(key.kId(), i);
+        store->byAlgKId.emplace(((uint64_t)key.algId() << 32) | key.kId(), i);
+    }
+
+    std::atomic_store(&m_store, std::shared_ptr<const KeyStore>(std::move(store)));
+}
+
 /* Loads the table from the passed lookup table file. */
 
 bool CryptoContainer::load()
@@ -411,6 +438,10 @@ bool CryptoContainer::load()
     inflateEnd(&strm);
     ::fclose(ekcFile);
 
+    // keys are parsed into a local table and only published once the container has been read
+    // successfully, a failed reload leaves the previously loaded keys in place
+    std::vector<EKCKeyItem> loadedKeys;
+
     try {
         // ensure zero termination
         decompressedData.push_back(0U);
@@ -528,11 +559,6 @@ bool CryptoContainer::load()
 
             rapidxml::xml_node<>* innerRoot = ekcInnerContainer.first_node("InnerContainer");
             if (innerRoot != nullptr) {
-                // clear table
-                clear();
-
-                std::lock_guard<std::mutex> lock(s_mutex);
-
                 // get keys node
                 rapidxml::xml_node<>* keys = innerRoot->first_node("Keys");
                 if (keys != nullptr) {
@@ -585,7 +611,7 @@ bool CryptoContainer::load()
 
                         ::LogInfoEx(LOG_HOST, "Key NAME: %s SLN: %u ALGID: $%02X, KID: $%04X", key.name().c_str(), key.sln(), key.algId(), key.kId());
 
-                        m_keys.push_back(key);
+                        loadedKeys.push_back(key);
                         i++;
                     }
                 }
@@ -598,15 +624,20 @@ bool CryptoContainer::load()
         return false;
     }
 
-    if (m_keys.size() == 0U) {
+    if (loadedKeys.size() == 0U) {
         ::LogError(LOG_HOST, "No encryption keys defined!");
         return false;
     }
 
-    size_t size = m_keys.size();
+    size_t size = loadedKeys.size();
     if (size == 0U)
         return false;
 
+    {
+        std::lock_guard<std::mutex> lock(s_mutex);
+        publish(std::move(loadedKeys));
+    }
+
     uint64_t now = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::system_clock::now().time_since_epoch()).count();
     m_lastLoadTime = now;
 
@@ -21,6 +21,8 @@
 #include "common/Utils.h"
 
 #include <cassert>
+#include <cstring>
+#include <memory>
 #include <string>
 #include <mutex>
 #include <unordered_map>
@@ -46,9 +48,10 @@ public:
         m_sln(0U),
         m_algId(0U),
         m_kId(0U),
-        m_keyMaterial()
+        m_keyMaterial(),
+        m_keyLength(0U)
     {
-        /* stub */
+        ::memset(m_key, 0x00U, sizeof(m_key));
     }
 
     /**
@@ -66,6 +69,8 @@ public:
             m_kId = data.m_kId;
 
             m_keyMaterial = data.m_keyMaterial;
+            ::memcpy(m_key, data.m_key, sizeof(m_key));
+            m_keyLength = data.m_keyLength;
         }
 
         return *this;
@@ -97,14 +102,33 @@ public:
     {
         assert(key != nullptr);
 
-        const char* rawKey = m_keyMaterial.c_str();
         ::memset(key, 0x00U, 32U);
+        ::memcpy(key, m_key, m_keyLength);
+        return m_keyLength;
+    }
+
+    /**
+     * @brief Gets the encryption key material.
+     * @returns std::string Encryption key material (hex string).
+     */
+    std::string keyMaterial() const { return m_keyMaterial; }
+    /**
+     * @brief Sets the encryption key material.
+     *  (NOTE: The key material is decoded from hex once here, so getKey() does not parse on every call.)
+     * @param keyMaterial Encryption key material (hex string).
+     */
+    void keyMaterial(const std::string& keyMaterial)
+    {
+        m_keyMaterial = keyMaterial;
 
+        ::memset(m_key, 0x00U, sizeof(m_key));
+
+        const char* rawKey = m_keyMaterial.c_str();
         uint8_t len = 32U, charPos = 0U;
         for (uint8_t i = 0U; i < 32U; i++) {
             char t[4] = {rawKey[0], rawKey[1], 0};
 
-            key[i] = (uint8_t)::strtoul(t, NULL, 16);
+            m_key[i] = (uint8_t)::strtoul(t, NULL, 16);
 
             if (charPos + 2U > m_keyMaterial.size()) {
                 len = i;
@@ -115,7 +139,7 @@ public:
             charPos += 2U;
         }
 
-        return len;
+        m_keyLength = len;
     }
 
 public:
@@ -146,10 +170,11 @@ public:
      */
     DECLARE_PROPERTY_PLAIN(uint32_t, kId);
 
-    /**
-     * @brief Encryption key material.
-     */
-    DECLARE_PROPERTY_PLAIN(std::string, keyMaterial);
+private:
+    std::string m_keyMaterial;
+
+    uint8_t m_key[32U];
+    uint8_t m_keyLength;
 };
 
 // ---------------------------------------------------------------------------
@@ -219,6 +244,14 @@ public:
      * @returns KeyItem Table entry.
      */
     virtual EKCKeyItem find(uint32_t kId);
+    /**
+     * @brief Finds a table entry in this lookup table, without copying the entry.
+     *  (NOTE: This does not take a lock; the returned entry remains valid even if the table is reloaded.)
+     * @param kId Encryption key ID.
+     * @param algId Encryption algorithm ID (0 matches any algorithm).
+     * @returns std::shared_ptr<const EKCKeyItem> Table entry, or nullptr if not found.
+     */
+    std::shared_ptr<const EKCKeyItem> findKey(uint32_t kId, uint8_t algId = 0U) const;
 
     /**
      * @brief Finds a table entry in this lookup table.
@@ -251,6 +284,17 @@ public:
      */
     const uint64_t lastLoadTime() const { return m_lastLoadTime; }
 
+    /**
+     * @brief Returns a copy of the list of keys.
+     * @returns std::vector<EKCKeyItem> List of keys.
+     */
+    std::vector<EKCKeyItem> keys() const { return std::atomic_load(&m_store)->keys; }
+    /**
+     * @brief Returns the number of keys in this lookup table.
+     * @returns size_t Number of keys.
+     */
+    size_t keyCount() const { return std::atomic_load(&m_store)->keys.size(); }
+
 private:
     std::string m_file;
     std::string m_password;
@@ -261,19 +305,30 @@ private:
     bool m_enabled;
     bool m_stop;
 
+    /**
+     * @brief Immutable snapshot of the loaded keys and their lookup indexes.
+     */
+    struct KeyStore {
+        std::vector<EKCKeyItem> keys;
+        std::unordered_map<uint32_t, size_t> byKId;
+        std::unordered_map<uint64_t, size_t> byAlgKId;
+    };
+    std::shared_ptr<const KeyStore> m_store;
+
     static std::mutex s_mutex;
 
     /**
-     * @brief Loads the table from the passed lookup table file.
-     * @return True, if lookup table was loaded, otherwise false.
+     * @brief Helper to build the lookup indexes for the given list of keys and publish it.
+     *  (NOTE: The caller must hold s_mutex.)
+     * @param keys List of keys.
      */
-    bool load();
+    void publish(std::vector<EKCKeyItem>&& keys);
 
-public:
     /**
-     * @brief List of keys.
+     * @brief Loads the table from the passed lookup table file.
+     * @return True, if lookup table was loaded, otherwise false.
      */
-    DECLARE_PROPERTY_PLAIN(std::vector<EKCKeyItem>, keys);
+    bool load();
 };
 
 #endif // __CRYPTO_CONTAINER_H__
@@ -39,6 +39,10 @@
 #undef DEFAULT_LOCK_FILE
 #define DEFAULT_LOCK_FILE "/tmp/dvmfne.lock"
 
+#define DEFAULT_STATE_SNAPSHOT_FILE "/var/lib/dvm/fne-state.snap"
+#define FNE_STATE_SNAPSHOT_TAG "FNES"
+#define FNE_STATE_SNAPSHOT_VERSION 2U
+
 /** @cond */
 
 #define LOG_MASTER  "MSTR"
@@ -48,6 +48,7 @@ std::string g_lockFile = std::string(DEFAULT_LOCK_FILE);
 
 bool g_foreground = false;
 bool g_killed = false;
+bool g_lockDump = false;
 
 bool g_promiscuousHub = false;
 
@@ -65,6 +66,15 @@ static void sigHandler(int signum)
     g_signal = signum;
     g_killed = true;
 }
+
+#if !defined(_WIN32)
+/* Internal lock profiling dump signal handler. */
+
+static void sigLockDumpHandler(int signum)
+{
+    g_lockDump = true;
+}
+#endif // !defined(_WIN32)
 #endif
 
 /* Helper to print a fatal error message and exit. */
@@ -226,6 +236,7 @@ int main(int argc, char** argv)
     ::signal(SIGTERM, sigHandler);
 #if !defined(_WIN32)
     ::signal(SIGHUP, sigHandler);
+    ::signal(SIGUSR1, sigLockDumpHandler);
 #endif // !defined(_WIN32)
 
     int ret = 0;
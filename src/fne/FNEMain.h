@@ -37,6 +37,8 @@ extern std::string g_lockFile;
 extern bool g_foreground;
 /** @brief (Global) Flag indicating the FNE should stop immediately. */
 extern bool g_killed;
+/** @brief (Global) Flag indicating the lock profiling statistics should be written to the log. */
+extern bool g_lockDump;
 
 /** @brief (Global) Flag indicating the FNE is a promiscuous hub, and will pass all TGs and RIDs. */
 extern bool g_promiscuousHub;
@@ -9,6 +9,7 @@
  */
 #include "Defines.h"
 #include "common/network/udp/Socket.h"
+#include "common/LockProfiler.h"
 #include "common/Log.h"
 #include "common/StopWatch.h"
 #include "common/Thread.h"
@@ -30,6 +31,8 @@ using namespace lookups;
 #include <algorithm>
 #include <functional>
 
+#include <signal.h>
+
 #if !defined(_WIN32)
 #include <sys/utsname.h>
 #include <unistd.h>
@@ -47,9 +50,15 @@ using namespace lookups;
 
 #define THREAD_CYCLE_THRESHOLD 2U
 
+#ifndef SIGHUP
+#define SIGHUP 1
+#endif
+
 #define IDLE_WARMUP_MS 5U
 #define DEFAULT_MTU_SIZE 496
 #define MAX_MTU_SIZE 65535
+#define VTUN_READ_TIMEOUT 100U
+#define VTUN_READ_BATCH 32U
 
 // ---------------------------------------------------------------------------
 //  Public Class Members
@@ -64,6 +73,7 @@ HostFNE::HostFNE(const std::string& confFile) :
     m_mdNetwork(nullptr),
     m_vtunEnabled(false),
     m_packetDataMode(PacketDataMode::PROJECT25),
+    m_vtunPduWindow(1U),
 #if !defined(_WIN32)
     m_tun(nullptr),
 #endif // !defined(_WIN32)
@@ -82,6 +92,10 @@ HostFNE::HostFNE(const std::string& confFile) :
     m_peerReplicaSavesACL(false),
     m_allowActivityTransfer(false),
     m_allowDiagnosticTransfer(false),
+    m_snapshotEnabled(false),
+    m_snapshotFile(),
+    m_snapshotMaxAge(120U),
+    m_snapshotTimer(1000U, 60U),
     m_RESTAPI(nullptr)
 {
     /* stub */
@@ -247,6 +261,19 @@ int HostFNE::run()
         if (m_mdNetwork != nullptr)
             m_mdNetwork->clock(ms);
 
+        // dump lock profiling statistics (requested by SIGUSR1)
+        if (g_lockDump) {
+            g_lockDump = false;
+            LockProfiler::dump();
+        }
+
+        // periodically save the state snapshot
+        m_snapshotTimer.clock(ms);
+        if (m_snapshotTimer.isRunning() && m_snapshotTimer.hasExpired()) {
+            writeStateSnapshot();
+            m_snapshotTimer.start();
+        }
+
         // clock peers
         for (auto network : m_peerNetworks) {
             network::PeerNetwork* peerNetwork = network.second;
@@ -273,8 +300,16 @@ int HostFNE::run()
             Thread::sleep(1U);
     }
 
+    // save the state snapshot before the master network is torn down; peers are only left connected when
+    // the FNE is restarting (SIGHUP) and their state was saved, otherwise they must reconnect and are sent
+    // a master disconnect
+    bool warmRestart = false;
+    if (m_snapshotEnabled)
+        warmRestart = writeStateSnapshot() && g_signal == SIGHUP;
+
     // shutdown threads
     if (m_network != nullptr) {
+        m_network->setWarmRestart(warmRestart);
         m_network->close();
         delete m_network;
     }
@@ -379,6 +414,16 @@ bool HostFNE::readParams()
         LogWarning(LOG_HOST, "Promiscuous Hub is intended as a loop breaking measure *only*!");
     }
 
+    // apply thread scheduling configuration before any threads are started
+    ThreadPolicy::configure(systemConf["threads"]);
+
+    // select the UDP transport before any sockets are created
+    bool ioUring = systemConf["ioUring"].as<bool>(false);
+    network::udp::Socket::setIoUringDefault(ioUring);
+
+    bool lockProfiling = systemConf["lockProfiling"].as<bool>(false);
+    LockProfiler::setEnabled(lockProfiling);
+
     LogInfo("General Parameters");
     if (g_promiscuousHub)
         LogInfo(" !! Promiscuous Hub: yes");
@@ -394,6 +439,8 @@ bool HostFNE::readParams()
     else
         LogInfo(" !! Allow Activity Log Transfer: no");
     LogInfo("    Allow Diagnostic Log Transfer: %s", m_allowDiagnosticTransfer ? "yes" : "no");
+    LogInfo("    io_uring UDP Transport: %s", ioUring ? "yes" : "no");
+    LogInfo("    Lock Profiling: %s", lockProfiling ? "yes" : "no");
 
     // attempt to load and populate routing rules
     yaml::Node masterConf = m_conf["master"];
@@ -477,6 +524,8 @@ bool HostFNE::initializeRESTAPI()
     std::string restApiSSLCert = systemConf["restSslCertificate"].as<std::string>("web.crt");
     std::string restApiSSLKey = systemConf["restSslKey"].as<std::string>("web.key");
     bool restApiDebug = systemConf["restDebug"].as<bool>(false);
+    uint32_t restApiWorkers = systemConf["restWorkers"].as<uint32_t>(1U);
+    uint32_t restApiBlockingWorkers = systemConf["restBlockingWorkers"].as<uint32_t>(1U);
 
     if (restApiPassword.length() > 64) {
         std::string password = restApiPassword;
@@ -509,6 +558,7 @@ bool HostFNE::initializeRESTAPI()
         LogInfo("    REST API SSL Enabled: %s", restApiEnableSSL ? "yes" : "no");
         LogInfo("    REST API SSL Certificate: %s", restApiSSLCert.c_str());
         LogInfo("    REST API SSL Private Key: %s", restApiSSLKey.c_str());
+        LogInfo("    REST API Workers: %u (blocking %u)", restApiWorkers, restApiBlockingWorkers);
 
         if (restApiDebug) {
             LogInfo("    REST API Debug: yes");
@@ -518,6 +568,7 @@ bool HostFNE::initializeRESTAPI()
     // initialize network remote command
     if (restApiEnable) {
         m_RESTAPI = new RESTAPI(restApiAddress, restApiPort, restApiPassword, restApiSSLKey, restApiSSLCert, restApiEnableSSL, this, restApiDebug);
+        m_RESTAPI->setWorkers(restApiWorkers, restApiBlockingWorkers);
         m_RESTAPI->setLookups(m_ridLookup, m_tidLookup, m_peerListLookup, m_adjSiteMapLookup, m_cryptoLookup);
         bool ret = m_RESTAPI->open();
         if (!ret) {
@@ -611,6 +662,18 @@ bool HostFNE::createMasterNetwork()
     }
     bool parrotGrantDemand = masterConf["parrotGrantDemand"].as<bool>(true);
 
+    yaml::Node snapshotConf = masterConf["snapshot"];
+    m_snapshotEnabled = snapshotConf["enable"].as<bool>(false);
+    m_snapshotFile = snapshotConf["file"].as<std::string>(DEFAULT_STATE_SNAPSHOT_FILE);
+    if (m_snapshotEnabled && m_snapshotFile.find('/') != 0U) {
+        // a daemon changes its working directory to /, a relative path would not resolve where it was expected
+        LogWarning(LOG_HOST, "State snapshot file, %s, is not an absolute path", m_snapshotFile.c_str());
+    }
+    uint32_t snapshotInterval = snapshotConf["interval"].as<uint32_t>(60U);
+    m_snapshotMaxAge = snapshotConf["maxAge"].as<uint32_t>(120U);
+    if (snapshotInterval == 0U)
+        snapshotInterval = 60U;
+
     LogInfo("Network Parameters");
     LogInfo("    Identity: %s", identity.c_str());
     LogInfo("    Peer ID: %u", id);
@@ -630,6 +693,13 @@ bool HostFNE::createMasterNetwork()
 
     LogInfo("    Report Peer Pings: %s", reportPeerPing ? "yes" : "no");
 
+    LogInfo("    State Snapshot: %s", m_snapshotEnabled ? "yes" : "no");
+    if (m_snapshotEnabled) {
+        LogInfo("    State Snapshot File: %s", m_snapshotFile.c_str());
+        LogInfo("    State Snapshot Interval: %us", snapshotInterval);
+        LogInfo("    State Snapshot Max Age: %us", m_snapshotMaxAge);
+    }
+
     if (verbose) {
         LogInfo("    Verbose: yes");
     }
@@ -672,6 +742,13 @@ bool HostFNE::createMasterNetwork()
         m_network->setPresharedKey(presharedKey);
     }
 
+    if (m_snapshotEnabled) {
+        restoreStateSnapshot();
+
+        m_snapshotTimer.setTimeout(snapshotInterval);
+        m_snapshotTimer.start();
+    }
+
     // initialize metadata networking
     m_mdNetwork = new MetadataNetwork(this, m_network, address, port + 1U, workerCnt);
     m_mdNetwork->setPacketDump(packetDump);
@@ -692,6 +769,45 @@ bool HostFNE::createMasterNetwork()
     return true;
 }
 
+/* Helper to write the master network state to the state snapshot file. */
+
+bool HostFNE::writeStateSnapshot()
+{
+    if (m_network == nullptr)
+        return false;
+
+    StateSnapshot snapshot(FNE_STATE_SNAPSHOT_TAG, FNE_STATE_SNAPSHOT_VERSION);
+    m_network->writeSnapshot(snapshot);
+    if (!snapshot.save(m_snapshotFile)) {
+        LogError(LOG_HOST, "Failed to save the state snapshot, %s", m_snapshotFile.c_str());
+        return false;
+    }
+
+    return true;
+}
+
+/* Helper to restore the master network state from the state snapshot file. */
+
+void HostFNE::restoreStateSnapshot()
+{
+    StateSnapshot snapshot(FNE_STATE_SNAPSHOT_TAG, FNE_STATE_SNAPSHOT_VERSION);
+    if (!snapshot.load(m_snapshotFile)) {
+        LogInfoEx(LOG_HOST, "No valid state snapshot, %s, peers must reconnect", m_snapshotFile.c_str());
+        return;
+    }
+
+    uint64_t now = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::system_clock::now().time_since_epoch()).count();
+    uint64_t elapsed = (now > snapshot.timestamp()) ? now - snapshot.timestamp() : 0U;
+    if (elapsed > m_snapshotMaxAge * 1000U) {
+        LogWarning(LOG_HOST, "State snapshot, %s, is older then %us, ignoring", m_snapshotFile.c_str(), m_snapshotMaxAge);
+        return;
+    }
+
+    if (!m_network->restoreSnapshot(snapshot, elapsed)) {
+        LogError(LOG_HOST, "State snapshot, %s, is malformed, restore is incomplete", m_snapshotFile.c_str());
+    }
+}
+
 /* Entry point to master traffic network thread. */
 
 void* HostFNE::threadTrafficNetwork(void* arg)
@@ -717,9 +833,7 @@ void* HostFNE::threadTrafficNetwork(void* arg)
         }
 
         LogInfoEx(LOG_HOST, "[ OK ] %s", threadName.c_str());
-#ifdef _GNU_SOURCE
-        ::pthread_setname_np(th->thread, threadName.c_str());
-#endif // _GNU_SOURCE
+        ThreadPolicy::apply(th->thread, threadName);
 
         StopWatch stopWatch;
         stopWatch.start();
@@ -729,7 +843,11 @@ void* HostFNE::threadTrafficNetwork(void* arg)
                 uint32_t ms = stopWatch.elapsed();
                 stopWatch.start();
 
-                fne->m_network->processNetwork();
+                bool received = fne->m_network->processNetwork();
+
+                // with receive shards, frames are processed on this thread; keep reading while frames are waiting
+                if (received && fne->m_network->getRxShardCount() > 1U)
+                    continue;
 
                 if (ms < THREAD_CYCLE_THRESHOLD)
                     Thread::sleep(THREAD_CYCLE_THRESHOLD);
@@ -768,9 +886,7 @@ void* HostFNE::threadMetadataNetwork(void* arg)
         }
 
         LogInfoEx(LOG_HOST, "[ OK ] %s", threadName.c_str());
-#ifdef _GNU_SOURCE
-        ::pthread_setname_np(th->thread, threadName.c_str());
-#endif // _GNU_SOURCE
+        ThreadPolicy::apply(th->thread, threadName);
 
         StopWatch stopWatch;
         stopWatch.start();
@@ -933,6 +1049,13 @@ bool HostFNE::createVirtualNetworking()
         std::string ipv4Broadcast = vtunConf["broadcast"].as<std::string>("192.168.1.255");
         std::string packetDataModeStr = vtunConf["digitalMode"].as<std::string>("p25");
 
+        uint32_t pduWindow = vtunConf["pduWindow"].as<uint32_t>(1U);
+        if (pduWindow < 1U)
+            pduWindow = 1U;
+        if (pduWindow > 7U)
+            pduWindow = 7U; // V(S) is modulo 8
+        m_vtunPduWindow = (uint8_t)pduWindow;
+
         if (packetDataModeStr == "dmr") {
             m_packetDataMode = PacketDataMode::DMR;
         } else {
@@ -945,6 +1068,7 @@ bool HostFNE::createVirtualNetworking()
         LogInfo("    Netmask: %s", ipv4Netmask.c_str());
         LogInfo("    Broadcast: %s", ipv4Broadcast.c_str());
         LogInfo("    Digital Packet Mode: %s", packetDataModeStr.c_str());
+        LogInfo("    PDU Window: %u", m_vtunPduWindow);
 
         // initialize networking
         m_tun = new VIFace(vtunName, false);
@@ -987,23 +1111,28 @@ void* HostFNE::threadVirtualNetworking(void* arg)
         }
 
         LogInfoEx(LOG_HOST, "[ OK ] %s", threadName.c_str());
-#ifdef _GNU_SOURCE
-        ::pthread_setname_np(th->thread, threadName.c_str());
-#endif // _GNU_SOURCE
+        ThreadPolicy::apply(th->thread, threadName);
 
         if (fne->m_tun != nullptr) {
-            StopWatch stopWatch;
-            stopWatch.start();
+            uint8_t packet[MAX_MTU_SIZE];
 
             while (!g_killed) {
-                uint32_t ms = stopWatch.elapsed();
-                stopWatch.start();
+                // block until the tunnel is readable (bounded so shutdown is still noticed), then drain
+                // whatever else is already queued without waiting
+                uint32_t timeout = VTUN_READ_TIMEOUT;
+                for (uint32_t i = 0U; i < VTUN_READ_BATCH && !g_killed; i++) {
+                    ssize_t len = fne->m_tun->read(packet, timeout);
+                    if (len < 0) {
+                        // the read failed outright (rather than timing out), back off so a persistent
+                        // error doesn't spin this thread
+                        Thread::sleep(THREAD_CYCLE_THRESHOLD);
+                        break;
+                    }
 
-                uint8_t packet[MAX_MTU_SIZE];
-                ::memset(packet, 0x00U, MAX_MTU_SIZE);
+                    if (len == 0)
+                        break;
 
-                ssize_t len = fne->m_tun->read(packet);
-                if (len > 0) {
+                    timeout = 0U;
                     switch (fne->m_packetDataMode) {
                     case PacketDataMode::DMR:
                         fne->m_network->dmrTrafficHandler()->packetData()->processPacketFrame(packet, (uint32_t)len);
@@ -1014,9 +1143,6 @@ void* HostFNE::threadVirtualNetworking(void* arg)
                         break;
                     }
                 }
-
-                if (ms < THREAD_CYCLE_THRESHOLD)
-                    Thread::sleep(THREAD_CYCLE_THRESHOLD);
             }
         }
 
@@ -24,6 +24,7 @@
 #include "common/network/viface/VIFace.h"
 #include "common/yaml/Yaml.h"
 #include "common/Timer.h"
+#include "common/ThreadPolicy.h"
 #include "network/TrafficNetwork.h"
 #include "network/MetadataNetwork.h"
 #include "network/PeerNetwork.h"
@@ -96,6 +97,7 @@ private:
 
     bool m_vtunEnabled;
     PacketDataMode m_packetDataMode;
+    uint8_t m_vtunPduWindow;
 #if !defined(_WIN32)
     network::viface::VIFace* m_tun;
 #endif // !defined(_WIN32)
@@ -123,6 +125,11 @@ private:
     bool m_allowActivityTransfer;
     bool m_allowDiagnosticTransfer;
 
+    bool m_snapshotEnabled;
+    std::string m_snapshotFile;
+    uint32_t m_snapshotMaxAge;
+    Timer m_snapshotTimer;
+
     friend class RESTAPI;
     RESTAPI* m_RESTAPI;
 
@@ -141,6 +148,15 @@ private:
      * @returns bool True, if network connectivity was initialized, otherwise false.
      */
     bool createMasterNetwork();
+    /**
+     * @brief Helper to write the master network state to the state snapshot file.
+     * @returns bool True, if the state snapshot was saved, otherwise false.
+     */
+    bool writeStateSnapshot();
+    /**
+     * @brief Helper to restore the master network state from the state snapshot file.
+     */
+    void restoreStateSnapshot();
     /**
      * @brief Entry point to master traffic network thread.
      * @param arg Instance of the thread_t structure.
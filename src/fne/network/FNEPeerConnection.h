@@ -53,6 +53,7 @@ namespace network
             m_address(),
             m_port(),
             m_salt(0U),
+            m_resumeProof(),
             m_connected(false),
             m_connectionState(NET_STAT_INVALID),
             m_pingsReceived(0U),
@@ -89,6 +90,7 @@ namespace network
             m_address(udp::Socket::address(socketStorage)),
             m_port(udp::Socket::port(socketStorage)),
             m_salt(0U),
+            m_resumeProof(),
             m_connected(false),
             m_connectionState(NET_STAT_INVALID),
             m_pingsReceived(0U),
@@ -215,6 +217,11 @@ namespace network
          * @brief Salt value used for peer authentication.
          */
         DECLARE_PROPERTY_PLAIN(uint32_t, salt);
+        /**
+         * @brief Proof expected with the configuration of a peer resuming a session, empty if the peer is
+         *  performing the login exchange.
+         */
+        DECLARE_PROPERTY_PLAIN(std::string, resumeProof);
 
         /**
          * @brief Flag indicating whether or not the peer is connected.
@@ -282,11 +282,11 @@ UInt8Array P25OTARService::cryptKMM(uint8_t algoId, uint16_t kid, uint8_t* mi, c
     **  because we aren't performing FNE KEY_REQ's to upstream peer'ed FNEs to find the key used to encrypt the KMM.
     */
 
-    ::EKCKeyItem keyItem = m_network->m_cryptoLookup->find(kid);
-    if (!keyItem.isInvalid()) {
+    std::shared_ptr<const ::EKCKeyItem> keyItem = m_network->m_cryptoLookup->findKey(kid, algoId);
+    if (keyItem != nullptr && !keyItem->isInvalid()) {
         uint8_t key[P25DEF::MAX_ENC_KEY_LENGTH_BYTES];
         ::memset(key, 0x00U, P25DEF::MAX_ENC_KEY_LENGTH_BYTES);
-        uint8_t keyLength = keyItem.getKey(key);
+        uint8_t keyLength = keyItem->getKey(key);
 
         if (m_network->m_debug) {
             LogDebugEx(LOG_P25, "P25OTARService::cryptKMM()", "keyLength = %u", keyLength);
@@ -540,7 +540,7 @@ UInt8Array P25OTARService::write_KMM_Rekey_Command(uint32_t llId, uint32_t kmmRS
     else
         ks.keyLength(P25DEF::MAX_ENC_KEY_LENGTH_BYTES);
 
-    for (EKCKeyItem keyItem : m_network->m_cryptoLookup->keys()) {
+    for (const EKCKeyItem& keyItem : m_network->m_cryptoLookup->keys()) {
         if (keyItem.algId() != ALGO_AES_256) {
             LogWarning(LOG_P25, P25_KMM_STR", %s, ignoring kId = %u, is not an AES-256 key, llId = %u, RSI = %u", outKmm.toString().c_str(),
                 keyItem.kId(), outKmm.getSrcLLId(), outKmm.getDstLLId());
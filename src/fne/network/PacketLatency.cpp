@@ -0,0 +1,236 @@
+// SPDX-License-Identifier: GPL-2.0-only
+/*
+ * Digital Voice Modem - Converged FNE Software
+ * GPLv2 Open Source. Use is subject to license terms.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ *  Copyright (C) 2026 Bryan Biedenkapp, N2PLL
+ *
+ */
+#include "fne/Defines.h"
+#include "common/network/RTPFNEHeader.h"
+#include "network/PacketLatency.h"
+
+#include <chrono>
+#include <mutex>
+
+using namespace network;
+
+// ---------------------------------------------------------------------------
+//  Constants
+// ---------------------------------------------------------------------------
+
+const uint64_t LATENCY_MIN_US = 16U;
+const uint64_t LATENCY_MAX_US = 8388608U; // ~8.4s
+const uint32_t LATENCY_SUB_BUCKETS = 4U;
+
+const char* PROTOCOL_NAMES[PacketLatency::PROTO_COUNT] = { "dmr", "p25", "nxdn", "analog" };
+const char* STAGE_NAMES[PacketLatency::STAGE_COUNT] = { "receive", "queue", "handler", "send", "total" };
+
+// ---------------------------------------------------------------------------
+//  Static Class Members
+// ---------------------------------------------------------------------------
+
+thread_local PacketLatency::Context PacketLatency::t_context = { false, 0U, 0U, 0U, 0U };
+
+metrics::Histogram* PacketLatency::s_stages[PacketLatency::PROTO_COUNT][PacketLatency::STAGE_COUNT];
+concurrent::unordered_map<uint32_t, metrics::Histogram*> PacketLatency::s_peers;
+
+// ---------------------------------------------------------------------------
+//  Public Class Members
+// ---------------------------------------------------------------------------
+
+/* Registers the per-protocol latency histograms. */
+
+void PacketLatency::initialize()
+{
+    static std::once_flag once;
+    std::call_once(once, []() {
+        std::vector<uint64_t> bounds = metrics::Histogram::logLinearBounds(LATENCY_MIN_US, LATENCY_MAX_US, LATENCY_SUB_BUCKETS);
+        for (uint32_t proto = 0U; proto < PROTO_COUNT; proto++) {
+            for (uint32_t stage = 0U; stage < STAGE_COUNT; stage++) {
+                std::string labels = std::string("proto=\"") + PROTOCOL_NAMES[proto] + "\",stage=\"" + STAGE_NAMES[stage] + "\"";
+                s_stages[proto][stage] = metrics::Registry::histogram("dvm_fne_packet_latency_us",
+                    "Protocol frame latency through the FNE packet pipeline, in microseconds.", bounds, labels);
+            }
+        }
+    });
+}
+
+/* Gets the current monotonic time (us). */
+
+uint64_t PacketLatency::now()
+{
+    return std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+/* Starts tracking a protocol frame on the calling worker thread. */
+
+void PacketLatency::begin(uint8_t subFunc, uint32_t peerId, uint64_t rxTick, uint64_t enqueueTick, uint64_t workerTick)
+{
+    uint8_t proto = PROTO_COUNT;
+    switch (subFunc) {
+    case NET_SUBFUNC::PROTOCOL_SUBFUNC_DMR:
+        proto = PROTO_DMR;
+        break;
+    case NET_SUBFUNC::PROTOCOL_SUBFUNC_P25:
+        proto = PROTO_P25;
+        break;
+    case NET_SUBFUNC::PROTOCOL_SUBFUNC_NXDN:
+        proto = PROTO_NXDN;
+        break;
+    case NET_SUBFUNC::PROTOCOL_SUBFUNC_ANALOG:
+        proto = PROTO_ANALOG;
+        break;
+    default:
+        t_context.active = false;
+        return;
+    }
+
+    if (s_stages[proto][STAGE_TOTAL] == nullptr) {
+        t_context.active = false;
+        return;
+    }
+
+    record(proto, STAGE_RECEIVE, rxTick, enqueueTick);
+    record(proto, STAGE_QUEUE, enqueueTick, workerTick);
+
+    t_context.active = true;
+    t_context.proto = proto;
+    t_context.peerId = peerId;
+    t_context.rxTick = rxTick;
+    t_context.decisionTick = workerTick;
+}
+
+/* Marks the protocol handler deciding to repeat the frame being tracked. */
+
+void PacketLatency::decision()
+{
+    if (!t_context.active)
+        return;
+
+    // frames released together from a jitter buffer are only tracked once
+    uint64_t tick = now();
+    record(t_context.proto, STAGE_HANDLER, t_context.decisionTick, tick);
+    t_context.decisionTick = tick;
+}
+
+/* Marks the repeat of the frame being tracked to the connected peers as sent. */
+
+void PacketLatency::sent()
+{
+    if (!t_context.active)
+        return;
+
+    uint64_t tick = now();
+    record(t_context.proto, STAGE_SEND, t_context.decisionTick, tick);
+    record(t_context.proto, STAGE_TOTAL, t_context.rxTick, tick);
+
+    metrics::Histogram* histogram = peer(t_context.peerId);
+    if (histogram != nullptr)
+        histogram->observe((tick > t_context.rxTick) ? tick - t_context.rxTick : 0U);
+
+    t_context.active = false;
+}
+
+/* Stops tracking the frame on the calling worker thread. */
+
+void PacketLatency::end()
+{
+    t_context.active = false;
+}
+
+/* Gets the latency quantiles of all protocols, stages and peers. */
+
+json::object PacketLatency::status()
+{
+    json::object status = json::object();
+
+    json::array protocols = json::array();
+    for (uint32_t proto = 0U; proto < PROTO_COUNT; proto++) {
+        if (s_stages[proto][STAGE_TOTAL] == nullptr)
+            continue;
+
+        json::object protoObj = json::object();
+        std::string name = PROTOCOL_NAMES[proto];
+        protoObj["protocol"].set<std::string>(name);
+        for (uint32_t stage = 0U; stage < STAGE_COUNT; stage++) {
+            json::object stageObj = quantiles(s_stages[proto][stage]);
+            protoObj[STAGE_NAMES[stage]].set<json::object>(stageObj);
+        }
+
+        protocols.push_back(json::value(protoObj));
+    }
+    status["protocols"].set<json::array>(protocols);
+
+    json::array peers = json::array();
+    s_peers.lock(false);
+    for (auto& entry : s_peers.get()) {
+        json::object peerObj = quantiles(entry.second);
+        uint32_t peerId = entry.first;
+        peerObj["peerId"].set<uint32_t>(peerId);
+        peers.push_back(json::value(peerObj));
+    }
+    s_peers.unlock();
+    status["peers"].set<json::array>(peers);
+
+    return status;
+}
+
+// ---------------------------------------------------------------------------
+//  Private Class Members
+// ---------------------------------------------------------------------------
+
+/* Helper to record an observation into the histogram of a stage. */
+
+void PacketLatency::record(uint8_t proto, STAGE stage, uint64_t start, uint64_t end)
+{
+    s_stages[proto][stage]->observe((end > start) ? end - start : 0U);
+}
+
+/* Helper to get (or create) the total latency histogram of a peer. */
+
+metrics::Histogram* PacketLatency::peer(uint32_t peerId)
+{
+    if (peerId == 0U)
+        return nullptr;
+
+    auto it = s_peers.find(peerId);
+    if (it != s_peers.end())
+        return it->second;
+
+    // peer histograms are never freed, a reconnecting peer continues its histogram
+    s_peers.lock(false);
+    metrics::Histogram* histogram = nullptr;
+    auto existing = s_peers.get().find(peerId);
+    if (existing != s_peers.get().end()) {
+        histogram = existing->second;
+    }
+    else {
+        histogram = new metrics::Histogram(metrics::Histogram::logLinearBounds(LATENCY_MIN_US, LATENCY_MAX_US, LATENCY_SUB_BUCKETS));
+        s_peers.get()[peerId] = histogram;
+    }
+    s_peers.unlock();
+
+    return histogram;
+}
+
+/* Helper to create a JSON representation of the quantiles of a histogram. */
+
+json::object PacketLatency::quantiles(const metrics::Histogram* histogram)
+{
+    json::object obj = json::object();
+
+    uint64_t count = histogram->count();
+    obj["count"].set<uint64_t>(count);
+    uint64_t p50 = histogram->percentile(0.5);
+    obj["p50"].set<uint64_t>(p50);
+    uint64_t p99 = histogram->percentile(0.99);
+    obj["p99"].set<uint64_t>(p99);
+    uint64_t p999 = histogram->percentile(0.999);
+    obj["p999"].set<uint64_t>(p999);
+    uint64_t max = histogram->max();
+    obj["max"].set<uint64_t>(max);
+
+    return obj;
+}
@@ -0,0 +1,150 @@
+// SPDX-License-Identifier: GPL-2.0-only
+/*
+ * Digital Voice Modem - Converged FNE Software
+ * GPLv2 Open Source. Use is subject to license terms.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ *  Copyright (C) 2026 Bryan Biedenkapp, N2PLL
+ *
+ */
+/**
+ * @file PacketLatency.h
+ * @ingroup fne_network
+ * @file PacketLatency.cpp
+ * @ingroup fne_network
+ */
+#if !defined(__PACKET_LATENCY_H__)
+#define __PACKET_LATENCY_H__
+
+#include "fne/Defines.h"
+#include "common/concurrent/unordered_map.h"
+#include "common/json/json.h"
+#include "common/Metrics.h"
+
+#include <cstdint>
+
+namespace network
+{
+    // ---------------------------------------------------------------------------
+    //  Class Declaration
+    // ---------------------------------------------------------------------------
+
+    /**
+     * @brief Implements per-stage latency tracking of protocol frames through the FNE packet pipeline.
+     * @ingroup fne_network
+     * @remarks
+     * Each protocol frame is timestamped (with a monotonic clock) when it is read from the socket, when it
+     *  is enqueued for a worker, when a worker starts processing it, when the protocol handler has decided
+     *  to repeat it, and when the repeat to the connected peers has been sent. The time spent in each stage
+     *  is recorded into a log-linear histogram per protocol (exported through the metrics registry), and the
+     *  total per source peer.
+     *
+     * The handler decision and send completion are marked by the protocol handlers on the worker thread,
+     *  so the frame being tracked is held in thread local state between begin() and end().
+     */
+    class HOST_SW_API PacketLatency {
+    public:
+        /**
+         * @brief Latency Stages
+         */
+        enum STAGE {
+            STAGE_RECEIVE = 0U,         //!< Socket Read to Enqueue
+            STAGE_QUEUE,                //!< Enqueue to Worker Start
+            STAGE_HANDLER,              //!< Worker Start to Handler Decision
+            STAGE_SEND,                 //!< Handler Decision to Send Completion
+            STAGE_TOTAL,                //!< Socket Read to Send Completion
+
+            STAGE_COUNT
+        };
+        /**
+         * @brief Latency Protocols
+         */
+        enum PROTOCOL {
+            PROTO_DMR = 0U,             //!< DMR
+            PROTO_P25,                  //!< P25
+            PROTO_NXDN,                 //!< NXDN
+            PROTO_ANALOG,               //!< Analog
+
+            PROTO_COUNT
+        };
+
+        /**
+         * @brief Registers the per-protocol latency histograms.
+         */
+        static void initialize();
+
+        /**
+         * @brief Gets the current monotonic time (us).
+         * @returns uint64_t Current monotonic time.
+         */
+        static uint64_t now();
+
+        /**
+         * @brief Starts tracking a protocol frame on the calling worker thread.
+         * @param subFunc Protocol network sub-function.
+         * @param peerId Source peer ID.
+         * @param rxTick Time the frame was read from the socket.
+         * @param enqueueTick Time the frame was enqueued for a worker.
+         * @param workerTick Time the worker started processing the frame.
+         */
+        static void begin(uint8_t subFunc, uint32_t peerId, uint64_t rxTick, uint64_t enqueueTick, uint64_t workerTick);
+        /**
+         * @brief Marks the protocol handler deciding to repeat the frame being tracked.
+         */
+        static void decision();
+        /**
+         * @brief Marks the repeat of the frame being tracked to the connected peers as sent.
+         */
+        static void sent();
+        /**
+         * @brief Stops tracking the frame on the calling worker thread.
+         */
+        static void end();
+
+        /**
+         * @brief Gets the latency quantiles of all protocols, stages and peers.
+         * @returns json::object JSON object describing the latency quantiles.
+         */
+        static json::object status();
+
+    private:
+        /**
+         * @brief Represents the frame being tracked on a worker thread.
+         */
+        struct Context {
+            bool active;                //!< Flag indicating a frame is being tracked.
+            uint8_t proto;              //!< Protocol.
+            uint32_t peerId;            //!< Source peer ID.
+            uint64_t rxTick;            //!< Time the frame was read from the socket.
+            uint64_t decisionTick;      //!< Time the handler decided to repeat the frame.
+        };
+
+        static thread_local Context t_context;
+
+        static metrics::Histogram* s_stages[PROTO_COUNT][STAGE_COUNT];
+        static concurrent::unordered_map<uint32_t, metrics::Histogram*> s_peers;
+
+        /**
+         * @brief Helper to record an observation into the histogram of a stage.
+         * @param proto Protocol.
+         * @param stage Latency stage.
+         * @param start Stage start time.
+         * @param end Stage end time.
+         */
+        static void record(uint8_t proto, STAGE stage, uint64_t start, uint64_t end);
+        /**
+         * @brief Helper to get (or create) the total latency histogram of a peer.
+         * @param peerId Peer ID.
+         * @returns metrics::Histogram* Peer latency histogram.
+         */
+        static metrics::Histogram* peer(uint32_t peerId);
+        /**
+         * @brief Helper to create a JSON representation of the quantiles of a histogram.
+         * @param histogram Histogram.
+         * @returns json::object JSON object describing the histogram quantiles.
+         */
+        static json::object quantiles(const metrics::Histogram* histogram);
+    };
+} // namespace network
+
+#endif // __PACKET_LATENCY_H__
@@ -531,6 +531,7 @@ bool PeerNetwork::writeConfig()
     config["masterPeerId"].set<uint32_t>(m_masterPeerId);                           // Master Peer ID
 
     config["software"].set<std::string>(std::string(software));                     // Software ID
+    writeResumeProof(config);
 
     json::value v = json::value(config);
     std::string json = v.serialize();
@@ -9,6 +9,7 @@
  */
 #include "fne/Defines.h"
 #include "common/edac/SHA256.h"
+#include "common/EventTrace.h"
 #include "common/p25/kmm/KMMFactory.h"
 #include "common/json/json.h"
 #include "common/zlib/Compression.h"
@@ -16,6 +17,7 @@
 #include "common/StopWatch.h"
 #include "common/Utils.h"
 #include "network/TrafficNetwork.h"
+#include "network/PacketLatency.h"
 #include "network/callhandler/TagDMRData.h"
 #include "network/callhandler/TagP25Data.h"
 #include "network/callhandler/TagNXDNData.h"
@@ -50,11 +52,53 @@ const uint64_t PACKET_LATE_TIME = 250U; // 250ms
 
 const uint32_t FIXED_HA_UPDATE_INTERVAL = 30U; // 30s
 
+const uint32_t MAX_RX_SHARDS = 16U;
+const uint32_t RX_SHARD_CYCLE_THRESHOLD = 2U; // 2ms
+// offset of the peer ID in a datagram; RTP header, then the peer ID at byte 12 of the FNE header
+const uint32_t RX_SHARD_PEER_ID_OFFSET = RTP_HEADER_LENGTH_BYTES + 12U;
+
+const uint32_t MAX_LOGIN_WORKERS = 16U;
+const uint32_t MAX_RESUME_TICKET_TIME = 3600U; // 1 hour
+const uint32_t RESUME_TICKET_MAC_LEN = 16U;
+
 // ---------------------------------------------------------------------------
 //  Static Class Members
 // ---------------------------------------------------------------------------
 
-std::timed_mutex TrafficNetwork::s_keyQueueMutex;
+ProfiledMutex<std::timed_mutex> TrafficNetwork::s_keyQueueMutex("TrafficNetwork::s_keyQueueMutex");
+
+// ---------------------------------------------------------------------------
+//  Global Functions
+// ---------------------------------------------------------------------------
+
+/**
+ * @brief Helper to write a JSON document to a state snapshot, with a 32-bit length.
+ *  (NOTE: StateSnapshot::writeString() truncates at 65535 bytes, which a large spanning tree or peer
+ *  configuration can exceed.)
+ * @param snapshot State snapshot.
+ * @param json JSON text.
+ */
+static void writeSnapshotJSON(StateSnapshot& snapshot, const std::string& json)
+{
+    snapshot.writeUInt32((uint32_t)json.length());
+    snapshot.writeBytes((const uint8_t*)json.data(), (uint32_t)json.length());
+}
+
+/**
+ * @brief Helper to read a JSON document written by writeSnapshotJSON() from a state snapshot.
+ * @param snapshot State snapshot.
+ * @param[out] json JSON text.
+ * @returns bool True, if the JSON text was read, otherwise false.
+ */
+static bool readSnapshotJSON(StateSnapshot& snapshot, std::string& json)
+{
+    uint32_t length = 0U;
+    if (!snapshot.readUInt32(length) || length > snapshot.size())
+        return false;
+
+    json.assign(length, '\0');
+    return snapshot.readBytes((uint8_t*)&json[0], length);
+}
 
 // ---------------------------------------------------------------------------
 //  Public Class Members
@@ -78,6 +122,7 @@ TrafficNetwork::TrafficNetwork(HostFNE* host, const std::string& address, uint16
     m_port(port),
     m_password(password),
     m_isReplica(false),
+    m_warmRestart(false),
     m_dmrEnabled(dmr),
     m_p25Enabled(p25),
     m_nxdnEnabled(nxdn),
@@ -97,6 +142,7 @@ TrafficNetwork::TrafficNetwork(HostFNE* host, const std::string& address, uint16
     m_peers(),
     m_peerReplicaPeers(),
     m_peerAffiliations(),
+    m_peerAffiliationsVersion(0U),
     m_ccPeerMap(),
     m_peerReplicaKeyQueue(),
     m_treeRoot(nullptr),
@@ -139,14 +185,32 @@ TrafficNetwork::TrafficNetwork(HostFNE* host, const std::string& address, uint16
     m_jitterMaxSize(4U),
     m_jitterMaxWait(40000U),
     m_threadPool(workerCnt, "fne"),
+    m_loginPool(2U, "fne:login"),
+    m_loginRateLimit(50U),
+    m_loginTokens(0.0),
+    m_loginTokenTime(0U),
+    m_loginRateLock(),
+    m_resumeTicketTime(0U),
+    m_resumeTicketEpoch(0U),
+    m_resumeTicketUsed(),
+    m_resumeTicketLock(),
+    m_metadataPool(2U, "fne:acl"),
+    m_aclPushStagger(50U),
+    m_metadataSchedule(),
+    m_metadataScheduleLast(0U),
+    m_metadataScheduleLock(),
+    m_rxShardCnt(1U),
+    m_rxShards(),
     m_disablePacketData(false),
     m_dumpPacketData(false),
     m_verbosePacketData(false),
     m_sndcpStartAddr(__IP_FROM_STR("10.10.1.10")),
     m_sndcpEndAddr(__IP_FROM_STR("10.10.1.254")),
-    m_totalActiveCalls(0U),
-    m_totalCallsProcessed(0U),
-    m_totalCallCollisions(0U),
+    m_totalActiveCalls(nullptr),
+    m_totalCallsProcessed(nullptr),
+    m_totalCallCollisions(nullptr),
+    m_totalNAKs(nullptr),
+    m_connectedPeers(nullptr),
     m_logDenials(false),
     m_logUpstreamCallStartEnd(true),
     m_reportPeerPing(reportPeerPing),
@@ -162,6 +226,16 @@ TrafficNetwork::TrafficNetwork(HostFNE* host, const std::string& address, uint16
     m_peerAffiliations.reserve(MAX_HARD_CONN_CAP);
     m_ccPeerMap.reserve(MAX_HARD_CONN_CAP);
 
+    m_peers.setLockName("TrafficNetwork::m_peers");
+    m_ccPeerMap.setLockName("TrafficNetwork::m_ccPeerMap");
+
+    m_totalActiveCalls = metrics::Registry::gauge("dvm_fne_active_calls", "Calls currently active on the FNE.");
+    m_totalCallsProcessed = metrics::Registry::counter("dvm_fne_calls", "Calls processed by the FNE.");
+    m_totalCallCollisions = metrics::Registry::counter("dvm_fne_call_collisions", "Calls rejected due to a call collision.");
+    m_totalNAKs = metrics::Registry::counter("dvm_fne_naks", "Negative acknowledgements sent to peers.");
+    m_connectedPeers = metrics::Registry::gauge("dvm_fne_peers", "Peers connected to the FNE.");
+    PacketLatency::initialize();
+
     m_tagDMR = new TagDMRData(this, debug);
     m_tagP25 = new TagP25Data(this, debug);
     m_tagNXDN = new TagNXDNData(this, debug);
@@ -173,6 +247,11 @@ TrafficNetwork::TrafficNetwork(HostFNE* host, const std::string& address, uint16
     m_treeRoot = new SpanningTree(peerId, peerId, nullptr);
     m_treeRoot->identity(identity);
 
+    // session resumption tickets are bound to this instance of the FNE; the record of used tickets is not
+    // persisted, so a ticket issued before a restart must not validate after it
+    std::uniform_int_distribution<uint32_t> dist(DVM_RAND_MIN, DVM_RAND_MAX);
+    m_resumeTicketEpoch = dist(m_random);
+
     /*
     ** Initialize Threads
     */
@@ -340,8 +419,54 @@ void TrafficNetwork::setOptions(yaml::Node& conf, bool printOptions)
         m_peerReplicaHAParams.push_back(params);
     }
 
+    m_rxShardCnt = conf["receiveShards"].as<uint32_t>(1U);
+    if (m_rxShardCnt < 1U)
+        m_rxShardCnt = 1U;
+    if (m_rxShardCnt > MAX_RX_SHARDS)
+        m_rxShardCnt = MAX_RX_SHARDS;
+#if !defined(__linux__)
+    if (m_rxShardCnt > 1U) {
+        LogWarning(LOG_MASTER, "Receive shards are only supported on Linux, using a single receive socket");
+        m_rxShardCnt = 1U;
+    }
+#endif // !defined(__linux__)
+
+    // login admission configuration
+    uint32_t loginWorkers = conf["loginWorkers"].as<uint32_t>(2U);
+    if (loginWorkers < 1U)
+        loginWorkers = 1U;
+    if (loginWorkers > MAX_LOGIN_WORKERS)
+        loginWorkers = MAX_LOGIN_WORKERS;
+    m_loginPool.setMaxWorkerCnt((uint16_t)loginWorkers);
+    m_metadataPool.setMaxWorkerCnt((uint16_t)loginWorkers);
+
+    uint32_t loginQueueDepth = conf["loginQueueDepth"].as<uint32_t>(MAX_HARD_CONN_CAP);
+    if (loginQueueDepth < 1U)
+        loginQueueDepth = 1U;
+    m_loginPool.setMaxQueuedTasks((uint16_t)loginQueueDepth);
+
+    m_loginRateLimit = conf["loginRateLimit"].as<uint32_t>(50U);
+    m_resumeTicketTime = conf["resumeTicketTime"].as<uint32_t>(0U);
+    if (m_resumeTicketTime > MAX_RESUME_TICKET_TIME)
+        m_resumeTicketTime = MAX_RESUME_TICKET_TIME;
+    m_aclPushStagger = conf["aclPushStagger"].as<uint32_t>(50U);
+
     if (printOptions) {
         LogInfo("    Maximum Permitted Connections: %u", m_softConnLimit);
+        LogInfo("    Receive Shards: %u", m_rxShardCnt);
+        LogInfo("    Login Workers: %u", loginWorkers);
+        LogInfo("    Login Queue Depth: %u", loginQueueDepth);
+        if (m_loginRateLimit > 0U) {
+            LogInfo("    Login Rate Limit: %u logins/s", m_loginRateLimit);
+        } else {
+            LogInfo("    Login Rate Limit: unlimited");
+        }
+        if (m_resumeTicketTime > 0U) {
+            LogInfo("    Session Resumption Ticket Lifetime: %us", m_resumeTicketTime);
+        } else {
+            LogInfo("    Session Resumption: disabled");
+        }
+        LogInfo("    ACL Push Stagger: %ums", m_aclPushStagger);
         LogInfo("    Enable Peer Spanning Tree: %s", m_enableSpanningTree ? "yes" : "no");
         LogInfo("    Log Spanning Tree Changes: %s", m_logSpanningTreeChanges ? "yes" : "no");
         LogInfo("    Spanning Tree Allow Fast Reconnect: %s", m_spanningTreeFastReconnect ? "yes" : "no");
@@ -416,14 +541,29 @@ void TrafficNetwork::setLookups(lookups::RadioIdLookup* ridLookup, lookups::Talk
 void TrafficNetwork::setPresharedKey(const uint8_t* presharedKey)
 {
     m_socket->setPresharedKey(presharedKey);
+    for (RxShard* shard : m_rxShards)
+        shard->socket->setPresharedKey(presharedKey);
+
+    // the peer ID is not visible in a wrapped datagram; fall back to the kernel steering frames by source address
+    if (!m_rxShards.empty()) {
+        if (!m_socket->clearReusePortSteering())
+            LogWarning(LOG_MASTER, "Failed to remove the receive shard steering program, frames from a peer may be processed out of order");
+    }
 }
 
 /* Process a data frames from the network. */
 
-void TrafficNetwork::processNetwork()
+bool TrafficNetwork::processNetwork(uint32_t shard)
 {
     if (m_status != NET_STAT_MST_RUNNING) {
-        return;
+        return false;
+    }
+
+    FrameQueue* frameQueue = m_frameQueue;
+    if (shard > 0U) {
+        if (shard > m_rxShards.size())
+            return false;
+        frameQueue = m_rxShards[shard - 1U]->frameQueue;
     }
 
     sockaddr_storage address;
@@ -433,7 +573,8 @@ void TrafficNetwork::processNetwork()
     int length = 0U;
 
     // read message
-    UInt8Array buffer = m_frameQueue->read(length, address, addrLen, &rtpHeader, &fneHeader);
+    UInt8Array buffer = frameQueue->read(length, address, addrLen, &rtpHeader, &fneHeader);
+    uint64_t rxTick = PacketLatency::now();
     if (length > 0) {
         if (m_debug)
             Utils::dump(1U, "TrafficNetwork::processNetwork(), Network Message", buffer.get(), length);
@@ -450,12 +591,45 @@ void TrafficNetwork::processNetwork()
         req->rtpHeader = rtpHeader;
         req->fneHeader = fneHeader;
 
-        req->pktRxTime = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::system_clock::now().time_since_epoch()).count();
+        req->rxTick = rxTick;
 
         req->length = length;
         req->buffer = new uint8_t[length];
         ::memcpy(req->buffer, buffer.get(), length);
 
+        // logins are processed on the login stage, so a login storm doesn't starve traffic processing
+        NET_FUNC::ENUM func = fneHeader.getFunction();
+        if (func == NET_FUNC::RPTL || func == NET_FUNC::RPTK || func == NET_FUNC::RPTC) {
+            bool admitted = true;
+            if (func == NET_FUNC::RPTL && !admitLogin()) {
+                if (m_verbose)
+                    LogWarning(LOG_MASTER, "PEER %u RPTL dropped, login rate limit exceeded, %s:%u", peerId, 
+                        udp::Socket::address(address).c_str(), udp::Socket::port(address));
+                admitted = false;
+            }
+
+            if (admitted && !m_loginPool.enqueue(new_pooltask(taskNetworkRx, req))) {
+                LogWarning(LOG_MASTER, "PEER %u login dropped, login queue full, %s:%u", peerId, 
+                    udp::Socket::address(address).c_str(), udp::Socket::port(address));
+                admitted = false;
+            }
+
+            // the peer will retry the login
+            if (!admitted) {
+                delete[] req->buffer;
+                delete req;
+            }
+
+            return true;
+        }
+
+        // a peer's frames are always received by the same shard; process them here, in the order received
+        req->enqueueTick = PacketLatency::now();
+        if (m_rxShardCnt > 1U) {
+            taskNetworkRx(req);
+            return true;
+        }
+
         // enqueue the task
         if (!m_threadPool.enqueue(new_pooltask(taskNetworkRx, req))) {
             LogError(LOG_NET, "Failed to task enqueue network packet request, peerId = %u, %s:%u", peerId, 
@@ -466,7 +640,11 @@ void TrafficNetwork::processNetwork()
                 delete req;
             }
         }
+
+        return true;
     }
+
+    return false;
 }
 
 /* Process network tree disconnect notification. */
@@ -542,13 +720,14 @@ void TrafficNetwork::clock(uint32_t ms)
     }
     m_peers.unlock();
 
-    if (m_forceListUpdate) {
+    if (m_forceListUpdate.exchange(false)) {
         for (auto& peer : m_peers) {
             peerMetadataUpdate(peer.first);
         }
-        m_forceListUpdate = false;
     }
 
+    processMetadataSchedule(now);
+
     m_maintainenceTimer.clock(ms);
     if (m_maintainenceTimer.isRunning() && m_maintainenceTimer.hasExpired()) {
         // check to see if any peers have been quiet (no ping) longer than allowed
@@ -631,8 +810,10 @@ void TrafficNetwork::clock(uint32_t ms)
         m_tagDMR->packetData()->cleanupStale();
         m_tagP25->packetData()->cleanupStale();
 
-        m_totalActiveCalls = 0U; // bryanb: this is techincally incorrect and should be better implemented
-                                 // but for now it will suffice to reset the active call count on maintainence cycle
+        m_totalActiveCalls->set(0); // bryanb: this is techincally incorrect and should be better implemented
+                                    // but for now it will suffice to reset the active call count on maintainence cycle
+
+        m_connectedPeers->set((int64_t)m_peers.size());
 
         m_maintainenceTimer.start();
     }
@@ -711,8 +892,10 @@ bool TrafficNetwork::open()
     if (m_debug)
         LogInfoEx(LOG_MASTER, "Opening Network");
 
-    // start thread pool
+    // start thread pools
     m_threadPool.start();
+    m_loginPool.start();
+    m_metadataPool.start();
 
     // start FluxQL thread pool
     if (m_enableInfluxDB) {
@@ -735,11 +918,43 @@ bool TrafficNetwork::open()
         m_frameQueue = new FrameQueue(m_socket, m_peerId, m_debug);
     }
 
+    if (m_rxShardCnt > 1U)
+        m_socket->setReusePort(true);
+
     bool ret = m_socket->open();
     if (!ret) {
         m_socket->recvBufSize(524288U); // 512K recv buffer
         m_socket->sendBufSize(524288U); // 512K send buffer
         m_status = NET_STAT_INVALID;
+        return ret;
+    }
+
+    // open the additional receive shards; sockets join the SO_REUSEPORT group in the order they are
+    // bound, which is the shard index the steering program selects
+    if (m_rxShardCnt > 1U) {
+        for (uint32_t i = 1U; i < m_rxShardCnt; i++) {
+            udp::Socket* socket = new udp::Socket(m_address, m_port);
+            socket->setReusePort(true);
+            if (!socket->open()) {
+                LogError(LOG_MASTER, "Failed to open receive shard %u, using %u receive shards", i, i);
+                delete socket;
+                break;
+            }
+
+            socket->recvBufSize(524288U); // 512K recv buffer
+            m_rxShards.push_back(new RxShard(this, i, socket, m_peerId, m_debug));
+        }
+
+        m_rxShardCnt = (uint32_t)m_rxShards.size() + 1U;
+        if (m_rxShardCnt > 1U) {
+            if (!m_socket->setReusePortSteering(RX_SHARD_PEER_ID_OFFSET, m_rxShardCnt))
+                LogWarning(LOG_MASTER, "Failed to attach the receive shard steering program, frames will be steered by source address");
+        }
+
+        for (size_t i = 0U; i < m_rxShards.size(); i++) {
+            if (m_rxShards[i]->run())
+                m_rxShards[i]->setName("fne:traf-net:" + std::to_string(i + 1U));
+        }
     }
 
     return ret;
@@ -752,7 +967,8 @@ void TrafficNetwork::close()
     if (m_debug)
         LogInfoEx(LOG_MASTER, "Closing Network");
 
-    if (m_status == NET_STAT_MST_RUNNING) {
+    // on a warm restart peers keep their sessions, and are restored from the state snapshot
+    if (m_status == NET_STAT_MST_RUNNING && !m_warmRestart) {
         uint8_t buffer[1U];
         ::memset(buffer, 0x00U, 1U);
 
@@ -766,10 +982,23 @@ void TrafficNetwork::close()
     m_maintainenceTimer.stop();
     m_updateLookupTimer.stop();
 
-    // stop thread pool
+    // stop receive shards
+    for (RxShard* shard : m_rxShards) {
+        shard->stop();
+        delete shard;
+    }
+    m_rxShards.clear();
+
+    // stop thread pools
+    m_loginPool.stop();
+    m_loginPool.wait();
+    m_metadataPool.stop();
+    m_metadataPool.wait();
     m_threadPool.stop();
     m_threadPool.wait();
 
+    m_metadataSchedule.clear();
+
     // stop FluxQL thread pool
     if (m_enableInfluxDB) {
         influxdb::detail::TSCaller::stop();
@@ -810,9 +1039,7 @@ void* TrafficNetwork::threadParrotHandler(void* arg)
         }
 
         LogInfoEx(LOG_HOST, "[ OK ] %s", threadName.c_str());
-#ifdef _GNU_SOURCE
-        ::pthread_setname_np(th->thread, threadName.c_str());
-#endif // _GNU_SOURCE
+        ThreadPolicy::apply(th->thread, threadName);
 
         StopWatch stopWatch;
         stopWatch.start();
@@ -895,12 +1122,57 @@ void* TrafficNetwork::threadParrotHandler(void* arg)
     return nullptr;
 }
 
+/* Initializes a new instance of the RxShard class. */
+
+TrafficNetwork::RxShard::RxShard(TrafficNetwork* network, uint32_t index, udp::Socket* socket, uint32_t peerId, bool debug) : Thread(),
+    socket(socket),
+    frameQueue(nullptr),
+    m_network(network),
+    m_index(index),
+    m_running(true)
+{
+    assert(network != nullptr);
+    assert(socket != nullptr);
+
+    frameQueue = new FrameQueue(socket, peerId, debug);
+}
+
+/* Finalizes a instance of the RxShard class. */
+
+TrafficNetwork::RxShard::~RxShard()
+{
+    delete frameQueue;
+
+    socket->close();
+    delete socket;
+}
+
+/* Thread entry point; reads and processes frames until stopped. */
+
+void TrafficNetwork::RxShard::entry()
+{
+    while (m_running && !g_killed) {
+        // keep reading while frames are waiting
+        if (!m_network->processNetwork(m_index))
+            Thread::sleep(RX_SHARD_CYCLE_THRESHOLD);
+    }
+}
+
+/* Stops the receive thread and waits for it to exit. */
+
+void TrafficNetwork::RxShard::stop()
+{
+    if (m_running.exchange(false))
+        wait();
+}
+
 /* Process a data frames from the network. */
 
 void TrafficNetwork::taskNetworkRx(NetPacketRequest* req)
 {
     if (req != nullptr) {
         uint64_t now = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::system_clock::now().time_since_epoch()).count();
+        uint64_t workerTick = PacketLatency::now();
 
         TrafficNetwork* network = static_cast<TrafficNetwork*>(req->obj);
         if (network == nullptr) {
@@ -922,11 +1194,11 @@ void TrafficNetwork::taskNetworkRx(NetPacketRequest* req)
             uint32_t streamId = req->fneHeader.getStreamId();
 
             // determine if this packet is late (i.e. are we processing this packet more than 250ms after it was received?)
-            uint64_t dt = req->pktRxTime + PACKET_LATE_TIME;
-            if (dt < now) {
+            uint64_t dt = (workerTick - req->rxTick) / 1000U;
+            if (dt > PACKET_LATE_TIME) {
                 std::string peerIdentity = network->resolvePeerIdentity(peerId);
-                LogWarning(LOG_MASTER, "PEER %u (%s) packet processing latency >250ms, ssrc = %u, dt = %u, now = %u", peerId, peerIdentity.c_str(),
-                    ssrc, dt, now);
+                LogWarning(LOG_MASTER, "PEER %u (%s) packet processing latency >250ms, ssrc = %u, dt = %ums", peerId, peerIdentity.c_str(),
+                    ssrc, (uint32_t)dt);
             }
 
             // update current peer packet sequence and stream ID
@@ -963,6 +1235,9 @@ void TrafficNetwork::taskNetworkRx(NetPacketRequest* req)
                 return;
             }
 
+            if (req->fneHeader.getFunction() == NET_FUNC::PROTOCOL)
+                PacketLatency::begin(req->fneHeader.getSubFunction(), peerId, req->rxTick, req->enqueueTick, workerTick);
+
             // process incoming message function opcodes
             switch (req->fneHeader.getFunction()) {
             case NET_FUNC::PROTOCOL:                                    // Protocol
@@ -1158,8 +1433,14 @@ void TrafficNetwork::taskNetworkRx(NetPacketRequest* req)
                         FNEPeerConnection* connection = new FNEPeerConnection(peerId, req->address, req->addrLen);
                         connection->lastPing(now);
 
+                        // did the peer present a session resumption ticket?
+                        bool resumed = false;
+                        if (network->m_resumeTicketTime > 0U && (uint32_t)req->length >= 8U + RESUME_TICKET_LEN) {
+                            resumed = network->validateResumeTicket(peerId, connection->address(), req->buffer + 8U);
+                        }
+
                         network->applyJitterBufferConfig(peerId, connection);
-                        network->setupRepeaterLogin(peerId, streamId, connection);
+                        network->setupRepeaterLogin(peerId, streamId, connection, resumed ? req->buffer + 8U : nullptr);
 
                         // check if the peer is in the peer ACL list
                         if (network->m_peerListLookup->getACL()) {
@@ -1189,9 +1470,15 @@ void TrafficNetwork::taskNetworkRx(NetPacketRequest* req)
                                     connection = new FNEPeerConnection(peerId, req->address, req->addrLen);
                                     connection->lastPing(now);
 
+                                    // did the peer present a session resumption ticket?
+                                    bool resumed = false;
+                                    if (network->m_resumeTicketTime > 0U && (uint32_t)req->length >= 8U + RESUME_TICKET_LEN) {
+                                        resumed = network->validateResumeTicket(peerId, connection->address(), req->buffer + 8U);
+                                    }
+
                                     network->applyJitterBufferConfig(peerId, connection);
                                     network->erasePeerAffiliations(peerId);
-                                    network->setupRepeaterLogin(peerId, streamId, connection);
+                                    network->setupRepeaterLogin(peerId, streamId, connection, resumed ? req->buffer + 8U : nullptr);
 
                                     // check if the peer is in the peer ACL list
                                     if (network->m_peerListLookup->getACL()) {
@@ -1248,31 +1535,9 @@ void TrafficNetwork::taskNetworkRx(NetPacketRequest* req)
                                 ::memset(salt, 0x00U, 4U);
                                 SET_UINT32(connection->salt(), salt, 0U);
 
-                                std::string passwordForPeer = network->m_password;
-
                                 // check if the peer is in the peer ACL list
-                                bool validAcl = true;
-                                if (network->m_peerListLookup->getACL()) {
-                                    if (!network->m_peerListLookup->isPeerAllowed(peerId) && !network->m_peerListLookup->isPeerListEmpty()) {
-                                        LogWarning(LOG_MASTER, "PEER %u RPTK, failed peer ACL check", peerId);
-                                        validAcl = false;
-                                    } else {
-                                        lookups::PeerId peerEntry = network->m_peerListLookup->find(peerId);
-                                        if (peerEntry.peerDefault()) {
-                                            validAcl = false; // default peer IDs are a no-no as they have no data thus fail ACL check
-                                        } else {
-                                            passwordForPeer = peerEntry.peerPassword();
-                                            if (passwordForPeer.length() == 0) {
-                                                passwordForPeer = network->m_password;
-                                            }
-                                        }
-                                    }
-
-                                    if (network->m_peerListLookup->isPeerListEmpty()) {
-                                        LogWarning(LOG_MASTER, "Peer List ACL enabled, but we have an empty peer list? Passing all peers.");
-                                        validAcl = true;
-                                    }
-                                }
+                                std::string passwordForPeer;
+                                bool validAcl = network->resolvePeerPassword(peerId, "RPTK", passwordForPeer);
 
                                 if (validAcl) {
                                     size_t size = passwordForPeer.size();
@@ -1366,8 +1631,17 @@ void TrafficNetwork::taskNetworkRx(NetPacketRequest* req)
                                         network->writePeerNAK(peerId, TAG_REPEATER_AUTH, NET_CONN_NAK_INVALID_CONFIG_DATA, req->address, req->addrLen);
                                         network->disconnectPeer(peerId, connection);
                                     }
+                                    else if (!network->validateResumeProof(connection, v.get<json::object>())) {
+                                        LogWarning(LOG_MASTER, "PEER %u RPTC NAK, failed the session resumption proof", peerId);
+                                        network->writePeerNAK(peerId, TAG_REPEATER_AUTH, NET_CONN_NAK_FNE_UNAUTHORIZED, req->address, req->addrLen);
+                                        network->disconnectPeer(peerId, connection);
+                                    }
                                     else {
-                                        connection->config(v.get<json::object>());
+                                        json::object config = v.get<json::object>();
+                                        config.erase("resumeProof");
+
+                                        connection->config(config);
+                                        connection->resumeProof(std::string());
                                         connection->connectionState(NET_STAT_RUNNING);
                                         connection->connected(true);
                                         connection->pingsReceived(0U);
@@ -1386,7 +1660,7 @@ void TrafficNetwork::taskNetworkRx(NetPacketRequest* req)
 
                                         // attach extra notification data to the RPTC ACK to notify the peer of 
                                         // the use of the alternate diagnostic port
-                                        uint8_t buffer[1U];
+                                        uint8_t buffer[1U + RESUME_TICKET_LEN];
                                         buffer[0U] = 0x80U; // this should really be a defined constant -- but
                                                             // because this is the only option and its *always* sent now
                                                             // we can just hardcode this for now
@@ -1483,7 +1757,15 @@ void TrafficNetwork::taskNetworkRx(NetPacketRequest* req)
                                             }
                                         }
 
-                                        network->writePeerACK(peerId, streamId, buffer, 1U);
+                                        // issue a session resumption ticket, so a reconnecting peer can skip the challenge
+                                        uint32_t ackLen = 1U;
+                                        if (network->m_resumeTicketTime > 0U && 
+                                            network->createResumeTicket(peerId, connection->address(), buffer + 1U)) {
+                                            buffer[0U] |= RPTC_ACK_FLAG_RESUME_TICKET;
+                                            ackLen += RESUME_TICKET_LEN;
+                                        }
+
+                                        network->writePeerACK(peerId, streamId, buffer, ackLen);
                                         LogInfoEx(LOG_MASTER, "PEER %u RPTC ACK, completed the configuration exchange", peerId);
 
                                         // is the peer reporting it is a conventional peer?
@@ -1563,8 +1845,8 @@ void TrafficNetwork::taskNetworkRx(NetPacketRequest* req)
                                 connection->pingsReceived(pingsRx);
                                 connection->lastPing(now);
 
-                                uint8_t payload[8U];
-                                ::memset(payload, 0x00U, 8U);
+                                uint8_t payload[8U + RESUME_TICKET_LEN];
+                                ::memset(payload, 0x00U, 8U + RESUME_TICKET_LEN);
 
                                 // split ulong64_t (8 byte) value into bytes
                                 payload[0U] = (uint8_t)((now >> 56) & 0xFFU);
@@ -1576,8 +1858,15 @@ void TrafficNetwork::taskNetworkRx(NetPacketRequest* req)
                                 payload[6U] = (uint8_t)((now >> 8) & 0xFFU);
                                 payload[7U] = (uint8_t)((now >> 0) & 0xFFU);
 
+                                // refresh the peer's session resumption ticket
+                                uint32_t payloadLen = 8U;
+                                if (network->m_resumeTicketTime > 0U && connection->connectionState() == NET_STAT_RUNNING &&
+                                    network->createResumeTicket(peerId, ip, payload + 8U)) {
+                                    payloadLen += RESUME_TICKET_LEN;
+                                }
+
                                 network->m_peers[peerId] = connection;
-                                network->writePeerCommand(peerId, { NET_FUNC::PONG, NET_SUBFUNC::NOP }, payload, 8U, streamId, false);
+                                network->writePeerCommand(peerId, { NET_FUNC::PONG, NET_SUBFUNC::NOP }, payload, payloadLen, streamId, false);
 
                                 if (network->m_reportPeerPing) {
                                     LogInfoEx(LOG_MASTER, "PEER %u (%s) ping, pingsReceived = %u, lastPing = %u, now = %u", peerId, connection->identWithQualifier().c_str(),
@@ -1728,11 +2017,11 @@ void TrafficNetwork::taskNetworkRx(NetPacketRequest* req)
                                         if (modifyKey->getAlgId() > 0U && modifyKey->getKId() > 0U) {
                                             LogInfoEx(LOG_MASTER, "PEER %u (%s) requested enc. key, algId = $%02X, kID = $%04X", peerId, connection->identWithQualifier().c_str(),
                                                 modifyKey->getAlgId(), modifyKey->getKId());
-                                            ::EKCKeyItem keyItem = network->m_cryptoLookup->find(modifyKey->getKId());
-                                            if (!keyItem.isInvalid()) {
+                                            std::shared_ptr<const ::EKCKeyItem> keyItem = network->m_cryptoLookup->findKey(modifyKey->getKId(), modifyKey->getAlgId());
+                                            if (keyItem != nullptr && !keyItem->isInvalid()) {
                                                 uint8_t key[P25DEF::MAX_ENC_KEY_LENGTH_BYTES];
                                                 ::memset(key, 0x00U, P25DEF::MAX_ENC_KEY_LENGTH_BYTES);
-                                                uint8_t keyLength = keyItem.getKey(key);
+                                                uint8_t keyLength = keyItem->getKey(key);
 
                                                 if (network->m_debug) {
                                                     LogDebugEx(LOG_HOST, "TrafficNetwork::threadedNetworkRx()", "keyLength = %u", keyLength);
@@ -1758,8 +2047,8 @@ void TrafficNetwork::taskNetworkRx(NetPacketRequest* req)
 
                                                 p25::kmm::KeyItem ki = p25::kmm::KeyItem();
                                                 ki.keyFormat(KEY_FORMAT_TEK);
-                                                ki.kId((uint16_t)keyItem.kId());
-                                                ki.sln((uint16_t)keyItem.sln());
+                                                ki.kId((uint16_t)keyItem->kId());
+                                                ki.sln((uint16_t)keyItem->sln());
                                                 ki.setKey(key, keyLength);
 
                                                 ks.push_back(ki);
@@ -2075,6 +2364,8 @@ void TrafficNetwork::taskNetworkRx(NetPacketRequest* req)
             }
         }
 
+        PacketLatency::end();
+
         if (req->buffer != nullptr)
             delete[] req->buffer;
         delete req;
@@ -2158,8 +2449,12 @@ void TrafficNetwork::createPeerAffiliations(uint32_t peerId, std::string peerNam
     erasePeerAffiliations(peerId);
 
     lookups::ChannelLookup* chLookup = new lookups::ChannelLookup();
-    m_peerAffiliations[peerId] = new fne_lookups::AffiliationLookup(peerName, chLookup, m_verbose);
-    m_peerAffiliations[peerId]->setDisableUnitRegTimeout(true); // FNE doesn't allow unit registration timeouts (notification must come from the peers)
+    fne_lookups::AffiliationLookup* aff = new fne_lookups::AffiliationLookup(peerName, chLookup, m_verbose);
+    aff->setDisableUnitRegTimeout(true); // FNE doesn't allow unit registration timeouts (notification must come from the peers)
+    aff->setGrpAffChangeCounter(&m_peerAffiliationsVersion);
+
+    m_peerAffiliations.insert(peerId, aff);
+    m_peerAffiliationsVersion++;
 }
 
 /* Helper to erase the peer from the peers affiliations list. */
@@ -2168,14 +2463,19 @@ bool TrafficNetwork::erasePeerAffiliations(uint32_t peerId)
 {
     auto it = std::find_if(m_peerAffiliations.begin(), m_peerAffiliations.end(), [&](PeerAffiliationMapPair x) { return x.first == peerId; });
     if (it != m_peerAffiliations.end()) {
-        lookups::AffiliationLookup* aff = m_peerAffiliations[peerId];
+        lookups::AffiliationLookup* aff = it->second;
+
+        // remove the entry before destroying it; erasing waits for anyone holding the table lock (i.e. a REST
+        //  affiliation report) to finish with it
+        m_peerAffiliations.erase(peerId);
+        m_peerAffiliationsVersion++;
+
         if (aff != nullptr) {
             lookups::ChannelLookup* rfCh = aff->rfCh();
             if (rfCh != nullptr)
                 delete rfCh;
             delete aff;
         }
-        m_peerAffiliations.erase(peerId);
 
         return true;
     }
@@ -2380,6 +2680,235 @@ void TrafficNetwork::setPeerReplica(bool replica)
     }
 }
 
+/* Helper to write the peer, affiliation, spanning tree and call state to a state snapshot. */
+
+void TrafficNetwork::writeSnapshot(StateSnapshot& snapshot)
+{
+    // peers -- only peers that have completed the configuration exchange are written
+    std::vector<FNEPeerConnection*> peers;
+    m_peers.shared_lock();
+    for (auto& peer : m_peers) {
+        FNEPeerConnection* connection = peer.second;
+        if (connection != nullptr && connection->connected() && connection->connectionState() == NET_STAT_RUNNING)
+            peers.push_back(connection);
+    }
+
+    snapshot.writeUInt32((uint32_t)peers.size());
+    for (FNEPeerConnection* connection : peers) {
+        sockaddr_storage addr = connection->socketStorage();
+
+        snapshot.writeUInt32(connection->id());
+        snapshot.writeUInt32(connection->sockStorageLen());
+        snapshot.writeBytes((const uint8_t*)&addr, sizeof(sockaddr_storage));
+        snapshot.writeString(connection->identity());
+        writeSnapshotJSON(snapshot, json::value(connection->config()).serialize());
+        snapshot.writeUInt32(connection->masterId());
+        snapshot.writeUInt32(connection->ccPeerId());
+        snapshot.writeBool(connection->isNeighborFNEPeer());
+        snapshot.writeBool(connection->isReplica());
+        snapshot.writeBool(connection->isConventionalPeer());
+        snapshot.writeBool(connection->isSysView());
+        snapshot.writeBool(connection->hasCallPriority());
+        snapshot.writeUInt64(connection->lastPing());
+        snapshot.writeUInt32(connection->pingsReceived());
+
+        // peer affiliations
+        fne_lookups::AffiliationLookup* aff = nullptr;
+        auto it = m_peerAffiliations.find(connection->id());
+        if (it != m_peerAffiliations.end())
+            aff = it->second;
+
+        if (aff != nullptr) {
+            std::vector<uint32_t> unitRegTable = aff->unitRegTable();
+            snapshot.writeUInt32((uint32_t)unitRegTable.size());
+            for (uint32_t srcId : unitRegTable) {
+                snapshot.writeUInt32(srcId);
+                snapshot.writeUInt32(aff->getSSRCByUnitReg(srcId));
+            }
+
+            std::unordered_map<uint32_t, uint32_t> grpAffTable = aff->grpAffTable();
+            snapshot.writeUInt32((uint32_t)grpAffTable.size());
+            for (auto& entry : grpAffTable) {
+                snapshot.writeUInt32(entry.first);
+                snapshot.writeUInt32(entry.second);
+            }
+        } else {
+            snapshot.writeUInt32(0U);
+            snapshot.writeUInt32(0U);
+        }
+    }
+    m_peers.unlock();
+
+    // control channel to voice channel peer mappings
+    m_ccPeerMap.shared_lock();
+    snapshot.writeUInt32((uint32_t)m_ccPeerMap.size());
+    for (auto& entry : m_ccPeerMap) {
+        snapshot.writeUInt32(entry.first);
+        snapshot.writeUInt32((uint32_t)entry.second.size());
+        for (uint32_t vcPeerId : entry.second)
+            snapshot.writeUInt32(vcPeerId);
+    }
+    m_ccPeerMap.unlock();
+
+    // spanning tree
+    {
+        std::lock_guard<std::mutex> guard(m_treeLock);
+
+        json::array jsonArray;
+        if (m_enableSpanningTree && m_treeRoot != nullptr) {
+            for (auto child : m_treeRoot->m_children)
+                SpanningTree::serializeTree(child, jsonArray);
+        }
+
+        writeSnapshotJSON(snapshot, json::value(jsonArray).serialize());
+    }
+
+    // call status
+    m_tagDMR->writeSnapshot(snapshot);
+    m_tagP25->writeSnapshot(snapshot);
+    m_tagNXDN->writeSnapshot(snapshot);
+    m_tagAnalog->writeSnapshot(snapshot);
+}
+
+/* Helper to restore the peer, affiliation, spanning tree and call state from a state snapshot. */
+
+bool TrafficNetwork::restoreSnapshot(StateSnapshot& snapshot, uint64_t elapsed)
+{
+    // peers
+    uint32_t peerCnt = 0U;
+    if (!snapshot.readUInt32(peerCnt))
+        return false;
+
+    std::vector<uint32_t> restoredPeers;
+    for (uint32_t i = 0U; i < peerCnt; i++) {
+        uint32_t peerId = 0U, addrLen = 0U, masterId = 0U, ccPeerId = 0U, pingsReceived = 0U;
+        sockaddr_storage addr;
+        std::string identity, config;
+        bool neighbor = false, replica = false, convPeer = false, sysView = false, callPriority = false;
+        uint64_t lastPing = 0U;
+
+        if (!snapshot.readUInt32(peerId) || !snapshot.readUInt32(addrLen) || 
+            !snapshot.readBytes((uint8_t*)&addr, sizeof(sockaddr_storage)) ||
+            !snapshot.readString(identity) || !readSnapshotJSON(snapshot, config) ||
+            !snapshot.readUInt32(masterId) || !snapshot.readUInt32(ccPeerId) ||
+            !snapshot.readBool(neighbor) || !snapshot.readBool(replica) || !snapshot.readBool(convPeer) ||
+            !snapshot.readBool(sysView) || !snapshot.readBool(callPriority) ||
+            !snapshot.readUInt64(lastPing) || !snapshot.readUInt32(pingsReceived))
+            return false;
+
+        FNEPeerConnection* connection = nullptr;
+        if (peerId > 0U && addrLen > 0U && addrLen <= sizeof(sockaddr_storage) && m_peers.find(peerId) == m_peers.end()) {
+            json::value v;
+            std::string err = json::parse(v, config);
+            if (err.empty() && v.is<json::object>()) {
+                connection = new FNEPeerConnection(peerId, addr, addrLen);
+                connection->identity(identity);
+                connection->config(v.get<json::object>());
+                connection->masterId(masterId);
+                connection->ccPeerId(ccPeerId);
+                connection->isNeighborFNEPeer(neighbor);
+                connection->isReplica(replica);
+                connection->isConventionalPeer(convPeer);
+                connection->isSysView(sysView);
+                connection->hasCallPriority(callPriority);
+
+                // the last ping time is carried over, peers that did not survive the restart are
+                // expired by the maintenance ping timeout
+                connection->lastPing(lastPing);
+                connection->pingsReceived(pingsReceived);
+                connection->missedMetadataUpdates(0U);
+                connection->connectionState(NET_STAT_RUNNING);
+                connection->connected(true);
+
+                m_peers[peerId] = connection;
+                applyJitterBufferConfig(peerId, connection);
+
+                std::stringstream peerName;
+                peerName << "PEER " << peerId;
+                createPeerAffiliations(peerId, peerName.str());
+
+                restoredPeers.push_back(peerId);
+            }
+        }
+
+        // peer affiliations
+        fne_lookups::AffiliationLookup* aff = nullptr;
+        if (connection != nullptr)
+            aff = m_peerAffiliations[peerId];
+
+        uint32_t unitRegCnt = 0U;
+        if (!snapshot.readUInt32(unitRegCnt))
+            return false;
+        for (uint32_t j = 0U; j < unitRegCnt; j++) {
+            uint32_t srcId = 0U, ssrc = 0U;
+            if (!snapshot.readUInt32(srcId) || !snapshot.readUInt32(ssrc))
+                return false;
+            if (aff != nullptr)
+                aff->unitReg(srcId, ssrc);
+        }
+
+        uint32_t grpAffCnt = 0U;
+        if (!snapshot.readUInt32(grpAffCnt))
+            return false;
+        for (uint32_t j = 0U; j < grpAffCnt; j++) {
+            uint32_t srcId = 0U, dstId = 0U;
+            if (!snapshot.readUInt32(srcId) || !snapshot.readUInt32(dstId))
+                return false;
+            if (aff != nullptr)
+                aff->groupAff(srcId, dstId);
+        }
+    }
+
+    // control channel to voice channel peer mappings
+    uint32_t ccCnt = 0U;
+    if (!snapshot.readUInt32(ccCnt))
+        return false;
+    for (uint32_t i = 0U; i < ccCnt; i++) {
+        uint32_t peerId = 0U, vcCnt = 0U;
+        if (!snapshot.readUInt32(peerId) || !snapshot.readUInt32(vcCnt))
+            return false;
+
+        std::vector<uint32_t> vcPeers;
+        for (uint32_t j = 0U; j < vcCnt; j++) {
+            uint32_t vcPeerId = 0U;
+            if (!snapshot.readUInt32(vcPeerId))
+                return false;
+            vcPeers.push_back(vcPeerId);
+        }
+
+        if (std::find(restoredPeers.begin(), restoredPeers.end(), peerId) != restoredPeers.end())
+            m_ccPeerMap[peerId] = vcPeers;
+    }
+
+    // spanning tree
+    std::string tree;
+    if (!readSnapshotJSON(snapshot, tree))
+        return false;
+    if (m_enableSpanningTree) {
+        json::value v;
+        std::string err = json::parse(v, tree);
+        if (err.empty() && v.is<json::array>()) {
+            json::array arr = v.get<json::array>();
+            if (arr.size() > 0U) {
+                std::lock_guard<std::mutex> guard(m_treeLock);
+                SpanningTree::deserializeTree(arr, m_treeRoot, nullptr);
+            }
+        }
+    }
+
+    // call status
+    if (!m_tagDMR->readSnapshot(snapshot, elapsed) || !m_tagP25->readSnapshot(snapshot, elapsed) ||
+        !m_tagNXDN->readSnapshot(snapshot, elapsed) || !m_tagAnalog->readSnapshot(snapshot, elapsed))
+        return false;
+
+    // push the current ACLs to the restored peers
+    for (uint32_t peerId : restoredPeers)
+        peerMetadataUpdate(peerId);
+
+    LogInfoEx(LOG_MASTER, "Restored %u peers from state snapshot, snapshot age %ums", (uint32_t)restoredPeers.size(), (uint32_t)elapsed);
+    return true;
+}
+
 /* Helper to resolve the peer ID to its identity string. */
 
 std::string TrafficNetwork::resolvePeerIdentity(uint32_t peerId)
@@ -2397,25 +2926,214 @@ std::string TrafficNetwork::resolvePeerIdentity(uint32_t peerId)
 
 /* Helper to complete setting up a repeater login request. */
 
-void TrafficNetwork::setupRepeaterLogin(uint32_t peerId, uint32_t streamId, FNEPeerConnection* connection)
+void TrafficNetwork::setupRepeaterLogin(uint32_t peerId, uint32_t streamId, FNEPeerConnection* connection, const uint8_t* resumeTicket)
 {
     std::uniform_int_distribution<uint32_t> dist(DVM_RAND_MIN, DVM_RAND_MAX);
     connection->salt(dist(m_random));
 
     LogInfoEx(LOG_MASTER, "PEER %u started login from, %s:%u", peerId, connection->address().c_str(), connection->port());
 
-    connection->connectionState(NET_STAT_WAITING_AUTHORISATION);
-    m_peers[peerId] = connection;
-
     // transmit salt to peer
-    uint8_t salt[4U];
-    ::memset(salt, 0x00U, 4U);
+    uint8_t salt[5U];
+    ::memset(salt, 0x00U, 5U);
     SET_UINT32(connection->salt(), salt, 0U);
 
+    // the ticket travels in the clear, so holding one is not enough; the peer must answer the salt with
+    // a proof derived from the ticket and its password, which it sends with its configuration
+    std::string password;
+    if (resumeTicket != nullptr && resolvePeerPassword(peerId, nullptr, password)) {
+        connection->resumeProof(createResumeProof(password, resumeTicket, salt));
+    } else {
+        connection->resumeProof(std::string());
+    }
+
+    bool resumed = !connection->resumeProof().empty();
+    connection->connectionState(resumed ? NET_STAT_WAITING_CONFIG : NET_STAT_WAITING_AUTHORISATION);
+    m_peers[peerId] = connection;
+
+    if (resumed) {
+        salt[4U] = RPTL_ACK_RESUMED;
+        writePeerACK(peerId, streamId, salt, 5U);
+        LogInfoEx(LOG_MASTER, "PEER %u RPTL ACK, session resumed, skipping the login exchange", peerId);
+        return;
+    }
+
     writePeerACK(peerId, streamId, salt, 4U);
     LogInfoEx(LOG_MASTER, "PEER %u RPTL ACK, challenge response sent for login", peerId);
 }
 
+/* Helper to check whether a login may be admitted under the configured login rate limit. */
+
+bool TrafficNetwork::admitLogin()
+{
+    if (m_loginRateLimit == 0U)
+        return true;
+
+    uint64_t now = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+
+    std::lock_guard<std::mutex> lock(m_loginRateLock);
+
+    // token bucket; refilled at the rate limit, holding at most one second worth of logins
+    if (m_loginTokenTime == 0U) {
+        m_loginTokens = (double)m_loginRateLimit;
+    } else {
+        m_loginTokens += ((double)(now - m_loginTokenTime) * m_loginRateLimit) / 1000.0;
+        if (m_loginTokens > (double)m_loginRateLimit)
+            m_loginTokens = (double)m_loginRateLimit;
+    }
+    m_loginTokenTime = now;
+
+    if (m_loginTokens < 1.0)
+        return false;
+
+    m_loginTokens -= 1.0;
+    return true;
+}
+
+/* Helper to resolve the password a peer authenticates with, checking the peer ACL. */
+
+bool TrafficNetwork::resolvePeerPassword(uint32_t peerId, const char* tag, std::string& password)
+{
+    password = m_password;
+
+    bool validAcl = true;
+    if (m_peerListLookup->getACL()) {
+        if (!m_peerListLookup->isPeerAllowed(peerId) && !m_peerListLookup->isPeerListEmpty()) {
+            if (tag != nullptr)
+                LogWarning(LOG_MASTER, "PEER %u %s, failed peer ACL check", peerId, tag);
+            validAcl = false;
+        } else {
+            lookups::PeerId peerEntry = m_peerListLookup->find(peerId);
+            if (peerEntry.peerDefault()) {
+                validAcl = false; // default peer IDs are a no-no as they have no data thus fail ACL check
+            } else {
+                password = peerEntry.peerPassword();
+                if (password.length() == 0) {
+                    password = m_password;
+                }
+            }
+        }
+
+        if (m_peerListLookup->isPeerListEmpty()) {
+            if (tag != nullptr)
+                LogWarning(LOG_MASTER, "Peer List ACL enabled, but we have an empty peer list? Passing all peers.");
+            validAcl = true;
+        }
+    }
+
+    return validAcl;
+}
+
+/* Helper to create a session resumption ticket for the specified peer. */
+
+bool TrafficNetwork::createResumeTicket(uint32_t peerId, const std::string& address, uint8_t* ticket)
+{
+    assert(ticket != nullptr);
+
+    std::string password;
+    if (!resolvePeerPassword(peerId, nullptr, password))
+        return false;
+
+    uint64_t now = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::system_clock::now().time_since_epoch()).count();
+    uint64_t expiry = now + (m_resumeTicketTime * 1000U);
+
+    SET_UINT32(peerId, ticket, 0U);                                                 // Peer ID
+    SET_UINT32((uint32_t)(expiry >> 32), ticket, 4U);                               // Expiry
+    SET_UINT32((uint32_t)(expiry & 0xFFFFFFFFU), ticket, 8U);
+
+    // MAC covers the peer ID, expiry, the ticket epoch and the peer IP address
+    std::vector<uint8_t> in(ticket, ticket + 12U);
+    uint8_t epoch[4U];
+    SET_UINT32(m_resumeTicketEpoch, epoch, 0U);
+    in.insert(in.end(), epoch, epoch + 4U);
+    in.insert(in.end(), address.begin(), address.end());
+
+    uint8_t mac[edac::SHA256_DIGEST_SIZE];
+    edac::SHA256::hmac((const uint8_t*)password.data(), (uint32_t)password.size(), in.data(), (uint32_t)in.size(), mac);
+    ::memcpy(ticket + 12U, mac, RESUME_TICKET_MAC_LEN);                             // MAC
+
+    return true;
+}
+
+/* Helper to validate a session resumption ticket presented by a peer with its login. */
+
+bool TrafficNetwork::validateResumeTicket(uint32_t peerId, const std::string& address, const uint8_t* ticket)
+{
+    assert(ticket != nullptr);
+
+    uint32_t ticketPeerId = GET_UINT32(ticket, 0U);
+    if (ticketPeerId != peerId) {
+        LogWarning(LOG_MASTER, "PEER %u RPTL, session resumption ticket is for another peer, performing login exchange", peerId);
+        return false;
+    }
+
+    uint64_t now = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::system_clock::now().time_since_epoch()).count();
+    uint32_t expiryHi = GET_UINT32(ticket, 4U);
+    uint32_t expiryLo = GET_UINT32(ticket, 8U);
+    uint64_t expiry = ((uint64_t)expiryHi << 32) | expiryLo;
+    if (expiry <= now || expiry > now + (m_resumeTicketTime * 1000U)) {
+        LogInfoEx(LOG_MASTER, "PEER %u RPTL, session resumption ticket expired, performing login exchange", peerId);
+        return false;
+    }
+
+    std::string password;
+    if (!resolvePeerPassword(peerId, "RPTL", password))
+        return false;
+
+    std::vector<uint8_t> in(ticket, ticket + 12U);
+    uint8_t epoch[4U];
+    SET_UINT32(m_resumeTicketEpoch, epoch, 0U);
+    in.insert(in.end(), epoch, epoch + 4U);
+    in.insert(in.end(), address.begin(), address.end());
+
+    uint8_t mac[edac::SHA256_DIGEST_SIZE];
+    edac::SHA256::hmac((const uint8_t*)password.data(), (uint32_t)password.size(), in.data(), (uint32_t)in.size(), mac);
+
+    uint8_t diff = 0U;
+    for (uint32_t i = 0U; i < RESUME_TICKET_MAC_LEN; i++)
+        diff |= mac[i] ^ ticket[12U + i];
+    if (diff != 0U) {
+        LogWarning(LOG_MASTER, "PEER %u RPTL, invalid session resumption ticket, performing login exchange", peerId);
+        return false;
+    }
+
+    // tickets are single use; a later ticket always carries a later expiry
+    std::lock_guard<std::mutex> lock(m_resumeTicketLock);
+    auto it = m_resumeTicketUsed.find(peerId);
+    if (it != m_resumeTicketUsed.end() && expiry <= it->second) {
+        LogWarning(LOG_MASTER, "PEER %u RPTL, session resumption ticket already used, performing login exchange", peerId);
+        return false;
+    }
+
+    m_resumeTicketUsed[peerId] = expiry;
+    return true;
+}
+
+/* Helper to check the proof sent with the configuration of a peer resuming a session. */
+
+bool TrafficNetwork::validateResumeProof(FNEPeerConnection* connection, json::object& config)
+{
+    assert(connection != nullptr);
+
+    // a peer that performed the login exchange has nothing to prove
+    const std::string& expected = connection->resumeProof();
+    if (expected.empty())
+        return true;
+
+    if (!config["resumeProof"].is<std::string>())
+        return false;
+
+    std::string proof = config["resumeProof"].get<std::string>();
+    if (proof.size() != expected.size())
+        return false;
+
+    uint8_t diff = 0U;
+    for (size_t i = 0U; i < expected.size(); i++)
+        diff |= (uint8_t)(proof[i] ^ expected[i]);
+
+    return diff == 0U;
+}
+
 /* Helper to process an In-Call Control message. */
 
 void TrafficNetwork::processInCallCtrl(network::NET_ICC::ENUM command, network::NET_SUBFUNC::ENUM subFunc, uint32_t dstId, 
@@ -2526,19 +3244,60 @@ void TrafficNetwork::processInCallCtrl(network::NET_ICC::ENUM command, network::
     }
 }
 
-/* Helper to send the network metadata to the specified peer in a separate thread. */
+/* Helper to schedule sending the network metadata to the specified peer in a separate thread. */
 
 void TrafficNetwork::peerMetadataUpdate(uint32_t peerId)
 {
-    MetadataUpdateRequest* req = new MetadataUpdateRequest();
-    req->obj = this;
-    req->peerId = peerId;
+    uint64_t now = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::system_clock::now().time_since_epoch()).count();
+
+    std::lock_guard<std::mutex> lock(m_metadataScheduleLock);
+
+    // an update already scheduled for this peer will send the current metadata
+    if (m_metadataSchedule.find(peerId) != m_metadataSchedule.end())
+        return;
+
+    // stagger updates, so a burst of logins doesn't push every peer's ACLs at once
+    uint64_t due = now;
+    if (m_metadataScheduleLast + m_aclPushStagger > due)
+        due = m_metadataScheduleLast + m_aclPushStagger;
+
+    m_metadataSchedule[peerId] = due;
+    m_metadataScheduleLast = due;
+}
+
+/* Helper to start any scheduled network metadata updates that are due. */
+
+void TrafficNetwork::processMetadataSchedule(uint64_t now)
+{
+    std::vector<uint32_t> due;
 
-    // enqueue the task
-    if (!m_threadPool.enqueue(new_pooltask(taskMetadataUpdate, req))) {
-        LogError(LOG_NET, "Failed to task enqueue metadata update, peerId = %u", peerId);
-        if (req != nullptr)
-            delete req;
+    // scope is intentional
+    {
+        std::lock_guard<std::mutex> lock(m_metadataScheduleLock);
+        if (m_metadataSchedule.empty())
+            return;
+
+        for (auto it = m_metadataSchedule.begin(); it != m_metadataSchedule.end(); ) {
+            if (it->second <= now) {
+                due.push_back(it->first);
+                it = m_metadataSchedule.erase(it);
+            } else {
+                ++it;
+            }
+        }
+    }
+
+    for (uint32_t peerId : due) {
+        MetadataUpdateRequest* req = new MetadataUpdateRequest();
+        req->obj = this;
+        req->peerId = peerId;
+
+        // enqueue the task
+        if (!m_metadataPool.enqueue(new_pooltask(taskMetadataUpdate, req))) {
+            LogError(LOG_NET, "Failed to task enqueue metadata update, peerId = %u", peerId);
+            if (req != nullptr)
+                delete req;
+        }
     }
 }
 
@@ -3192,6 +3951,8 @@ bool TrafficNetwork::writePeer(uint32_t peerId, uint32_t ssrc, FrameQueue::Opcod
 bool TrafficNetwork::writePeerQueue(udp::BufferQueue* buffers, uint32_t peerId, uint32_t ssrc, FrameQueue::OpcodePair opcode, 
     const uint8_t* data, uint32_t length, uint16_t pktSeq, uint32_t streamId, bool incPktSeq) const
 {
+    EventTrace::instant(TRACE_EVENT::FNE_WRITE_PEER_QUEUE, streamId, peerId, 0U, length);
+
     if (streamId == 0U) {
         LogError(LOG_NET, "BUGBUG: PEER %u, trying to send data with a streamId of 0?", peerId);
     }
@@ -3330,6 +4091,7 @@ bool TrafficNetwork::writePeerNAK(uint32_t peerId, uint32_t streamId, const char
     SET_UINT32(peerId, buffer, 6U);                                             // Peer ID
     SET_UINT16((uint16_t)reason, buffer, 10U);                                  // Reason
 
+    m_totalNAKs->inc();
     logPeerNAKReason(peerId, tag, reason);
     return writePeer(peerId, m_peerId, { NET_FUNC::NAK, NET_SUBFUNC::NOP }, buffer, 12U, RTP_END_OF_CALL_SEQ, streamId);
 }
@@ -3349,6 +4111,7 @@ bool TrafficNetwork::writePeerNAK(uint32_t peerId, const char* tag, NET_CONN_NAK
     SET_UINT32(peerId, buffer, 6U);                                             // Peer ID
     SET_UINT16((uint16_t)reason, buffer, 10U);                                  // Reason
 
+    m_totalNAKs->inc();
     logPeerNAKReason(peerId, tag, reason);
     LogWarning(LOG_MASTER, "PEER %u NAK %s -> %s:%u", peerId, tag, udp::Socket::address(addr).c_str(), udp::Socket::port(addr));
     return m_frameQueue->write(buffer, 12U, createStreamId(), peerId, m_peerId,
@@ -35,6 +35,9 @@
 #include "common/network/BaseNetwork.h"
 #include "common/network/Network.h"
 #include "common/network/PacketBuffer.h"
+#include "common/Metrics.h"
+#include "common/StateSnapshot.h"
+#include "common/Thread.h"
 #include "common/ThreadPool.h"
 #include "fne/lookups/AffiliationLookup.h"
 #include "fne/network/influxdb/InfluxDB.h"
@@ -43,10 +46,12 @@
 #include "fne/network/HAParameters.h"
 #include "fne/CryptoContainer.h"
 
+#include <atomic>
 #include <string>
 #include <cstdint>
 #include <unordered_map>
 #include <mutex>
+#include <vector>
 
 // ---------------------------------------------------------------------------
 //  Class Prototypes
@@ -129,7 +134,8 @@ namespace network
         int length = 0U;                    //!< Length of raw data buffer
         uint8_t* buffer = nullptr;          //!< Raw data buffer
 
-        uint64_t pktRxTime;                 //!< Packet receive time
+        uint64_t rxTick = 0U;               //!< Packet receive time (monotonic, us)
+        uint64_t enqueueTick = 0U;          //!< Packet enqueue time (monotonic, us)
     };
 
     // ---------------------------------------------------------------------------
@@ -228,8 +234,18 @@ namespace network
 
         /**
          * @brief Process data frames from the network.
+         *
+         *  With a single receive shard, frames are handed to the worker thread pool; with several receive
+         *  shards, each shard processes the frames it receives to completion on its own thread.
+         * @param shard Receive shard to read from (0 is the primary master socket).
+         * @returns bool True, if a frame was read, otherwise false.
          */
-        void processNetwork();
+        bool processNetwork(uint32_t shard = 0U);
+        /**
+         * @brief Gets the number of receive shards (sockets opened on the master port).
+         * @returns uint32_t Number of receive shards.
+         */
+        uint32_t getRxShardCount() const { return m_rxShardCnt; }
 
         /**
          * @brief Process network tree disconnect notification.
@@ -288,6 +304,27 @@ namespace network
          */
         void setPeerReplica(bool replica);
 
+        /**
+         * @brief Helper to set the warm restart flag. When set, peers are not sent a master disconnect
+         *  on close, so they keep their sessions across a restart of the FNE. (This must only be set
+         *  once the final state snapshot was saved.)
+         * @param warmRestart Flag indicating warm restart is enabled.
+         */
+        void setWarmRestart(bool warmRestart) { m_warmRestart = warmRestart; }
+
+        /**
+         * @brief Helper to write the peer, affiliation, spanning tree and call state to a state snapshot.
+         * @param snapshot State snapshot.
+         */
+        void writeSnapshot(StateSnapshot& snapshot);
+        /**
+         * @brief Helper to restore the peer, affiliation, spanning tree and call state from a state snapshot.
+         * @param snapshot State snapshot.
+         * @param elapsed Time elapsed (ms) since the snapshot was saved.
+         * @returns bool True, if the state was restored, otherwise false.
+         */
+        bool restoreSnapshot(StateSnapshot& snapshot, uint64_t elapsed);
+
     private:
         friend class MetadataNetwork;
         friend class callhandler::TagDMRData;
@@ -313,6 +350,7 @@ namespace network
         std::string m_password;
 
         bool m_isReplica;
+        bool m_warmRestart;
 
         bool m_dmrEnabled;
         bool m_p25Enabled;
@@ -341,8 +379,9 @@ namespace network
         concurrent::unordered_map<uint32_t, json::array> m_peerReplicaPeers;
         typedef std::pair<const uint32_t, lookups::AffiliationLookup*> PeerAffiliationMapPair;
         concurrent::unordered_map<uint32_t, fne_lookups::AffiliationLookup*> m_peerAffiliations;
+        std::atomic<uint32_t> m_peerAffiliationsVersion;
         concurrent::shared_unordered_map<uint32_t, std::vector<uint32_t>> m_ccPeerMap;
-        static std::timed_mutex s_keyQueueMutex;
+        static ProfiledMutex<std::timed_mutex> s_keyQueueMutex;
         std::unordered_map<uint32_t, uint16_t> m_peerReplicaKeyQueue;
 
         SpanningTree* m_treeRoot;
@@ -380,7 +419,7 @@ namespace network
 
         bool m_filterTerminators;
 
-        bool m_forceListUpdate;
+        std::atomic<bool> m_forceListUpdate;
 
         bool m_disallowU2U;
         std::vector<uint32_t> m_dropU2UPeerTable;
@@ -400,6 +439,63 @@ namespace network
 
         ThreadPool m_threadPool;
 
+        ThreadPool m_loginPool;
+        uint32_t m_loginRateLimit;
+        double m_loginTokens;
+        uint64_t m_loginTokenTime;
+        std::mutex m_loginRateLock;
+
+        uint32_t m_resumeTicketTime;
+        uint32_t m_resumeTicketEpoch;
+        std::unordered_map<uint32_t, uint64_t> m_resumeTicketUsed;
+        std::mutex m_resumeTicketLock;
+
+        ThreadPool m_metadataPool;
+        uint32_t m_aclPushStagger;
+        std::unordered_map<uint32_t, uint64_t> m_metadataSchedule;
+        uint64_t m_metadataScheduleLast;
+        std::mutex m_metadataScheduleLock;
+
+        /**
+         * @brief Represents an additional receive shard; a socket opened on the master port with
+         *  SO_REUSEPORT and the thread reading from it.
+         */
+        class RxShard : public Thread {
+        public:
+            /**
+             * @brief Initializes a new instance of the RxShard class.
+             * @param network Instance of the TrafficNetwork class.
+             * @param index Receive shard index.
+             * @param socket Socket opened on the master port.
+             * @param peerId Unique ID on the network.
+             * @param debug Flag indicating whether network debug is enabled.
+             */
+            RxShard(TrafficNetwork* network, uint32_t index, udp::Socket* socket, uint32_t peerId, bool debug);
+            /**
+             * @brief Finalizes a instance of the RxShard class.
+             */
+            ~RxShard() override;
+
+            /**
+             * @brief Thread entry point; reads and processes frames until stopped.
+             */
+            void entry() override;
+            /**
+             * @brief Stops the receive thread and waits for it to exit.
+             */
+            void stop();
+
+            udp::Socket* socket;
+            FrameQueue* frameQueue;
+
+        private:
+            TrafficNetwork* m_network;
+            uint32_t m_index;
+            std::atomic<bool> m_running;
+        };
+        uint32_t m_rxShardCnt;
+        std::vector<RxShard*> m_rxShards;
+
         bool m_disablePacketData;
         bool m_dumpPacketData;
         bool m_verbosePacketData;
@@ -407,9 +503,11 @@ namespace network
         uint32_t m_sndcpStartAddr;
         uint32_t m_sndcpEndAddr;
 
-        int32_t m_totalActiveCalls;
-        uint64_t m_totalCallsProcessed;
-        uint64_t m_totalCallCollisions;
+        metrics::Gauge* m_totalActiveCalls;
+        metrics::Counter* m_totalCallsProcessed;
+        metrics::Counter* m_totalCallCollisions;
+        metrics::Counter* m_totalNAKs;
+        metrics::Gauge* m_connectedPeers;
 
         bool m_logDenials;
         bool m_logUpstreamCallStartEnd;
@@ -506,8 +604,73 @@ namespace network
          * @param peerId Peer ID.
          * @param streamId Stream ID for the login sequence.
          * @param connection Instance of the FNEPeerConnection class.
+         * @param[in] resumeTicket Valid session resumption ticket presented by the peer, or nullptr. The
+         *  challenge exchange is skipped, and the peer proves it holds the ticket with its configuration.
          */
-        void setupRepeaterLogin(uint32_t peerId, uint32_t streamId, FNEPeerConnection* connection);
+        void setupRepeaterLogin(uint32_t peerId, uint32_t streamId, FNEPeerConnection* connection, const uint8_t* resumeTicket = nullptr);
+
+        /**
+         * @brief Helper to check whether a login may be admitted under the configured login rate limit.
+         * @returns bool True, if the login is admitted, otherwise false.
+         */
+        bool admitLogin();
+        /**
+         * @brief Helper to resolve the password a peer authenticates with, checking the peer ACL.
+         * @param peerId Peer ID.
+         * @param tag Tag of the message being processed (for logging), or nullptr to not log.
+         * @param[out] password Password for the peer.
+         * @returns bool True, if the peer passes the peer ACL, otherwise false.
+         */
+        bool resolvePeerPassword(uint32_t peerId, const char* tag, std::string& password);
+        /**
+         * @brief Helper to create a session resumption ticket for the specified peer.
+         * \code{.unparsed}
+         *  Below is the representation of the data layout for the session resumption ticket.
+         * 
+         *  Byte 0               1               2               3
+         *  Bit  0 1 2 3 4 5 6 7 0 1 2 3 4 5 6 7 0 1 2 3 4 5 6 7 0 1 2 3 4 5 6 7
+         *      +-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+
+         *      | Peer ID                                                       |
+         *      +-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+
+         *      | Expiry (ms since epoch)                                       |
+         *      +                                                               +
+         *      |                                                               |
+         *      +-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+
+         *      | HMAC-SHA256 (truncated to 16 bytes)                           |
+         *      +                                                               +
+         *      |                                                               |
+         *      +                                                               +
+         *      |                                                               |
+         *      +                                                               +
+         *      |                                                               |
+         *      +-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+
+         *  28 bytes
+         * 
+         *  The HMAC is keyed with the peer password, and covers the peer ID, expiry, the ticket epoch
+         *  of this FNE instance and the peer IP address.
+         * \endcode
+         * @param peerId Peer ID.
+         * @param address IP address of the peer.
+         * @param[out] ticket Buffer to write the ticket to (RESUME_TICKET_LEN bytes).
+         * @returns bool True, if the ticket was created, otherwise false.
+         */
+        bool createResumeTicket(uint32_t peerId, const std::string& address, uint8_t* ticket);
+        /**
+         * @brief Helper to validate a session resumption ticket presented by a peer with its login.
+         *  A ticket is accepted once, and only by the FNE instance that issued it.
+         * @param peerId Peer ID.
+         * @param address IP address of the peer.
+         * @param[in] ticket Ticket presented by the peer (RESUME_TICKET_LEN bytes).
+         * @returns bool True, if the ticket is valid, otherwise false.
+         */
+        bool validateResumeTicket(uint32_t peerId, const std::string& address, const uint8_t* ticket);
+        /**
+         * @brief Helper to check the proof sent with the configuration of a peer resuming a session.
+         * @param connection Instance of the FNEPeerConnection class.
+         * @param config Configuration sent by the peer.
+         * @returns bool True, if the peer is not resuming a session or sent a valid proof, otherwise false.
+         */
+        bool validateResumeProof(FNEPeerConnection* connection, json::object& config);
 
         /**
          * @brief Helper to process an In-Call Control message.
@@ -523,10 +686,16 @@ namespace network
             uint8_t slotNo, uint32_t peerId, uint32_t ssrc, uint32_t streamId);
 
         /**
-         * @brief Helper to send the network metadata to the specified peer in a separate thread.
+         * @brief Helper to schedule sending the network metadata to the specified peer in a separate thread.
+         *  Updates are staggered across peers by the configured ACL push stagger.
          * @param peerId Peer ID.
          */
         void peerMetadataUpdate(uint32_t peerId);
+        /**
+         * @brief Helper to start any scheduled network metadata updates that are due.
+         * @param now Current time (ms since epoch).
+         */
+        void processMetadataSchedule(uint64_t now);
         /**
          * @brief Entry point to send the network metadata to the specified peer in a separate thread.
          * @param req Instance of the MetadataUpdateRequest structure.
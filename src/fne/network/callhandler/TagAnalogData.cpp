@@ -11,8 +11,10 @@
 #include "common/analog/AnalogDefines.h"
 #include "common/analog/data/NetData.h"
 #include "common/Clock.h"
+#include "common/EventTrace.h"
 #include "common/Log.h"
 #include "common/Utils.h"
+#include "network/PacketLatency.h"
 #include "network/TrafficNetwork.h"
 #include "network/callhandler/TagAnalogData.h"
 #include "HostFNE.h"
@@ -45,6 +47,8 @@ TagAnalogData::TagAnalogData(TrafficNetwork* network, bool debug) :
     m_debug(debug)
 {
     assert(network != nullptr);
+
+    m_status.setLockName("TagAnalogData::m_status");
 }
 
 /* Finalizes a instance of the TagAnalogData class. */
@@ -56,6 +60,7 @@ TagAnalogData::~TagAnalogData() = default;
 bool TagAnalogData::processFrame(const uint8_t* data, uint32_t len, uint32_t peerId, uint32_t ssrc, uint16_t pktSeq, uint32_t streamId, bool fromUpstream)
 {
     hrc::hrc_t pktTime = hrc::now();
+    EventTraceScope trace(TRACE_EVENT::FNE_ANALOG_FRAME, streamId, peerId);
 
     DECLARE_UINT8_ARRAY(buffer, len);
     ::memcpy(buffer, data, len);
@@ -64,6 +69,7 @@ bool TagAnalogData::processFrame(const uint8_t* data, uint32_t len, uint32_t pee
 
     uint32_t srcId = GET_UINT24(data, 5U);
     uint32_t dstId = GET_UINT24(data, 8U);
+    trace.set(streamId, peerId, dstId);
 
     bool individual = (data[15] & 0x40U) == 0x40U;
 
@@ -128,9 +134,9 @@ bool TagAnalogData::processFrame(const uint8_t* data, uint32_t len, uint32_t pee
                     LogInfoEx(LOG_MASTER, CALL_END_LOG);
 
                 if (!tg.config().parrot()) {
-                    m_network->m_totalActiveCalls--;
-                    if (m_network->m_totalActiveCalls < 0)
-                        m_network->m_totalActiveCalls = 0;
+                    m_network->m_totalActiveCalls->dec();
+                    if (m_network->m_totalActiveCalls->value() < 0)
+                        m_network->m_totalActiveCalls->set(0);
                 }
 
                 // report call event to InfluxDB
@@ -219,7 +225,7 @@ bool TagAnalogData::processFrame(const uint8_t* data, uint32_t len, uint32_t pee
                                 LogWarning((fromUpstream) ? LOG_PEER : LOG_MASTER, "Analog, Call Collision, peer = %u, ssrc = %u, srcId = %u, dstId = %u, streamId = %u, rxPeer = %u, rxSrcId = %u, rxDstId = %u, rxStreamId = %u, fromUpstream = %u",
                                     peerId, ssrc, srcId, dstId, streamId, status.peerId, status.srcId, status.dstId, status.streamId, fromUpstream);
 
-                                m_network->m_totalCallCollisions++;
+                                m_network->m_totalCallCollisions->inc();
 
                                 return false;
                             }
@@ -275,8 +281,8 @@ bool TagAnalogData::processFrame(const uint8_t* data, uint32_t len, uint32_t pee
                 m_status.unlock();
 
                 if (!tg.config().parrot()) {
-                    m_network->m_totalCallsProcessed++;
-                    m_network->m_totalActiveCalls++;
+                    m_network->m_totalCallsProcessed->inc();
+                    m_network->m_totalActiveCalls->inc();
                 }
 
                 #define CALL_START_LOG "Analog, Call Start, peer = %u, ssrc = %u, srcId = %u, dstId = %u, streamId = %u, fromUpstream = %u", peerId, ssrc, srcId, dstId, streamId, fromUpstream
@@ -315,6 +321,8 @@ bool TagAnalogData::processFrame(const uint8_t* data, uint32_t len, uint32_t pee
         m_status[dstId].lastPacket = hrc::now();
         m_status.unlock();
 
+        PacketLatency::decision();
+
         /*
         ** MASTER TRAFFIC
         */
@@ -363,6 +371,8 @@ bool TagAnalogData::processFrame(const uint8_t* data, uint32_t len, uint32_t pee
             m_network->m_peers.shared_unlock();
         }
 
+        PacketLatency::sent();
+
         /*
         ** PEER TRAFFIC (e.g. upstream networks this FNE is peered to)
         */
@@ -433,6 +443,20 @@ void TagAnalogData::triggerCallTakeover(uint32_t dstId)
     }
 }
 
+/* Helper to write the active call status to a state snapshot. */
+
+void TagAnalogData::writeSnapshot(StateSnapshot& snapshot)
+{
+    writeStatusTable(snapshot, m_status);
+}
+
+/* Helper to restore the active call status from a state snapshot. */
+
+bool TagAnalogData::readSnapshot(StateSnapshot& snapshot, uint64_t elapsed)
+{
+    return readStatusTable(snapshot, elapsed, m_status);
+}
+
 /* Helper to playback a parrot frame to the network. */
 
 void TagAnalogData::playbackParrot()
@@ -502,6 +526,70 @@ void TagAnalogData::playbackParrot()
 //  Private Class Members
 // ---------------------------------------------------------------------------
 
+/* Helper to write a call status table to a state snapshot. */
+
+void TagAnalogData::writeStatusTable(StateSnapshot& snapshot, concurrent::unordered_map<uint32_t, RxStatus>& status)
+{
+    hrc::hrc_t now = hrc::now();
+
+    // only active calls are written
+    std::vector<std::pair<uint32_t, RxStatus>> calls;
+    status.lock(false);
+    for (auto& entry : status.get()) {
+        if (entry.second.activeCall)
+            calls.push_back(entry);
+    }
+    status.unlock();
+
+    snapshot.writeUInt32((uint32_t)calls.size());
+    for (auto& entry : calls) {
+        snapshot.writeUInt32(entry.first);
+        snapshot.writeUInt32(entry.second.srcId);
+        snapshot.writeUInt32(entry.second.dstId);
+        snapshot.writeUInt32(entry.second.streamId);
+        snapshot.writeUInt32(entry.second.peerId);
+        snapshot.writeUInt32(entry.second.ssrc);
+        snapshot.writeBool(entry.second.callTakeover);
+        snapshot.writeUInt64(hrc::diff(now, entry.second.callStartTime));
+        snapshot.writeUInt64(hrc::diff(now, entry.second.lastPacket));
+    }
+}
+
+/* Helper to restore a call status table from a state snapshot. */
+
+bool TagAnalogData::readStatusTable(StateSnapshot& snapshot, uint64_t elapsed, concurrent::unordered_map<uint32_t, RxStatus>& status)
+{
+    hrc::hrc_t now = hrc::now();
+
+    uint32_t count = 0U;
+    if (!snapshot.readUInt32(count))
+        return false;
+
+    for (uint32_t i = 0U; i < count; i++) {
+        uint32_t key = 0U;
+        uint64_t callStartAge = 0U, lastPacketAge = 0U;
+        RxStatus entry = RxStatus();
+        if (!snapshot.readUInt32(key) ||
+            !snapshot.readUInt32(entry.srcId) || !snapshot.readUInt32(entry.dstId) ||
+            !snapshot.readUInt32(entry.streamId) || !snapshot.readUInt32(entry.peerId) ||
+            !snapshot.readUInt32(entry.ssrc) ||
+            !snapshot.readBool(entry.callTakeover) || !snapshot.readUInt64(callStartAge) || !snapshot.readUInt64(lastPacketAge))
+            return false;
+
+        // calls that ended while the FNE was down are expired by the call collision timeout, as their
+        // last packet time is carried over
+        entry.activeCall = true;
+        entry.callStartTime = now - std::chrono::milliseconds(callStartAge + elapsed);
+        entry.lastPacket = now - std::chrono::milliseconds(lastPacketAge + elapsed);
+
+        status.lock(false);
+        status[key] = entry;
+        status.unlock();
+    }
+
+    return true;
+}
+
 /* Helper to route rewrite the network data buffer. */
 
 void TagAnalogData::routeRewrite(uint8_t* buffer, uint32_t peerId, uint32_t dstId, bool outbound)
@@ -551,6 +639,9 @@ bool TagAnalogData::peerRewrite(uint32_t peerId, uint32_t& dstId, bool outbound)
 
 bool TagAnalogData::isPeerPermitted(uint32_t peerId, data::NetData& data, uint32_t streamId, bool fromUpstream)
 {
+    EventTraceScope trace(TRACE_EVENT::FNE_PEER_PERMITTED, streamId, peerId, data.getDstId());
+    trace.setArg(NET_SUBFUNC::PROTOCOL_SUBFUNC_ANALOG);
+
     if (!data.getGroup()) {
         if (m_network->m_disallowU2U)
             return false;
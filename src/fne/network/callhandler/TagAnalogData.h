@@ -23,6 +23,7 @@
 #include "common/dmr/data/NetData.h"
 #include "common/dmr/lc/CSBK.h"
 #include "common/Clock.h"
+#include "common/StateSnapshot.h"
 #include "network/TrafficNetwork.h"
 #include "network/callhandler/packetdata/DMRPacketData.h"
 
@@ -69,6 +70,19 @@ namespace network
              */
             void triggerCallTakeover(uint32_t dstId);
 
+            /**
+             * @brief Helper to write the active call status to a state snapshot.
+             * @param snapshot State snapshot.
+             */
+            void writeSnapshot(StateSnapshot& snapshot);
+            /**
+             * @brief Helper to restore the active call status from a state snapshot.
+             * @param snapshot State snapshot.
+             * @param elapsed Time elapsed (ms) since the snapshot was saved.
+             * @returns bool True, if the call status was restored, otherwise false.
+             */
+            bool readSnapshot(StateSnapshot& snapshot, uint64_t elapsed);
+
             /**
              * @brief Helper to playback a parrot frame to the network.
              */
@@ -206,6 +220,21 @@ namespace network
 
             bool m_debug;
 
+            /**
+             * @brief Helper to write a call status table to a state snapshot.
+             * @param snapshot State snapshot.
+             * @param status Call status table.
+             */
+            void writeStatusTable(StateSnapshot& snapshot, concurrent::unordered_map<uint32_t, RxStatus>& status);
+            /**
+             * @brief Helper to restore a call status table from a state snapshot.
+             * @param snapshot State snapshot.
+             * @param elapsed Time elapsed (ms) since the snapshot was saved.
+             * @param status Call status table.
+             * @returns bool True, if the call status table was restored, otherwise false.
+             */
+            bool readStatusTable(StateSnapshot& snapshot, uint64_t elapsed, concurrent::unordered_map<uint32_t, RxStatus>& status);
+
             /**
              * @brief Helper to route rewrite the network data buffer.
              * @param buffer Frame buffer.
@@ -14,8 +14,10 @@
 #include "common/dmr/SlotType.h"
 #include "common/dmr/Sync.h"
 #include "common/Clock.h"
+#include "common/EventTrace.h"
 #include "common/Log.h"
 #include "common/Utils.h"
+#include "network/PacketLatency.h"
 #include "network/TrafficNetwork.h"
 #include "network/callhandler/TagDMRData.h"
 #include "HostFNE.h"
@@ -51,6 +53,8 @@ TagDMRData::TagDMRData(TrafficNetwork* network, bool debug) :
 {
     assert(network != nullptr);
 
+    m_status.setLockName("TagDMRData::m_status");
+
     m_packetData = new DMRPacketData(network, this, debug);
 }
 
@@ -66,6 +70,7 @@ TagDMRData::~TagDMRData()
 bool TagDMRData::processFrame(const uint8_t* data, uint32_t len, uint32_t peerId, uint32_t ssrc, uint16_t pktSeq, uint32_t streamId, bool fromUpstream)
 {
     hrc::hrc_t pktTime = hrc::now();
+    EventTraceScope trace(TRACE_EVENT::FNE_DMR_FRAME, streamId, peerId);
 
     DECLARE_UINT8_ARRAY(buffer, len);
     ::memcpy(buffer, data, len);
@@ -74,6 +79,7 @@ bool TagDMRData::processFrame(const uint8_t* data, uint32_t len, uint32_t peerId
 
     uint32_t srcId = GET_UINT24(data, 5U);
     uint32_t dstId = GET_UINT24(data, 8U);
+    trace.set(streamId, peerId, dstId);
 
     FLCO::E flco = (data[15U] & 0x40U) == 0x40U ? FLCO::PRIVATE : FLCO::GROUP;
 
@@ -208,9 +214,9 @@ bool TagDMRData::processFrame(const uint8_t* data, uint32_t len, uint32_t peerId
                 }
 
                 if (!tg.config().parrot()) {
-                    m_network->m_totalActiveCalls--;
-                    if (m_network->m_totalActiveCalls < 0)
-                        m_network->m_totalActiveCalls = 0;
+                    m_network->m_totalActiveCalls->dec();
+                    if (m_network->m_totalActiveCalls->value() < 0)
+                        m_network->m_totalActiveCalls->set(0);
                 }
 
                 // report call event to InfluxDB
@@ -327,7 +333,7 @@ bool TagDMRData::processFrame(const uint8_t* data, uint32_t len, uint32_t peerId
                                     LogWarning((fromUpstream) ? LOG_PEER : LOG_MASTER, "DMR, Call Collision, peer = %u, ssrc = %u, srcId = %u, dstId = %u, slotNo = %u, streamId = %u, rxPeer = %u, rxSrcId = %u, rxDstId = %u, rxSlotNo = %u, rxStreamId = %u, fromUpstream = %u",
                                         peerId, ssrc, srcId, dstId, slotNo, streamId, status.peerId, status.srcId, status.dstId, status.slotNo, status.streamId, fromUpstream);
 
-                                    m_network->m_totalCallCollisions++;
+                                    m_network->m_totalCallCollisions->inc();
 
                                     return false;
                                 }
@@ -386,8 +392,8 @@ bool TagDMRData::processFrame(const uint8_t* data, uint32_t len, uint32_t peerId
                 m_status.unlock();
 
                 if (!tg.config().parrot()) {
-                    m_network->m_totalCallsProcessed++;
-                    m_network->m_totalActiveCalls++;
+                    m_network->m_totalCallsProcessed->inc();
+                    m_network->m_totalActiveCalls->inc();
                 }
 
                 // is this a private call?
@@ -497,6 +503,8 @@ bool TagDMRData::processFrame(const uint8_t* data, uint32_t len, uint32_t peerId
             }
         }
 
+        PacketLatency::decision();
+
         /*
         ** MASTER TRAFFIC
         */
@@ -571,6 +579,8 @@ bool TagDMRData::processFrame(const uint8_t* data, uint32_t len, uint32_t peerId
             m_network->m_peers.shared_unlock();
         }
 
+        PacketLatency::sent();
+
         // if this is a private call, and we have already repeated to the connected peer that registered
         // the unit, don't repeat to any neighbor FNE peers
         if (privateCallInProgress && !noConnectedPeerRepeat) {
@@ -694,6 +704,23 @@ void TagDMRData::triggerCallTakeover(uint32_t dstId)
     }
 }
 
+/* Helper to write the active call status to a state snapshot. */
+
+void TagDMRData::writeSnapshot(StateSnapshot& snapshot)
+{
+    writeStatusTable(snapshot, m_status);
+    writeStatusTable(snapshot, m_statusPVCall);
+}
+
+/* Helper to restore the active call status from a state snapshot. */
+
+bool TagDMRData::readSnapshot(StateSnapshot& snapshot, uint64_t elapsed)
+{
+    if (!readStatusTable(snapshot, elapsed, m_status))
+        return false;
+    return readStatusTable(snapshot, elapsed, m_statusPVCall);
+}
+
 /* Helper to playback a parrot frame to the network. */
 
 void TagDMRData::playbackParrot()
@@ -800,6 +827,72 @@ void TagDMRData::write_Call_Alrt(uint32_t peerId, uint8_t slot, uint32_t srcId,
 //  Private Class Members
 // ---------------------------------------------------------------------------
 
+/* Helper to write a call status table to a state snapshot. */
+
+void TagDMRData::writeStatusTable(StateSnapshot& snapshot, concurrent::unordered_map<uint32_t, RxStatus>& status)
+{
+    hrc::hrc_t now = hrc::now();
+
+    // only active calls are written
+    std::vector<std::pair<uint32_t, RxStatus>> calls;
+    status.lock(false);
+    for (auto& entry : status.get()) {
+        if (entry.second.activeCall)
+            calls.push_back(entry);
+    }
+    status.unlock();
+
+    snapshot.writeUInt32((uint32_t)calls.size());
+    for (auto& entry : calls) {
+        snapshot.writeUInt32(entry.first);
+        snapshot.writeUInt32(entry.second.srcId);
+        snapshot.writeUInt32(entry.second.dstId);
+        snapshot.writeUInt8(entry.second.slotNo);
+        snapshot.writeUInt32(entry.second.streamId);
+        snapshot.writeUInt32(entry.second.peerId);
+        snapshot.writeUInt32(entry.second.ssrc);
+        snapshot.writeUInt32(entry.second.dstPeerId);
+        snapshot.writeBool(entry.second.callTakeover);
+        snapshot.writeUInt64(hrc::diff(now, entry.second.callStartTime));
+        snapshot.writeUInt64(hrc::diff(now, entry.second.lastPacket));
+    }
+}
+
+/* Helper to restore a call status table from a state snapshot. */
+
+bool TagDMRData::readStatusTable(StateSnapshot& snapshot, uint64_t elapsed, concurrent::unordered_map<uint32_t, RxStatus>& status)
+{
+    hrc::hrc_t now = hrc::now();
+
+    uint32_t count = 0U;
+    if (!snapshot.readUInt32(count))
+        return false;
+
+    for (uint32_t i = 0U; i < count; i++) {
+        uint32_t key = 0U;
+        uint64_t callStartAge = 0U, lastPacketAge = 0U;
+        RxStatus entry = RxStatus();
+        if (!snapshot.readUInt32(key) ||
+            !snapshot.readUInt32(entry.srcId) || !snapshot.readUInt32(entry.dstId) ||
+            !snapshot.readUInt8(entry.slotNo) || !snapshot.readUInt32(entry.streamId) || !snapshot.readUInt32(entry.peerId) ||
+            !snapshot.readUInt32(entry.ssrc) || !snapshot.readUInt32(entry.dstPeerId) ||
+            !snapshot.readBool(entry.callTakeover) || !snapshot.readUInt64(callStartAge) || !snapshot.readUInt64(lastPacketAge))
+            return false;
+
+        // calls that ended while the FNE was down are expired by the call collision timeout, as their
+        // last packet time is carried over
+        entry.activeCall = true;
+        entry.callStartTime = now - std::chrono::milliseconds(callStartAge + elapsed);
+        entry.lastPacket = now - std::chrono::milliseconds(lastPacketAge + elapsed);
+
+        status.lock(false);
+        status[key] = entry;
+        status.unlock();
+    }
+
+    return true;
+}
+
 /* Helper to route rewrite the network data buffer. */
 
 void TagDMRData::routeRewrite(uint8_t* buffer, uint32_t peerId, dmr::data::NetData& dmrData, DataType::E dataType, uint32_t dstId, uint32_t slotNo, bool outbound)
@@ -956,6 +1049,9 @@ bool TagDMRData::processCSBK(uint8_t* buffer, uint32_t peerId, dmr::data::NetDat
 
 bool TagDMRData::isPeerPermitted(uint32_t peerId, data::NetData& data, uint32_t streamId, bool fromUpstream)
 {
+    EventTraceScope trace(TRACE_EVENT::FNE_PEER_PERMITTED, streamId, peerId, data.getDstId());
+    trace.setArg(NET_SUBFUNC::PROTOCOL_SUBFUNC_DMR);
+
     // promiscuous hub mode performs no ACL checking and will pass all traffic
     if (g_promiscuousHub)
         return true;
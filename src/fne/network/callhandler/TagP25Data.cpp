@@ -12,9 +12,11 @@
 #include "common/p25/lc/tdulc/TDULCFactory.h"
 #include "common/p25/Sync.h"
 #include "common/Clock.h"
+#include "common/EventTrace.h"
 #include "common/Log.h"
 #include "common/Thread.h"
 #include "common/Utils.h"
+#include "network/PacketLatency.h"
 #include "network/TrafficNetwork.h"
 #include "network/callhandler/TagP25Data.h"
 #include "HostFNE.h"
@@ -58,6 +60,8 @@ TagP25Data::TagP25Data(TrafficNetwork* network, bool debug) :
 {
     assert(network != nullptr);
 
+    m_status.setLockName("TagP25Data::m_status");
+
     m_packetData = new P25PacketData(network, this, debug);
 }
 
@@ -73,6 +77,7 @@ TagP25Data::~TagP25Data()
 bool TagP25Data::processFrame(const uint8_t* data, uint32_t len, uint32_t peerId, uint32_t ssrc, uint16_t pktSeq, uint32_t streamId, bool fromUpstream)
 {
     hrc::hrc_t pktTime = hrc::now();
+    EventTraceScope trace(TRACE_EVENT::FNE_P25_FRAME, streamId, peerId);
 
     // P25 network frame should never be less then 24 bytes
     if (len < 24U) {
@@ -87,6 +92,7 @@ bool TagP25Data::processFrame(const uint8_t* data, uint32_t len, uint32_t peerId
 
     uint32_t srcId = GET_UINT24(data, 5U);
     uint32_t dstId = GET_UINT24(data, 8U);
+    trace.set(streamId, peerId, dstId);
 
     uint8_t controlByte = data[14U];
 
@@ -297,9 +303,9 @@ bool TagP25Data::processFrame(const uint8_t* data, uint32_t len, uint32_t peerId
                         }
 
                         if (!tg.config().parrot()) {
-                            m_network->m_totalActiveCalls--;
-                            if (m_network->m_totalActiveCalls < 0)
-                                m_network->m_totalActiveCalls = 0;
+                            m_network->m_totalActiveCalls->dec();
+                            if (m_network->m_totalActiveCalls->value() < 0)
+                                m_network->m_totalActiveCalls->set(0);
                         }
 
                         // report call event to InfluxDB
@@ -416,7 +422,7 @@ bool TagP25Data::processFrame(const uint8_t* data, uint32_t len, uint32_t peerId
                                         LogWarning((fromUpstream) ? LOG_PEER : LOG_MASTER, "P25, Call Collision, peer = %u, ssrc = %u, sysId = $%03X, netId = $%05X, srcId = %u, dstId = %u, streamId = %u, rxPeer = %u, rxSrcId = %u, rxDstId = %u, rxStreamId = %u, fromUpstream = %u",
                                             peerId, ssrc, sysId, netId, srcId, dstId, streamId, status.peerId, status.srcId, status.dstId, status.streamId, fromUpstream);
 
-                                        m_network->m_totalCallCollisions++;
+                                        m_network->m_totalCallCollisions->inc();
 
                                         return false;
                                     }
@@ -473,8 +479,8 @@ bool TagP25Data::processFrame(const uint8_t* data, uint32_t len, uint32_t peerId
                     m_status.unlock();
 
                     if (!tg.config().parrot()) {
-                        m_network->m_totalCallsProcessed++;
-                        m_network->m_totalActiveCalls++;
+                        m_network->m_totalCallsProcessed->inc();
+                        m_network->m_totalActiveCalls->inc();
                     }
 
                     // is this a private call?
@@ -596,6 +602,8 @@ bool TagP25Data::processFrame(const uint8_t* data, uint32_t len, uint32_t peerId
             }
         }
 
+        PacketLatency::decision();
+
         /*
         ** MASTER TRAFFIC
         */
@@ -675,6 +683,8 @@ bool TagP25Data::processFrame(const uint8_t* data, uint32_t len, uint32_t peerId
             m_network->m_peers.shared_unlock();
         }
 
+        PacketLatency::sent();
+
         // if this is a private call, and we have already repeated to the connected peer that registered
         // the unit, don't repeat to any neighbor FNE peers
         if (privateCallInProgress && !noConnectedPeerRepeat) {
@@ -803,6 +813,23 @@ void TagP25Data::triggerCallTakeover(uint32_t dstId)
     }
 }
 
+/* Helper to write the active call status to a state snapshot. */
+
+void TagP25Data::writeSnapshot(StateSnapshot& snapshot)
+{
+    writeStatusTable(snapshot, m_status);
+    writeStatusTable(snapshot, m_statusPVCall);
+}
+
+/* Helper to restore the active call status from a state snapshot. */
+
+bool TagP25Data::readSnapshot(StateSnapshot& snapshot, uint64_t elapsed)
+{
+    if (!readStatusTable(snapshot, elapsed, m_status))
+        return false;
+    return readStatusTable(snapshot, elapsed, m_statusPVCall);
+}
+
 /* Helper to playback a parrot frame to the network. */
 
 void TagP25Data::playbackParrot()
@@ -1031,6 +1058,71 @@ void TagP25Data::write_TSDU_U_Reg_Cmd(uint32_t peerId, uint32_t dstId)
 //  Private Class Members
 // ---------------------------------------------------------------------------
 
+/* Helper to write a call status table to a state snapshot. */
+
+void TagP25Data::writeStatusTable(StateSnapshot& snapshot, concurrent::unordered_map<uint32_t, RxStatus>& status)
+{
+    hrc::hrc_t now = hrc::now();
+
+    // only active calls are written
+    std::vector<std::pair<uint32_t, RxStatus>> calls;
+    status.lock(false);
+    for (auto& entry : status.get()) {
+        if (entry.second.activeCall)
+            calls.push_back(entry);
+    }
+    status.unlock();
+
+    snapshot.writeUInt32((uint32_t)calls.size());
+    for (auto& entry : calls) {
+        snapshot.writeUInt32(entry.first);
+        snapshot.writeUInt32(entry.second.srcId);
+        snapshot.writeUInt32(entry.second.dstId);
+        snapshot.writeUInt32(entry.second.streamId);
+        snapshot.writeUInt32(entry.second.peerId);
+        snapshot.writeUInt32(entry.second.ssrc);
+        snapshot.writeUInt32(entry.second.dstPeerId);
+        snapshot.writeBool(entry.second.callTakeover);
+        snapshot.writeUInt64(hrc::diff(now, entry.second.callStartTime));
+        snapshot.writeUInt64(hrc::diff(now, entry.second.lastPacket));
+    }
+}
+
+/* Helper to restore a call status table from a state snapshot. */
+
+bool TagP25Data::readStatusTable(StateSnapshot& snapshot, uint64_t elapsed, concurrent::unordered_map<uint32_t, RxStatus>& status)
+{
+    hrc::hrc_t now = hrc::now();
+
+    uint32_t count = 0U;
+    if (!snapshot.readUInt32(count))
+        return false;
+
+    for (uint32_t i = 0U; i < count; i++) {
+        uint32_t key = 0U;
+        uint64_t callStartAge = 0U, lastPacketAge = 0U;
+        RxStatus entry = RxStatus();
+        if (!snapshot.readUInt32(key) ||
+            !snapshot.readUInt32(entry.srcId) || !snapshot.readUInt32(entry.dstId) ||
+            !snapshot.readUInt32(entry.streamId) || !snapshot.readUInt32(entry.peerId) ||
+            !snapshot.readUInt32(entry.ssrc) || !snapshot.readUInt32(entry.dstPeerId) ||
+            !snapshot.readBool(entry.callTakeover) || !snapshot.readUInt64(callStartAge) || !snapshot.readUInt64(lastPacketAge))
+            return false;
+
+        // calls that ended while the FNE was down are expired by the call collision timeout, as their
+        // last packet time is carried over
+        entry.activeCall = true;
+        entry.callStartTime = now - std::chrono::milliseconds(callStartAge + elapsed);
+        entry.lastPacket = now - std::chrono::milliseconds(lastPacketAge + elapsed);
+
+        status.lock(false);
+        status[key] = entry;
+        status.unlock();
+    }
+
+    return true;
+}
+
 /* Helper to route rewrite the network data buffer. */
 
 void TagP25Data::routeRewrite(uint8_t* buffer, uint32_t peerId, uint8_t duid, uint32_t dstId, bool outbound)
@@ -1346,6 +1438,9 @@ bool TagP25Data::processTSDUToNeighbor(uint8_t* buffer, uint32_t srcPeerId, uint
 
 bool TagP25Data::isPeerPermitted(uint32_t peerId, lc::LC& control, DUID::E duid, uint32_t streamId, bool fromUpstream)
 {
+    EventTraceScope trace(TRACE_EVENT::FNE_PEER_PERMITTED, streamId, peerId, control.getDstId());
+    trace.setArg(NET_SUBFUNC::PROTOCOL_SUBFUNC_P25);
+
     // promiscuous hub mode performs no ACL checking and will pass all traffic
     if (g_promiscuousHub)
         return true;
@@ -18,6 +18,7 @@
 
 #include "fne/Defines.h"
 #include "common/Clock.h"
+#include "common/StateSnapshot.h"
 #include "common/concurrent/deque.h"
 #include "common/concurrent/unordered_map.h"
 #include "common/p25/P25Defines.h"
@@ -85,6 +86,19 @@ namespace network
              */
             void triggerCallTakeover(uint32_t dstId);
 
+            /**
+             * @brief Helper to write the active call status to a state snapshot.
+             * @param snapshot State snapshot.
+             */
+            void writeSnapshot(StateSnapshot& snapshot);
+            /**
+             * @brief Helper to restore the active call status from a state snapshot.
+             * @param snapshot State snapshot.
+             * @param elapsed Time elapsed (ms) since the snapshot was saved.
+             * @returns bool True, if the call status was restored, otherwise false.
+             */
+            bool readSnapshot(StateSnapshot& snapshot, uint64_t elapsed);
+
             /**
              * @brief Helper to playback a parrot frame to the network.
              */
@@ -273,6 +287,21 @@ namespace network
 
             bool m_debug;
 
+            /**
+             * @brief Helper to write a call status table to a state snapshot.
+             * @param snapshot State snapshot.
+             * @param status Call status table.
+             */
+            void writeStatusTable(StateSnapshot& snapshot, concurrent::unordered_map<uint32_t, RxStatus>& status);
+            /**
+             * @brief Helper to restore a call status table from a state snapshot.
+             * @param snapshot State snapshot.
+             * @param elapsed Time elapsed (ms) since the snapshot was saved.
+             * @param status Call status table.
+             * @returns bool True, if the call status table was restored, otherwise false.
+             */
+            bool readStatusTable(StateSnapshot& snapshot, uint64_t elapsed, concurrent::unordered_map<uint32_t, RxStatus>& status);
+
             /**
              * @brief Helper to route rewrite the network data buffer.
              * @param buffer Frame buffer.
@@ -49,6 +49,9 @@ const uint32_t INTERPACKET_DELAY = 100U; // milliseconds
 const uint32_t ARP_RETRY_MS = 5000U; // milliseconds
 const uint32_t SUBSCRIBER_READY_RETRY_MS = 1000U; // milliseconds
 
+const uint32_t MAX_LINK_QUEUE_DEPTH = 64U;
+const uint32_t MAX_ARP_PENDING_DEPTH = 128U;
+
 // ---------------------------------------------------------------------------
 //  Public Class Members
 // ---------------------------------------------------------------------------
@@ -59,12 +62,14 @@ P25PacketData::P25PacketData(TrafficNetwork* network, TagP25Data* tag, bool debu
     m_network(network),
     m_tag(tag),
     m_assembler(nullptr),
-    m_queuedFrames(),
+    m_linkLock(),
+    m_linkQueues(),
+    m_arpPending(),
+    m_arpPendingDropped(0U),
     m_status(),
+    m_arpLock(),
     m_arpTable(),
-    m_readyForNextPkt(),
-    m_suSendSeq(),
-    m_suRecvSeq(),
+    m_sequence(),
     m_debug(debug)
 {
     assert(network != nullptr);
@@ -96,6 +101,16 @@ P25PacketData::~P25PacketData()
 {
     if (m_assembler != nullptr)
         delete m_assembler;
+
+    for (auto& entry : m_linkQueues) {
+        for (QueuedDataFrame* frame : entry.second.frames)
+            releaseFrame(frame);
+    }
+    m_linkQueues.clear();
+
+    for (QueuedDataFrame* frame : m_arpPending)
+        releaseFrame(frame);
+    m_arpPending.clear();
 }
 
 /* Process a data frame from the network. */
@@ -206,7 +221,7 @@ bool P25PacketData::processFrame(const uint8_t* data, uint32_t len, uint32_t pee
                     status->hasRxHeader = true;
                     status->llId = status->assembler.dataHeader.getLLId();
 
-                    m_readyForNextPkt[status->llId] = true;
+                    setLinkReady(status->llId);
 
                     // is this a response header?
                     if (status->assembler.dataHeader.getFormat() == PDUFormatType::RSP) {
@@ -404,7 +419,7 @@ void P25PacketData::processPacketFrame(const uint8_t* data, uint32_t len, bool a
     ::memcpy(qf->userData, pduUserData, pduLength);
     qf->userDataLen = pduLength;
 
-    m_queuedFrames.push_back(qf);
+    enqueueFrame(qf);
 #endif // !defined(_WIN32)
 }
 
@@ -467,89 +482,116 @@ void P25PacketData::clock(uint32_t ms)
 #if !defined(_WIN32)
     uint64_t now = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::system_clock::now().time_since_epoch()).count();
 
-    if (m_queuedFrames.size() == 0U) {
-        return;
-    }
+    uint8_t window = m_network->m_host->m_vtunPduWindow;
+    std::vector<QueuedDataFrame*> ready;
 
-    // transmit queued data frames
-    bool processed = false;
+    // scope is intentional
+    {
+        std::lock_guard<std::mutex> lock(m_linkLock);
 
-    auto& frame = m_queuedFrames[0];
-    if (frame != nullptr) {
-        if (now > frame->timestamp) {
-            processed = true;
+        // resolve data frames awaiting ARP
+        size_t pending = m_arpPending.size();
+        for (size_t i = 0U; i < pending; i++) {
+            QueuedDataFrame* frame = m_arpPending.front();
+            m_arpPending.pop_front();
 
-            if (frame->retryCnt >= MAX_PKT_RETRY_CNT && !frame->extendRetry) {
-                LogWarning(LOG_P25, P25_PDU_STR ", max packet retry count exceeded, dropping packet, dstIp = %s", __IP_FROM_UINT(frame->tgtProtoAddr).c_str());
-                goto pkt_clock_abort;
+            if (now <= frame->timestamp) {
+                m_arpPending.push_back(frame);
+                continue;
             }
 
-            if (frame->retryCnt >= (MAX_PKT_RETRY_CNT * 2U) && frame->extendRetry) {
-                LogWarning(LOG_P25, P25_PDU_STR ", max packet retry count exceeded, dropping packet, dstIp = %s", __IP_FROM_UINT(frame->tgtProtoAddr).c_str());
-                m_readyForNextPkt[frame->llId] = true; // force ready for next packet
-                goto pkt_clock_abort;
+            std::string tgtIpStr = __IP_FROM_UINT(frame->tgtProtoAddr);
+
+            frame->llId = getLLIdAddress(frame->tgtProtoAddr);
+            if (frame->llId == 0U) {
+                if (frame->retryCnt >= MAX_PKT_RETRY_CNT) {
+                    LogWarning(LOG_P25, P25_PDU_STR ", max packet retry count exceeded, dropping packet, dstIp = %s", tgtIpStr.c_str());
+                    releaseFrame(frame);
+                    continue;
+                }
+
+                LogWarning(LOG_P25, P25_PDU_STR ", no ARP entry for, dstIp = %s", tgtIpStr.c_str());
+                write_PDU_ARP(frame->tgtProtoAddr);
+
+                frame->timestamp = now + ARP_RETRY_MS;
+                frame->retryCnt++;
+                m_arpPending.push_back(frame);
+                continue;
             }
 
-            std::string tgtIpStr = __IP_FROM_UINT(frame->tgtProtoAddr);
+            frame->header->setLLId(frame->llId);
+            frame->retryCnt = 0U;
 
-            // extract protocol for logging
-            uint8_t proto = 0x00;
-            if (frame->userDataLen >= 20) {
-                struct ip* ipHeader = (struct ip*)(frame->userData);
-                proto = ipHeader->ip_p;
+            LinkQueue& queue = m_linkQueues[frame->llId];
+            if (queue.frames.size() >= MAX_LINK_QUEUE_DEPTH) {
+                LogWarning(LOG_P25, P25_PDU_STR ", send queue full, dropping packet, dstIp = %s (%u)", tgtIpStr.c_str(), frame->llId);
+                queue.dropped++;
+                releaseFrame(frame);
+                continue;
             }
 
-            LogInfoEx(LOG_P25, "VTUN -> PDU IP Data (queued), dstIp = %s (%u), userDataLen = %u, proto = %02X%s, retries = %u", 
-                tgtIpStr.c_str(), frame->llId, frame->userDataLen, proto, (proto == 0x01) ? " (ICMP)" : "", frame->retryCnt);
+            queue.frames.push_back(frame);
+            if (queue.frames.size() > queue.maxDepth)
+                queue.maxDepth = (uint32_t)queue.frames.size();
+        }
 
-            // do we have a valid target address?
-            if (frame->llId == 0U) {
-                frame->llId = getLLIdAddress(frame->tgtProtoAddr);
-                if (frame->llId == 0U) {
-                    LogWarning(LOG_P25, P25_PDU_STR ", no ARP entry for, dstIp = %s", tgtIpStr.c_str());
-                    write_PDU_ARP(frame->tgtProtoAddr);
+        // service each logical link's send queue independently; a subscriber that has not yet responded
+        // only holds back its own queue
+        for (auto& entry : m_linkQueues) {
+            uint32_t llId = entry.first;
+            LinkQueue& queue = entry.second;
 
-                    processed = false;
-                    frame->timestamp = now + ARP_RETRY_MS;
-                    frame->retryCnt++;
-                    goto pkt_clock_abort;
-                }
-                else {
-                    frame->header->setLLId(frame->llId);
-                }
-            }
+            while (!queue.frames.empty()) {
+                QueuedDataFrame* frame = queue.frames.front();
+                if (now <= frame->timestamp)
+                    break;
+
+                std::string tgtIpStr = __IP_FROM_UINT(frame->tgtProtoAddr);
 
-            // is the SU ready for the next packet?
-            auto ready = std::find_if(m_readyForNextPkt.begin(), m_readyForNextPkt.end(), [=](ReadyForNextPktPair x) { return x.first == frame->llId; });
-            if (ready != m_readyForNextPkt.end()) {
-                if (!ready->second) {
-                    LogWarning(LOG_P25, P25_PDU_STR ", subscriber not ready, dstIp = %s (%u), proto = %02X%s, will retry in %ums", 
-                        tgtIpStr.c_str(), frame->llId, proto, (proto == 0x01) ? " (ICMP)" : "", SUBSCRIBER_READY_RETRY_MS);
-                    processed = false;
+                // is the SU ready for the next packet?
+                if (queue.outstanding >= window) {
+                    if (frame->retryCnt >= (MAX_PKT_RETRY_CNT * 2U)) {
+                        LogWarning(LOG_P25, P25_PDU_STR ", max packet retry count exceeded, dropping packet, dstIp = %s", tgtIpStr.c_str());
+                        queue.frames.pop_front();
+                        queue.dropped++;
+                        queue.outstanding = 0U; // force ready for next packet
+                        releaseFrame(frame);
+                        continue;
+                    }
+
+                    LogWarning(LOG_P25, P25_PDU_STR ", subscriber not ready, dstIp = %s (%u), will retry in %ums", 
+                        tgtIpStr.c_str(), llId, SUBSCRIBER_READY_RETRY_MS);
                     frame->timestamp = now + SUBSCRIBER_READY_RETRY_MS;
-                    frame->extendRetry = true;
                     frame->retryCnt++;
-                    goto pkt_clock_abort;
+                    queue.retries++;
+                    break;
                 }
-            }
 
-            m_readyForNextPkt[frame->llId] = false;
-            //LogDebugEx(LOG_P25, "P25PacketData::clock()", "dispatching queued PDU to llId %u (proto = %02X)", frame->llId, proto);
-            dispatchUserFrameToFNE(*frame->header, false, false, frame->userData);
+                queue.frames.pop_front();
+                queue.outstanding++;
+                queue.txFrames++;
+                queue.txBytes += frame->userDataLen;
+                queue.lastTx = now;
+
+                ready.push_back(frame);
+            }
         }
     }
 
-pkt_clock_abort:
-    m_queuedFrames.pop_front();
-    if (processed) {
-        if (frame->userData != nullptr)
-            delete[] frame->userData;
-        if (frame->header != nullptr)
-            delete frame->header;
-        delete frame;
-    } else {
-        // requeue packet
-        m_queuedFrames.push_back(frame);
+    // transmit outside of the link lock
+    for (QueuedDataFrame* frame : ready) {
+        // extract protocol for logging
+        uint8_t proto = 0x00;
+        if (frame->userDataLen >= 20) {
+            struct ip* ipHeader = (struct ip*)(frame->userData);
+            proto = ipHeader->ip_p;
+        }
+
+        LogInfoEx(LOG_P25, "VTUN -> PDU IP Data (queued), dstIp = %s (%u), userDataLen = %u, proto = %02X%s, retries = %u", 
+            __IP_FROM_UINT(frame->tgtProtoAddr).c_str(), frame->llId, frame->userDataLen, proto, (proto == 0x01) ? " (ICMP)" : "", frame->retryCnt);
+
+        dispatchUserFrameToFNE(*frame->header, false, false, frame->userData);
+        releaseFrame(frame);
     }
 #endif // !defined(_WIN32)
 }
@@ -586,6 +628,53 @@ void P25PacketData::cleanupStale()
     }
 }
 
+/* Helper to get the send queue state and statistics of each logical link. */
+
+json::array P25PacketData::getLinkStats()
+{
+    json::array links = json::array();
+
+    std::lock_guard<std::mutex> lock(m_linkLock);
+    for (auto& entry : m_linkQueues) {
+        const LinkQueue& queue = entry.second;
+
+        json::object link = json::object();
+        uint32_t llId = entry.first;
+        link["llId"].set<uint32_t>(llId);
+        uint32_t depth = (uint32_t)queue.frames.size();
+        link["depth"].set<uint32_t>(depth);
+        uint32_t maxDepth = queue.maxDepth;
+        link["maxDepth"].set<uint32_t>(maxDepth);
+        uint8_t outstanding = queue.outstanding;
+        link["outstanding"].set<uint8_t>(outstanding);
+        uint64_t txFrames = queue.txFrames;
+        link["txFrames"].set<uint64_t>(txFrames);
+        uint64_t txBytes = queue.txBytes;
+        link["txBytes"].set<uint64_t>(txBytes);
+        uint64_t retries = queue.retries;
+        link["retries"].set<uint64_t>(retries);
+        uint64_t dropped = queue.dropped;
+        link["dropped"].set<uint64_t>(dropped);
+        uint64_t lastTx = queue.lastTx;
+        link["lastTx"].set<uint64_t>(lastTx);
+
+        links.push_back(json::value(link));
+    }
+
+    uint32_t pending = (uint32_t)m_arpPending.size();
+    if (pending > 0U || m_arpPendingDropped > 0U) {
+        json::object link = json::object();
+        uint32_t llId = 0U;
+        link["llId"].set<uint32_t>(llId);
+        link["depth"].set<uint32_t>(pending);
+        uint64_t dropped = m_arpPendingDropped;
+        link["dropped"].set<uint64_t>(dropped);
+        links.push_back(json::value(link));
+    }
+
+    return links;
+}
+
 // ---------------------------------------------------------------------------
 //  Private Class Members
 // ---------------------------------------------------------------------------
@@ -606,8 +695,8 @@ void P25PacketData::dispatch(uint32_t peerId)
                 peerId, status->assembler.dataHeader.getFormat(), status->assembler.dataHeader.getResponseClass(), status->assembler.dataHeader.getResponseType(), status->assembler.dataHeader.getResponseStatus(),
                 status->assembler.dataHeader.getLLId(), status->assembler.dataHeader.getSrcLLId());
 
-        // bryanb: this is naive and possibly error prone
-        m_readyForNextPkt[status->assembler.dataHeader.getSrcLLId()] = true;
+        // release the confirmed delivery window slot for the responding SU
+        linkResponse(status->assembler.dataHeader.getSrcLLId());
 
         if (status->assembler.dataHeader.getResponseClass() == PDUAckClass::ACK && status->assembler.dataHeader.getResponseType() == PDUAckType::ACK) {
             LogInfoEx(LOG_P25, P25_PDU_STR ", ISP, response, OSP ACK, peer = %u, llId = %u, all blocks received OK, n = %u",
@@ -643,7 +732,7 @@ void P25PacketData::dispatch(uint32_t peerId)
     }
 
     if (status->assembler.dataHeader.getFormat() == PDUFormatType::UNCONFIRMED) {
-        m_readyForNextPkt[status->assembler.dataHeader.getSrcLLId()] = true;
+        setLinkReady(status->assembler.dataHeader.getSrcLLId());
     }
 
     uint8_t sap = (status->assembler.getExtendedAddress()) ? status->assembler.dataHeader.getEXSAP() : status->assembler.dataHeader.getSAP();
@@ -689,17 +778,8 @@ void P25PacketData::dispatch(uint32_t peerId)
             if (fneIPv4 == srcProtoAddr) {
                 LogWarning(LOG_P25, P25_PDU_STR ", ARP reply, %u is trying to masquerade as us...", srcHWAddr);
             } else {
-                m_arpTable[srcHWAddr] = srcProtoAddr;
-
-                // is the SU ready for the next packet?
-                auto ready = std::find_if(m_readyForNextPkt.begin(), m_readyForNextPkt.end(), [=](ReadyForNextPktPair x) { return x.first == srcHWAddr; });
-                if (ready != m_readyForNextPkt.end()) {
-                    if (!ready->second) {
-                        m_readyForNextPkt[srcHWAddr] = true;
-                    }
-                } else {
-                    m_readyForNextPkt[srcHWAddr] = true;
-                }
+                setARPEntry(srcHWAddr, srcProtoAddr);
+                setLinkReady(srcHWAddr);
             }
         }
 #else
@@ -763,17 +843,15 @@ void P25PacketData::dispatch(uint32_t peerId)
             handled = true;
 
             // is the source SU one we have proper ARP entries for?
-            auto arpEntry = std::find_if(m_arpTable.begin(), m_arpTable.end(), [=](ArpTablePair x) { return x.first == status->assembler.dataHeader.getSrcLLId(); });
-            if (arpEntry == m_arpTable.end()) {
+            if (!hasARPEntry(status->assembler.dataHeader.getSrcLLId())) {
                 uint32_t srcProtoAddr = Utils::reverseEndian(ipHeader->ip_src.s_addr);
                 LogInfoEx(LOG_P25, P25_PDU_STR ", adding ARP entry, %s is at %u", __IP_FROM_UINT(srcProtoAddr).c_str(), status->assembler.dataHeader.getSrcLLId());
-                m_arpTable[status->assembler.dataHeader.getSrcLLId()] = Utils::reverseEndian(ipHeader->ip_src.s_addr);
+                setARPEntry(status->assembler.dataHeader.getSrcLLId(), srcProtoAddr);
             }
         }
 
         // is the target SU one we have proper ARP entries for?
-        auto arpEntry = std::find_if(m_arpTable.begin(), m_arpTable.end(), [=](ArpTablePair x) { return x.first == status->assembler.dataHeader.getLLId(); });
-        if (arpEntry != m_arpTable.end()) {
+        if (hasARPEntry(status->assembler.dataHeader.getLLId())) {
             LogInfoEx(LOG_P25, "PDU -> VTUN, IP Data, repeated to CAI, destination IP has a CAI ARP table entry, dstIp = %s (%u)", 
                 dstIp, status->assembler.dataHeader.getLLId());
 
@@ -782,11 +860,10 @@ void P25PacketData::dispatch(uint32_t peerId)
             handled = true;
 
             // is the source SU one we have proper ARP entries for?
-            auto arpEntry = std::find_if(m_arpTable.begin(), m_arpTable.end(), [=](ArpTablePair x) { return x.first == status->assembler.dataHeader.getSrcLLId(); });
-            if (arpEntry == m_arpTable.end()) {
+            if (!hasARPEntry(status->assembler.dataHeader.getSrcLLId())) {
                 uint32_t srcProtoAddr = Utils::reverseEndian(ipHeader->ip_src.s_addr);
                 LogInfoEx(LOG_P25, P25_PDU_STR ", adding ARP entry, %s is at %u", __IP_FROM_UINT(srcProtoAddr).c_str(), status->assembler.dataHeader.getSrcLLId());
-                m_arpTable[status->assembler.dataHeader.getSrcLLId()] = Utils::reverseEndian(ipHeader->ip_src.s_addr);
+                setARPEntry(status->assembler.dataHeader.getSrcLLId(), srcProtoAddr);
             }
         }
 
@@ -794,31 +871,10 @@ void P25PacketData::dispatch(uint32_t peerId)
         uint8_t receivedNs = status->assembler.dataHeader.getNs();
         bool synchronize = status->assembler.dataHeader.getSynchronize();
 
-        // Initialize V(R) if first packet from this LLId
-        auto recvSeqIt = m_suRecvSeq.find(srcLlId);
-        if (recvSeqIt == m_suRecvSeq.end()) {
-            m_suRecvSeq[srcLlId] = 0U;
-        }
-
-        uint8_t expectedNs = m_suRecvSeq[srcLlId];
-        bool sequenceValid = false;
-
-        // handle synchronize flag - resets receive window per TIA-102
-        if (synchronize) {
-            //LogDebugEx(LOG_P25, "P25PacketData::dispatch()", "synchronize flag set by llId %u, resetting V(R) from %u to %u", 
-            //    srcLlId, expectedNs, (receivedNs + 1) % 8);
-            m_suRecvSeq[srcLlId] = (receivedNs + 1) % 8;
-            sequenceValid = true;
-        }
-        else if (receivedNs == expectedNs || receivedNs == (expectedNs + 1) % 8) {
-            // accept if N(S) == V(R) or V(R)+1 (allows one-ahead windowing)
-            m_suRecvSeq[srcLlId] = (receivedNs + 1) % 8;
-            sequenceValid = true;
-            //LogDebugEx(LOG_P25, "P25PacketData::dispatch()", "sequence valid, llId %u, N(S) = %u, V(R) now = %u", 
-            //    srcLlId, receivedNs, m_suRecvSeq[srcLlId]);
-        }
-        else {
-            // out of sequence - send NACK_OUT_OF_SEQ
+        uint8_t expectedNs = 0U;
+        if (!m_sequence.receive(srcLlId, receivedNs, synchronize, expectedNs)) {
+            // out of sequence - send NACK_OUT_OF_SEQ (the sequence state is not locked here, the NACK takes
+            // the next N(S))
             LogWarning(LOG_P25, P25_PDU_STR ", NACK_OUT_OF_SEQ, llId %u, expected N(S) %u or %u, received N(S) = %u", 
                 srcLlId, expectedNs, (expectedNs + 1) % 8, receivedNs);
             if (status->assembler.getExtendedAddress()) {
@@ -829,10 +885,6 @@ void P25PacketData::dispatch(uint32_t peerId)
             break; // don't process out-of-sequence packet
         }
 
-        if (!sequenceValid) {
-            break; // should never reach here due to logic above, but safety check
-        }
-
         // transmit packet to IP network
         LogInfoEx(LOG_P25, "PDU -> VTUN, IP Data, srcIp = %s (%u), dstIp = %s (%u), pktLen = %u, proto = %02X%s", 
             srcIp, srcLlId, dstIp, dstLlId, pktLen, proto, (proto == 0x01) ? " (ICMP)" : "");
@@ -850,10 +902,10 @@ void P25PacketData::dispatch(uint32_t peerId)
         if (!handled) {
             //LogDebugEx(LOG_P25, "P25PacketData::dispatch()", "marking llId %u ready for next packet (proto = %02X)", srcLlId, proto);
             if (status->assembler.getExtendedAddress()) {
-                m_readyForNextPkt[srcLlId] = true;
+                setLinkReady(srcLlId);
                 write_PDU_Ack_Response(PDUAckClass::ACK, PDUAckType::ACK, receivedNs, srcLlId, true, dstLlId);
             } else {
-                m_readyForNextPkt[srcLlId] = true;
+                setLinkReady(srcLlId);
                 write_PDU_Ack_Response(PDUAckClass::ACK, PDUAckType::ACK, receivedNs, srcLlId, false);
             }
         }
@@ -956,14 +1008,10 @@ void P25PacketData::dispatchUserFrameToFNE(p25::data::DataHeader& dataHeader, bo
     uint32_t dstId = dataHeader.getLLId();
 
     // update the sequence number
-    m_suSendSeq[srcId]++;
-    if (m_suSendSeq[srcId] >= 8U)
-    {
-        m_suSendSeq[srcId] = 0U;
+    bool synchronize = false;
+    dataHeader.setNs(m_sequence.nextSend(srcId, synchronize));
+    if (synchronize)
         dataHeader.setSynchronize(true);
-    }
-
-    dataHeader.setNs(m_suSendSeq[srcId]);
 
     /*
     ** MASTER TRAFFIC
@@ -998,7 +1046,7 @@ bool P25PacketData::processConvDataReg(RxStatus* status)
         }
 
         LogInfoEx(LOG_P25, P25_PDU_STR ", CONNECT (Registration Request Connect), llId = %u, ipAddr = %s", llId, __IP_FROM_UINT(ipAddr).c_str());
-        m_arpTable[llId] = ipAddr; // update ARP table
+        setARPEntry(llId, ipAddr); // update ARP table
     }
     break;
     case PDURegType::DISCONNECT:
@@ -1007,7 +1055,8 @@ bool P25PacketData::processConvDataReg(RxStatus* status)
 
         LogInfoEx(LOG_P25, P25_PDU_STR ", DISCONNECT (Registration Request Disconnect), llId = %u", llId);
 
-        m_arpTable.erase(llId);
+        removeARPEntry(llId);
+        removeLink(llId);
     }
     break;
     default:
@@ -1127,8 +1176,8 @@ bool P25PacketData::processSNDCPControl(RxStatus* status)
                     rspHeader.setBlocksToFollow(1U);
                     rspHeader.calculateLength(13U);
 
-                    m_arpTable[llId] = staticIP;
-                    m_readyForNextPkt[llId] = true;
+                    setARPEntry(llId, staticIP);
+                    setLinkReady(llId);
 
                     dispatchUserFrameToFNE(rspHeader, false, false, txPduUserData);
 
@@ -1192,8 +1241,8 @@ bool P25PacketData::processSNDCPControl(RxStatus* status)
                     rspHeader.setBlocksToFollow(1U);
                     rspHeader.calculateLength(13U);
 
-                    m_arpTable[llId] = dynamicIP;
-                    m_readyForNextPkt[llId] = true;
+                    setARPEntry(llId, dynamicIP);
+                    setLinkReady(llId);
 
                     dispatchUserFrameToFNE(rspHeader, false, false, txPduUserData);
 
@@ -1238,8 +1287,8 @@ bool P25PacketData::processSNDCPControl(RxStatus* status)
             LogInfoEx(LOG_P25, P25_PDU_STR ", SNDCP context deactivation request, llId = %u, deactType = %02X", llId,
                 isp->getDeactType());
 
-            m_arpTable.erase(llId);
-            m_readyForNextPkt.erase(llId);
+            removeARPEntry(llId);
+            removeLink(llId);
 
             // send ACK response
             write_PDU_Ack_Response(PDUAckClass::ACK, PDUAckType::ACK, 
@@ -1413,17 +1462,13 @@ bool P25PacketData::hasARPEntry(uint32_t llId) const
     }
 
     // lookup ARP table entry
-    try {
-        uint32_t addr = m_arpTable.at(llId);
-        if (addr != 0U) {
-            return true;
-        }
-        else {
-            return false;
-        }
-    } catch (...) {
-        return false;
+    std::lock_guard<std::mutex> lock(m_arpLock);
+    auto it = m_arpTable.find(llId);
+    if (it != m_arpTable.end()) {
+        return it->second != 0U;
     }
+
+    return false;
 }
 
 /* Helper to get the IP address for the given logical link ID. */
@@ -1435,6 +1480,7 @@ uint32_t P25PacketData::getIPAddress(uint32_t llId)
     }
 
     if (hasARPEntry(llId)) {
+        std::lock_guard<std::mutex> lock(m_arpLock);
         return m_arpTable[llId];
     } else {
         // do we have a static entry for this LLID?
@@ -1460,9 +1506,12 @@ uint32_t P25PacketData::getLLIdAddress(uint32_t addr)
     }
 
     // lookup ARP table entry
-    for (auto entry : m_arpTable) {
-        if (entry.second == addr) {
-            return entry.first;
+    {
+        std::lock_guard<std::mutex> lock(m_arpLock);
+        for (auto entry : m_arpTable) {
+            if (entry.second == addr) {
+                return entry.first;
+            }
         }
     }
 
@@ -1502,8 +1551,11 @@ uint32_t P25PacketData::allocateIPAddress(uint32_t llId)
 
     // build set of already-allocated IPs to ensure uniqueness
     std::unordered_set<uint32_t> allocatedIPs;
-    for (const auto& entry : m_arpTable) {
-        allocatedIPs.insert(entry.second);
+    {
+        std::lock_guard<std::mutex> lock(m_arpLock);
+        for (const auto& entry : m_arpTable) {
+            allocatedIPs.insert(entry.second);
+        }
     }
 
     // find next available IP not already in use
@@ -1537,9 +1589,115 @@ uint32_t P25PacketData::allocateIPAddress(uint32_t llId)
         nextIP = m_network->m_sndcpStartAddr;
     }
 
-    m_arpTable[llId] = allocatedIP;
+    setARPEntry(llId, allocatedIP);
     LogInfoEx(LOG_P25, P25_PDU_STR ", SNDCP allocated dynamic IP %s to llId = %u (pool: %s - %s)", 
         __IP_FROM_UINT(allocatedIP).c_str(), llId, __IP_FROM_UINT(m_network->m_sndcpStartAddr).c_str(), __IP_FROM_UINT(m_network->m_sndcpEndAddr).c_str());
 
     return allocatedIP;
 }
+
+/* Helper to add or update an ARP table entry. */
+
+void P25PacketData::setARPEntry(uint32_t llId, uint32_t addr)
+{
+    std::lock_guard<std::mutex> lock(m_arpLock);
+    m_arpTable[llId] = addr;
+}
+
+/* Helper to remove an ARP table entry. */
+
+void P25PacketData::removeARPEntry(uint32_t llId)
+{
+    std::lock_guard<std::mutex> lock(m_arpLock);
+    m_arpTable.erase(llId);
+}
+
+/* Helper to place a data frame on the send queue of its logical link. */
+
+void P25PacketData::enqueueFrame(QueuedDataFrame* frame)
+{
+    std::lock_guard<std::mutex> lock(m_linkLock);
+
+    // frames with no resolved logical link wait on ARP
+    if (frame->llId == 0U) {
+        if (m_arpPending.size() >= MAX_ARP_PENDING_DEPTH) {
+            LogWarning(LOG_P25, P25_PDU_STR ", ARP pending queue full, dropping packet, dstIp = %s", 
+                __IP_FROM_UINT(frame->tgtProtoAddr).c_str());
+            m_arpPendingDropped++;
+            releaseFrame(frame);
+            return;
+        }
+
+        m_arpPending.push_back(frame);
+        return;
+    }
+
+    LinkQueue& queue = m_linkQueues[frame->llId];
+    if (queue.frames.size() >= MAX_LINK_QUEUE_DEPTH) {
+        LogWarning(LOG_P25, P25_PDU_STR ", send queue full, dropping packet, dstIp = %s (%u)", 
+            __IP_FROM_UINT(frame->tgtProtoAddr).c_str(), frame->llId);
+        queue.dropped++;
+        releaseFrame(frame);
+        return;
+    }
+
+    queue.frames.push_back(frame);
+    if (queue.frames.size() > queue.maxDepth)
+        queue.maxDepth = (uint32_t)queue.frames.size();
+}
+
+/* Helper to mark a logical link as ready for the next data frame. */
+
+void P25PacketData::setLinkReady(uint32_t llId)
+{
+    if (llId == 0U)
+        return;
+
+    std::lock_guard<std::mutex> lock(m_linkLock);
+    auto it = m_linkQueues.find(llId);
+    if (it != m_linkQueues.end())
+        it->second.outstanding = 0U;
+}
+
+/* Helper to release one outstanding data frame slot of a logical link. */
+
+void P25PacketData::linkResponse(uint32_t llId)
+{
+    if (llId == 0U)
+        return;
+
+    std::lock_guard<std::mutex> lock(m_linkLock);
+    auto it = m_linkQueues.find(llId);
+    if (it != m_linkQueues.end() && it->second.outstanding > 0U)
+        it->second.outstanding--;
+}
+
+/* Helper to remove a logical link and drop any data frames queued for it. */
+
+void P25PacketData::removeLink(uint32_t llId)
+{
+    m_sequence.remove(llId);
+
+    std::lock_guard<std::mutex> lock(m_linkLock);
+    auto it = m_linkQueues.find(llId);
+    if (it == m_linkQueues.end())
+        return;
+
+    for (QueuedDataFrame* frame : it->second.frames)
+        releaseFrame(frame);
+    m_linkQueues.erase(it);
+}
+
+/* Helper to release a queued data frame. */
+
+void P25PacketData::releaseFrame(QueuedDataFrame* frame)
+{
+    if (frame == nullptr)
+        return;
+
+    if (frame->header != nullptr)
+        delete frame->header;
+    if (frame->userData != nullptr)
+        delete[] frame->userData;
+    delete frame;
+}
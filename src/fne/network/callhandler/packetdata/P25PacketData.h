@@ -24,11 +24,13 @@
 #include "common/p25/data/Assembler.h"
 #include "common/p25/data/DataHeader.h"
 #include "common/p25/data/DataBlock.h"
+#include "common/p25/data/LinkSequence.h"
 #include "network/TrafficNetwork.h"
 #include "network/PeerNetwork.h"
 #include "network/callhandler/TagP25Data.h"
 
 #include <deque>
+#include <mutex>
 
 namespace network
 {
@@ -110,6 +112,12 @@ namespace network
                  */
                 void cleanupStale();
 
+                /**
+                 * @brief Helper to get the send queue state and statistics of each logical link.
+                 * @returns json::array JSON array of logical link send queue states.
+                 */
+                json::array getLinkStats();
+
             private:
                 TrafficNetwork* m_network;
                 TagP25Data* m_tag;
@@ -146,7 +154,39 @@ namespace network
                     uint8_t retryCnt;               //!< Packet Retry Counter
                     bool extendRetry;               //!< Flag indicating whether or not to extend the retry count for this packet.
                 };
-                concurrent::deque<QueuedDataFrame*> m_queuedFrames;
+
+                /**
+                 * @brief Represents the outbound send queue of a logical link.
+                 */
+                class LinkQueue {
+                public:
+                    std::deque<QueuedDataFrame*> frames;        //!< Queued data frames
+                    uint8_t outstanding;                        //!< Number of confirmed data frames sent and not yet responded to
+
+                    uint64_t txFrames;                          //!< Number of data frames sent
+                    uint64_t txBytes;                           //!< Number of user data bytes sent
+                    uint64_t retries;                           //!< Number of data frame send retries
+                    uint64_t dropped;                           //!< Number of data frames dropped
+                    uint32_t maxDepth;                          //!< Maximum queue depth
+                    uint64_t lastTx;                            //!< Timestamp of the last data frame sent
+
+                    LinkQueue() :
+                        frames(),
+                        outstanding(0U),
+                        txFrames(0U),
+                        txBytes(0U),
+                        retries(0U),
+                        dropped(0U),
+                        maxDepth(0U),
+                        lastTx(0U)
+                    {
+                        /* stub */
+                    }
+                };
+                std::mutex m_linkLock;
+                std::unordered_map<uint32_t, LinkQueue> m_linkQueues;  // send queue per LLId
+                std::deque<QueuedDataFrame*> m_arpPending;              // data frames awaiting ARP resolution
+                uint64_t m_arpPendingDropped;                           // data frames dropped while awaiting ARP resolution
 
                 /**
                  * @brief Represents the receive status of a call.
@@ -221,12 +261,9 @@ namespace network
                 typedef std::pair<const uint32_t, RxStatus*> StatusMapPair;
                 concurrent::unordered_map<uint32_t, RxStatus*> m_status;
 
-                typedef std::pair<const uint32_t, uint32_t> ArpTablePair;
+                mutable std::mutex m_arpLock;
                 std::unordered_map<uint32_t, uint32_t> m_arpTable;
-                typedef std::pair<const uint32_t, bool> ReadyForNextPktPair;
-                std::unordered_map<uint32_t, bool> m_readyForNextPkt;
-                std::unordered_map<uint32_t, uint8_t> m_suSendSeq;      // V(S) send state variable per LLId
-                std::unordered_map<uint32_t, uint8_t> m_suRecvSeq;      // V(R) receive state variable per LLId
+                p25::data::LinkSequence m_sequence;
 
                 bool m_debug;
 
@@ -310,6 +347,45 @@ namespace network
                  * @returns bool True, if the logical link ID has an arp entry, otherwise false.
                  */
                 bool hasARPEntry(uint32_t llId) const;
+                /**
+                 * @brief Helper to add or update the ARP entry for the given logical link ID.
+                 * @param llId Logical Link ID.
+                 * @param addr IP Address.
+                 */
+                void setARPEntry(uint32_t llId, uint32_t addr);
+                /**
+                 * @brief Helper to remove the ARP entry for the given logical link ID.
+                 * @param llId Logical Link ID.
+                 */
+                void removeARPEntry(uint32_t llId);
+
+                /**
+                 * @brief Helper to queue a data frame for transmission to its logical link.
+                 * @param frame Queued data frame.
+                 */
+                void enqueueFrame(QueuedDataFrame* frame);
+                /**
+                 * @brief Helper to mark the logical link ready for the next data frame (clears all outstanding
+                 *  data frames).
+                 * @param llId Logical Link ID.
+                 */
+                void setLinkReady(uint32_t llId);
+                /**
+                 * @brief Helper to record a response from the logical link (releases one outstanding data frame
+                 *  from the confirmed delivery window).
+                 * @param llId Logical Link ID.
+                 */
+                void linkResponse(uint32_t llId);
+                /**
+                 * @brief Helper to remove the send queue of the given logical link, dropping any queued data frames.
+                 * @param llId Logical Link ID.
+                 */
+                void removeLink(uint32_t llId);
+                /**
+                 * @brief Helper to release a queued data frame.
+                 * @param frame Queued data frame.
+                 */
+                static void releaseFrame(QueuedDataFrame* frame);
                 /**
                  * @brief Helper to get the IP address for the given logical link ID.
                  * @param llId Logical Link Address.
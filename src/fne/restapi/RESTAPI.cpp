@@ -11,11 +11,17 @@
 #include "fne/Defines.h"
 #include "common/edac/SHA256.h"
 #include "common/json/json.h"
+#include "common/json/writer.h"
 #include "common/lookups/AffiliationLookup.h"
+#include "common/EventTrace.h"
+#include "common/LockProfiler.h"
 #include "common/Log.h"
+#include "common/Metrics.h"
+#include "common/ThreadPolicy.h"
 #include "common/Utils.h"
 #include "fne/network/callhandler/TagDMRData.h"
 #include "fne/network/callhandler/TagP25Data.h"
+#include "fne/network/PacketLatency.h"
 #include "fne/network/SpanningTree.h"
 #include "fne/restapi/RESTAPI.h"
 #include "HostFNE.h"
@@ -30,9 +36,12 @@ using namespace lookups;
 #include <cassert>
 #include <cstring>
 
+#include <map>
 #include <memory>
+#include <mutex>
 #include <stdexcept>
 #include <unordered_map>
+#include <vector>
 
 // ---------------------------------------------------------------------------
 //  Macros
@@ -125,10 +134,95 @@ bool parseRequestBody(const HTTPPayload& request, HTTPPayload& reply, json::obje
         return false;
     }
 
-    obj = v.get<json::object>();
+    obj.swap(v.get<json::object>());
     return true;
 }
 
+/**
+ * @brief Helper to fetch a unsigned integer query string parameter.
+ * @param query Query string parameters.
+ * @param name Parameter name.
+ * @param defValue Default value if the parameter is not present.
+ * @returns uint32_t Parameter value.
+ */
+uint32_t queryUInt(const std::map<std::string, std::string>& query, const std::string& name, uint32_t defValue)
+{
+    auto it = query.find(name);
+    if (it == query.end() || it->second.empty())
+        return defValue;
+
+    return (uint32_t)::strtoul(it->second.c_str(), nullptr, 10);
+}
+
+/**
+ * @brief Helper to fetch a tri-state boolean query string parameter.
+ * @param query Query string parameters.
+ * @param name Parameter name.
+ * @returns int -1 if the parameter is not present, 0 if false, 1 if true.
+ */
+int queryBool(const std::map<std::string, std::string>& query, const std::string& name)
+{
+    auto it = query.find(name);
+    if (it == query.end() || it->second.empty())
+        return -1;
+
+    std::string value = ::strtolower(it->second);
+    return (value == "true" || value == "1") ? 1 : 0;
+}
+
+/**
+ * @brief Helper to check if a string begins with the given prefix.
+ * @param str String to check.
+ * @param prefix Prefix.
+ * @returns bool True, if the string begins with the prefix, otherwise false.
+ */
+bool startsWith(const std::string& str, const std::string& prefix)
+{
+    return str.size() >= prefix.size() && str.compare(0U, prefix.size(), prefix) == 0;
+}
+
+/**
+ * @brief Helper to handle a conditional GET request. The entity tag is always attached to the reply; if the
+ *  request If-None-Match header matches the entity tag, a 304 Not Modified reply is generated.
+ * @param request HTTP request.
+ * @param reply HTTP reply.
+ * @param etag Entity tag of the current representation.
+ * @returns bool True, if a 304 Not Modified reply was generated, otherwise false.
+ */
+bool checkNotModified(const HTTPPayload& request, HTTPPayload& reply, const std::string& etag)
+{
+    reply.headers.add("ETag", etag);
+
+    std::string ifNoneMatch = request.headers.find("If-None-Match");
+    if (ifNoneMatch.empty())
+        return false;
+
+    // the header may carry a list of (possibly weak) entity tags
+    size_t start = 0U;
+    while (start < ifNoneMatch.size()) {
+        size_t end = ifNoneMatch.find(',', start);
+        if (end == std::string::npos)
+            end = ifNoneMatch.size();
+
+        std::string tag = ifNoneMatch.substr(start, end - start);
+        tag.erase(0U, tag.find_first_not_of(' '));
+        tag.erase(tag.find_last_not_of(' ') + 1U);
+        if (startsWith(tag, "W/"))
+            tag.erase(0U, 2U);
+
+        if (tag == etag || tag == "*") {
+            reply.status = HTTPPayload::NOT_MODIFIED;
+            reply.content.clear();
+            reply.headers.add("Content-Length", "0");
+            return true;
+        }
+
+        start = end + 1U;
+    }
+
+    return false;
+}
+
 /**
  * @brief Helper to convert a TalkgroupRuleGroupVoice to JSON.
  * @param groupVoice Instance of TalkgroupRuleGroupVoice to convert to JSON.
@@ -497,6 +591,7 @@ RESTAPI::RESTAPI(const std::string& address, uint16_t port, const std::string& p
     m_enableSSL(enableSSL),
 #endif // ENABLE_SSL
     m_random(),
+    m_etagSeed(0U),
     m_password(password),
     m_passwordHash(nullptr),
     m_debug(debug),
@@ -507,7 +602,8 @@ RESTAPI::RESTAPI(const std::string& address, uint16_t port, const std::string& p
     m_peerListLookup(nullptr),
     m_adjSiteMapLookup(nullptr),
     m_cryptoLookup(nullptr),
-    m_authTokens()
+    m_authTokens(),
+    m_authLock()
 {
     assert(!address.empty());
     assert(port > 0U);
@@ -543,6 +639,10 @@ RESTAPI::RESTAPI(const std::string& address, uint16_t port, const std::string& p
     std::random_device rd;
     std::mt19937 mt(rd());
     m_random = mt;
+
+    // seed entity tags per instance; table versions restart at zero when the FNE restarts
+    std::uniform_int_distribution<uint32_t> dist(DVM_RAND_MIN, DVM_RAND_MAX);
+    m_etagSeed = dist(m_random);
 }
 
 /* Finalizes a instance of the RESTAPI class. */
@@ -574,6 +674,16 @@ void RESTAPI::setNetwork(network::TrafficNetwork* network)
     m_network = network;
 }
 
+/* Sets the number of REST API worker threads. */
+
+void RESTAPI::setWorkers(uint32_t workers, uint32_t blockingWorkers)
+{
+#if defined(ENABLE_SSL)
+    m_restSecureServer.setWorkers(workers, blockingWorkers);
+#endif // ENABLE_SSL
+    m_restServer.setWorkers(workers, blockingWorkers);
+}
+
 /* Opens connection to the network. */
 
 bool RESTAPI::open()
@@ -633,53 +743,65 @@ void RESTAPI::entry()
 
 void RESTAPI::initializeEndpoints()
 {
+    // NOTE: endpoints that walk or (re)load entire tables, or write tables to disk, are marked blocking
+    //  so they are run on the blocking worker threads and do not stall other requests
+
     m_dispatcher.match(PUT_AUTHENTICATE).put(REST_API_BIND(RESTAPI::restAPI_PutAuth, this));
 
     m_dispatcher.match(GET_VERSION).get(REST_API_BIND(RESTAPI::restAPI_GetVersion, this));
     m_dispatcher.match(GET_STATUS).get(REST_API_BIND(RESTAPI::restAPI_GetStatus, this));
+    m_dispatcher.match(GET_THREADS).get(REST_API_BIND(RESTAPI::restAPI_GetThreads, this));
+    m_dispatcher.match(GET_METRICS).get(REST_API_BIND(RESTAPI::restAPI_GetMetrics, this));
+    m_dispatcher.match(GET_TRACE).get(REST_API_BIND(RESTAPI::restAPI_GetTrace, this));
+    m_dispatcher.match(PUT_TRACE).put(REST_API_BIND(RESTAPI::restAPI_PutTrace, this));
 
     m_dispatcher.match(FNE_GET_PEER_QUERY).get(REST_API_BIND(RESTAPI::restAPI_GetPeerQuery, this));
     m_dispatcher.match(FNE_GET_PEER_COUNT).get(REST_API_BIND(RESTAPI::restAPI_GetPeerCount, this));
     m_dispatcher.match(FNE_PUT_PEER_RESET).put(REST_API_BIND(RESTAPI::restAPI_PutPeerReset, this));
     m_dispatcher.match(FNE_PUT_PEER_RESET_CONN).put(REST_API_BIND(RESTAPI::restAPI_PutPeerResetConn, this));
 
-    m_dispatcher.match(FNE_GET_RID_QUERY).get(REST_API_BIND(RESTAPI::restAPI_GetRIDQuery, this));
+    m_dispatcher.match(FNE_GET_RID_QUERY).blocking().get(REST_API_BIND(RESTAPI::restAPI_GetRIDQuery, this));
     m_dispatcher.match(FNE_PUT_RID_ADD).put(REST_API_BIND(RESTAPI::restAPI_PutRIDAdd, this));
     m_dispatcher.match(FNE_PUT_RID_DELETE).put(REST_API_BIND(RESTAPI::restAPI_PutRIDDelete, this));
-    m_dispatcher.match(FNE_GET_RID_COMMIT).get(REST_API_BIND(RESTAPI::restAPI_GetRIDCommit, this));
+    m_dispatcher.match(FNE_GET_RID_COMMIT).blocking().get(REST_API_BIND(RESTAPI::restAPI_GetRIDCommit, this));
 
-    m_dispatcher.match(FNE_GET_TGID_QUERY).get(REST_API_BIND(RESTAPI::restAPI_GetTGQuery, this));
+    m_dispatcher.match(FNE_GET_TGID_QUERY).blocking().get(REST_API_BIND(RESTAPI::restAPI_GetTGQuery, this));
     m_dispatcher.match(FNE_PUT_TGID_ADD).put(REST_API_BIND(RESTAPI::restAPI_PutTGAdd, this));
     m_dispatcher.match(FNE_PUT_TGID_DELETE).put(REST_API_BIND(RESTAPI::restAPI_PutTGDelete, this));
-    m_dispatcher.match(FNE_GET_TGID_COMMIT).get(REST_API_BIND(RESTAPI::restAPI_GetTGCommit, this));
+    m_dispatcher.match(FNE_GET_TGID_COMMIT).blocking().get(REST_API_BIND(RESTAPI::restAPI_GetTGCommit, this));
 
-    m_dispatcher.match(FNE_GET_PEER_LIST).get(REST_API_BIND(RESTAPI::restAPI_GetPeerList, this));
+    m_dispatcher.match(FNE_GET_PEER_LIST).blocking().get(REST_API_BIND(RESTAPI::restAPI_GetPeerList, this));
     m_dispatcher.match(FNE_PUT_PEER_ADD).put(REST_API_BIND(RESTAPI::restAPI_PutPeerAdd, this));
     m_dispatcher.match(FNE_PUT_PEER_DELETE).put(REST_API_BIND(RESTAPI::restAPI_PutPeerDelete, this));
-    m_dispatcher.match(FNE_GET_PEER_COMMIT).get(REST_API_BIND(RESTAPI::restAPI_GetPeerCommit, this));
+    m_dispatcher.match(FNE_GET_PEER_COMMIT).blocking().get(REST_API_BIND(RESTAPI::restAPI_GetPeerCommit, this));
     m_dispatcher.match(FNE_PUT_PEER_NAK_PEERID).put(REST_API_BIND(RESTAPI::restAPI_PutPeerNAKByPeerId, this));
     m_dispatcher.match(FNE_PUT_PEER_NAK_ADDRESS).put(REST_API_BIND(RESTAPI::restAPI_PutPeerNAKByAddress, this));
 
     m_dispatcher.match(FNE_GET_ADJ_MAP_LIST).get(REST_API_BIND(RESTAPI::restAPI_GetAdjMapList, this));
     m_dispatcher.match(FNE_PUT_ADJ_MAP_ADD).put(REST_API_BIND(RESTAPI::restAPI_PutAdjMapAdd, this));
     m_dispatcher.match(FNE_PUT_ADJ_MAP_DELETE).put(REST_API_BIND(RESTAPI::restAPI_PutAdjMapDelete, this));
-    m_dispatcher.match(FNE_GET_ADJ_MAP_COMMIT).get(REST_API_BIND(RESTAPI::restAPI_GetAdjMapCommit, this));
+    m_dispatcher.match(FNE_GET_ADJ_MAP_COMMIT).blocking().get(REST_API_BIND(RESTAPI::restAPI_GetAdjMapCommit, this));
 
     m_dispatcher.match(FNE_GET_FORCE_UPDATE).get(REST_API_BIND(RESTAPI::restAPI_GetForceUpdate, this));
 
-    m_dispatcher.match(FNE_GET_RELOAD_TGS).get(REST_API_BIND(RESTAPI::restAPI_GetReloadTGs, this));
-    m_dispatcher.match(FNE_GET_RELOAD_RIDS).get(REST_API_BIND(RESTAPI::restAPI_GetReloadRIDs, this));
-    m_dispatcher.match(FNE_GET_RELOAD_PEERLIST).get(REST_API_BIND(RESTAPI::restAPI_GetReloadPeerList, this));
-    m_dispatcher.match(FNE_GET_RELOAD_CRYPTO).get(REST_API_BIND(RESTAPI::restAPI_GetReloadCrypto, this));
+    m_dispatcher.match(FNE_GET_RELOAD_TGS).blocking().get(REST_API_BIND(RESTAPI::restAPI_GetReloadTGs, this));
+    m_dispatcher.match(FNE_GET_RELOAD_RIDS).blocking().get(REST_API_BIND(RESTAPI::restAPI_GetReloadRIDs, this));
+    m_dispatcher.match(FNE_GET_RELOAD_PEERLIST).blocking().get(REST_API_BIND(RESTAPI::restAPI_GetReloadPeerList, this));
+    m_dispatcher.match(FNE_GET_RELOAD_CRYPTO).blocking().get(REST_API_BIND(RESTAPI::restAPI_GetReloadCrypto, this));
 
     m_dispatcher.match(FNE_GET_STATS).get(REST_API_BIND(RESTAPI::restAPI_GetStats, this));
+    m_dispatcher.match(FNE_GET_LATENCY).get(REST_API_BIND(RESTAPI::restAPI_GetLatency, this));
+    m_dispatcher.match(FNE_GET_LOCKS).get(REST_API_BIND(RESTAPI::restAPI_GetLocks, this));
+    m_dispatcher.match(FNE_PUT_LOCKS).put(REST_API_BIND(RESTAPI::restAPI_PutLocks, this));
     m_dispatcher.match(FNE_GET_RESET_TOTAL_CALLS).get(REST_API_BIND(RESTAPI::restAPI_GetResetTotalCalls, this));
     m_dispatcher.match(FNE_GET_RESET_ACTIVE_CALLS).get(REST_API_BIND(RESTAPI::restAPI_GetResetActiveCalls, this));
     m_dispatcher.match(FNE_GET_RESET_CALL_COLLISIONS).get(REST_API_BIND(RESTAPI::restAPI_GetResetCallCollisions, this));
-    m_dispatcher.match(FNE_GET_AFF_LIST).get(REST_API_BIND(RESTAPI::restAPI_GetAffList, this));
+    m_dispatcher.match(FNE_GET_AFF_LIST).blocking().get(REST_API_BIND(RESTAPI::restAPI_GetAffList, this));
 
     m_dispatcher.match(FNE_GET_SPANNING_TREE).get(REST_API_BIND(RESTAPI::restAPI_GetSpanningTree, this));
 
+    m_dispatcher.match(FNE_GET_VTUN_LINKS).get(REST_API_BIND(RESTAPI::restAPI_GetVTUNLinks, this));
+
     /*
     ** Digital Mobile Radio
     */
@@ -697,6 +819,7 @@ void RESTAPI::initializeEndpoints()
 
 void RESTAPI::invalidateHostToken(const std::string host)
 {
+    std::lock_guard<std::mutex> lock(m_authLock);
     auto token = std::find_if(m_authTokens.begin(), m_authTokens.end(), [&](const AuthTokenValueType& tok) { return tok.first == host; });
     if (token != m_authTokens.end()) {
         m_authTokens.erase(host);
@@ -717,6 +840,7 @@ bool RESTAPI::validateAuth(const HTTPPayload& request, HTTPPayload& reply)
         return false;
     }
 
+    std::lock_guard<std::mutex> lock(m_authLock);
     for (auto& token : m_authTokens) {
 #if DEBUG_HTTP_PAYLOAD
         ::LogDebugEx(LOG_REST, "RESTAPI::validateAuth()", "valid list, host = %s, token = %s", token.first.c_str(), std::to_string(token.second).c_str());
@@ -741,6 +865,15 @@ bool RESTAPI::validateAuth(const HTTPPayload& request, HTTPPayload& reply)
     return false;
 }
 
+/* Helper to generate a entity tag for the given table version. */
+
+std::string RESTAPI::makeETag(uint32_t version) const
+{
+    char etag[24U];
+    ::snprintf(etag, sizeof(etag), "\"%08X-%u\"", m_etagSeed, version);
+    return std::string(etag);
+}
+
 /* REST API endpoint; implements authentication request. */
 
 void RESTAPI::restAPI_PutAuth(const HTTPPayload& request, HTTPPayload& reply, const RequestMatch& match)
@@ -809,10 +942,16 @@ void RESTAPI::restAPI_PutAuth(const HTTPPayload& request, HTTPPayload& reply, co
     delete[] passwordHash;
 
     invalidateHostToken(host);
-    std::uniform_int_distribution<uint64_t> dist(DVM_RAND_MIN, DVM_REST_RAND_MAX);
-    uint64_t salt = dist(m_random);
 
-    m_authTokens[host] = salt;
+    uint64_t salt = 0U;
+    {
+        std::lock_guard<std::mutex> lock(m_authLock);
+        std::uniform_int_distribution<uint64_t> dist(DVM_RAND_MIN, DVM_REST_RAND_MAX);
+        salt = dist(m_random);
+
+        m_authTokens[host] = salt;
+    }
+
     response["token"].set<std::string>(std::to_string(salt));
     reply.payload(response);
 }
@@ -859,6 +998,78 @@ void RESTAPI::restAPI_GetStatus(const HTTPPayload& request, HTTPPayload& reply,
     reply.payload(response);
 }
 
+/* REST API endpoint; implements get thread scheduling policy request. */
+
+void RESTAPI::restAPI_GetThreads(const HTTPPayload& request, HTTPPayload& reply, const RequestMatch& match)
+{
+    if (!validateAuth(request, reply)) {
+        return;
+    }
+
+    json::object response = ThreadPolicy::status();
+    setResponseDefaultStatus(response);
+
+    reply.payload(response);
+}
+
+/* REST API endpoint; implements get metrics request. */
+
+void RESTAPI::restAPI_GetMetrics(const HTTPPayload& request, HTTPPayload& reply, const RequestMatch& match)
+{
+    // metrics are intentionally not authenticated, scrapers cannot perform the authentication exchange
+    std::string content = metrics::Registry::expose();
+    reply.payload(content, HTTPPayload::OK, metrics::CONTENT_TYPE);
+}
+
+/* REST API endpoint; implements get event trace request. */
+
+void RESTAPI::restAPI_GetTrace(const HTTPPayload& request, HTTPPayload& reply, const RequestMatch& match)
+{
+    if (!validateAuth(request, reply)) {
+        return;
+    }
+
+    std::string content = EventTrace::chromeTrace();
+    reply.payload(content, HTTPPayload::OK, "application/json");
+}
+
+/* REST API endpoint; implements put event trace request. */
+
+void RESTAPI::restAPI_PutTrace(const HTTPPayload& request, HTTPPayload& reply, const RequestMatch& match)
+{
+    if (!validateAuth(request, reply)) {
+        return;
+    }
+
+    json::object req = json::object();
+    if (!parseRequestBody(request, reply, req)) {
+        return;
+    }
+
+    errorPayload(reply, "OK", HTTPPayload::OK);
+
+    if (req.find("enable") != req.end()) {
+        if (!req["enable"].is<bool>()) {
+            errorPayload(reply, "enable was not a valid boolean");
+            return;
+        }
+
+        bool enable = req["enable"].get<bool>();
+        LogInfoEx(LOG_REST, "Event tracing %s", enable ? "enabled" : "disabled");
+        EventTrace::setEnabled(enable);
+    }
+
+    if (req.find("clear") != req.end()) {
+        if (!req["clear"].is<bool>()) {
+            errorPayload(reply, "clear was not a valid boolean");
+            return;
+        }
+
+        if (req["clear"].get<bool>())
+            EventTrace::clear();
+    }
+}
+
 /* REST API endpoint; implements get peer query request. */
 
 void RESTAPI::restAPI_GetPeerQuery(const HTTPPayload& request, HTTPPayload& reply, const RequestMatch& match)
@@ -867,13 +1078,15 @@ void RESTAPI::restAPI_GetPeerQuery(const HTTPPayload& request, HTTPPayload& repl
         return;
     }
 
-    json::object response = json::object();
-    setResponseDefaultStatus(response);
+    json::writer writer;
+    writer.beginObject();
+    writer.member("status", (int)HTTPPayload::OK);
 
-    json::array peers = json::array();
+    writer.key("peers").beginArray();
     if (m_network != nullptr) {
         if (m_network->m_peers.size() > 0) {
-            for (auto entry : m_network->m_peers) {
+            m_network->m_peers.shared_lock();
+            for (auto& entry : m_network->m_peers) {
                 uint32_t peerId = entry.first;
                 network::FNEPeerConnection* peer = entry.second;
                 if (peer != nullptr) {
@@ -882,9 +1095,10 @@ void RESTAPI::restAPI_GetPeerQuery(const HTTPPayload& request, HTTPPayload& repl
                     }
 
                     json::object peerObj = m_network->fneConnObject(peerId, peer);
-                    peers.push_back(json::value(peerObj));
+                    writer.write(peerObj);
                 }
             }
+            m_network->m_peers.shared_unlock();
         }
         else {
             LogError(LOG_REST, "peer query failed, no peers connected to this FNE");
@@ -892,24 +1106,26 @@ void RESTAPI::restAPI_GetPeerQuery(const HTTPPayload& request, HTTPPayload& repl
 
         // report any peers from replica peers
         if (m_network->m_peerReplicaPeers.size() > 0) {
-            for (auto entry : m_network->m_peerReplicaPeers) {
-                json::array peerObjs = entry.second;
+            m_network->m_peerReplicaPeers.lock(false);
+            for (auto& entry : m_network->m_peerReplicaPeers) {
                 if (entry.second.size() > 0) {
-                    for (auto linkEntry : entry.second) {
+                    for (auto& linkEntry : entry.second) {
                         if (linkEntry.is<json::object>()) {
-                            peers.push_back(json::value(linkEntry));
+                            writer.write(linkEntry);
                         }
                     }
                 }
             }
+            m_network->m_peerReplicaPeers.unlock();
         }
     }
     else {
         LogError(LOG_REST, "peer query failed, network not set up, no peers to return");
     }
+    writer.endArray();
 
-    response["peers"].set<json::array>(peers);
-    reply.payload(response);
+    writer.endObject();
+    reply.payload(writer);
 }
 
 /* REST API endpoint; implements get peer count request. */
@@ -1005,29 +1221,54 @@ void RESTAPI::restAPI_GetRIDQuery(const HTTPPayload& request, HTTPPayload& reply
         return;
     }
 
-    json::object response = json::object();
-    setResponseDefaultStatus(response);
-
-    json::array rids = json::array();
-    if (m_ridLookup != nullptr) {
-        if (m_ridLookup->table().size() > 0) {
-            for (auto entry : m_ridLookup->table()) {
-                json::object ridObj = json::object();
-
-                uint32_t rid = entry.first;
-                ridObj["id"].set<uint32_t>(rid);
-                bool enabled = entry.second.radioEnabled();
-                ridObj["enabled"].set<bool>(enabled);
-                std::string alias = entry.second.radioAlias();
-                ridObj["alias"].set<std::string>(alias);
-
-                rids.push_back(json::value(ridObj));
-            }
-        }
+    uint32_t version = (m_ridLookup != nullptr) ? m_ridLookup->tableVersion() : 0U;
+    if (checkNotModified(request, reply, makeETag(version))) {
+        return;
     }
 
-    response["rids"].set<json::array>(rids);
-    reply.payload(response);
+    // parse filter and paging parameters
+    std::map<std::string, std::string> query = request.query();
+    uint32_t start = queryUInt(query, "start", 0U);
+    uint32_t end = queryUInt(query, "end", UINT32_MAX);
+    int enabled = queryBool(query, "enabled");
+    std::string alias = (query.find("alias") != query.end()) ? query["alias"] : "";
+    uint32_t limit = queryUInt(query, "limit", 0U);
+    uint32_t cursor = queryUInt(query, "cursor", 0U);
+
+    uint32_t matched = 0U, nextCursor = 0U;
+    std::vector<std::pair<uint32_t, RadioId>> rids;
+    if (m_ridLookup != nullptr) {
+        rids = m_ridLookup->page(cursor, limit, [&](uint32_t id, const RadioId& rid) {
+            if (id < start || id > end)
+                return false;
+            if (enabled != -1 && rid.radioEnabled() != (enabled == 1))
+                return false;
+            if (!alias.empty() && !startsWith(rid.radioAlias(), alias))
+                return false;
+            return true;
+        }, matched, nextCursor);
+    }
+
+    // stream the response directly, this table can be very large
+    json::writer writer(rids.size() * 48U);
+    writer.beginObject();
+    writer.member("status", (int)HTTPPayload::OK);
+    writer.member("version", version);
+    writer.member("total", matched);
+    writer.member("nextCursor", nextCursor);
+
+    writer.key("rids").beginArray();
+    for (auto& entry : rids) {
+        writer.beginObject();
+        writer.member("id", entry.first);
+        writer.member("enabled", entry.second.radioEnabled());
+        writer.member("alias", entry.second.radioAlias());
+        writer.endObject();
+    }
+    writer.endArray();
+
+    writer.endObject();
+    reply.payload(writer);
 }
 
 /* REST API endpoint; implements put radio ID add request. */
@@ -1139,21 +1380,72 @@ void RESTAPI::restAPI_GetTGQuery(const HTTPPayload& request, HTTPPayload& reply,
         return;
     }
 
-    json::object response = json::object();
-    setResponseDefaultStatus(response);
+    uint32_t version = (m_tidLookup != nullptr) ? m_tidLookup->tableVersion() : 0U;
+    if (checkNotModified(request, reply, makeETag(version))) {
+        return;
+    }
 
-    json::array tgs = json::array();
+    // parse filter and paging parameters
+    std::map<std::string, std::string> query = request.query();
+    uint32_t start = queryUInt(query, "start", 0U);
+    uint32_t end = queryUInt(query, "end", UINT32_MAX);
+    int active = queryBool(query, "active");
+    std::string name = (query.find("name") != query.end()) ? query["name"] : "";
+    uint32_t limit = queryUInt(query, "limit", 0U);
+    uint32_t cursor = queryUInt(query, "cursor", 0U);
+
+    std::vector<TalkgroupRuleGroupVoice> tgs;
+    uint32_t matched = 0U, nextCursor = 0U;
     if (m_tidLookup != nullptr) {
-        if (m_tidLookup->groupVoice().size() > 0) {
-            for (auto entry : m_tidLookup->groupVoice()) {
-                json::object tg = tgToJson(entry);
-                tgs.push_back(json::value(tg));
-            }
+        for (auto& entry : m_tidLookup->groupVoice()) {
+            uint32_t tgId = entry.source().tgId();
+            if (tgId < start || tgId > end)
+                continue;
+            if (active != -1 && entry.config().active() != (active == 1))
+                continue;
+            if (!name.empty() && !startsWith(entry.name(), name))
+                continue;
+
+            matched++;
+            if (tgId > cursor)
+                tgs.push_back(entry);
         }
     }
 
-    response["tgs"].set<json::array>(tgs);
-    reply.payload(response);
+    std::sort(tgs.begin(), tgs.end(), [](const TalkgroupRuleGroupVoice& a, const TalkgroupRuleGroupVoice& b) {
+        if (a.source().tgId() == b.source().tgId())
+            return a.source().tgSlot() < b.source().tgSlot();
+        return a.source().tgId() < b.source().tgId();
+    });
+
+    if (limit > 0U && tgs.size() > limit) {
+        // never split the slots of the same talkgroup across pages
+        size_t count = limit;
+        while (count < tgs.size() && tgs[count].source().tgId() == tgs[count - 1U].source().tgId())
+            count++;
+
+        if (count < tgs.size()) {
+            tgs.resize(count);
+            nextCursor = tgs.back().source().tgId();
+        }
+    }
+
+    json::writer writer;
+    writer.beginObject();
+    writer.member("status", (int)HTTPPayload::OK);
+    writer.member("version", version);
+    writer.member("total", matched);
+    writer.member("nextCursor", nextCursor);
+
+    writer.key("tgs").beginArray();
+    for (auto& entry : tgs) {
+        json::object tg = tgToJson(entry);
+        writer.write(tg);
+    }
+    writer.endArray();
+
+    writer.endObject();
+    reply.payload(writer);
 }
 
 /* REST API endpoint; implements put talkgroup ID add request. */
@@ -1275,36 +1567,54 @@ void RESTAPI::restAPI_GetPeerList(const HTTPPayload& request, HTTPPayload& reply
         return;
     }
 
-    json::object response = json::object();
-    setResponseDefaultStatus(response);
-
-    json::array peers = json::array();
-    if (m_peerListLookup != nullptr) {
-        if (m_peerListLookup->table().size() > 0) {
-            for (auto entry : m_peerListLookup->table()) {
-                json::object peerObj = json::object();
-
-                uint32_t peerId = entry.first;
-                std::string peerAlias = entry.second.peerAlias();
-                bool peerPassword = !entry.second.peerPassword().empty();   // True if password is not empty, otherwise false
-                bool peerReplica = entry.second.peerReplica();
-                bool canRequestKeys = entry.second.canRequestKeys();
-                bool canIssueInhibit = entry.second.canIssueInhibit();
-                bool hasCallPriority = entry.second.hasCallPriority();
-                peerObj["peerId"].set<uint32_t>(peerId);
-                peerObj["peerAlias"].set<std::string>(peerAlias);
-                peerObj["peerPassword"].set<bool>(peerPassword);
-                peerObj["peerReplica"].set<bool>(peerReplica);
-                peerObj["canRequestKeys"].set<bool>(canRequestKeys);
-                peerObj["canIssueInhibit"].set<bool>(canIssueInhibit);
-                peerObj["hasCallPriority"].set<bool>(hasCallPriority);
-                peers.push_back(json::value(peerObj));
-            }
-        }
+    uint32_t version = (m_peerListLookup != nullptr) ? m_peerListLookup->tableVersion() : 0U;
+    if (checkNotModified(request, reply, makeETag(version))) {
+        return;
     }
 
-    response["peers"].set<json::array>(peers);
-    reply.payload(response);
+    // parse filter and paging parameters
+    std::map<std::string, std::string> query = request.query();
+    uint32_t start = queryUInt(query, "start", 0U);
+    uint32_t end = queryUInt(query, "end", UINT32_MAX);
+    std::string alias = (query.find("alias") != query.end()) ? query["alias"] : "";
+    uint32_t limit = queryUInt(query, "limit", 0U);
+    uint32_t cursor = queryUInt(query, "cursor", 0U);
+
+    uint32_t matched = 0U, nextCursor = 0U;
+    std::vector<std::pair<uint32_t, PeerId>> peers;
+    if (m_peerListLookup != nullptr) {
+        peers = m_peerListLookup->page(cursor, limit, [&](uint32_t id, const PeerId& peer) {
+            if (id < start || id > end)
+                return false;
+            if (!alias.empty() && !startsWith(peer.peerAlias(), alias))
+                return false;
+            return true;
+        }, matched, nextCursor);
+    }
+
+    json::writer writer(peers.size() * 160U);
+    writer.beginObject();
+    writer.member("status", (int)HTTPPayload::OK);
+    writer.member("version", version);
+    writer.member("total", matched);
+    writer.member("nextCursor", nextCursor);
+
+    writer.key("peers").beginArray();
+    for (auto& entry : peers) {
+        writer.beginObject();
+        writer.member("peerId", entry.first);
+        writer.member("peerAlias", entry.second.peerAlias());
+        writer.member("peerPassword", !entry.second.peerPassword().empty());   // True if password is not empty, otherwise false
+        writer.member("peerReplica", entry.second.peerReplica());
+        writer.member("canRequestKeys", entry.second.canRequestKeys());
+        writer.member("canIssueInhibit", entry.second.canIssueInhibit());
+        writer.member("hasCallPriority", entry.second.hasCallPriority());
+        writer.endObject();
+    }
+    writer.endArray();
+
+    writer.endObject();
+    reply.payload(writer);
 }
 
 /* REST API endpoint; implements put peer add request. */
@@ -1796,6 +2106,7 @@ void RESTAPI::restAPI_GetStats(const HTTPPayload& request, HTTPPayload& reply, c
         // peer statistics (right now this is just a list of connected peers)
         json::array peerStats = json::array();
         if (m_network->m_peers.size() > 0) {
+            m_network->m_peers.shared_lock();
             for (auto entry : m_network->m_peers) {
                 uint32_t peerId = entry.first;
                 network::FNEPeerConnection* peer = entry.second;
@@ -1841,6 +2152,7 @@ void RESTAPI::restAPI_GetStats(const HTTPPayload& request, HTTPPayload& reply, c
                     peerStats.push_back(json::value(peerObj));
                 }
             }
+            m_network->m_peers.shared_unlock();
         }
         response["peerStats"].set<json::array>(peerStats);
 
@@ -1949,11 +2261,11 @@ void RESTAPI::restAPI_GetStats(const HTTPPayload& request, HTTPPayload& reply, c
         response["tableLastLoad"].set<json::object>(tableLastLoad);
 
         // total calls processed
-        uint32_t totalCallsProcessed = m_network->m_totalCallsProcessed;
+        uint32_t totalCallsProcessed = (uint32_t)m_network->m_totalCallsProcessed->value();
         response["totalCallsProcessed"].set<uint32_t>(totalCallsProcessed);
-        uint32_t totalCallCollisions = m_network->m_totalCallCollisions;
+        uint32_t totalCallCollisions = (uint32_t)m_network->m_totalCallCollisions->value();
         response["totalCallCollisions"].set<uint32_t>(totalCallCollisions);
-        int32_t totalActiveCalls = m_network->m_totalActiveCalls;
+        int32_t totalActiveCalls = (int32_t)m_network->m_totalActiveCalls->value();
         response["totalActiveCalls"].set<int32_t>(totalActiveCalls);
 
         // table totals
@@ -1965,13 +2277,78 @@ void RESTAPI::restAPI_GetStats(const HTTPPayload& request, HTTPPayload& reply, c
         response["peerListTotalEntries"].set<uint32_t>(peerListTotalEntries);
         uint32_t adjSiteMapTotalEntries = m_adjSiteMapLookup->adjPeerMap().size();
         response["adjSiteMapTotalEntries"].set<uint32_t>(adjSiteMapTotalEntries);
-        uint32_t cryptoKeyTotalEntries = m_cryptoLookup->keys().size();
+        uint32_t cryptoKeyTotalEntries = m_cryptoLookup->keyCount();
         response["cryptoKeyTotalEntries"].set<uint32_t>(cryptoKeyTotalEntries);
     }
 
     reply.payload(response);
 }
 
+/* REST API endpoint; implements get packet latency request. */
+
+void RESTAPI::restAPI_GetLatency(const HTTPPayload& request, HTTPPayload& reply, const RequestMatch& match)
+{
+    if (!validateAuth(request, reply)) {
+        return;
+    }
+
+    json::object response = PacketLatency::status();
+    setResponseDefaultStatus(response);
+
+    reply.payload(response);
+}
+
+/* REST API endpoint; implements get lock profiling request. */
+
+void RESTAPI::restAPI_GetLocks(const HTTPPayload& request, HTTPPayload& reply, const RequestMatch& match)
+{
+    if (!validateAuth(request, reply)) {
+        return;
+    }
+
+    json::object response = LockProfiler::status();
+    setResponseDefaultStatus(response);
+
+    reply.payload(response);
+}
+
+/* REST API endpoint; implements put lock profiling request. */
+
+void RESTAPI::restAPI_PutLocks(const HTTPPayload& request, HTTPPayload& reply, const RequestMatch& match)
+{
+    if (!validateAuth(request, reply)) {
+        return;
+    }
+
+    json::object req = json::object();
+    if (!parseRequestBody(request, reply, req)) {
+        return;
+    }
+
+    errorPayload(reply, "OK", HTTPPayload::OK);
+
+    if (req.find("enable") != req.end()) {
+        if (!req["enable"].is<bool>()) {
+            errorPayload(reply, "enable was not a valid boolean");
+            return;
+        }
+
+        bool enable = req["enable"].get<bool>();
+        LogInfoEx(LOG_REST, "Lock profiling %s", enable ? "enabled" : "disabled");
+        LockProfiler::setEnabled(enable);
+    }
+
+    if (req.find("reset") != req.end()) {
+        if (!req["reset"].is<bool>()) {
+            errorPayload(reply, "reset was not a valid boolean");
+            return;
+        }
+
+        if (req["reset"].get<bool>())
+            LockProfiler::reset();
+    }
+}
+
 /* REST API endpoint; implements get reset total calls request. */
 
 void RESTAPI::restAPI_GetResetTotalCalls(const HTTPPayload& request, HTTPPayload& reply, const RequestMatch& match)
@@ -1985,7 +2362,7 @@ void RESTAPI::restAPI_GetResetTotalCalls(const HTTPPayload& request, HTTPPayload
 
     LogInfoEx(LOG_REST, "request to reset total calls processed");
     if (m_network != nullptr) {
-        m_network->m_totalCallsProcessed = 0U;
+        m_network->m_totalCallsProcessed->reset();
     }
 
     reply.payload(response);
@@ -2004,7 +2381,7 @@ void RESTAPI::restAPI_GetResetActiveCalls(const HTTPPayload& request, HTTPPayloa
 
     LogInfoEx(LOG_REST, "request to reset total active calls");
     if (m_network != nullptr) {
-        m_network->m_totalActiveCalls = 0U;
+        m_network->m_totalActiveCalls->set(0);
     }
 
     reply.payload(response);
@@ -2023,7 +2400,7 @@ void RESTAPI::restAPI_GetResetCallCollisions(const HTTPPayload& request, HTTPPay
 
     LogInfoEx(LOG_REST, "request to reset total call collisions");
     if (m_network != nullptr) {
-        m_network->m_totalCallCollisions = 0U;
+        m_network->m_totalCallCollisions->reset();
     }
 
     reply.payload(response);
@@ -2037,46 +2414,96 @@ void RESTAPI::restAPI_GetAffList(const HTTPPayload& request, HTTPPayload& reply,
         return;
     }
 
-    json::object response = json::object();
-    setResponseDefaultStatus(response);
+    // the report version is the FNE-wide affiliation change counter; it is read before gathering, so a
+    //  change made while the report is built only makes the next request see a newer version
+    uint32_t version = (m_network != nullptr) ? m_network->m_peerAffiliationsVersion.load() : 0U;
+    if (checkNotModified(request, reply, makeETag(version))) {
+        return;
+    }
+
+    // parse filter and paging parameters
+    std::map<std::string, std::string> query = request.query();
+    uint32_t start = queryUInt(query, "start", 0U);
+    uint32_t end = queryUInt(query, "end", UINT32_MAX);
+    uint32_t dstId = queryUInt(query, "dstId", 0U);
+    uint32_t limit = queryUInt(query, "limit", 0U);
+    uint32_t cursor = queryUInt(query, "cursor", 0U);
 
-    json::array affs = json::array();
+    // gather the matching peers and copy their affiliation tables; the peer and affiliation tables are
+    //  locked while doing so, as the network (and other request handlers) run concurrently
+    std::vector<std::pair<uint32_t, std::unordered_map<uint32_t, uint32_t>>> peers;
+    uint32_t matched = 0U;
+    uint32_t nextCursor = 0U;
     if (m_network != nullptr) {
-        if (m_network->m_peers.size() > 0) {
-            for (auto entry : m_network->m_peers) {
-                uint32_t peerId = entry.first;
-                network::FNEPeerConnection* peer = entry.second;
-                if (peer != nullptr) {
-                    lookups::AffiliationLookup* affLookup = m_network->m_peerAffiliations[peerId];
-                    if (affLookup != nullptr) {
-                        std::unordered_map<uint32_t, uint32_t> affTable = affLookup->grpAffTable();
-
-                        json::object peerObj = json::object();
-                        peerObj["peerId"].set<uint32_t>(peerId);
-
-                        json::array peerAffs = json::array();
-                        if (affLookup->grpAffSize() > 0U) {
-                            for (auto entry : affTable) {
-                                uint32_t srcId = entry.first;
-                                uint32_t dstId = entry.second;
-
-                                json::object affObj = json::object();
-                                affObj["srcId"].set<uint32_t>(srcId);
-                                affObj["dstId"].set<uint32_t>(dstId);
-                                peerAffs.push_back(json::value(affObj));
-                            }
-                        }
+        m_network->m_peers.shared_lock();
+        m_network->m_peerAffiliations.lock(false);
+
+        std::vector<uint32_t> peerIds;
+        for (auto& entry : m_network->m_peers) {
+            uint32_t peerId = entry.first;
+            if (entry.second == nullptr)
+                continue;
+            if (peerId < start || peerId > end)
+                continue;
+
+            auto it = m_network->m_peerAffiliations.find(peerId);
+            if (it == m_network->m_peerAffiliations.end() || it->second == nullptr)
+                continue;
+
+            peerIds.push_back(peerId);
+        }
 
-                        peerObj["affiliations"].set<json::array>(peerAffs);
-                        affs.push_back(json::value(peerObj));
-                    }
-                }
-            }
+        matched = (uint32_t)peerIds.size();
+        std::sort(peerIds.begin(), peerIds.end());
+        peerIds.erase(peerIds.begin(), std::upper_bound(peerIds.begin(), peerIds.end(), cursor));
+
+        if (limit > 0U && peerIds.size() > limit) {
+            peerIds.resize(limit);
+            nextCursor = peerIds.back();
+        }
+
+        for (uint32_t peerId : peerIds) {
+            auto it = m_network->m_peerAffiliations.find(peerId);
+            peers.push_back(std::make_pair(peerId, it->second->grpAffTable()));
         }
+
+        m_network->m_peerAffiliations.unlock();
+        m_network->m_peers.shared_unlock();
     }
 
-    response["affiliations"].set<json::array>(affs);
-    reply.payload(response);
+    // stream the response directly, on large systems this report can be very large
+    json::writer writer;
+    writer.beginObject();
+    writer.member("status", (int)HTTPPayload::OK);
+    writer.member("version", version);
+    writer.member("total", matched);
+    writer.member("nextCursor", nextCursor);
+
+    writer.key("affiliations").beginArray();
+    for (auto& entry : peers) {
+        const std::unordered_map<uint32_t, uint32_t>& affTable = entry.second;
+
+        writer.beginObject();
+        writer.member("peerId", entry.first);
+
+        writer.key("affiliations").beginArray();
+        for (auto& affEntry : affTable) {
+            if (dstId != 0U && affEntry.second != dstId)
+                continue;
+
+            writer.beginObject();
+            writer.member("srcId", affEntry.first);
+            writer.member("dstId", affEntry.second);
+            writer.endObject();
+        }
+        writer.endArray();
+
+        writer.endObject();
+    }
+    writer.endArray();
+
+    writer.endObject();
+    reply.payload(writer);
 }
 
 /* REST API endpoint; implements get spanning tree list request. */
@@ -2092,6 +2519,7 @@ void RESTAPI::restAPI_GetSpanningTree(const HTTPPayload& request, HTTPPayload& r
 
     json::array tree = json::array();
     if (m_network != nullptr) {
+        std::lock_guard<std::mutex> guard(m_network->m_treeLock);
         SpanningTree::serializeTree(m_network->m_treeRoot, tree);
     }
 
@@ -2099,6 +2527,31 @@ void RESTAPI::restAPI_GetSpanningTree(const HTTPPayload& request, HTTPPayload& r
     reply.payload(response);
 }
 
+/* REST API endpoint; implements get virtual tunnel logical link send queue request. */
+
+void RESTAPI::restAPI_GetVTUNLinks(const HTTPPayload& request, HTTPPayload& reply, const RequestMatch& match)
+{
+    if (!validateAuth(request, reply)) {
+        return;
+    }
+
+    json::object response = json::object();
+    setResponseDefaultStatus(response);
+
+    json::array links = json::array();
+#if !defined(_WIN32)
+    if (m_network != nullptr && m_host->m_vtunEnabled && m_host->m_packetDataMode == HostFNE::PacketDataMode::PROJECT25) {
+        links = m_network->p25TrafficHandler()->packetData()->getLinkStats();
+    }
+
+    uint32_t window = m_host->m_vtunPduWindow;
+    response["pduWindow"].set<uint32_t>(window);
+#endif // !defined(_WIN32)
+
+    response["links"].set<json::array>(links);
+    reply.payload(response);
+}
+
 /*
 ** Digital Mobile Radio
 */
@@ -30,6 +30,7 @@
 
 #include <vector>
 #include <string>
+#include <mutex>
 #include <random>
 
 // ---------------------------------------------------------------------------
@@ -84,6 +85,14 @@ public:
      */
     void setNetwork(::network::TrafficNetwork* network);
 
+    /**
+     * @brief Sets the number of REST API worker threads.
+     * @param workers Number of threads servicing REST API connections.
+     * @param blockingWorkers Number of threads running blocking REST API endpoints (0 runs blocking
+     *  endpoints on the connection threads).
+     */
+    void setWorkers(uint32_t workers, uint32_t blockingWorkers);
+
     /**
      * @brief Opens connection to the network.
      * @returns bool True, if REST API services are started, otherwise false. 
@@ -106,6 +115,7 @@ private:
 #endif // ENABLE_SSL
 
     std::mt19937 m_random;
+    uint32_t m_etagSeed;
 
     std::string m_password;
     uint8_t* m_passwordHash;
@@ -122,6 +132,7 @@ private:
 
     typedef std::unordered_map<std::string, uint64_t>::value_type AuthTokenValueType;
     std::unordered_map<std::string, uint64_t> m_authTokens;
+    std::mutex m_authLock;
 
     /**
      * @brief Thread entry point. This function is provided to run the thread
@@ -146,6 +157,12 @@ private:
      * @returns bool True, if authentication token is valid, otherwise false.
      */
     bool validateAuth(const HTTPPayload& request, HTTPPayload& reply);
+    /**
+     * @brief Helper to generate a entity tag for the given table version.
+     * @param version Table version.
+     * @returns std::string Entity tag.
+     */
+    std::string makeETag(uint32_t version) const;
 
     /**
      * @brief REST API endpoint; implements authentication request.
@@ -169,6 +186,34 @@ private:
      * @param match HTTP request matcher.
      */
     void restAPI_GetStatus(const HTTPPayload& request, HTTPPayload& reply, const restapi::RequestMatch& match);
+    /**
+     * @brief REST API endpoint; implements get thread scheduling policy request.
+     * @param request HTTP request.
+     * @param reply HTTP reply.
+     * @param match HTTP request matcher.
+     */
+    void restAPI_GetThreads(const HTTPPayload& request, HTTPPayload& reply, const restapi::RequestMatch& match);
+    /**
+     * @brief REST API endpoint; implements get metrics request.
+     * @param request HTTP request.
+     * @param reply HTTP reply.
+     * @param match HTTP request matcher.
+     */
+    void restAPI_GetMetrics(const HTTPPayload& request, HTTPPayload& reply, const restapi::RequestMatch& match);
+    /**
+     * @brief REST API endpoint; implements get event trace request.
+     * @param request HTTP request.
+     * @param reply HTTP reply.
+     * @param match HTTP request matcher.
+     */
+    void restAPI_GetTrace(const HTTPPayload& request, HTTPPayload& reply, const restapi::RequestMatch& match);
+    /**
+     * @brief REST API endpoint; implements put event trace request.
+     * @param request HTTP request.
+     * @param reply HTTP reply.
+     * @param match HTTP request matcher.
+     */
+    void restAPI_PutTrace(const HTTPPayload& request, HTTPPayload& reply, const restapi::RequestMatch& match);
     
     /**
      * @brief REST API endpoint; implements get peer query request.
@@ -375,6 +420,27 @@ private:
      * @param match HTTP request matcher.
      */
     void restAPI_GetStats(const HTTPPayload& request, HTTPPayload& reply, const restapi::RequestMatch& match);
+    /**
+     * @brief REST API endpoint; implements get packet latency request.
+     * @param request HTTP request.
+     * @param reply HTTP reply.
+     * @param match HTTP request matcher.
+     */
+    void restAPI_GetLatency(const HTTPPayload& request, HTTPPayload& reply, const restapi::RequestMatch& match);
+    /**
+     * @brief REST API endpoint; implements get lock profiling request.
+     * @param request HTTP request.
+     * @param reply HTTP reply.
+     * @param match HTTP request matcher.
+     */
+    void restAPI_GetLocks(const HTTPPayload& request, HTTPPayload& reply, const restapi::RequestMatch& match);
+    /**
+     * @brief REST API endpoint; implements put lock profiling request.
+     * @param request HTTP request.
+     * @param reply HTTP reply.
+     * @param match HTTP request matcher.
+     */
+    void restAPI_PutLocks(const HTTPPayload& request, HTTPPayload& reply, const restapi::RequestMatch& match);
 
     /**
      * @brief REST API endpoint; implements put reset total calls request.
@@ -416,6 +482,14 @@ private:
      */
     void restAPI_GetSpanningTree(const HTTPPayload& request, HTTPPayload& reply, const restapi::RequestMatch& match);
 
+    /**
+     * @brief REST API endpoint; implements get virtual tunnel logical link send queue request.
+     * @param request HTTP request.
+     * @param reply HTTP reply.
+     * @param match HTTP request matcher.
+     */
+    void restAPI_GetVTUNLinks(const HTTPPayload& request, HTTPPayload& reply, const restapi::RequestMatch& match);
+
     /*
     ** Digital Mobile Radio
     */
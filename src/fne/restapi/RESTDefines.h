@@ -60,6 +60,9 @@
 #define FNE_GET_RELOAD_CRYPTO           "/reload-crypto"
 
 #define FNE_GET_STATS                   "/stats"
+#define FNE_GET_LATENCY                 "/latency"
+#define FNE_GET_LOCKS                   "/locks"
+#define FNE_PUT_LOCKS                   "/locks"
 #define FNE_GET_RESET_TOTAL_CALLS       "/stat-reset-total-calls"
 #define FNE_GET_RESET_ACTIVE_CALLS      "/stat-reset-active-calls"
 #define FNE_GET_RESET_CALL_COLLISIONS   "/stat-reset-call-collisions"
@@ -67,4 +70,6 @@
 
 #define FNE_GET_SPANNING_TREE           "/spanning-tree"
 
+#define FNE_GET_VTUN_LINKS              "/vtun/links"
+
 #endif // __FNE_REST_DEFINES_H__
@@ -96,6 +96,13 @@ bool Host::readParams()
 
     m_disableWatchdogOverflow = systemConf["disableWatchdogOverflow"].as<bool>(false);
 
+    // apply thread scheduling configuration before any threads are started
+    ThreadPolicy::configure(systemConf["threads"]);
+
+    // select the UDP transport before any sockets are created
+    bool ioUring = systemConf["ioUring"].as<bool>(false);
+    network::udp::Socket::setIoUringDefault(ioUring);
+
     LogInfo("General Parameters");
     if (!udpMasterMode) {
         LogInfo("    DMR: %s", m_dmrEnabled ? "enabled" : "disabled");
@@ -117,6 +124,9 @@ bool Host::readParams()
         if (m_disableWatchdogOverflow) {
             LogInfo("    Disable Watchdog Overflow Check: yes");
         }
+        if (ioUring) {
+            LogInfo("    io_uring UDP Transport: yes");
+        }
 
         yaml::Node systemInfo = systemConf["info"];
         m_latitude = systemInfo["latitude"].as<float>(0.0F);
@@ -848,6 +858,8 @@ bool Host::createNetwork()
     std::string restApiSSLCert = networkConf["restSslCertificate"].as<std::string>("web.crt");
     std::string restApiSSLKey = networkConf["restSslKey"].as<std::string>("web.key");
     bool restApiDebug = networkConf["restDebug"].as<bool>(false);
+    uint32_t restApiWorkers = networkConf["restWorkers"].as<uint32_t>(1U);
+    uint32_t restApiBlockingWorkers = networkConf["restBlockingWorkers"].as<uint32_t>(0U);
     uint32_t id = networkConf["id"].as<uint32_t>(1000U);
     uint32_t jitter = networkConf["talkgroupHang"].as<uint32_t>(360U);
     std::string password = networkConf["password"].as<std::string>();
@@ -964,6 +976,7 @@ bool Host::createNetwork()
         LogInfo("    REST API SSL Enabled: %s", restApiEnableSSL ? "yes" : "no");
         LogInfo("    REST API SSL Certificate: %s", restApiSSLCert.c_str());
         LogInfo("    REST API SSL Private Key: %s", restApiSSLKey.c_str());
+        LogInfo("    REST API Workers: %u (blocking %u)", restApiWorkers, restApiBlockingWorkers);
 
         if (restApiDebug) {
             LogInfo("    REST API Debug: yes");
@@ -1011,6 +1024,7 @@ bool Host::createNetwork()
         m_restAddress = restApiAddress;
         m_restPort = restApiPort;
         m_RESTAPI = new RESTAPI(restApiAddress, restApiPort, restApiPassword, restApiSSLKey, restApiSSLCert, restApiEnableSSL, this, restApiDebug);
+        m_RESTAPI->setWorkers(restApiWorkers, restApiBlockingWorkers);
         m_RESTAPI->setLookups(m_ridLookup, m_tidLookup);
         bool ret = m_RESTAPI->open();
         if (!ret) {
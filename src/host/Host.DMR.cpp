@@ -55,9 +55,7 @@ void* Host::threadDMRReader1(void* arg)
         }
 
         LogInfoEx(LOG_HOST, "[ OK ] %s", threadName.c_str());
-#ifdef _GNU_SOURCE
-        ::pthread_setname_np(th->thread, threadName.c_str());
-#endif // _GNU_SOURCE
+        ThreadPolicy::apply(th->thread, threadName);
 
         StopWatch stopWatch;
         stopWatch.start();
@@ -211,9 +209,7 @@ void* Host::threadDMRWriter1(void* arg)
         }
 
         LogInfoEx(LOG_HOST, "[ OK ] %s", threadName.c_str());
-#ifdef _GNU_SOURCE
-        ::pthread_setname_np(th->thread, threadName.c_str());
-#endif // _GNU_SOURCE
+        ThreadPolicy::apply(th->thread, threadName);
 
         StopWatch stopWatch;
         stopWatch.start();
@@ -341,9 +337,7 @@ void* Host::threadDMRReader2(void* arg)
         }
 
         LogInfoEx(LOG_HOST, "[ OK ] %s", threadName.c_str());
-#ifdef _GNU_SOURCE
-        ::pthread_setname_np(th->thread, threadName.c_str());
-#endif // _GNU_SOURCE
+        ThreadPolicy::apply(th->thread, threadName);
 
         StopWatch stopWatch;
         stopWatch.start();
@@ -496,9 +490,7 @@ void* Host::threadDMRWriter2(void* arg)
         }
 
         LogInfoEx(LOG_HOST, "[ OK ] %s", threadName.c_str());
-#ifdef _GNU_SOURCE
-        ::pthread_setname_np(th->thread, threadName.c_str());
-#endif // _GNU_SOURCE
+        ThreadPolicy::apply(th->thread, threadName);
 
         StopWatch stopWatch;
         stopWatch.start();
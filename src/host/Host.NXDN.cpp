@@ -42,9 +42,7 @@ void* Host::threadNXDNReader(void* arg)
         }
 
         LogInfoEx(LOG_HOST, "[ OK ] %s", threadName.c_str());
-#ifdef _GNU_SOURCE
-        ::pthread_setname_np(th->thread, threadName.c_str());
-#endif // _GNU_SOURCE
+        ThreadPolicy::apply(th->thread, threadName);
 
         StopWatch stopWatch;
         stopWatch.start();
@@ -160,9 +158,7 @@ void* Host::threadNXDNWriter(void* arg)
         }
 
         LogInfoEx(LOG_HOST, "[ OK ] %s", threadName.c_str());
-#ifdef _GNU_SOURCE
-        ::pthread_setname_np(th->thread, threadName.c_str());
-#endif // _GNU_SOURCE
+        ThreadPolicy::apply(th->thread, threadName);
 
         StopWatch stopWatch;
         stopWatch.start();
@@ -44,9 +44,7 @@ void* Host::threadP25Reader(void* arg)
         }
 
         LogInfoEx(LOG_HOST, "[ OK ] %s", threadName.c_str());
-#ifdef _GNU_SOURCE
-        ::pthread_setname_np(th->thread, threadName.c_str());
-#endif // _GNU_SOURCE
+        ThreadPolicy::apply(th->thread, threadName);
 
         StopWatch stopWatch;
         stopWatch.start();
@@ -203,9 +201,7 @@ void* Host::threadP25Writer(void* arg)
         }
 
         LogInfoEx(LOG_HOST, "[ OK ] %s", threadName.c_str());
-#ifdef _GNU_SOURCE
-        ::pthread_setname_np(th->thread, threadName.c_str());
-#endif // _GNU_SOURCE
+        ThreadPolicy::apply(th->thread, threadName);
 
         StopWatch stopWatch;
         stopWatch.start();
@@ -27,6 +27,7 @@
 
 #include "Defines.h"
 #include "common/Timer.h"
+#include "common/ThreadPolicy.h"
 #include "common/lookups/AffiliationLookup.h"
 #include "common/lookups/ChannelLookup.h"
 #include "common/lookups/IdenTableLookup.h"
@@ -12,6 +12,7 @@
 #include "common/dmr/acl/AccessControl.h"
 #include "common/dmr/lc/CSBK.h"
 #include "common/dmr/lc/csbk/CSBKFactory.h"
+#include "common/EventTrace.h"
 #include "common/Log.h"
 #include "dmr/Control.h"
 #include "Host.h"
@@ -329,6 +330,9 @@ bool Control::processFrame(uint32_t slotNo, uint8_t *data, uint32_t len)
 {
     assert(data != nullptr);
 
+    EventTraceScope trace(TRACE_EVENT::DMR_FRAME);
+    trace.setArg(slotNo);
+
     switch (slotNo) {
     case 1U:
         return m_slot1->processFrame(data, len);
@@ -697,6 +701,8 @@ void Control::processNetwork()
         return;
     }
 
+    EventTraceScope trace(TRACE_EVENT::DMR_NETWORK);
+
     data::NetData data;
 
     // process network message header
@@ -75,8 +75,7 @@ bool DMRAffiliationLookup::grantChSlot(uint32_t dstId, uint32_t srcId, uint8_t s
     m_uuGrantedTable[dstId] = !grp;
     m_netGrantedTable[dstId] = netGranted;
 
-    m_grantTimers[dstId] = Timer(1000U, grantTimeout);
-    m_grantTimers[dstId].start();
+    m_grantExpiry.start(dstId, grantTimeout * 1000U);
 
     if (m_verbose) {
         LogInfoEx(LOG_HOST, "%s, granting channel, chNo = %u, slot = %u, dstId = %u, group = %u",
@@ -145,7 +144,7 @@ bool DMRAffiliationLookup::releaseGrant(uint32_t dstId, bool releaseAll)
             m_rfGrantChCnt = 0U;
         }
 
-        m_grantTimers[dstId].stop();
+        m_grantExpiry.stop(dstId);
 
         __unlock();
 
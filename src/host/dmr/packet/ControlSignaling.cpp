@@ -680,6 +680,7 @@ void ControlSignaling::writeRF_Call_Alrt(uint32_t srcId, uint32_t dstId)
 
 ControlSignaling::ControlSignaling(Slot* slot, network::BaseNetwork * network, bool dumpCSBKData, bool debug, bool verbose) :
     m_slot(slot),
+    m_tsccCache(DMR_FRAME_LENGTH_BYTES),
     m_dumpCSBKData(dumpCSBKData),
     m_verbose(verbose),
     m_debug(debug)
@@ -731,6 +732,89 @@ void ControlSignaling::writeRF_CSBK(lc::CSBK* csbk, bool imm)
         m_slot->addFrame(data, false, imm);
 }
 
+/* Helper to get the broadcast cache key for a TSCC broadcast CSBK. */
+
+uint64_t ControlSignaling::tsccCacheKey(uint8_t csbko, uint64_t param)
+{
+    // debug dumping requires the CSBK to be generated
+    if (m_debug || lc::CSBK::getVerbose())
+        return 0U;
+
+    // the cached broadcasts depend on the site data, the color code and the bandplan entry
+    const SiteData& site = m_slot->s_siteData;
+    uint64_t version = BroadcastFrameCache::INITIAL_VERSION;
+    version = BroadcastFrameCache::hash(version, site.siteModel());
+    version = BroadcastFrameCache::hash(version, site.netId());
+    version = BroadcastFrameCache::hash(version, site.siteId());
+    version = BroadcastFrameCache::hash(version, site.parId());
+    version = BroadcastFrameCache::hash(version, site.requireReg() ? 1U : 0U);
+    version = BroadcastFrameCache::hash(version, site.netActive() ? 1U : 0U);
+    version = BroadcastFrameCache::hash(version, m_slot->s_colorCode);
+    version = BroadcastFrameCache::hash(version, m_slot->s_duplex ? 1U : 0U);
+    version = BroadcastFrameCache::hash(version, m_slot->s_alohaNRandWait);
+    version = BroadcastFrameCache::hash(version, m_slot->s_alohaBackOff);
+    version = BroadcastFrameCache::hash(version, m_slot->s_idenEntry.channelId());
+    version = BroadcastFrameCache::hash(version, m_slot->s_idenEntry.baseFrequency());
+    version = BroadcastFrameCache::hash(version, (uint64_t)(m_slot->s_idenEntry.chSpaceKhz() * 1000.0F));
+    version = BroadcastFrameCache::hash(version, (uint64_t)(int64_t)(m_slot->s_idenEntry.txOffsetMhz() * 1000000.0F));
+    m_tsccCache.validate(version);
+
+    return ((uint64_t)(csbko + 1U) << 56) | (param & 0x00FFFFFFFFFFFFFFULL);
+}
+
+/* Helper to write a TSCC broadcast CSBK packet through the pre-encoded broadcast cache. */
+
+bool ControlSignaling::writeRF_CSBK_Bcast(lc::CSBK* csbk, uint64_t key)
+{
+    if (key == 0U) {
+        if (csbk == nullptr)
+            return false;
+
+        writeRF_CSBK(csbk);
+        return true;
+    }
+
+    // don't add any frames if the queue is full
+    uint8_t len = DMR_FRAME_LENGTH_BYTES + 2U;
+    uint32_t space = m_slot->m_txQueue.freeSpace();
+    if (space < (len + 1U)) {
+        return true;
+    }
+
+    uint8_t data[DMR_FRAME_LENGTH_BYTES + 2U];
+    if (!m_tsccCache.find(key, data + 2U)) {
+        if (csbk == nullptr)
+            return false;
+
+        ::memset(data + 2U, 0x00U, DMR_FRAME_LENGTH_BYTES);
+
+        SlotType slotType;
+        slotType.setColorCode(m_slot->s_colorCode);
+        slotType.setDataType(DataType::CSBK);
+
+        // Regenerate the CSBK data
+        csbk->encode(data + 2U);
+
+        // Regenerate the Slot Type
+        slotType.encode(data + 2U);
+
+        // Convert the Data Sync to be from the BS or MS as needed
+        Sync::addDMRDataSync(data + 2U, m_slot->s_duplex);
+
+        m_tsccCache.insert(key, data + 2U);
+    }
+
+    m_slot->m_rfSeqNo = 0U;
+
+    data[0U] = modem::TAG_DATA;
+    data[1U] = 0x00U;
+
+    if (m_slot->s_duplex)
+        m_slot->addFrame(data);
+
+    return true;
+}
+
 /* Helper to write a network CSBK. */
 
 void ControlSignaling::writeNet_CSBK(lc::CSBK* csbk)
@@ -1525,12 +1609,16 @@ void ControlSignaling::writeRF_CSBK_Payload_Clear(uint32_t dstId, uint32_t srcId
 
 void ControlSignaling::writeRF_TSCC_Aloha()
 {
+    uint64_t key = tsccCacheKey(CSBKO::ALOHA);
+    if (writeRF_CSBK_Bcast(nullptr, key))
+        return;
+
     std::unique_ptr<CSBK_ALOHA> csbk = std::make_unique<CSBK_ALOHA>();
     DEBUG_LOG_CSBK(csbk->toString());
     csbk->setNRandWait(m_slot->s_alohaNRandWait);
     csbk->setBackoffNo(m_slot->s_alohaBackOff);
 
-    writeRF_CSBK(csbk.get());
+    writeRF_CSBK_Bcast(csbk.get(), key);
 }
 
 /* Helper to write a TSCC Ann-Wd broadcast packet on the RF interface. */
@@ -1539,6 +1627,11 @@ void ControlSignaling::writeRF_TSCC_Bcast_Ann_Wd(uint32_t channelNo, bool annWd,
 {
     m_slot->m_rfSeqNo = 0U;
 
+    uint64_t key = tsccCacheKey(CSBKO::BROADCAST, ((uint64_t)(systemIdentity & 0xFFFFU) << 34) +
+        ((requireReg) ? (1ULL << 33) : 0U) + ((annWd) ? (1ULL << 32) : 0U) + channelNo);
+    if (writeRF_CSBK_Bcast(nullptr, key))
+        return;
+
     std::unique_ptr<CSBK_BROADCAST> csbk = std::make_unique<CSBK_BROADCAST>();
     csbk->siteIdenEntry(m_slot->s_idenEntry);
     csbk->setCdef(false);
@@ -1553,26 +1646,35 @@ void ControlSignaling::writeRF_TSCC_Bcast_Ann_Wd(uint32_t channelNo, bool annWd,
             m_slot->m_slotNo, csbk->toString().c_str(), channelNo, annWd);
     }
 
-    writeRF_CSBK(csbk.get());
+    writeRF_CSBK_Bcast(csbk.get(), key);
 }
 
 /* Helper to write a TSCC Sys_Parm broadcast packet on the RF interface. */
 
 void ControlSignaling::writeRF_TSCC_Bcast_Sys_Parm()
 {
+    // the announcement type is carried above the Ann-Wd broadcast parameters (which use bits 0 - 49)
+    uint64_t key = tsccCacheKey(CSBKO::BROADCAST, ((uint64_t)BroadcastAnncType::SITE_PARMS + 1U) << 50);
+    if (writeRF_CSBK_Bcast(nullptr, key))
+        return;
+
     std::unique_ptr<CSBK_BROADCAST> csbk = std::make_unique<CSBK_BROADCAST>();
     DEBUG_LOG_CSBK(csbk->toString());
     csbk->setAnncType(BroadcastAnncType::SITE_PARMS);
 
-    writeRF_CSBK(csbk.get());
+    writeRF_CSBK_Bcast(csbk.get(), key);
 }
 
 /* Helper to write a TSCC Git Hash broadcast packet on the RF interface. */
 
 void ControlSignaling::writeRF_TSCC_Git_Hash()
 {
+    uint64_t key = tsccCacheKey(CSBKO::DVM_GIT_HASH);
+    if (writeRF_CSBK_Bcast(nullptr, key))
+        return;
+
     std::unique_ptr<CSBK_DVM_GIT_HASH> csbk = std::make_unique<CSBK_DVM_GIT_HASH>();
     DEBUG_LOG_CSBK(csbk->toString());
 
-    writeRF_CSBK(csbk.get());
+    writeRF_CSBK_Bcast(csbk.get(), key);
 }
@@ -23,6 +23,7 @@
 #include "common/dmr/lc/LC.h"
 #include "common/dmr/lc/CSBK.h"
 #include "common/network/BaseNetwork.h"
+#include "common/BroadcastFrameCache.h"
 #include "common/RingBuffer.h"
 #include "common/StopWatch.h"
 #include "common/Timer.h"
@@ -89,6 +90,8 @@ namespace dmr
             friend class dmr::Slot;
             Slot* m_slot;
 
+            BroadcastFrameCache m_tsccCache;
+
             bool m_dumpCSBKData;
             bool m_verbose;
             bool m_debug;
@@ -127,6 +130,21 @@ namespace dmr
              * @param csbk CSBK to write to the network.
              */
             void writeNet_CSBK(lc::CSBK* csbk);
+            /**
+             * @brief Helper to get the broadcast cache key for a TSCC broadcast CSBK.
+             *  (This validates the broadcast cache against the current site configuration.)
+             * @param csbko CSBK opcode.
+             * @param param Broadcast parameters that are not part of the site configuration.
+             * @returns uint64_t Broadcast cache key, or 0 if the broadcast should not be cached.
+             */
+            uint64_t tsccCacheKey(uint8_t csbko, uint64_t param = 0U);
+            /**
+             * @brief Helper to write a TSCC broadcast CSBK packet through the pre-encoded broadcast cache.
+             * @param csbk CSBK to encode on a cache miss, or nullptr to only write a cached frame.
+             * @param key Broadcast cache key.
+             * @returns bool True, if the broadcast was written (or the queue is full), otherwise false.
+             */
+            bool writeRF_CSBK_Bcast(lc::CSBK* csbk, uint64_t key);
 
             /*
             ** Control Signalling Logic
@@ -15,6 +15,7 @@
 #include "common/p25/P25Defines.h"
 #include "common/nxdn/NXDNDefines.h"
 #include "common/edac/CRC.h"
+#include "common/EventTrace.h"
 #include "common/Log.h"
 #include "common/Thread.h"
 #include "common/Utils.h"
@@ -522,6 +523,8 @@ bool Modem::open()
 
 void Modem::clock(uint32_t ms)
 {
+    EventTraceScope trace(TRACE_EVENT::MODEM_CLOCK);
+
     // poll the modem status
     m_statusTimer.clock(ms);
     if (m_statusTimer.hasExpired()) {
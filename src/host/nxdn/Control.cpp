@@ -17,6 +17,7 @@
 #include "common/nxdn/lc/RTCH.h"
 #include "common/nxdn/Sync.h"
 #include "common/nxdn/NXDNUtils.h"
+#include "common/EventTrace.h"
 #include "common/Log.h"
 #include "common/Utils.h"
 #include "nxdn/Control.h"
@@ -367,6 +368,8 @@ bool Control::processFrame(uint8_t* data, uint32_t len)
 {
     assert(data != nullptr);
 
+    EventTraceScope trace(TRACE_EVENT::NXDN_FRAME);
+
     bool sync = data[1U] == 0x01U;
 
     if (data[0U] == modem::TAG_LOST) {
@@ -946,6 +949,8 @@ void Control::processNetwork()
         return;
     }
 
+    EventTraceScope trace(TRACE_EVENT::NXDN_NETWORK);
+
     // don't process network frames if the RF modem isn't in a listening state
     if (m_rfState != RS_RF_LISTENING && m_netState == RS_NET_IDLE) {
         return;
@@ -294,6 +294,7 @@ ControlSignaling::ControlSignaling(Control* nxdn, bool debug, bool verbose) :
     m_rcchIterateCnt(4U),
     m_pgRCCHQueue((NXDN_FRAME_LENGTH_BYTES + 2U) * 16U, "RCCH Paging Frame"),
     m_mpRCCHQueue((NXDN_FRAME_LENGTH_BYTES + 2U) * 16U, "RCCH Multipurpose Frame"),
+    m_ccCache(NXDN_FRAME_LENGTH_BYTES + 2U),
     m_verifyAff(false),
     m_verifyReg(false),
     m_disableGrantSrcIdCheck(false),
@@ -796,48 +797,84 @@ void ControlSignaling::writeRF_Message_U_Reg_Rsp(uint32_t srcId, uint32_t dstId,
     writeRF_Message(rcch.get(), true);
 }
 
+/* Helper to get the broadcast cache key for a CC broadcast message. */
+
+uint64_t ControlSignaling::ccCacheKey(uint8_t messageType)
+{
+    // debug dumping requires the message to be generated
+    if (m_debug || lc::RCCH::getVerbose())
+        return 0U;
+
+    // the cached broadcasts depend on the site data, the RAN and the channel structure
+    const SiteData& site = m_nxdn->m_siteData;
+    uint64_t version = BroadcastFrameCache::INITIAL_VERSION;
+    version = BroadcastFrameCache::hash(version, site.locId());
+    version = BroadcastFrameCache::hash(version, site.channelId());
+    version = BroadcastFrameCache::hash(version, site.channelNo());
+    version = BroadcastFrameCache::hash(version, site.siteInfo1());
+    version = BroadcastFrameCache::hash(version, site.siteInfo2());
+    version = BroadcastFrameCache::hash(version, site.requireReg() ? 1U : 0U);
+    version = BroadcastFrameCache::hash(version, site.netActive() ? 1U : 0U);
+    version = BroadcastFrameCache::hash(version, m_nxdn->m_ran);
+    version = BroadcastFrameCache::hash(version, m_bcchCnt);
+    version = BroadcastFrameCache::hash(version, m_rcchGroupingCnt);
+    version = BroadcastFrameCache::hash(version, m_ccchPagingCnt);
+    version = BroadcastFrameCache::hash(version, m_ccchMultiCnt);
+    version = BroadcastFrameCache::hash(version, m_rcchIterateCnt);
+    m_ccCache.validate(version);
+
+    return (uint64_t)messageType + 1U;
+}
+
 /* Helper to write a CC SITE_INFO broadcast packet on the RF interface. */
 
 void ControlSignaling::writeRF_CC_Message_Site_Info()
 {
     uint8_t data[NXDN_FRAME_LENGTH_BYTES + 2U];
-    ::memset(data + 2U, 0x00U, NXDN_FRAME_LENGTH_BYTES);
 
-    Sync::addNXDNSync(data + 2U);
+    uint64_t key = ccCacheKey(MessageType::RCCH_SITE_INFO);
+    if (key == 0U || !m_ccCache.find(key, data)) {
+        ::memset(data + 2U, 0x00U, NXDN_FRAME_LENGTH_BYTES);
 
-    // generate the LICH
-    channel::LICH lich;
-    lich.setRFCT(RFChannelType::RCCH);
-    lich.setFCT(FuncChannelType::CAC_OUTBOUND);
-    lich.setOption(ChOption::DATA_NORMAL);
-    lich.setOutbound(true);
-    lich.encode(data + 2U);
+        Sync::addNXDNSync(data + 2U);
 
-    uint8_t buffer[NXDN_RCCH_LC_LENGTH_BYTES];
-    ::memset(buffer, 0x00U, NXDN_RCCH_LC_LENGTH_BYTES);
+        // generate the LICH
+        channel::LICH lich;
+        lich.setRFCT(RFChannelType::RCCH);
+        lich.setFCT(FuncChannelType::CAC_OUTBOUND);
+        lich.setOption(ChOption::DATA_NORMAL);
+        lich.setOutbound(true);
+        lich.encode(data + 2U);
 
-    std::unique_ptr<rcch::MESSAGE_TYPE_SITE_INFO> rcch = std::make_unique<rcch::MESSAGE_TYPE_SITE_INFO>();
-    DEBUG_LOG_MSG(rcch->toString());
-    rcch->setBcchCnt(m_bcchCnt);
-    rcch->setRcchGroupingCnt(m_rcchGroupingCnt);
-    rcch->setCcchPagingCnt(m_ccchPagingCnt);
-    rcch->setCcchMultiCnt(m_ccchMultiCnt);
-    rcch->setRcchIterateCount(m_rcchIterateCnt);
+        uint8_t buffer[NXDN_RCCH_LC_LENGTH_BYTES];
+        ::memset(buffer, 0x00U, NXDN_RCCH_LC_LENGTH_BYTES);
 
-    rcch->encode(buffer, NXDN_RCCH_LC_LENGTH_BITS);
+        std::unique_ptr<rcch::MESSAGE_TYPE_SITE_INFO> rcch = std::make_unique<rcch::MESSAGE_TYPE_SITE_INFO>();
+        DEBUG_LOG_MSG(rcch->toString());
+        rcch->setBcchCnt(m_bcchCnt);
+        rcch->setRcchGroupingCnt(m_rcchGroupingCnt);
+        rcch->setCcchPagingCnt(m_ccchPagingCnt);
+        rcch->setCcchMultiCnt(m_ccchMultiCnt);
+        rcch->setRcchIterateCount(m_rcchIterateCnt);
 
-    // generate the CAC
-    channel::CAC cac;
-    cac.setRAN(m_nxdn->m_ran);
-    cac.setStructure(ChStructure::SR_RCCH_HEAD_SINGLE);
-    cac.setData(buffer);
-    cac.encode(data + 2U);
+        rcch->encode(buffer, NXDN_RCCH_LC_LENGTH_BITS);
 
-    data[0U] = modem::TAG_DATA;
-    data[1U] = 0x00U;
+        // generate the CAC
+        channel::CAC cac;
+        cac.setRAN(m_nxdn->m_ran);
+        cac.setStructure(ChStructure::SR_RCCH_HEAD_SINGLE);
+        cac.setData(buffer);
+        cac.encode(data + 2U);
 
-    NXDNUtils::scrambler(data + 2U);
-    NXDNUtils::addPostBits(data + 2U);
+        data[0U] = modem::TAG_DATA;
+        data[1U] = 0x00U;
+
+        NXDNUtils::scrambler(data + 2U);
+        NXDNUtils::addPostBits(data + 2U);
+
+        if (key != 0U)
+            m_ccCache.insert(key, data);
+    }
 
     if (m_nxdn->m_duplex) {
         m_nxdn->addFrame(data);
@@ -849,38 +886,45 @@ void ControlSignaling::writeRF_CC_Message_Site_Info()
 void ControlSignaling::writeRF_CC_Message_Service_Info()
 {
     uint8_t data[NXDN_FRAME_LENGTH_BYTES + 2U];
-    ::memset(data + 2U, 0x00U, NXDN_FRAME_LENGTH_BYTES);
 
-    Sync::addNXDNSync(data + 2U);
+    uint64_t key = ccCacheKey(MessageType::SRV_INFO);
+    if (key == 0U || !m_ccCache.find(key, data)) {
+        ::memset(data + 2U, 0x00U, NXDN_FRAME_LENGTH_BYTES);
 
-    // generate the LICH
-    channel::LICH lich;
-    lich.setRFCT(RFChannelType::RCCH);
-    lich.setFCT(FuncChannelType::CAC_OUTBOUND);
-    lich.setOption(ChOption::DATA_NORMAL);
-    lich.setOutbound(true);
-    lich.encode(data + 2U);
+        Sync::addNXDNSync(data + 2U);
 
-    uint8_t buffer[NXDN_RCCH_LC_LENGTH_BYTES];
-    ::memset(buffer, 0x00U, NXDN_RCCH_LC_LENGTH_BYTES);
+        // generate the LICH
+        channel::LICH lich;
+        lich.setRFCT(RFChannelType::RCCH);
+        lich.setFCT(FuncChannelType::CAC_OUTBOUND);
+        lich.setOption(ChOption::DATA_NORMAL);
+        lich.setOutbound(true);
+        lich.encode(data + 2U);
 
-    std::unique_ptr<rcch::MESSAGE_TYPE_SRV_INFO> rcch = std::make_unique<rcch::MESSAGE_TYPE_SRV_INFO>();
-    DEBUG_LOG_MSG(rcch->toString());
-    rcch->encode(buffer, NXDN_RCCH_LC_LENGTH_BITS / 2U);
-    //rcch->encode(buffer, NXDN_RCCH_LC_LENGTH_BITS / 2U, NXDN_RCCH_LC_LENGTH_BITS / 2U);
+        uint8_t buffer[NXDN_RCCH_LC_LENGTH_BYTES];
+        ::memset(buffer, 0x00U, NXDN_RCCH_LC_LENGTH_BYTES);
 
-    // generate the CAC
-    channel::CAC cac;
-    cac.setRAN(m_nxdn->m_ran);
-    cac.setStructure(ChStructure::SR_RCCH_SINGLE);
-    cac.setData(buffer);
-    cac.encode(data + 2U);
+        std::unique_ptr<rcch::MESSAGE_TYPE_SRV_INFO> rcch = std::make_unique<rcch::MESSAGE_TYPE_SRV_INFO>();
+        DEBUG_LOG_MSG(rcch->toString());
+        rcch->encode(buffer, NXDN_RCCH_LC_LENGTH_BITS / 2U);
+        //rcch->encode(buffer, NXDN_RCCH_LC_LENGTH_BITS / 2U, NXDN_RCCH_LC_LENGTH_BITS / 2U);
 
-    data[0U] = modem::TAG_DATA;
-    data[1U] = 0x00U;
+        // generate the CAC
+        channel::CAC cac;
+        cac.setRAN(m_nxdn->m_ran);
+        cac.setStructure(ChStructure::SR_RCCH_SINGLE);
+        cac.setData(buffer);
+        cac.encode(data + 2U);
 
-    NXDNUtils::scrambler(data + 2U);
-    NXDNUtils::addPostBits(data + 2U);
+        data[0U] = modem::TAG_DATA;
+        data[1U] = 0x00U;
+
+        NXDNUtils::scrambler(data + 2U);
+        NXDNUtils::addPostBits(data + 2U);
+
+        if (key != 0U)
+            m_ccCache.insert(key, data);
+    }
 
     if (m_nxdn->m_duplex) {
         m_nxdn->addFrame(data);
@@ -892,38 +936,45 @@ void ControlSignaling::writeRF_CC_Message_Service_Info()
 void ControlSignaling::writeRF_CC_Message_Idle()
 {
     uint8_t data[NXDN_FRAME_LENGTH_BYTES + 2U];
-    ::memset(data + 2U, 0x00U, NXDN_FRAME_LENGTH_BYTES);
 
-    Sync::addNXDNSync(data + 2U);
+    uint64_t key = ccCacheKey(MessageType::IDLE);
+    if (key == 0U || !m_ccCache.find(key, data)) {
+        ::memset(data + 2U, 0x00U, NXDN_FRAME_LENGTH_BYTES);
 
-    // generate the LICH
-    channel::LICH lich;
-    lich.setRFCT(RFChannelType::RCCH);
-    lich.setFCT(FuncChannelType::CAC_OUTBOUND);
-    lich.setOption(ChOption::DATA_IDLE);
-    lich.setOutbound(true);
-    lich.encode(data + 2U);
+        Sync::addNXDNSync(data + 2U);
 
-    uint8_t buffer[NXDN_RCCH_LC_LENGTH_BYTES];
-    ::memset(buffer, 0x00U, NXDN_RCCH_LC_LENGTH_BYTES);
+        // generate the LICH
+        channel::LICH lich;
+        lich.setRFCT(RFChannelType::RCCH);
+        lich.setFCT(FuncChannelType::CAC_OUTBOUND);
+        lich.setOption(ChOption::DATA_IDLE);
+        lich.setOutbound(true);
+        lich.encode(data + 2U);
 
-    std::unique_ptr<rcch::MESSAGE_TYPE_IDLE> rcch = std::make_unique<rcch::MESSAGE_TYPE_IDLE>();
-    DEBUG_LOG_MSG(rcch->toString());
-    rcch->encode(buffer, NXDN_RCCH_LC_LENGTH_BITS / 2U);
-    //rcch->encode(buffer, NXDN_RCCH_LC_LENGTH_BITS / 2U, NXDN_RCCH_LC_LENGTH_BITS / 2U);
+        uint8_t buffer[NXDN_RCCH_LC_LENGTH_BYTES];
+        ::memset(buffer, 0x00U, NXDN_RCCH_LC_LENGTH_BYTES);
 
-    // generate the CAC
-    channel::CAC cac;
-    cac.setRAN(m_nxdn->m_ran);
-    cac.setStructure(ChStructure::SR_RCCH_SINGLE);
-    cac.setData(buffer);
-    cac.encode(data + 2U);
+        std::unique_ptr<rcch::MESSAGE_TYPE_IDLE> rcch = std::make_unique<rcch::MESSAGE_TYPE_IDLE>();
+        DEBUG_LOG_MSG(rcch->toString());
+        rcch->encode(buffer, NXDN_RCCH_LC_LENGTH_BITS / 2U);
+        //rcch->encode(buffer, NXDN_RCCH_LC_LENGTH_BITS / 2U, NXDN_RCCH_LC_LENGTH_BITS / 2U);
 
-    data[0U] = modem::TAG_DATA;
-    data[1U] = 0x00U;
+        // generate the CAC
+        channel::CAC cac;
+        cac.setRAN(m_nxdn->m_ran);
+        cac.setStructure(ChStructure::SR_RCCH_SINGLE);
+        cac.setData(buffer);
+        cac.encode(data + 2U);
 
-    NXDNUtils::scrambler(data + 2U);
-    NXDNUtils::addPostBits(data + 2U);
+        data[0U] = modem::TAG_DATA;
+        data[1U] = 0x00U;
+
+        NXDNUtils::scrambler(data + 2U);
+        NXDNUtils::addPostBits(data + 2U);
+
+        if (key != 0U)
+            m_ccCache.insert(key, data);
+    }
 
     if (m_nxdn->m_duplex) {
         m_nxdn->addFrame(data);
@@ -18,6 +18,7 @@
 
 #include "Defines.h"
 #include "common/nxdn/lc/RCCH.h"
+#include "common/BroadcastFrameCache.h"
 #include "nxdn/Control.h"
 
 #include <cstdio>
@@ -82,6 +83,8 @@ namespace nxdn
             RingBuffer<uint8_t> m_pgRCCHQueue;
             RingBuffer<uint8_t> m_mpRCCHQueue;
 
+            BroadcastFrameCache m_ccCache;
+
             bool m_verifyAff;
             bool m_verifyReg;
 
@@ -173,6 +176,13 @@ namespace nxdn
              * @brief Helper to write a CC SITE_INFO broadcast packet on the RF interface.
              */
             void writeRF_CC_Message_Site_Info();
+            /**
+             * @brief Helper to get the broadcast cache key for a CC broadcast message.
+             *  (This validates the broadcast cache against the current site configuration.)
+             * @param messageType Message type.
+             * @returns uint64_t Broadcast cache key, or 0 if the broadcast should not be cached.
+             */
+            uint64_t ccCacheKey(uint8_t messageType);
             /**
              * @brief Helper to write a CC SRV_INFO broadcast packet on the RF interface.
              */
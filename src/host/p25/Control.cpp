@@ -14,6 +14,7 @@
 #include "common/p25/P25Utils.h"
 #include "common/p25/Sync.h"
 #include "common/AESCrypto.h"
+#include "common/EventTrace.h"
 #include "common/Log.h"
 #include "common/Utils.h"
 #include "p25/Control.h"
@@ -607,6 +608,11 @@ void Control::setOptions(yaml::Node& conf, bool supervisor, const std::string cw
     if (m_data != nullptr) {
         m_data->resetRF();
     }
+
+    // site data, bandplan and NAC may have changed
+    if (m_control != nullptr) {
+        m_control->invalidateCtrlCache();
+    }
 }
 
 /* Process a data frame from the RF interface. */
@@ -615,6 +621,8 @@ bool Control::processFrame(uint8_t* data, uint32_t len)
 {
     assert(data != nullptr);
 
+    EventTraceScope trace(TRACE_EVENT::P25_FRAME);
+
     bool sync = data[1U] == 0x01U;
 
     if (data[0U] == modem::TAG_LOST) {
@@ -902,11 +910,10 @@ void Control::clock()
     if (m_network != nullptr) {
         processNetwork();
 
-        if (m_network->getStatus() == network::NET_STAT_RUNNING) {
-            m_siteData.setNetActive(true);
-        }
-        else {
-            m_siteData.setNetActive(false);
+        bool netActive = m_network->getStatus() == network::NET_STAT_RUNNING;
+        if (netActive != m_siteData.netActive()) {
+            m_siteData.setNetActive(netActive);
+            m_control->invalidateCtrlCache();
         }
 
         lc::TDULC::setSiteData(m_siteData);
@@ -1120,6 +1127,11 @@ void Control::clockSiteData(uint32_t ms)
                         uint8_t updateCnt = entry.second;
                         if (updateCnt > 0U) {
                             updateCnt--;
+
+                            // CFVA of the adjacent site broadcast changes once the site has expired
+                            if (updateCnt == 0U) {
+                                m_control->invalidateCtrlCache();
+                            }
                         }
 
                         if (updateCnt == 0U) {
@@ -1450,6 +1462,8 @@ void Control::processNetwork()
         return;
     }
 
+    EventTraceScope trace(TRACE_EVENT::P25_NETWORK);
+
     if (m_netState != RS_NET_DATA) {
         // don't process network frames if the RF modem isn't in a listening state
         if (m_rfState != RS_RF_LISTENING && m_netState == RS_NET_IDLE) {
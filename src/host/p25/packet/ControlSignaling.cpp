@@ -760,6 +760,7 @@ bool ControlSignaling::processNetwork(uint8_t* data, uint32_t len, lc::LC& contr
 
                         m_adjSiteTable[site.siteId()] = site;
                         m_adjSiteUpdateCnt[site.siteId()] = ADJ_SITE_UPDATE_CNT;
+                        invalidateCtrlCache();
                     } else {
                         /*
                         ** treat same site adjacent site broadcast as a SCCB for this site
@@ -782,6 +783,7 @@ bool ControlSignaling::processNetwork(uint8_t* data, uint32_t len, lc::LC& contr
 
                         m_sccbTable[site.rfssId()] = site;
                         m_sccbUpdateCnt[site.rfssId()] = ADJ_SITE_UPDATE_CNT;
+                        invalidateCtrlCache();
                     }
 
                     return true;
@@ -1290,6 +1292,11 @@ ControlSignaling::ControlSignaling(Control* p25, bool dumpTSBKData, bool debug,
     m_microslotCount(0U),
     m_ctrlTimeDateAnn(false),
     m_ctrlTSDUMBF(true),
+    m_ctrlFrameCache(P25_TSDU_FRAME_LENGTH_BYTES),
+    m_ctrlBlockCache(P25_TSBK_FEC_LENGTH_BYTES),
+    m_ctrlIdenCnt(0U),
+    m_ctrlIdenTableVersion(0U),
+    m_ctrlCacheDirty(true),
     m_disableGrantSrcIdCheck(false),
     m_redundantImmediate(true),
     m_redundantGrant(false),
@@ -1561,12 +1568,6 @@ void ControlSignaling::writeNet_TSDU(lc::TSBK* tsbk)
 
 void ControlSignaling::writeRF_TSDU_MBF(lc::TSBK* tsbk)
 {
-    if (!m_p25->m_enableControl) {
-        ::memset(m_rfMBF, 0x00U, P25_PDU_FRAME_LENGTH_BYTES + 2U);
-        m_mbfCnt = 0U;
-        return;
-    }
-
     assert(tsbk != nullptr);
 
     uint8_t frame[P25_TSBK_FEC_LENGTH_BYTES];
@@ -1574,6 +1575,34 @@ void ControlSignaling::writeRF_TSDU_MBF(lc::TSBK* tsbk)
 
     // LogDebug(LOG_P25, "writeRF_TSDU_MBF, mbfCnt = %u", m_mbfCnt);
 
+    // generate TSBK block (the last block of the multi-block frame triggers the frame write)
+    bool lastBlock = (m_mbfCnt + 1U == TSBK_MBF_CNT);
+    tsbk->setLastBlock(lastBlock);
+    tsbk->encode(frame, true);
+
+    if (m_debug) {
+        LogDebug(LOG_RF, P25_TSDU_STR " (MBF), lco = $%02X, mfId = $%02X, lastBlock = %u, AIV = %u, EX = %u, srcId = %u, dstId = %u, sysId = $%03X, netId = $%05X",
+            tsbk->getLCO(), tsbk->getMFId(), tsbk->getLastBlock(), tsbk->getAIV(), tsbk->getEX(), tsbk->getSrcId(), tsbk->getDstId(),
+            tsbk->getSysId(), tsbk->getNetId());
+
+        Utils::dump(1U, (lastBlock) ? "!!! *TSDU MBF Last TSBK Block" : "!!! *TSDU MBF Block Data", frame, P25_TSBK_FEC_LENGTH_BYTES);
+    }
+
+    writeRF_TSDU_MBF_Block(frame);
+}
+
+/* Helper to write an encoded (Trellis coded) TSBK block into a multi-block (3-block) P25 TSDU packet. */
+
+void ControlSignaling::writeRF_TSDU_MBF_Block(const uint8_t* block)
+{
+    if (!m_p25->m_enableControl) {
+        ::memset(m_rfMBF, 0x00U, P25_PDU_FRAME_LENGTH_BYTES + 2U);
+        m_mbfCnt = 0U;
+        return;
+    }
+
+    assert(block != nullptr);
+
     // trunking data is unsupported in simplex operation
     if (!m_p25->m_duplex) {
         ::memset(m_rfMBF, 0x00U, P25_PDU_FRAME_LENGTH_BYTES + 2U);
@@ -1585,36 +1614,21 @@ void ControlSignaling::writeRF_TSDU_MBF(lc::TSBK* tsbk)
         ::memset(m_rfMBF, 0x00U, P25_TSBK_FEC_LENGTH_BYTES * TSBK_MBF_CNT);
     }
 
+    Utils::setBitRange(block, m_rfMBF, (m_mbfCnt * P25_TSBK_FEC_LENGTH_BITS), P25_TSBK_FEC_LENGTH_BITS);
+
     // trigger encoding of last block and write to queue
     if (m_mbfCnt + 1U == TSBK_MBF_CNT) {
-        // generate TSBK block
-        tsbk->setLastBlock(true); // set last block
-        tsbk->encode(frame, true);
-
-        if (m_debug) {
-            LogDebug(LOG_RF, P25_TSDU_STR " (MBF), lco = $%02X, mfId = $%02X, lastBlock = %u, AIV = %u, EX = %u, srcId = %u, dstId = %u, sysId = $%03X, netId = $%05X",
-                tsbk->getLCO(), tsbk->getMFId(), tsbk->getLastBlock(), tsbk->getAIV(), tsbk->getEX(), tsbk->getSrcId(), tsbk->getDstId(),
-                tsbk->getSysId(), tsbk->getNetId());
-
-            Utils::dump(1U, "!!! *TSDU MBF Last TSBK Block", frame, P25_TSBK_FEC_LENGTH_BYTES);
-        }
-
-        Utils::setBitRange(frame, m_rfMBF, (m_mbfCnt * P25_TSBK_FEC_LENGTH_BITS), P25_TSBK_FEC_LENGTH_BITS);
-
         // generate TSDU frame
         uint8_t tsdu[P25_TSDU_TRIPLE_FRAME_LENGTH_BYTES];
         ::memset(tsdu, 0x00U, P25_TSDU_TRIPLE_FRAME_LENGTH_BYTES);
 
+        uint8_t frame[P25_TSBK_FEC_LENGTH_BYTES];
         uint32_t offset = 0U;
         for (uint8_t i = 0U; i < m_mbfCnt + 1U; i++) {
             ::memset(frame, 0x00U, P25_TSBK_FEC_LENGTH_BYTES);
             Utils::getBitRange(m_rfMBF, frame, offset, P25_TSBK_FEC_LENGTH_BITS);
 
             if (m_debug) {
-                LogDebug(LOG_RF, P25_TSDU_STR " (MBF), lco = $%02X, mfId = $%02X, lastBlock = %u, AIV = %u, EX = %u, srcId = %u, dstId = %u, sysId = $%03X, netId = $%05X",
-                    tsbk->getLCO(), tsbk->getMFId(), tsbk->getLastBlock(), tsbk->getAIV(), tsbk->getEX(), tsbk->getSrcId(), tsbk->getDstId(),
-                    tsbk->getSysId(), tsbk->getNetId());
-
                 Utils::dump(1U, "!!! *TSDU (MBF) TSBK Block", frame, P25_TSBK_FEC_LENGTH_BYTES);
             }
 
@@ -1652,19 +1666,6 @@ void ControlSignaling::writeRF_TSDU_MBF(lc::TSBK* tsbk)
         return;
     }
 
-    // generate TSBK block
-    tsbk->setLastBlock(false); // clear last block
-    tsbk->encode(frame, true);
-
-    if (m_debug) {
-        LogDebug(LOG_RF, P25_TSDU_STR " (MBF), lco = $%02X, mfId = $%02X, lastBlock = %u, AIV = %u, EX = %u, srcId = %u, dstId = %u, sysId = $%03X, netId = $%05X",
-            tsbk->getLCO(), tsbk->getMFId(), tsbk->getLastBlock(), tsbk->getAIV(), tsbk->getEX(), tsbk->getSrcId(), tsbk->getDstId(),
-            tsbk->getSysId(), tsbk->getNetId());
-
-        Utils::dump(1U, "!!! *TSDU MBF Block Data", frame, P25_TSBK_FEC_LENGTH_BYTES);
-    }
-
-    Utils::setBitRange(frame, m_rfMBF, (m_mbfCnt * P25_TSBK_FEC_LENGTH_BITS), P25_TSBK_FEC_LENGTH_BITS);
     m_mbfCnt++;
 }
 
@@ -1927,6 +1928,25 @@ void ControlSignaling::queueRF_TSBK_Ctrl(uint8_t lco)
     if (!m_p25->m_enableControl)
         return;
 
+    // static site broadcasts are written from the pre-encoded broadcast cache, when possible
+    uint64_t cacheKey = ctrlCacheKey(lco);
+    if (cacheKey != 0U && writeRF_TSDU_Ctrl(nullptr, cacheKey)) {
+        // advance the rotating broadcast counters as if the TSBK had been generated
+        switch (lco) {
+            case TSBKO::OSP_IDEN_UP:
+                m_mbfIdenCnt++;
+                break;
+            case TSBKO::OSP_ADJ_STS_BCAST:
+                m_mbfAdjSSCnt++;
+                break;
+            case TSBKO::OSP_SCCB_EXP:
+                m_mbfSCCBCnt++;
+                break;
+        }
+
+        return;
+    }
+
     std::unique_ptr<lc::TSBK> tsbk;
 
     switch (lco) {
@@ -2121,6 +2141,11 @@ void ControlSignaling::queueRF_TSBK_Ctrl(uint8_t lco)
     if (tsbk != nullptr) {
         tsbk->setLastBlock(true); // always set last block
 
+        if (cacheKey != 0U) {
+            writeRF_TSDU_Ctrl(tsbk.get(), cacheKey);
+            return;
+        }
+
         // are we transmitting CC as a multi-block?
         if (m_ctrlTSDUMBF) {
             writeRF_TSDU_MBF(tsbk.get());
@@ -2131,6 +2156,170 @@ void ControlSignaling::queueRF_TSBK_Ctrl(uint8_t lco)
     }
 }
 
+/* Helper to get the broadcast cache key for the given control TSBK. */
+
+uint64_t ControlSignaling::ctrlCacheKey(uint8_t lco)
+{
+    // debug dumping requires the TSBK to be generated
+    if (m_debug)
+        return 0U;
+
+    switch (lco) {
+        case TSBKO::OSP_IDEN_UP:
+        case TSBKO::OSP_NET_STS_BCAST:
+        case TSBKO::OSP_RFSS_STS_BCAST:
+        case TSBKO::OSP_ADJ_STS_BCAST:
+        case TSBKO::OSP_SCCB_EXP:
+        case TSBKO::OSP_SNDCP_CH_ANN:
+        case TSBKO::OSP_MOT_PSH_CCH:
+        case TSBKO::OSP_MOT_CC_BSI:
+        case TSBKO::OSP_DVM_GIT_HASH:
+            break;
+        default:
+            return 0U; // SYNC_BCAST and TIME_DATE_ANN change every broadcast
+    }
+
+    // the cached broadcasts depend on the site data, the bandplan, the NAC and the adjacent site tables; the
+    // version is only rehashed when one of those was changed (the bandplan is versioned by the lookup table)
+    uint32_t idenTableVersion = m_p25->m_idenTable->tableVersion();
+    if (m_ctrlCacheDirty || idenTableVersion != m_ctrlIdenTableVersion) {
+        m_ctrlCacheDirty = false;
+        m_ctrlIdenTableVersion = idenTableVersion;
+
+        const SiteData& site = m_p25->m_siteData;
+        uint64_t version = BroadcastFrameCache::INITIAL_VERSION;
+        version = BroadcastFrameCache::hash(version, site.lra());
+        version = BroadcastFrameCache::hash(version, site.netId());
+        version = BroadcastFrameCache::hash(version, site.sysId());
+        version = BroadcastFrameCache::hash(version, site.rfssId());
+        version = BroadcastFrameCache::hash(version, site.siteId());
+        version = BroadcastFrameCache::hash(version, site.channelId());
+        version = BroadcastFrameCache::hash(version, site.channelNo());
+        version = BroadcastFrameCache::hash(version, site.serviceClass());
+        version = BroadcastFrameCache::hash(version, site.netActive() ? 1U : 0U);
+        version = BroadcastFrameCache::hash(version, site.callsign());
+        version = BroadcastFrameCache::hash(version, idenTableVersion);
+        version = BroadcastFrameCache::hash(version, m_p25->m_idenEntry.channelId());
+        version = BroadcastFrameCache::hash(version, m_p25->m_idenEntry.baseFrequency());
+        version = BroadcastFrameCache::hash(version, m_p25->m_txNAC);
+        version = BroadcastFrameCache::hash(version, m_p25->m_sndcpSupport ? 1U : 0U);
+
+        for (auto& entry : m_adjSiteTable) {
+            const SiteData& adjSite = entry.second;
+            version = BroadcastFrameCache::hash(version, adjSite.sysId());
+            version = BroadcastFrameCache::hash(version, adjSite.rfssId());
+            version = BroadcastFrameCache::hash(version, adjSite.siteId());
+            version = BroadcastFrameCache::hash(version, adjSite.channelId());
+            version = BroadcastFrameCache::hash(version, adjSite.channelNo());
+            version = BroadcastFrameCache::hash(version, adjSite.serviceClass());
+
+            // CFVA reflects whether the adjacent site is still updating
+            auto it = m_adjSiteUpdateCnt.find(entry.first);
+            version = BroadcastFrameCache::hash(version, (it == m_adjSiteUpdateCnt.end() || it->second == 0U) ? 1U : 0U);
+        }
+
+        for (auto& entry : m_sccbTable) {
+            version = BroadcastFrameCache::hash(version, entry.second.channelId());
+            version = BroadcastFrameCache::hash(version, entry.second.channelNo());
+        }
+
+        bool flushed = m_ctrlFrameCache.validate(version);
+        flushed = m_ctrlBlockCache.validate(version) || flushed;
+        if (flushed) {
+            m_ctrlIdenCnt = (uint8_t)m_p25->m_idenTable->list().size();
+        }
+    }
+
+    // rotating broadcasts are keyed by their rotation index
+    uint32_t index = 0U;
+    switch (lco) {
+        case TSBKO::OSP_IDEN_UP:
+            if (m_ctrlIdenCnt == 0U)
+                return 0U;
+            if (m_mbfIdenCnt >= m_ctrlIdenCnt)
+                m_mbfIdenCnt = 0U;
+            index = m_mbfIdenCnt;
+            break;
+        case TSBKO::OSP_ADJ_STS_BCAST:
+            if (m_adjSiteTable.size() == 0U)
+                return 0U;
+            if (m_mbfAdjSSCnt >= m_adjSiteTable.size())
+                m_mbfAdjSSCnt = 0U;
+            index = m_mbfAdjSSCnt;
+            break;
+        case TSBKO::OSP_SCCB_EXP:
+            if (m_sccbTable.size() == 0U)
+                return 0U;
+            if (m_mbfSCCBCnt >= m_sccbTable.size())
+                m_mbfSCCBCnt = 0U;
+            index = m_mbfSCCBCnt;
+            break;
+    }
+
+    // bit 0 is reserved for the multi-block last block flag
+    return ((uint64_t)lco << 16) | ((uint64_t)index << 1);
+}
+
+/* Helper to write a control TSBK through the pre-encoded broadcast cache. */
+
+bool ControlSignaling::writeRF_TSDU_Ctrl(lc::TSBK* tsbk, uint64_t key)
+{
+    // are we transmitting CC as a multi-block?
+    if (m_ctrlTSDUMBF) {
+        // multi-block frames cache the Trellis coded block, the last block flag depends on the block position
+        bool lastBlock = (m_mbfCnt + 1U == TSBK_MBF_CNT);
+        key |= (lastBlock) ? 1U : 0U;
+
+        uint8_t block[P25_TSBK_FEC_LENGTH_BYTES];
+        if (!m_ctrlBlockCache.find(key, block)) {
+            if (tsbk == nullptr)
+                return false;
+
+            tsbk->setLastBlock(lastBlock);
+            tsbk->encode(block, true);
+            m_ctrlBlockCache.insert(key, block);
+        }
+
+        writeRF_TSDU_MBF_Block(block);
+        return true;
+    }
+
+    // single-block frames cache the frame up to (but not including) the status bits
+    uint8_t data[P25_TSDU_FRAME_LENGTH_BYTES + 2U];
+    if (!m_ctrlFrameCache.find(key, data + 2U)) {
+        if (tsbk == nullptr)
+            return false;
+
+        ::memset(data + 2U, 0x00U, P25_TSDU_FRAME_LENGTH_BYTES);
+
+        // generate Sync
+        Sync::addP25Sync(data + 2U);
+
+        // generate NID
+        m_p25->m_nid.encode(data + 2U, DUID::TSDU);
+
+        // generate TSBK block
+        tsbk->setLastBlock(true); // always set last block -- this a Single Block TSDU
+        tsbk->encode(data + 2U);
+
+        m_ctrlFrameCache.insert(key, data + 2U);
+    }
+
+    // add status bits
+    P25Utils::addStatusBits(data + 2U, P25_TSDU_FRAME_LENGTH_BITS, m_inbound, true);
+    P25Utils::addIdleStatusBits(data + 2U, P25_TSDU_FRAME_LENGTH_BITS);
+    P25Utils::setStatusBitsStartIdle(data + 2U);
+
+    if (m_p25->m_duplex) {
+        data[0U] = modem::TAG_DATA;
+        data[1U] = 0x00U;
+
+        m_p25->addFrame(data, P25_TSDU_FRAME_LENGTH_BYTES + 2U, false, false);
+    }
+
+    return true;
+}
+
 /* Helper to write a grant packet. */
 
 bool ControlSignaling::writeRF_TSDU_Grant(uint32_t srcId, uint32_t dstId, uint8_t serviceOptions, bool grp, bool net, bool skip, uint32_t chNo)
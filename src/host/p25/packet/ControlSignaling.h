@@ -22,6 +22,7 @@
 #include "common/p25/lc/TSBK.h"
 #include "common/p25/lc/AMBT.h"
 #include "common/p25/lc/TDULC.h"
+#include "common/BroadcastFrameCache.h"
 #include "common/Timer.h"
 #include "p25/Control.h"
 
@@ -201,6 +202,12 @@ namespace p25
 
             bool m_ctrlTSDUMBF;
 
+            BroadcastFrameCache m_ctrlFrameCache;
+            BroadcastFrameCache m_ctrlBlockCache;
+            uint8_t m_ctrlIdenCnt;
+            uint32_t m_ctrlIdenTableVersion;
+            bool m_ctrlCacheDirty;
+
             bool m_disableGrantSrcIdCheck;
             bool m_redundantImmediate;
             bool m_redundantGrant;
@@ -280,6 +287,11 @@ namespace p25
              * @param tsbk TSBK to write to the multi-block queue.
              */
             void writeRF_TSDU_MBF(lc::TSBK* tsbk);
+            /**
+             * @brief Helper to write an encoded (Trellis coded) TSBK block into a multi-block (3-block) P25 TSDU packet.
+             * @param block Encoded TSBK block to write to the multi-block queue.
+             */
+            void writeRF_TSDU_MBF_Block(const uint8_t* block);
             /**
              * @brief Helper to write a alternate multi-block PDU packet.
              * @param tsbk AMBT to write to the modem.
@@ -312,6 +324,25 @@ namespace p25
              * @param lco TSBK LCO to queue into the frame queue.
              */
             void queueRF_TSBK_Ctrl(uint8_t lco);
+            /**
+             * @brief Helper to get the broadcast cache key for the given control TSBK.
+             *  (This validates the broadcast caches against the current site configuration.)
+             * @param lco TSBK LCO.
+             * @returns uint64_t Broadcast cache key, or 0 if the control TSBK is not cacheable.
+             */
+            uint64_t ctrlCacheKey(uint8_t lco);
+            /**
+             * @brief Helper to flag that an input to the broadcast cache version has changed.
+             *  (The version is rehashed, and the caches flushed if it differs, on the next control TSBK.)
+             */
+            void invalidateCtrlCache() { m_ctrlCacheDirty = true; }
+            /**
+             * @brief Helper to write a control TSBK through the pre-encoded broadcast cache.
+             * @param tsbk TSBK to encode on a cache miss, or nullptr to only write a cached frame.
+             * @param key Broadcast cache key.
+             * @returns bool True, if the control TSBK was written, otherwise false.
+             */
+            bool writeRF_TSDU_Ctrl(lc::TSBK* tsbk, uint64_t key);
 
             /**
              * @brief Helper to write a grant packet.
@@ -11,7 +11,11 @@
 #include "common/edac/SHA256.h"
 #include "common/lookups/AffiliationLookup.h"
 #include "common/json/json.h"
+#include "common/json/writer.h"
+#include "common/EventTrace.h"
 #include "common/Log.h"
+#include "common/Metrics.h"
+#include "common/ThreadPolicy.h"
 #include "common/Utils.h"
 #include "dmr/Control.h"
 #include "p25/Control.h"
@@ -32,6 +36,7 @@ using namespace modem;
 #include <cstring>
 
 #include <memory>
+#include <mutex>
 #include <stdexcept>
 #include <unordered_map>
 
@@ -126,7 +131,7 @@ bool parseRequestBody(const HTTPPayload& request, HTTPPayload& reply, json::obje
         return false;
     }
 
-    obj = v.get<json::object>();
+    obj.swap(v.get<json::object>());
     return true;
 }
 
@@ -155,7 +160,8 @@ RESTAPI::RESTAPI(const std::string& address, uint16_t port, const std::string& p
     m_nxdn(nullptr),
     m_ridLookup(nullptr),
     m_tidLookup(nullptr),
-    m_authTokens()
+    m_authTokens(),
+    m_authLock()
 {
     assert(!address.empty());
     assert(port > 0U);
@@ -219,6 +225,16 @@ void RESTAPI::setProtocols(dmr::Control* dmr, p25::Control* p25, nxdn::Control*
     m_nxdn = nxdn;
 }
 
+/* Sets the number of REST API worker threads. */
+
+void RESTAPI::setWorkers(uint32_t workers, uint32_t blockingWorkers)
+{
+#if defined(ENABLE_SSL)
+    m_restSecureServer.setWorkers(workers, blockingWorkers);
+#endif // ENABLE_SSL
+    m_restServer.setWorkers(workers, blockingWorkers);
+}
+
 /* Opens connection to the network. */
 
 bool RESTAPI::open()
@@ -282,6 +298,10 @@ void RESTAPI::initializeEndpoints()
 
     m_dispatcher.match(GET_VERSION).get(REST_API_BIND(RESTAPI::restAPI_GetVersion, this));
     m_dispatcher.match(GET_STATUS).get(REST_API_BIND(RESTAPI::restAPI_GetStatus, this));
+    m_dispatcher.match(GET_THREADS).get(REST_API_BIND(RESTAPI::restAPI_GetThreads, this));
+    m_dispatcher.match(GET_METRICS).get(REST_API_BIND(RESTAPI::restAPI_GetMetrics, this));
+    m_dispatcher.match(GET_TRACE).get(REST_API_BIND(RESTAPI::restAPI_GetTrace, this));
+    m_dispatcher.match(PUT_TRACE).put(REST_API_BIND(RESTAPI::restAPI_PutTrace, this));
     m_dispatcher.match(GET_VOICE_CH).get(REST_API_BIND(RESTAPI::restAPI_GetVoiceCh, this));
 
     m_dispatcher.match(PUT_MDM_MODE).put(REST_API_BIND(RESTAPI::restAPI_PutModemMode, this));
@@ -306,7 +326,7 @@ void RESTAPI::initializeEndpoints()
     m_dispatcher.match(PUT_DMR_RID).put(REST_API_BIND(RESTAPI::restAPI_PutDMRRID, this));
     m_dispatcher.match(GET_DMR_CC_DEDICATED).get(REST_API_BIND(RESTAPI::restAPI_GetDMRCCEnable, this));
     m_dispatcher.match(GET_DMR_CC_BCAST).get(REST_API_BIND(RESTAPI::restAPI_GetDMRCCBroadcast, this));
-    m_dispatcher.match(GET_DMR_AFFILIATIONS).get(REST_API_BIND(RESTAPI::restAPI_GetDMRAffList, this));
+    m_dispatcher.match(GET_DMR_AFFILIATIONS).blocking().get(REST_API_BIND(RESTAPI::restAPI_GetDMRAffList, this));
 
     /*
     ** Project 25
@@ -319,7 +339,7 @@ void RESTAPI::initializeEndpoints()
     m_dispatcher.match(GET_P25_CC_DEDICATED).get(REST_API_BIND(RESTAPI::restAPI_GetP25CCEnable, this));
     m_dispatcher.match(GET_P25_CC_BCAST).get(REST_API_BIND(RESTAPI::restAPI_GetP25CCBroadcast, this));
     m_dispatcher.match(PUT_P25_RAW_TSBK).put(REST_API_BIND(RESTAPI::restAPI_PutP25RawTSBK, this));
-    m_dispatcher.match(GET_P25_AFFILIATIONS).get(REST_API_BIND(RESTAPI::restAPI_GetP25AffList, this));
+    m_dispatcher.match(GET_P25_AFFILIATIONS).blocking().get(REST_API_BIND(RESTAPI::restAPI_GetP25AffList, this));
 
     /*
     ** Next Generation Digital Narrowband
@@ -329,13 +349,14 @@ void RESTAPI::initializeEndpoints()
     m_dispatcher.match(GET_NXDN_DEBUG).get(REST_API_BIND(RESTAPI::restAPI_GetNXDNDebug, this));
     m_dispatcher.match(GET_NXDN_DUMP_RCCH).get(REST_API_BIND(RESTAPI::restAPI_GetNXDNDumpRCCH, this));
     m_dispatcher.match(GET_NXDN_CC_DEDICATED).get(REST_API_BIND(RESTAPI::restAPI_GetNXDNCCEnable, this));
-    m_dispatcher.match(GET_NXDN_AFFILIATIONS).get(REST_API_BIND(RESTAPI::restAPI_GetNXDNAffList, this));
+    m_dispatcher.match(GET_NXDN_AFFILIATIONS).blocking().get(REST_API_BIND(RESTAPI::restAPI_GetNXDNAffList, this));
 }
 
 /* Helper to invalidate a host token. */
 
 void RESTAPI::invalidateHostToken(const std::string host)
 {
+    std::lock_guard<std::mutex> lock(m_authLock);
     auto token = std::find_if(m_authTokens.begin(), m_authTokens.end(), [&](const AuthTokenValueType& tok) { return tok.first == host; });
     if (token != m_authTokens.end()) {
         m_authTokens.erase(host);
@@ -356,6 +377,7 @@ bool RESTAPI::validateAuth(const HTTPPayload& request, HTTPPayload& reply)
         return false;
     }
 
+    std::lock_guard<std::mutex> lock(m_authLock);
     for (auto& token : m_authTokens) {
 #if DEBUG_HTTP_PAYLOAD
         ::LogDebugEx(LOG_REST, "RESTAPI::validateAuth()", "valid list, host = %s, token = %s", token.first.c_str(), std::to_string(token.second).c_str());
@@ -448,10 +470,16 @@ void RESTAPI::restAPI_PutAuth(const HTTPPayload& request, HTTPPayload& reply, co
     delete[] passwordHash;
 
     invalidateHostToken(host);
-    std::uniform_int_distribution<uint64_t> dist(DVM_RAND_MIN, DVM_REST_RAND_MAX);
-    uint64_t salt = dist(m_random);
 
-    m_authTokens[host] = salt;
+    uint64_t salt = 0U;
+    {
+        std::lock_guard<std::mutex> lock(m_authLock);
+        std::uniform_int_distribution<uint64_t> dist(DVM_RAND_MIN, DVM_REST_RAND_MAX);
+        salt = dist(m_random);
+
+        m_authTokens[host] = salt;
+    }
+
     response["token"].set<std::string>(std::to_string(salt));
     reply.payload(response);
 }
@@ -494,6 +522,78 @@ void RESTAPI::restAPI_GetStatus(const HTTPPayload& request, HTTPPayload& reply,
     reply.payload(response);
 }
 
+/* REST API endpoint; implements get thread scheduling policy request. */
+
+void RESTAPI::restAPI_GetThreads(const HTTPPayload& request, HTTPPayload& reply, const RequestMatch& match)
+{
+    if (!validateAuth(request, reply)) {
+        return;
+    }
+
+    json::object response = ThreadPolicy::status();
+    setResponseDefaultStatus(response);
+
+    reply.payload(response);
+}
+
+/* REST API endpoint; implements get metrics request. */
+
+void RESTAPI::restAPI_GetMetrics(const HTTPPayload& request, HTTPPayload& reply, const RequestMatch& match)
+{
+    // metrics are intentionally not authenticated, scrapers cannot perform the authentication exchange
+    std::string content = metrics::Registry::expose();
+    reply.payload(content, HTTPPayload::OK, metrics::CONTENT_TYPE);
+}
+
+/* REST API endpoint; implements get event trace request. */
+
+void RESTAPI::restAPI_GetTrace(const HTTPPayload& request, HTTPPayload& reply, const RequestMatch& match)
+{
+    if (!validateAuth(request, reply)) {
+        return;
+    }
+
+    std::string content = EventTrace::chromeTrace();
+    reply.payload(content, HTTPPayload::OK, "application/json");
+}
+
+/* REST API endpoint; implements put event trace request. */
+
+void RESTAPI::restAPI_PutTrace(const HTTPPayload& request, HTTPPayload& reply, const RequestMatch& match)
+{
+    if (!validateAuth(request, reply)) {
+        return;
+    }
+
+    json::object req = json::object();
+    if (!parseRequestBody(request, reply, req)) {
+        return;
+    }
+
+    errorPayload(reply, "OK", HTTPPayload::OK);
+
+    if (req.find("enable") != req.end()) {
+        if (!req["enable"].is<bool>()) {
+            errorPayload(reply, "enable was not a valid boolean");
+            return;
+        }
+
+        bool enable = req["enable"].get<bool>();
+        LogInfoEx(LOG_REST, "Event tracing %s", enable ? "enabled" : "disabled");
+        EventTrace::setEnabled(enable);
+    }
+
+    if (req.find("clear") != req.end()) {
+        if (!req["clear"].is<bool>()) {
+            errorPayload(reply, "clear was not a valid boolean");
+            return;
+        }
+
+        if (req["clear"].get<bool>())
+            EventTrace::clear();
+    }
+}
+
 /* REST API endpoint; implements get voice channels request. */
 
 void RESTAPI::restAPI_GetVoiceCh(const HTTPPayload& request, HTTPPayload& reply, const RequestMatch& match)
@@ -1254,28 +1354,24 @@ void RESTAPI::restAPI_GetDMRAffList(const HTTPPayload& request, HTTPPayload& rep
         return;
     }
 
-    json::object response = json::object();
-    setResponseDefaultStatus(response);
+    json::writer writer;
+    writer.beginObject();
+    writer.member("status", (int)HTTPPayload::OK);
 
-    json::array affs = json::array();
+    writer.key("affiliations").beginArray();
     if (m_dmr->affiliations() != nullptr) {
         std::unordered_map<uint32_t, uint32_t> affTable = m_dmr->affiliations()->grpAffTable();
-        if (affTable.size() > 0) {
-            for (auto entry : affTable) {
-                uint32_t srcId = entry.first;
-                uint32_t grpId = entry.second;
-
-                json::object aff = json::object();
-                aff["srcId"].set<uint32_t>(srcId);
-                aff["grpId"].set<uint32_t>(grpId);
-
-                affs.push_back(json::value(aff));
-            }
+        for (auto& entry : affTable) {
+            writer.beginObject();
+            writer.member("srcId", entry.first);
+            writer.member("grpId", entry.second);
+            writer.endObject();
         }
     }
+    writer.endArray();
 
-    response["affiliations"].set<json::array>(affs);
-    reply.payload(response);
+    writer.endObject();
+    reply.payload(writer);
 }
 
 /*
@@ -1628,28 +1724,24 @@ void RESTAPI::restAPI_GetP25AffList(const HTTPPayload& request, HTTPPayload& rep
         return;
     }
 
-    json::object response = json::object();
-    setResponseDefaultStatus(response);
+    json::writer writer;
+    writer.beginObject();
+    writer.member("status", (int)HTTPPayload::OK);
 
-    json::array affs = json::array();
+    writer.key("affiliations").beginArray();
     if (m_p25->affiliations() != nullptr) {
         std::unordered_map<uint32_t, uint32_t> affTable = m_p25->affiliations()->grpAffTable();
-        if (affTable.size() > 0) {
-            for (auto entry : affTable) {
-                uint32_t srcId = entry.first;
-                uint32_t grpId = entry.second;
-
-                json::object aff = json::object();
-                aff["srcId"].set<uint32_t>(srcId);
-                aff["grpId"].set<uint32_t>(grpId);
-
-                affs.push_back(json::value(aff));
-            }
+        for (auto& entry : affTable) {
+            writer.beginObject();
+            writer.member("srcId", entry.first);
+            writer.member("grpId", entry.second);
+            writer.endObject();
         }
     }
+    writer.endArray();
 
-    response["affiliations"].set<json::array>(affs);
-    reply.payload(response);
+    writer.endObject();
+    reply.payload(writer);
 }
 
 /*
@@ -1797,26 +1889,22 @@ void RESTAPI::restAPI_GetNXDNAffList(const HTTPPayload& request, HTTPPayload& re
         return;
     }
 
-    json::object response = json::object();
-    setResponseDefaultStatus(response);
+    json::writer writer;
+    writer.beginObject();
+    writer.member("status", (int)HTTPPayload::OK);
 
-    json::array affs = json::array();
+    writer.key("affiliations").beginArray();
     if (m_nxdn->affiliations() != nullptr) {
         std::unordered_map<uint32_t, uint32_t> affTable = m_nxdn->affiliations()->grpAffTable();
-        if (affTable.size() > 0) {
-            for (auto entry : affTable) {
-                uint32_t srcId = entry.first;
-                uint32_t grpId = entry.second;
-
-                json::object aff = json::object();
-                aff["srcId"].set<uint32_t>(srcId);
-                aff["grpId"].set<uint32_t>(grpId);
-
-                affs.push_back(json::value(aff));
-            }
+        for (auto& entry : affTable) {
+            writer.beginObject();
+            writer.member("srcId", entry.first);
+            writer.member("grpId", entry.second);
+            writer.endObject();
         }
     }
+    writer.endArray();
 
-    response["affiliations"].set<json::array>(affs);
-    reply.payload(response);
+    writer.endObject();
+    reply.payload(writer);
 }
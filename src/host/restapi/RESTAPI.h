@@ -27,6 +27,7 @@
 
 #include <vector>
 #include <string>
+#include <mutex>
 #include <random>
 
 // ---------------------------------------------------------------------------
@@ -80,6 +81,14 @@ public:
      */
     void setProtocols(dmr::Control* dmr, p25::Control* p25, nxdn::Control* nxdn);
 
+    /**
+     * @brief Sets the number of REST API worker threads.
+     * @param workers Number of threads servicing REST API connections.
+     * @param blockingWorkers Number of threads running blocking REST API endpoints (0 runs blocking
+     *  endpoints on the connection threads).
+     */
+    void setWorkers(uint32_t workers, uint32_t blockingWorkers);
+
     /**
      * @brief Opens connection to the network.
      * @returns bool True, if REST API services are started, otherwise false. 
@@ -119,6 +128,7 @@ private:
 
     typedef std::unordered_map<std::string, uint64_t>::value_type AuthTokenValueType;
     std::unordered_map<std::string, uint64_t> m_authTokens;
+    std::mutex m_authLock;
 
     /**
      * @brief Thread entry point. This function is provided to run the thread
@@ -166,6 +176,34 @@ private:
      * @param match HTTP request matcher.
      */
     void restAPI_GetStatus(const HTTPPayload& request, HTTPPayload& reply, const restapi::RequestMatch& match);
+    /**
+     * @brief REST API endpoint; implements get thread scheduling policy request.
+     * @param request HTTP request.
+     * @param reply HTTP reply.
+     * @param match HTTP request matcher.
+     */
+    void restAPI_GetThreads(const HTTPPayload& request, HTTPPayload& reply, const restapi::RequestMatch& match);
+    /**
+     * @brief REST API endpoint; implements get metrics request.
+     * @param request HTTP request.
+     * @param reply HTTP reply.
+     * @param match HTTP request matcher.
+     */
+    void restAPI_GetMetrics(const HTTPPayload& request, HTTPPayload& reply, const restapi::RequestMatch& match);
+    /**
+     * @brief REST API endpoint; implements get event trace request.
+     * @param request HTTP request.
+     * @param reply HTTP reply.
+     * @param match HTTP request matcher.
+     */
+    void restAPI_GetTrace(const HTTPPayload& request, HTTPPayload& reply, const restapi::RequestMatch& match);
+    /**
+     * @brief REST API endpoint; implements put event trace request.
+     * @param request HTTP request.
+     * @param reply HTTP reply.
+     * @param match HTTP request matcher.
+     */
+    void restAPI_PutTrace(const HTTPPayload& request, HTTPPayload& reply, const restapi::RequestMatch& match);
     /**
      * @brief REST API endpoint; implements get voice channels request.
      * @param request HTTP request.
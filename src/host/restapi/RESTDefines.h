@@ -35,6 +35,10 @@
 
 #define GET_VERSION                     "/version"
 #define GET_STATUS                      "/status"
+#define GET_THREADS                     "/threads"
+#define GET_METRICS                     "/metrics"
+#define GET_TRACE                       "/trace"
+#define PUT_TRACE                       "/trace"
 #define GET_VOICE_CH                    "/voice-ch"
 
 #define PUT_MDM_MODE                    "/mdm/mode"
@@ -35,6 +35,7 @@
 
 #define RCD_GET_VERSION                 "version"
 #define RCD_GET_STATUS                  "status"
+#define RCD_GET_THREADS                 "threads"
 #define RCD_GET_VOICE_CH                "voice-ch"
 
 #define RCD_FNE_GET_PEERLIST            "fne-peerlist"
@@ -214,6 +215,7 @@ void usage(const char* message, const char* arg)
     reply += "\r\nRCON Commands & Arguments\r\nGeneral Commands:\r\n";
     reply += "  version                     Display current version of host\r\n";
     reply += "  status                      Display current settings and operation mode\r\n";
+    reply += "  threads                     Display the effective scheduling policy of named threads\r\n";
     reply += "  voice-ch                    Retrieves the list of configured voice channels\r\n";
     reply += "\r\n";
     reply += "  fne-peerlist                Retrieves the list of connected peers (Converged FNE only)\r\n";
@@ -502,6 +504,9 @@ int main(int argc, char** argv)
         else if (rcom == RCD_GET_STATUS) {
             retCode = client->send(HTTP_GET, GET_STATUS, json::object(), response);
         }
+        else if (rcom == RCD_GET_THREADS) {
+            retCode = client->send(HTTP_GET, GET_THREADS, json::object(), response);
+        }
         else if (rcom == RCD_GET_VOICE_CH) {
             retCode = client->send(HTTP_GET, GET_VOICE_CH, json::object(), response);
         }
@@ -287,6 +287,7 @@ bool PeerNetwork::writeConfig()
     config["sysView"].set<bool>(sysView);                                           // SysView Peer Marker
 
     config["software"].set<std::string>(std::string(software));                     // Software ID
+    writeResumeProof(config);
 
     json::value v = json::value(config);
     std::string json = v.serialize();
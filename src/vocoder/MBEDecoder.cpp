@@ -72,7 +72,8 @@ const int MBEDecoder::rZ[36] = {
 MBEDecoder::MBEDecoder(MBE_DECODER_MODE mode) :
     m_mbelibParms(NULL),
     m_mbeMode(mode),
-    m_gainAdjust(1.0f)
+    m_gainAdjust(1.0f),
+    m_autoGain(false)
 {
     m_mbelibParms = new mbelibParms();
     mbe_initMbeParms(m_mbelibParms->m_cur_mp, m_mbelibParms->m_prev_mp, m_mbelibParms->m_prev_mp_enhanced);
@@ -314,3 +315,92 @@ int32_t MBEDecoder::decode(uint8_t* codeword, int16_t samples[])
 
     return errs;
 }
+
+/* Decodes the given MBE codewords to MBE model parameters using the decoder mode. */
+
+int32_t MBEDecoder::decodeParms(uint8_t* codeword, mbe_parms* parms)
+{
+    int32_t errs = 0;
+    int bad = 0;
+
+    mbe_parms* cur_mp = m_mbelibParms->m_cur_mp;
+    mbe_parms* prev_mp = m_mbelibParms->m_prev_mp;
+
+    switch (m_mbeMode)
+    {
+    case DECODE_DMR_AMBE:
+    {
+        char ambe_d[49U];
+        char ambe_fr[4][24];
+        ::memset(ambe_d, 0x00U, 49U);
+        ::memset(ambe_fr, 0x00U, 96U);
+
+        const int* w, *x, *y, *z;
+
+        w = rW;
+        x = rX;
+        y = rY;
+        z = rZ;
+
+        for (int i = 0; i < 9; ++i) {
+            for (int j = 0; j < 8; j += 2) {
+                ambe_fr[*y][*z] = (1 & (codeword[i] >> (7 - (j + 1))));
+                ambe_fr[*w][*x] = (1 & (codeword[i] >> (7 - j)));
+                w++;
+                x++;
+                y++;
+                z++;
+            }
+        }
+
+        errs = mbe_eccAmbe3600x2450C0(ambe_fr);
+        mbe_demodulateAmbe3600x2450Data(ambe_fr);
+        errs += mbe_eccAmbe3600x2450Data(ambe_fr, ambe_d);
+
+        bad = mbe_decodeAmbe2450Parms(ambe_d, cur_mp, prev_mp);
+        if (bad == 2 || bad == 3) {
+            // erasure or tone frame
+            cur_mp->repeat = 0;
+        }
+        else if (errs > 3) {
+            mbe_useLastMbeParms(cur_mp, prev_mp);
+            cur_mp->repeat++;
+        }
+        else {
+            cur_mp->repeat = 0;
+        }
+    }
+    break;
+
+    case DECODE_88BIT_IMBE:
+    {
+        char imbe_d[88U];
+        ::memset(imbe_d, 0x00U, 88U);
+
+        for (int i = 0; i < 11; ++i) {
+            for (int j = 0; j < 8; j++) {
+                imbe_d[j + (8 * i)] = (1 & (codeword[i] >> (7 - j)));
+            }
+        }
+
+        if (mbe_decodeImbe4400Parms(imbe_d, cur_mp, prev_mp) == 1) {
+            mbe_useLastMbeParms(cur_mp, prev_mp);
+            cur_mp->repeat++;
+        }
+        else {
+            cur_mp->repeat = 0;
+        }
+    }
+    break;
+    }
+
+    if (bad == 0 && cur_mp->repeat <= 3) {
+        mbe_moveMbeParms(cur_mp, prev_mp);
+    }
+    else {
+        mbe_initMbeParms(cur_mp, prev_mp, m_mbelibParms->m_prev_mp_enhanced);
+    }
+
+    ::memcpy(parms, cur_mp, sizeof(mbe_parms));
+    return errs;
+}
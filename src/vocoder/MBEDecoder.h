@@ -110,6 +110,18 @@ namespace vocoder
          */
         int32_t decode(uint8_t* codeword, int16_t samples[]);
 
+        /**
+         * @brief Decodes the given MBE codewords to MBE model parameters (fundamental frequency, voiced/unvoiced
+         *  decisions and spectral amplitudes) using the decoder mode, without synthesizing PCM samples.
+         * 
+         *  Erasure, tone and unrecoverable frames are returned as silence; frames with too many errors repeat
+         *  the last good parameters.
+         * @param[in] codeword MBE codeword.
+         * @param[out] parms MBE model parameters.
+         * @returns int32_t Number of bit errors corrected.
+         */
+        int32_t decodeParms(uint8_t* codeword, mbe_parms* parms);
+
     private:
         mbelibParms* m_mbelibParms;
 
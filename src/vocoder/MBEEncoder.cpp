@@ -573,6 +573,78 @@ static void encodeDmrAMBE(const uint8_t* in, uint8_t* out)
     }
 }
 
+/**
+ * @brief Helper to pack the given AMBE parameter vector into DMR AMBE codewords.
+ * @param[in] b AMBE parameter vector.
+ * @param[out] codeword DMR AMBE codewords.
+ */
+static void encodeAMBEFrame(const int b[9], uint8_t* codeword)
+{
+    uint8_t bits[49U];
+    ::memset(bits, 0x00U, 49U);
+
+    encode49bit(bits, b);
+
+    // build 49-bit AMBE bytes
+    uint8_t rawAmbe[9U];
+    ::memset(rawAmbe, 0x00U, 9U);
+
+    for (int i = 0; i < 7; ++i) {
+        for (int j = 0; j < 8; ++j) {
+            rawAmbe[i] |= (bits[(i * 8) + j] << (7 - j));
+        }
+    }
+
+    // build DMR AMBE bytes
+    uint8_t dmrAMBE[9U];
+    ::memset(dmrAMBE, 0x00U, 9U);
+
+    encodeDmrAMBE(rawAmbe, dmrAMBE);
+    ::memcpy(codeword, dmrAMBE, 9U);
+}
+
+/**
+ * @brief Helper to pack the given IMBE frame vector into 88-bit IMBE codewords.
+ * @param[in] frame_vector IMBE frame vector (u0 - u7).
+ * @param[out] codeword 88-bit IMBE codewords.
+ */
+static void encodeIMBE(const int16_t* frame_vector, uint8_t* codeword)
+{
+    uint32_t offset = 0U;
+    int16_t mask = 0x0800;
+
+    for (uint32_t i = 0U; i < 12U; i++, mask >>= 1, offset++)
+        WRITE_BIT(codeword, offset, (frame_vector[0U] & mask) != 0);
+
+    mask = 0x0800;
+    for (uint32_t i = 0U; i < 12U; i++, mask >>= 1, offset++)
+        WRITE_BIT(codeword, offset, (frame_vector[1U] & mask) != 0);
+
+    mask = 0x0800;
+    for (uint32_t i = 0U; i < 12U; i++, mask >>= 1, offset++)
+        WRITE_BIT(codeword, offset, (frame_vector[2U] & mask) != 0);
+
+    mask = 0x0800;
+    for (uint32_t i = 0U; i < 12U; i++, mask >>= 1, offset++)
+        WRITE_BIT(codeword, offset, (frame_vector[3U] & mask) != 0);
+
+    mask = 0x0400;
+    for (uint32_t i = 0U; i < 11U; i++, mask >>= 1, offset++)
+        WRITE_BIT(codeword, offset, (frame_vector[4U] & mask) != 0);
+
+    mask = 0x0400;
+    for (uint32_t i = 0U; i < 11U; i++, mask >>= 1, offset++)
+        WRITE_BIT(codeword, offset, (frame_vector[5U] & mask) != 0);
+
+    mask = 0x0400;
+    for (uint32_t i = 0U; i < 11U; i++, mask >>= 1, offset++)
+        WRITE_BIT(codeword, offset, (frame_vector[6U] & mask) != 0);
+
+    mask = 0x0040;
+    for (uint32_t i = 0U; i < 7U; i++, mask >>= 1, offset++)
+        WRITE_BIT(codeword, offset, (frame_vector[7U] & mask) != 0);
+}
+
 // ---------------------------------------------------------------------------
 //  Public Class Members
 // ---------------------------------------------------------------------------
@@ -652,66 +724,40 @@ void MBEEncoder::encode(int16_t* samples, uint8_t* codeword)
             m_vocoder.set_gain_adjust(m_gainAdjust);
         }
 
-        uint32_t offset = 0U;
-        int16_t mask = 0x0800;
-
-        for (uint32_t i = 0U; i < 12U; i++, mask >>= 1, offset++)
-            WRITE_BIT(codeword, offset, (frame_vector[0U] & mask) != 0);
-
-        mask = 0x0800;
-        for (uint32_t i = 0U; i < 12U; i++, mask >>= 1, offset++)
-            WRITE_BIT(codeword, offset, (frame_vector[1U] & mask) != 0);
-
-        mask = 0x0800;
-        for (uint32_t i = 0U; i < 12U; i++, mask >>= 1, offset++)
-            WRITE_BIT(codeword, offset, (frame_vector[2U] & mask) != 0);
-
-        mask = 0x0800;
-        for (uint32_t i = 0U; i < 12U; i++, mask >>= 1, offset++)
-            WRITE_BIT(codeword, offset, (frame_vector[3U] & mask) != 0);
-
-        mask = 0x0400;
-        for (uint32_t i = 0U; i < 11U; i++, mask >>= 1, offset++)
-            WRITE_BIT(codeword, offset, (frame_vector[4U] & mask) != 0);
-
-        mask = 0x0400;
-        for (uint32_t i = 0U; i < 11U; i++, mask >>= 1, offset++)
-            WRITE_BIT(codeword, offset, (frame_vector[5U] & mask) != 0);
-
-        mask = 0x0400;
-        for (uint32_t i = 0U; i < 11U; i++, mask >>= 1, offset++)
-            WRITE_BIT(codeword, offset, (frame_vector[6U] & mask) != 0);
-
-        mask = 0x0040;
-        for (uint32_t i = 0U; i < 7U; i++, mask >>= 1, offset++)
-            WRITE_BIT(codeword, offset, (frame_vector[7U] & mask) != 0);
+        encodeIMBE(frame_vector, codeword);
     }
     else {
         int b[9];
 
         // halfrate audio encoding - output rate is 2450 (49 bits)
         encodeAMBE(m_vocoder.param(), b, &m_curMBEParms, &m_prevMBEParms, m_gainAdjust);
+        encodeAMBEFrame(b, codeword);
+    }
+}
 
-        uint8_t bits[49U];
-        ::memset(bits, 0x00U, 49U);
-
-        encode49bit(bits, b);
+/* Encodes the given MBE model parameters using the encoder mode to MBE codewords. */
 
-        // build 49-bit AMBE bytes
-        uint8_t rawAmbe[9U];
-        ::memset(rawAmbe, 0x00U, 9U);
+void MBEEncoder::encodeParam(IMBE_PARAM* param, uint8_t* codeword)
+{
+    assert(param != nullptr);
+    assert(codeword != nullptr);
 
-        for (int i = 0; i < 7; ++i) {
-            for (int j = 0; j < 8; ++j) {
-                rawAmbe[i] |= (bits[(i * 8) + j] << (7 - j));
-            }
+    if (m_mbeMode == ENCODE_88BIT_IMBE) {
+        if (m_gainAdjust >= 1.0f) {
+            m_vocoder.set_gain_adjust(m_gainAdjust);
         }
 
-        // build DMR AMBE bytes
-        uint8_t dmrAMBE[9U];
-        ::memset(dmrAMBE, 0x00U, 9U);
+        int16_t frame_vector[8];
+        m_vocoder.imbe_encode_param(frame_vector, param);
 
-        encodeDmrAMBE(rawAmbe, dmrAMBE);
-        ::memcpy(codeword, dmrAMBE, 9U);
+        encodeIMBE(frame_vector, codeword);
+    }
+    else {
+        int b[9];
+        ::memset(b, 0x00U, sizeof(b));
+
+        // halfrate audio encoding - output rate is 2450 (49 bits)
+        encodeAMBE(param, b, &m_curMBEParms, &m_prevMBEParms, m_gainAdjust);
+        encodeAMBEFrame(b, codeword);
     }
 }
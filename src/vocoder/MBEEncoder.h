@@ -66,6 +66,14 @@ namespace vocoder
          */
         void encode(int16_t* samples, uint8_t* codeword);
 
+        /**
+         * @brief Encodes the given MBE model parameters using the encoder mode to MBE codewords, without
+         *  speech analysis.
+         * @param[in] param MBE model parameters (pitch, voiced/unvoiced decisions and spectral amplitudes).
+         * @param[out] codeword MBE codewords.
+         */
+        void encodeParam(IMBE_PARAM* param, uint8_t* codeword);
+
     private:
         imbe_vocoder m_vocoder;
         mbe_parms m_curMBEParms;
@@ -0,0 +1,95 @@
+// SPDX-License-Identifier: GPL-2.0-only
+/*
+ * Digital Voice Modem - MBE Vocoder
+ * GPLv2 Open Source. Use is subject to license terms.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ *  Copyright (C) 2026 Bryan Biedenkapp, N2PLL
+ *
+ */
+/**
+ * @file MBETranscoder.h
+ * @ingroup vocoder
+ * @file MBETranscoder.cpp
+ * @ingroup vocoder
+ */
+#if !defined(__MBE_TRANSCODER_H__)
+#define __MBE_TRANSCODER_H__
+
+#include "common/Defines.h"
+#include "vocoder/MBEDecoder.h"
+#include "vocoder/MBEEncoder.h"
+#include "vocoder/imbe/imbe_vocoder.h"
+
+#include <stdint.h>
+
+namespace vocoder
+{
+    // ---------------------------------------------------------------------------
+    //  Constants
+    // ---------------------------------------------------------------------------
+
+    /**
+     * @brief Vocoder Transcoding Mode
+     */
+    enum MBE_TRANSCODER_MODE {
+        TRANSCODE_DMR_AMBE_TO_IMBE,     //!< DMR AMBE to 88-bit IMBE (P25)
+        TRANSCODE_IMBE_TO_DMR_AMBE      //!< 88-bit IMBE (P25) to DMR AMBE
+    };
+
+    // ---------------------------------------------------------------------------
+    //  Class Declaration
+    // ---------------------------------------------------------------------------
+
+    /**
+     * @brief Implements MBE parametric transcoding between DMR AMBE and 88-bit IMBE.
+     * 
+     *  Rather than synthesizing PCM audio from the source codewords and running full speech analysis on
+     *  it to encode the target codewords, the source codewords are only decoded to MBE model parameters
+     *  (pitch, voiced/unvoiced decisions and spectral amplitudes), which are then re-quantized directly by
+     *  the target codec.
+     * 
+     *  An instance carries the predictive quantizer state of a single audio stream; use one instance per
+     *  call.
+     * 
+     *  The only in-tree consumer is the vocoder service (transcoding channels, see VocoderService); neither
+     *  dvmbridge nor dvmpatch opens a transcoding channel yet.
+     */
+    class HOST_SW_API MBETranscoder {
+    public:
+        /**
+         * @brief Initializes a new instance of the MBETranscoder class.
+         * @param mode Transcoder mode.
+         */
+        MBETranscoder(MBE_TRANSCODER_MODE mode);
+        /**
+         * @brief Finalizes a instance of the MBETranscoder class.
+         */
+        ~MBETranscoder();
+
+        /**
+         * @brief Transcodes the given MBE codewords using the transcoder mode.
+         * @param[in] codeword Source MBE codewords (9 bytes for DMR AMBE, 11 bytes for IMBE).
+         * @param[out] out Target MBE codewords (11 bytes for IMBE, 9 bytes for DMR AMBE).
+         * @returns int32_t Number of bit errors corrected in the source DMR AMBE codewords, or -1 if the source
+         *  IMBE codewords were invalid and the previous frame was repeated.
+         */
+        int32_t transcode(uint8_t* codeword, uint8_t* out);
+
+        /**
+         * @brief Helper to convert MBE model parameters decoded from DMR AMBE to IMBE model parameters.
+         * @param[in] mp MBE model parameters.
+         * @param[out] param IMBE model parameters.
+         */
+        static void ambeToIMBEParam(const mbe_parms* mp, IMBE_PARAM* param);
+
+    private:
+        MBE_TRANSCODER_MODE m_mode;
+
+        MBEDecoder* m_decoder;
+        MBEEncoder* m_encoder;
+        imbe_vocoder* m_imbe;
+    };
+} // namespace vocoder
+
+#endif // __MBE_TRANSCODER_H__
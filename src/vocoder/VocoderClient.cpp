@@ -0,0 +1,292 @@
+// SPDX-License-Identifier: GPL-2.0-only
+/*
+ * Digital Voice Modem - MBE Vocoder
+ * GPLv2 Open Source. Use is subject to license terms.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ *  Copyright (C) 2026 Bryan Biedenkapp, N2PLL
+ *
+ */
+#include "common/Defines.h"
+#include "vocoder/VocoderClient.h"
+
+#include <cassert>
+#include <cstring>
+#include <thread>
+#if !defined(_WIN32)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif // !defined(_WIN32)
+
+using namespace vocoder;
+using namespace vocoder::shm;
+
+// ---------------------------------------------------------------------------
+//  Constants
+// ---------------------------------------------------------------------------
+
+const uint64_t HEARTBEAT_TIMEOUT = 1000000000ULL;       // 1s
+const uint64_t SPIN_TIME = 50000ULL;                    // 50us
+const uint32_t POLL_SLEEP_US = 100U;
+
+// ---------------------------------------------------------------------------
+//  Public Class Members
+// ---------------------------------------------------------------------------
+
+/* Initializes a new instance of the VocoderClient class. */
+
+VocoderClient::VocoderClient(const std::string& name, uint32_t timeout) :
+    m_name(name),
+    m_timeout((uint64_t)timeout * 1000000ULL),
+    m_header(nullptr),
+    m_length(0U),
+    m_channel(nullptr),
+    m_channelNo(0U),
+    m_seqNo(0U),
+    m_lock(),
+    m_frames(0U),
+    m_timeouts(0U),
+    m_latencyTotal(0U),
+    m_latencyMax(0U)
+{
+    assert(!name.empty());
+}
+
+/* Finalizes a instance of the VocoderClient class. */
+
+VocoderClient::~VocoderClient()
+{
+    close();
+}
+
+/* Attaches to the service and claims a vocoder channel. */
+
+bool VocoderClient::open(CHANNEL_TYPE type, float decoderGain, bool decoderAutoGain, float encoderGain)
+{
+#if !defined(_WIN32)
+    std::lock_guard<std::mutex> lock(m_lock);
+    if (m_channel != nullptr)
+        return true;
+
+    int fd = ::shm_open(m_name.c_str(), O_RDWR, 0);
+    if (fd < 0)
+        return false;
+
+    struct stat st;
+    if (::fstat(fd, &st) != 0 || (size_t)st.st_size < sizeof(Header)) {
+        ::close(fd);
+        return false;
+    }
+
+    m_length = (size_t)st.st_size;
+    void* p = ::mmap(nullptr, m_length, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    ::close(fd);
+    if (p == MAP_FAILED)
+        return false;
+
+    m_header = reinterpret_cast<Header*>(p);
+    std::atomic_thread_fence(std::memory_order_acquire);
+    if (m_header->magic != SHM_MAGIC || m_header->version != SHM_VERSION ||
+        segmentLength(m_header->channels) > m_length || !isServiceAlive()) {
+        detach();
+        return false;
+    }
+
+    for (uint32_t n = 0U; n < m_header->channels; n++) {
+        Channel* ch = channel(m_header, n);
+
+        uint32_t expected = STATE_FREE;
+        if (!ch->state.compare_exchange_strong(expected, STATE_OPENING, std::memory_order_acq_rel))
+            continue;
+
+        ch->ownerPid = (uint32_t)::getpid();
+        ch->type = type;
+        ch->decoderGain = decoderGain;
+        ch->decoderAutoGain = decoderAutoGain ? 1U : 0U;
+        ch->encoderGain = encoderGain;
+
+        ch->frames.store(0U, std::memory_order_relaxed);
+        ch->latencyTotal.store(0U, std::memory_order_relaxed);
+        ch->latencyMax.store(0U, std::memory_order_relaxed);
+        ch->request.reset();
+        ch->response.reset();
+
+        ch->state.store(STATE_OPEN, std::memory_order_release);
+
+        m_channel = ch;
+        m_channelNo = n;
+        return true;
+    }
+
+    // no free channels
+    detach();
+    return false;
+#else
+    return false;
+#endif // !defined(_WIN32)
+}
+
+/* Releases the vocoder channel and detaches from the service. */
+
+void VocoderClient::close()
+{
+    std::lock_guard<std::mutex> lock(m_lock);
+    release();
+}
+
+/* Decodes the given MBE codewords to PCM samples. */
+
+bool VocoderClient::decode(const uint8_t* codeword, int16_t* samples, int32_t* errs)
+{
+    assert(codeword != nullptr);
+    assert(samples != nullptr);
+
+    std::lock_guard<std::mutex> lock(m_lock);
+    if (m_channel == nullptr)
+        return false;
+
+    return transact(OP_DECODE, codeword, codewordLength(m_channel->type), reinterpret_cast<uint8_t*>(samples),
+        FRAME_SAMPLES * 2U, errs);
+}
+
+/* Encodes the given PCM samples to MBE codewords. */
+
+bool VocoderClient::encode(const int16_t* samples, uint8_t* codeword)
+{
+    assert(samples != nullptr);
+    assert(codeword != nullptr);
+
+    std::lock_guard<std::mutex> lock(m_lock);
+    if (m_channel == nullptr)
+        return false;
+
+    return transact(OP_ENCODE, reinterpret_cast<const uint8_t*>(samples), FRAME_SAMPLES * 2U, codeword,
+        codewordLength(m_channel->type), nullptr);
+}
+
+/* Transcodes the given MBE codewords. */
+
+bool VocoderClient::transcode(const uint8_t* codeword, uint8_t* out, int32_t* errs)
+{
+    assert(codeword != nullptr);
+    assert(out != nullptr);
+
+    std::lock_guard<std::mutex> lock(m_lock);
+    if (m_channel == nullptr)
+        return false;
+
+    return transact(OP_TRANSCODE, codeword, codewordLength(m_channel->type), out,
+        codewordLength(m_channel->type, true), errs);
+}
+
+// ---------------------------------------------------------------------------
+//  Private Class Members
+// ---------------------------------------------------------------------------
+
+/* Queues a request frame and waits for its response. */
+
+bool VocoderClient::transact(FRAME_OP op, const uint8_t* data, uint32_t length, uint8_t* out, uint32_t outLength, int32_t* errs)
+{
+    // drop responses to earlier requests that timed out
+    Frame* resp = nullptr;
+    while ((resp = m_channel->response.consumerFrame()) != nullptr)
+        m_channel->response.consume();
+
+    Frame* req = m_channel->request.producerFrame();
+    if (req == nullptr) {
+        m_timeouts++;
+        if (!isServiceAlive())
+            release();
+        return false;
+    }
+
+    uint32_t seqNo = ++m_seqNo;
+    uint64_t start = now();
+
+    req->timestamp = start;
+    req->seqNo = seqNo;
+    req->op = op;
+    req->status = STATUS_OK;
+    req->length = (uint16_t)length;
+    req->errs = 0;
+    ::memcpy(req->data, data, length);
+    m_channel->request.produce();
+
+    while (true) {
+        resp = m_channel->response.consumerFrame();
+        if (resp != nullptr) {
+            if (resp->seqNo != seqNo) {
+                m_channel->response.consume();
+                continue;
+            }
+
+            bool ret = resp->status == STATUS_OK && resp->length == outLength;
+            if (ret) {
+                ::memcpy(out, resp->data, outLength);
+                if (errs != nullptr)
+                    *errs = resp->errs;
+            }
+            m_channel->response.consume();
+
+            uint64_t latency = now() - start;
+            m_frames++;
+            m_latencyTotal += latency;
+            if (latency > m_latencyMax)
+                m_latencyMax = latency;
+
+            return ret;
+        }
+
+        uint64_t elapsed = now() - start;
+        if (elapsed >= m_timeout) {
+            m_timeouts++;
+            if (!isServiceAlive())
+                release();
+            return false;
+        }
+
+        if (elapsed < SPIN_TIME)
+            std::this_thread::yield();
+        else
+            std::this_thread::sleep_for(std::chrono::microseconds(POLL_SLEEP_US));
+    }
+}
+
+/* Releases the vocoder channel and detaches from the service (the client lock must be held). */
+
+void VocoderClient::release()
+{
+    if (m_channel != nullptr) {
+        m_channel->state.store(STATE_CLOSING, std::memory_order_release);
+        m_channel = nullptr;
+    }
+
+    detach();
+}
+
+/* Helper to determine if the service heartbeat is current. */
+
+bool VocoderClient::isServiceAlive() const
+{
+    if (m_header == nullptr)
+        return false;
+
+    uint64_t heartbeat = m_header->heartbeat.load(std::memory_order_relaxed);
+    uint64_t ts = now();
+    return m_header->servicePid != 0U && (ts < heartbeat || ts - heartbeat < HEARTBEAT_TIMEOUT);
+}
+
+/* Unmaps the shared memory segment. */
+
+void VocoderClient::detach()
+{
+#if !defined(_WIN32)
+    if (m_header != nullptr) {
+        ::munmap(m_header, m_length);
+        m_header = nullptr;
+        m_length = 0U;
+    }
+#endif // !defined(_WIN32)
+}
@@ -0,0 +1,171 @@
+// SPDX-License-Identifier: GPL-2.0-only
+/*
+ * Digital Voice Modem - MBE Vocoder
+ * GPLv2 Open Source. Use is subject to license terms.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ *  Copyright (C) 2026 Bryan Biedenkapp, N2PLL
+ *
+ */
+/**
+ * @file VocoderClient.h
+ * @ingroup vocoder
+ * @file VocoderClient.cpp
+ * @ingroup vocoder
+ */
+#if !defined(__VOCODER_CLIENT_H__)
+#define __VOCODER_CLIENT_H__
+
+#include "common/Defines.h"
+#include "vocoder/VocoderShm.h"
+
+#include <mutex>
+#include <string>
+
+namespace vocoder
+{
+    // ---------------------------------------------------------------------------
+    //  Class Declaration
+    // ---------------------------------------------------------------------------
+
+    /**
+     * @brief Implements a client for a vocoder channel of a VocoderService running in another process.
+     *
+     *  A client claims a single channel; the vocoder state for the channel is kept by the service for as
+     *  long as the client holds it. Calls are synchronous (the frame is queued and the caller waits for the
+     *  response) and are serialized by the client, as the channel rings have a single producer and a single
+     *  consumer; threads that run vocoder operations concurrently should each use their own client. If the
+     *  service stops responding the client closes itself, and callers are expected to fall back to a local
+     *  vocoder.
+     */
+    class HOST_SW_API VocoderClient {
+    public:
+        /**
+         * @brief Initializes a new instance of the VocoderClient class.
+         * @param name Shared memory segment name.
+         * @param timeout Time to wait for a response from the service (milliseconds).
+         */
+        VocoderClient(const std::string& name = shm::DEFAULT_SHM_NAME, uint32_t timeout = 20U);
+        /**
+         * @brief Finalizes a instance of the VocoderClient class.
+         */
+        ~VocoderClient();
+
+        /**
+         * @brief Attaches to the service and claims a vocoder channel.
+         * @param type Channel type.
+         * @param decoderGain Decoder audio gain.
+         * @param decoderAutoGain Flag indicating decoder AGC is enabled.
+         * @param encoderGain Encoder audio gain.
+         * @returns bool True, if a channel was claimed, otherwise false.
+         */
+        bool open(shm::CHANNEL_TYPE type, float decoderGain = 1.0f, bool decoderAutoGain = false, float encoderGain = 1.0f);
+        /**
+         * @brief Releases the vocoder channel and detaches from the service.
+         */
+        void close();
+
+        /**
+         * @brief Decodes the given MBE codewords to PCM samples.
+         * @param[in] codeword MBE codewords.
+         * @param[out] samples 160 PCM samples.
+         * @param[out] errs Number of bit errors corrected (optional).
+         * @returns bool True, if the frame was decoded, otherwise false.
+         */
+        bool decode(const uint8_t* codeword, int16_t* samples, int32_t* errs = nullptr);
+        /**
+         * @brief Encodes the given PCM samples to MBE codewords.
+         * @param[in] samples 160 PCM samples.
+         * @param[out] codeword MBE codewords.
+         * @returns bool True, if the frame was encoded, otherwise false.
+         */
+        bool encode(const int16_t* samples, uint8_t* codeword);
+        /**
+         * @brief Transcodes the given MBE codewords.
+         * @param[in] codeword Source MBE codewords.
+         * @param[out] out Target MBE codewords.
+         * @param[out] errs Number of bit errors corrected, or -1 if the source codewords were invalid (optional).
+         * @returns bool True, if the frame was transcoded, otherwise false.
+         */
+        bool transcode(const uint8_t* codeword, uint8_t* out, int32_t* errs = nullptr);
+
+        /**
+         * @brief Helper to determine if the client holds a vocoder channel.
+         * @returns bool True, if the client holds a vocoder channel, otherwise false.
+         */
+        bool isOpen() const { return m_channel != nullptr; }
+        /**
+         * @brief Gets the claimed channel number.
+         * @returns uint32_t Channel number.
+         */
+        uint32_t getChannelNo() const { return m_channelNo; }
+
+        /**
+         * @brief Gets the number of completed frames.
+         * @returns uint64_t Number of completed frames.
+         */
+        uint64_t getFrames() const { return m_frames; }
+        /**
+         * @brief Gets the number of frames that timed out.
+         * @returns uint64_t Number of frames that timed out.
+         */
+        uint64_t getTimeouts() const { return m_timeouts; }
+        /**
+         * @brief Gets the average round trip latency of completed frames.
+         * @returns uint32_t Average round trip latency (microseconds).
+         */
+        uint32_t getLatencyAvg() const { return (m_frames > 0U) ? (uint32_t)((m_latencyTotal / m_frames) / 1000U) : 0U; }
+        /**
+         * @brief Gets the largest round trip latency of completed frames.
+         * @returns uint32_t Largest round trip latency (microseconds).
+         */
+        uint32_t getLatencyMax() const { return (uint32_t)(m_latencyMax / 1000U); }
+
+    private:
+        std::string m_name;
+        uint64_t m_timeout;
+
+        shm::Header* m_header;
+        size_t m_length;
+        shm::Channel* m_channel;
+        uint32_t m_channelNo;
+
+        uint32_t m_seqNo;
+
+        std::mutex m_lock;
+
+        uint64_t m_frames;
+        uint64_t m_timeouts;
+        uint64_t m_latencyTotal;
+        uint64_t m_latencyMax;
+
+        /**
+         * @brief Queues a request frame and waits for its response (the client lock must be held).
+         * @param op Frame operation.
+         * @param[in] data Request payload.
+         * @param length Length of the request payload.
+         * @param[out] out Response payload.
+         * @param outLength Expected length of the response payload.
+         * @param[out] errs Number of bit errors corrected (optional).
+         * @returns bool True, if the response was received, otherwise false.
+         */
+        bool transact(shm::FRAME_OP op, const uint8_t* data, uint32_t length, uint8_t* out, uint32_t outLength, int32_t* errs);
+
+        /**
+         * @brief Releases the vocoder channel and detaches from the service (the client lock must be held).
+         */
+        void release();
+
+        /**
+         * @brief Helper to determine if the service heartbeat is current.
+         * @returns bool True, if the service is alive, otherwise false.
+         */
+        bool isServiceAlive() const;
+        /**
+         * @brief Unmaps the shared memory segment.
+         */
+        void detach();
+    };
+} // namespace vocoder
+
+#endif // __VOCODER_CLIENT_H__
@@ -0,0 +1,405 @@
+// SPDX-License-Identifier: GPL-2.0-only
+/*
+ * Digital Voice Modem - MBE Vocoder
+ * GPLv2 Open Source. Use is subject to license terms.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ *  Copyright (C) 2026 Bryan Biedenkapp, N2PLL
+ *
+ */
+#include "common/Defines.h"
+#include "vocoder/VocoderService.h"
+
+#include <cassert>
+#include <cerrno>
+#include <cstring>
+#include <new>
+#if !defined(_WIN32)
+#include <fcntl.h>
+#include <signal.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif // !defined(_WIN32)
+
+using namespace vocoder;
+using namespace vocoder::shm;
+
+// ---------------------------------------------------------------------------
+//  Constants
+// ---------------------------------------------------------------------------
+
+const uint64_t HEARTBEAT_INTERVAL = 100000000ULL;       // 100ms
+const uint64_t OWNER_CHECK_INTERVAL = 1000000000ULL;    // 1s
+const uint32_t IDLE_SPINS = 64U;
+const uint32_t IDLE_SLEEP_US = 250U;
+
+// ---------------------------------------------------------------------------
+//  Public Class Members
+// ---------------------------------------------------------------------------
+
+/* Initializes a new instance of the VocoderService class. */
+
+VocoderService::VocoderService(const std::string& name, uint32_t channels, uint32_t workers) :
+    m_name(name),
+    m_channels(channels),
+    m_workerCnt(workers),
+    m_header(nullptr),
+    m_length(0U),
+    m_state(),
+    m_workers(),
+    m_running(false),
+    m_lastError()
+{
+    assert(!name.empty());
+    assert(channels > 0U);
+
+    if (m_workerCnt == 0U)
+        m_workerCnt = 1U;
+    if (m_workerCnt > m_channels)
+        m_workerCnt = m_channels;
+}
+
+/* Finalizes a instance of the VocoderService class. */
+
+VocoderService::~VocoderService()
+{
+    close();
+}
+
+/* Creates the shared memory segment and starts the worker threads. */
+
+bool VocoderService::open()
+{
+#if !defined(_WIN32)
+    if (m_header != nullptr)
+        return true;
+
+    // refuse to replace the segment of a service that is still running
+    int fd = ::shm_open(m_name.c_str(), O_RDONLY, 0);
+    if (fd >= 0) {
+        struct stat st;
+        if (::fstat(fd, &st) == 0 && (size_t)st.st_size >= sizeof(Header)) {
+            void* p = ::mmap(nullptr, sizeof(Header), PROT_READ, MAP_SHARED, fd, 0);
+            if (p != MAP_FAILED) {
+                const Header* hdr = reinterpret_cast<const Header*>(p);
+                bool running = hdr->magic == SHM_MAGIC && hdr->servicePid != 0U &&
+                    ::kill((pid_t)hdr->servicePid, 0) == 0;
+                uint32_t pid = hdr->servicePid;
+                ::munmap(p, sizeof(Header));
+
+                if (running) {
+                    ::close(fd);
+                    m_lastError = "vocoder service already running as PID " + std::to_string(pid);
+                    return false;
+                }
+            }
+        }
+
+        ::close(fd);
+    }
+
+    // stale segments are unlinked; clients still mapping one see its heartbeat stop
+    ::shm_unlink(m_name.c_str());
+
+    fd = ::shm_open(m_name.c_str(), O_CREAT | O_EXCL | O_RDWR, 0660);
+    if (fd < 0) {
+        m_lastError = "failed to create shared memory segment " + m_name + ", " + ::strerror(errno);
+        return false;
+    }
+
+    m_length = segmentLength(m_channels);
+    if (::ftruncate(fd, (off_t)m_length) != 0) {
+        m_lastError = "failed to size shared memory segment " + m_name + ", " + ::strerror(errno);
+        ::close(fd);
+        ::shm_unlink(m_name.c_str());
+        return false;
+    }
+
+    void* p = ::mmap(nullptr, m_length, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    ::close(fd);
+    if (p == MAP_FAILED) {
+        m_lastError = "failed to map shared memory segment " + m_name + ", " + ::strerror(errno);
+        ::shm_unlink(m_name.c_str());
+        return false;
+    }
+
+    ::memset(p, 0x00U, m_length);
+    m_header = new (p) Header();
+    m_header->version = SHM_VERSION;
+    m_header->channels = m_channels;
+    m_header->servicePid = (uint32_t)::getpid();
+    m_header->heartbeat.store(now(), std::memory_order_relaxed);
+
+    for (uint32_t n = 0U; n < m_channels; n++) {
+        Channel* ch = new (channel(m_header, n)) Channel();
+        ch->state.store(STATE_FREE, std::memory_order_relaxed);
+        ch->request.reset();
+        ch->response.reset();
+    }
+
+    m_state.resize(m_channels);
+    for (ChannelState& state : m_state) {
+        ::memset(&state, 0x00U, sizeof(ChannelState));
+    }
+
+    // clients validate the magic last
+    std::atomic_thread_fence(std::memory_order_release);
+    m_header->magic = SHM_MAGIC;
+
+    m_running = true;
+    for (uint32_t n = 0U; n < m_workerCnt; n++)
+        m_workers.emplace_back(&VocoderService::worker, this, n);
+
+    return true;
+#else
+    m_lastError = "shared memory vocoder service is not supported on this platform";
+    return false;
+#endif // !defined(_WIN32)
+}
+
+/* Stops the worker threads and removes the shared memory segment. */
+
+void VocoderService::close()
+{
+#if !defined(_WIN32)
+    m_running = false;
+    for (std::thread& t : m_workers) {
+        if (t.joinable())
+            t.join();
+    }
+    m_workers.clear();
+
+    for (ChannelState& state : m_state)
+        releaseState(state);
+    m_state.clear();
+
+    if (m_header != nullptr) {
+        m_header->servicePid = 0U;
+        ::munmap(m_header, m_length);
+        ::shm_unlink(m_name.c_str());
+        m_header = nullptr;
+    }
+#endif // !defined(_WIN32)
+}
+
+/* Gets the statistics of all vocoder channels in use. */
+
+std::vector<VocoderService::ChannelStats> VocoderService::getStats() const
+{
+    std::vector<ChannelStats> stats;
+    if (m_header == nullptr)
+        return stats;
+
+    for (uint32_t n = 0U; n < m_channels; n++) {
+        Channel* ch = channel(m_header, n);
+        if (ch->state.load(std::memory_order_acquire) != STATE_OPEN)
+            continue;
+
+        ChannelStats s;
+        s.channel = n;
+        s.ownerPid = ch->ownerPid;
+        s.type = ch->type;
+        s.frames = ch->frames.load(std::memory_order_relaxed);
+        uint64_t total = ch->latencyTotal.load(std::memory_order_relaxed);
+        s.latencyAvg = (s.frames > 0U) ? (uint32_t)((total / s.frames) / 1000U) : 0U;
+        s.latencyMax = ch->latencyMax.load(std::memory_order_relaxed) / 1000U;
+        s.pending = ch->request.pending();
+
+        stats.push_back(s);
+    }
+
+    return stats;
+}
+
+// ---------------------------------------------------------------------------
+//  Private Class Members
+// ---------------------------------------------------------------------------
+
+/* Worker thread entry point. */
+
+void VocoderService::worker(uint32_t n)
+{
+    uint32_t idle = 0U;
+    while (m_running) {
+        uint64_t ts = now();
+        if (n == 0U && ts - m_header->heartbeat.load(std::memory_order_relaxed) >= HEARTBEAT_INTERVAL)
+            m_header->heartbeat.store(ts, std::memory_order_relaxed);
+
+        uint32_t processed = 0U;
+        for (uint32_t ch = n; ch < m_channels; ch += m_workerCnt)
+            processed += serviceChannel(ch, ts);
+
+        if (processed > 0U) {
+            idle = 0U;
+            continue;
+        }
+
+        // spin briefly to catch back-to-back frames, then back off
+        if (++idle < IDLE_SPINS)
+            std::this_thread::yield();
+        else
+            std::this_thread::sleep_for(std::chrono::microseconds(IDLE_SLEEP_US));
+    }
+}
+
+/* Services a channel, processing all pending frames. */
+
+uint32_t VocoderService::serviceChannel(uint32_t n, uint64_t now)
+{
+#if !defined(_WIN32)
+    Channel* ch = channel(m_header, n);
+    ChannelState& state = m_state[n];
+
+    uint32_t chState = ch->state.load(std::memory_order_acquire);
+    if (chState == STATE_FREE)
+        return 0U;
+
+    // reclaim channels whose client exited without releasing them
+    if (now - state.lastOwnerCheck >= OWNER_CHECK_INTERVAL) {
+        state.lastOwnerCheck = now;
+        if (ch->ownerPid != 0U && ::kill((pid_t)ch->ownerPid, 0) != 0 && errno == ESRCH)
+            chState = STATE_CLOSING;
+    }
+
+    if (chState == STATE_CLOSING) {
+        releaseState(state);
+        ch->state.store(STATE_FREE, std::memory_order_release);
+        return 0U;
+    }
+
+    if (chState != STATE_OPEN)
+        return 0U;
+
+    if (!state.active)
+        createState(state, ch);
+
+    uint32_t processed = 0U;
+    while (processed < RING_DEPTH) {
+        Frame* req = ch->request.consumerFrame();
+        if (req == nullptr)
+            break;
+        // leave the request pending if the client is not draining its responses
+        Frame* resp = ch->response.producerFrame();
+        if (resp == nullptr)
+            break;
+
+        process(state, req, resp);
+
+        uint64_t latency = shm::now() - req->timestamp;
+        if (latency > 0xFFFFFFFFULL)
+            latency = 0xFFFFFFFFULL;
+        resp->latency = (uint32_t)latency;
+
+        ch->frames.fetch_add(1U, std::memory_order_relaxed);
+        ch->latencyTotal.fetch_add(latency, std::memory_order_relaxed);
+        if ((uint32_t)latency > ch->latencyMax.load(std::memory_order_relaxed))
+            ch->latencyMax.store((uint32_t)latency, std::memory_order_relaxed);
+
+        ch->response.produce();
+        ch->request.consume();
+        processed++;
+    }
+
+    return processed;
+#else
+    return 0U;
+#endif // !defined(_WIN32)
+}
+
+/* Processes a single request frame. */
+
+void VocoderService::process(ChannelState& state, Frame* req, Frame* resp)
+{
+    resp->timestamp = req->timestamp;
+    resp->seqNo = req->seqNo;
+    resp->op = req->op;
+    resp->status = STATUS_OK;
+    resp->length = 0U;
+    resp->errs = 0;
+
+    switch (req->op) {
+    case OP_DECODE:
+        if (state.decoder == nullptr || req->length < codewordLength(state.type))
+            break;
+
+        resp->errs = state.decoder->decode(req->data, reinterpret_cast<int16_t*>(resp->data));
+        resp->length = FRAME_SAMPLES * 2U;
+        return;
+
+    case OP_ENCODE:
+        if (state.encoder == nullptr || req->length < FRAME_SAMPLES * 2U)
+            break;
+
+        ::memset(resp->data, 0x00U, codewordLength(state.type));
+        state.encoder->encode(reinterpret_cast<int16_t*>(req->data), resp->data);
+        resp->length = (uint16_t)codewordLength(state.type);
+        return;
+
+    case OP_TRANSCODE:
+        if (state.transcoder == nullptr || req->length < codewordLength(state.type))
+            break;
+
+        resp->errs = state.transcoder->transcode(req->data, resp->data);
+        resp->length = (uint16_t)codewordLength(state.type, true);
+        return;
+
+    default:
+        break;
+    }
+
+    resp->status = STATUS_BAD_OP;
+}
+
+/* Initializes the vocoder state for a newly opened channel. */
+
+void VocoderService::createState(ChannelState& state, Channel* ch)
+{
+    releaseState(state);
+
+    state.type = ch->type;
+    switch (state.type) {
+    case CHANNEL_DMR_AMBE:
+        state.decoder = new MBEDecoder(DECODE_DMR_AMBE);
+        state.encoder = new MBEEncoder(ENCODE_DMR_AMBE);
+        break;
+    case CHANNEL_IMBE:
+        state.decoder = new MBEDecoder(DECODE_88BIT_IMBE);
+        state.encoder = new MBEEncoder(ENCODE_88BIT_IMBE);
+        break;
+    case CHANNEL_DMR_AMBE_TO_IMBE:
+        state.transcoder = new MBETranscoder(TRANSCODE_DMR_AMBE_TO_IMBE);
+        break;
+    case CHANNEL_IMBE_TO_DMR_AMBE:
+        state.transcoder = new MBETranscoder(TRANSCODE_IMBE_TO_DMR_AMBE);
+        break;
+    default:
+        break;
+    }
+
+    if (state.decoder != nullptr) {
+        state.decoder->setGainAdjust(ch->decoderGain);
+        state.decoder->setAutoGain(ch->decoderAutoGain != 0U);
+    }
+    if (state.encoder != nullptr)
+        state.encoder->setGainAdjust(ch->encoderGain);
+
+    state.active = true;
+}
+
+/* Releases the vocoder state of a channel. */
+
+void VocoderService::releaseState(ChannelState& state)
+{
+    if (state.decoder != nullptr)
+        delete state.decoder;
+    if (state.encoder != nullptr)
+        delete state.encoder;
+    if (state.transcoder != nullptr)
+        delete state.transcoder;
+
+    state.decoder = nullptr;
+    state.encoder = nullptr;
+    state.transcoder = nullptr;
+    state.active = false;
+}
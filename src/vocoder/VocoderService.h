@@ -0,0 +1,163 @@
+// SPDX-License-Identifier: GPL-2.0-only
+/*
+ * Digital Voice Modem - MBE Vocoder
+ * GPLv2 Open Source. Use is subject to license terms.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ *  Copyright (C) 2026 Bryan Biedenkapp, N2PLL
+ *
+ */
+/**
+ * @file VocoderService.h
+ * @ingroup vocoder
+ * @file VocoderService.cpp
+ * @ingroup vocoder
+ */
+#if !defined(__VOCODER_SERVICE_H__)
+#define __VOCODER_SERVICE_H__
+
+#include "common/Defines.h"
+#include "vocoder/MBEDecoder.h"
+#include "vocoder/MBEEncoder.h"
+#include "vocoder/MBETranscoder.h"
+#include "vocoder/VocoderShm.h"
+
+#include <atomic>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace vocoder
+{
+    // ---------------------------------------------------------------------------
+    //  Class Declaration
+    // ---------------------------------------------------------------------------
+
+    /**
+     * @brief Implements a pool of vocoder channels served to other processes over shared memory.
+     *
+     *  The service creates a POSIX shared memory segment holding a fixed number of channels; each channel
+     *  carries a lock-free single-producer single-consumer request ring (client to service) and response ring
+     *  (service to client). Clients claim a free channel, and the service keeps the vocoder state for that
+     *  channel until the client releases it (or the client process exits).
+     *
+     *  Channels are statically partitioned across the worker threads. On each pass a worker drains every
+     *  pending frame of a channel before moving to the next one, so a channel's vocoder state stays hot in
+     *  cache while its burst is processed.
+     */
+    class HOST_SW_API VocoderService {
+    public:
+        /**
+         * @brief Represents the statistics of a vocoder channel.
+         */
+        struct ChannelStats {
+            uint32_t channel;           //!< Channel number.
+            uint32_t ownerPid;          //!< Process ID of the owning client.
+            uint8_t type;               //!< Channel type.
+            uint64_t frames;            //!< Number of frames processed.
+            uint32_t latencyAvg;        //!< Average frame latency (microseconds).
+            uint32_t latencyMax;        //!< Largest frame latency (microseconds).
+            uint32_t pending;           //!< Number of frames waiting to be processed.
+        };
+
+        /**
+         * @brief Initializes a new instance of the VocoderService class.
+         * @param name Shared memory segment name.
+         * @param channels Number of vocoder channels.
+         * @param workers Number of worker threads.
+         */
+        VocoderService(const std::string& name, uint32_t channels, uint32_t workers);
+        /**
+         * @brief Finalizes a instance of the VocoderService class.
+         */
+        ~VocoderService();
+
+        /**
+         * @brief Creates the shared memory segment and starts the worker threads.
+         * @returns bool True, if the service was started, otherwise false.
+         */
+        bool open();
+        /**
+         * @brief Stops the worker threads and removes the shared memory segment.
+         */
+        void close();
+
+        /**
+         * @brief Gets the statistics of all vocoder channels in use.
+         * @returns std::vector<ChannelStats> Statistics of all vocoder channels in use.
+         */
+        std::vector<ChannelStats> getStats() const;
+
+        /**
+         * @brief Gets the number of vocoder channels.
+         * @returns uint32_t Number of vocoder channels.
+         */
+        uint32_t getChannelCount() const { return m_channels; }
+        /**
+         * @brief Gets the last error encountered by open().
+         * @returns std::string Last error.
+         */
+        std::string getLastError() const { return m_lastError; }
+
+    private:
+        /**
+         * @brief Represents the service-side vocoder state of a channel.
+         */
+        struct ChannelState {
+            bool active;                        //!< Flag indicating the state is initialized.
+            uint8_t type;                       //!< Channel type.
+            MBEDecoder* decoder;                //!< Vocoder decoder.
+            MBEEncoder* encoder;                //!< Vocoder encoder.
+            MBETranscoder* transcoder;          //!< Parametric transcoder.
+            uint64_t lastOwnerCheck;            //!< Last time the owning client was checked.
+        };
+
+        std::string m_name;
+        uint32_t m_channels;
+        uint32_t m_workerCnt;
+
+        shm::Header* m_header;
+        size_t m_length;
+
+        std::vector<ChannelState> m_state;
+        std::vector<std::thread> m_workers;
+        std::atomic<bool> m_running;
+
+        std::string m_lastError;
+
+        /**
+         * @brief Worker thread entry point.
+         * @param n Worker number.
+         */
+        void worker(uint32_t n);
+
+        /**
+         * @brief Services a channel, processing all pending frames.
+         * @param n Channel number.
+         * @param now Current monotonic time in nanoseconds.
+         * @returns uint32_t Number of frames processed.
+         */
+        uint32_t serviceChannel(uint32_t n, uint64_t now);
+        /**
+         * @brief Processes a single request frame.
+         * @param state Channel state.
+         * @param req Request frame.
+         * @param resp Response frame.
+         */
+        void process(ChannelState& state, shm::Frame* req, shm::Frame* resp);
+
+        /**
+         * @brief Initializes the vocoder state for a newly opened channel.
+         * @param state Channel state.
+         * @param ch Channel.
+         */
+        void createState(ChannelState& state, shm::Channel* ch);
+        /**
+         * @brief Releases the vocoder state of a channel.
+         * @param state Channel state.
+         */
+        void releaseState(ChannelState& state);
+    };
+} // namespace vocoder
+
+#endif // __VOCODER_SERVICE_H__
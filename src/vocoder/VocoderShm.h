@@ -0,0 +1,260 @@
+// SPDX-License-Identifier: GPL-2.0-only
+/*
+ * Digital Voice Modem - MBE Vocoder
+ * GPLv2 Open Source. Use is subject to license terms.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ *  Copyright (C) 2026 Bryan Biedenkapp, N2PLL
+ *
+ */
+/**
+ * @file VocoderShm.h
+ * @ingroup vocoder
+ */
+#if !defined(__VOCODER_SHM_H__)
+#define __VOCODER_SHM_H__
+
+#include "common/Defines.h"
+
+#include <atomic>
+#include <chrono>
+#include <cstring>
+#include <stdint.h>
+
+namespace vocoder
+{
+    namespace shm
+    {
+        // ---------------------------------------------------------------------------
+        //  Constants
+        // ---------------------------------------------------------------------------
+
+        const uint32_t SHM_MAGIC = 0x44564D56U;         // "DVMV"
+        const uint32_t SHM_VERSION = 1U;
+
+        /** @brief Default shared memory segment name. */
+        const char DEFAULT_SHM_NAME[] = "/dvmvocoder";
+
+        /** @brief Number of frames in each request/response ring (must be a power of 2). */
+        const uint32_t RING_DEPTH = 16U;
+        /** @brief Largest frame payload (160 16-bit PCM samples). */
+        const uint32_t MAX_FRAME_LENGTH = 320U;
+
+        /** @brief Number of PCM samples in a vocoder frame. */
+        const uint32_t FRAME_SAMPLES = 160U;
+        /** @brief Length of a DMR AMBE frame. */
+        const uint32_t DMR_AMBE_LENGTH = 9U;
+        /** @brief Length of a 88-bit IMBE frame. */
+        const uint32_t IMBE_LENGTH = 11U;
+
+        /**
+         * @brief Vocoder Channel Type
+         */
+        enum CHANNEL_TYPE : uint8_t {
+            CHANNEL_DMR_AMBE = 0U,              //!< DMR AMBE encode/decode
+            CHANNEL_IMBE = 1U,                  //!< 88-bit IMBE (P25) encode/decode
+            CHANNEL_DMR_AMBE_TO_IMBE = 2U,      //!< DMR AMBE to 88-bit IMBE transcode
+            CHANNEL_IMBE_TO_DMR_AMBE = 3U       //!< 88-bit IMBE to DMR AMBE transcode
+        };
+
+        /**
+         * @brief Vocoder Channel State
+         *  A channel moves FREE -> OPENING -> OPEN -> CLOSING under control of the client; only the service
+         *  moves a channel from CLOSING back to FREE, so the service never processes a channel whose rings
+         *  are being reset.
+         */
+        enum CHANNEL_STATE : uint32_t {
+            STATE_FREE = 0U,                    //!< Channel is unclaimed
+            STATE_OPENING = 1U,                 //!< Channel is claimed and being configured by a client
+            STATE_OPEN = 2U,                    //!< Channel is in use
+            STATE_CLOSING = 3U                  //!< Channel has been released by its client
+        };
+
+        /**
+         * @brief Vocoder Frame Operation
+         */
+        enum FRAME_OP : uint8_t {
+            OP_DECODE = 0U,                     //!< MBE codewords to PCM samples
+            OP_ENCODE = 1U,                     //!< PCM samples to MBE codewords
+            OP_TRANSCODE = 2U                   //!< MBE codewords to MBE codewords
+        };
+
+        /**
+         * @brief Vocoder Frame Status
+         */
+        enum FRAME_STATUS : uint8_t {
+            STATUS_OK = 0U,                     //!< Frame was processed
+            STATUS_BAD_OP = 1U                  //!< Operation is not valid for the channel type
+        };
+
+        // ---------------------------------------------------------------------------
+        //  Structure Declaration
+        // ---------------------------------------------------------------------------
+
+        /**
+         * @brief Represents a frame in a request or response ring.
+         */
+        struct Frame {
+            uint64_t timestamp;                 //!< Client enqueue time (monotonic nanoseconds).
+            uint32_t seqNo;                     //!< Client sequence number.
+            uint32_t latency;                   //!< Time from enqueue to response (nanoseconds; response only).
+            uint8_t op;                         //!< Frame operation.
+            uint8_t status;                     //!< Frame status (response only).
+            uint16_t length;                    //!< Payload length.
+            int32_t errs;                       //!< Bit errors corrected (response only).
+            uint8_t data[MAX_FRAME_LENGTH];     //!< Payload.
+        };
+
+        /**
+         * @brief Implements a single-producer single-consumer lock-free ring of frames placed in shared memory.
+         *  The producer and consumer indices are kept on separate cache lines.
+         */
+        struct Ring {
+            alignas(64) std::atomic<uint32_t> head;     //!< Producer index.
+            alignas(64) std::atomic<uint32_t> tail;     //!< Consumer index.
+            alignas(64) Frame frames[RING_DEPTH];       //!< Frames.
+
+            /**
+             * @brief Resets the ring to empty.
+             */
+            void reset()
+            {
+                head.store(0U, std::memory_order_relaxed);
+                tail.store(0U, std::memory_order_release);
+            }
+
+            /**
+             * @brief Gets the next free frame, or nullptr if the ring is full. (Producer only.)
+             * @returns Frame* Next free frame.
+             */
+            Frame* producerFrame()
+            {
+                uint32_t h = head.load(std::memory_order_relaxed);
+                if (h - tail.load(std::memory_order_acquire) >= RING_DEPTH)
+                    return nullptr;
+                return &frames[h & (RING_DEPTH - 1U)];
+            }
+            /**
+             * @brief Publishes the frame returned by producerFrame(). (Producer only.)
+             */
+            void produce() { head.store(head.load(std::memory_order_relaxed) + 1U, std::memory_order_release); }
+
+            /**
+             * @brief Gets the oldest pending frame, or nullptr if the ring is empty. (Consumer only.)
+             * @returns Frame* Oldest pending frame.
+             */
+            Frame* consumerFrame()
+            {
+                uint32_t t = tail.load(std::memory_order_relaxed);
+                if (t == head.load(std::memory_order_acquire))
+                    return nullptr;
+                return &frames[t & (RING_DEPTH - 1U)];
+            }
+            /**
+             * @brief Releases the frame returned by consumerFrame(). (Consumer only.)
+             */
+            void consume() { tail.store(tail.load(std::memory_order_relaxed) + 1U, std::memory_order_release); }
+
+            /**
+             * @brief Gets the number of pending frames.
+             * @returns uint32_t Number of pending frames.
+             */
+            uint32_t pending() const { return head.load(std::memory_order_acquire) - tail.load(std::memory_order_acquire); }
+        };
+
+        /**
+         * @brief Represents a vocoder channel.
+         */
+        struct Channel {
+            alignas(64) std::atomic<uint32_t> state;    //!< Channel state.
+            std::atomic<uint32_t> generation;           //!< Incremented every time the channel is opened.
+            uint32_t ownerPid;                          //!< Process ID of the owning client.
+            uint8_t type;                               //!< Channel type.
+            uint8_t decoderAutoGain;                    //!< Flag indicating decoder AGC is enabled.
+            float decoderGain;                          //!< Decoder audio gain.
+            float encoderGain;                          //!< Encoder audio gain.
+
+            std::atomic<uint64_t> frames;               //!< Number of frames processed.
+            std::atomic<uint64_t> latencyTotal;         //!< Sum of frame latencies (nanoseconds).
+            std::atomic<uint32_t> latencyMax;           //!< Largest frame latency (nanoseconds).
+
+            Ring request;                               //!< Client to service ring.
+            Ring response;                              //!< Service to client ring.
+        };
+
+        /**
+         * @brief Represents the shared memory segment header.
+         */
+        struct Header {
+            uint32_t magic;                             //!< Segment magic.
+            uint32_t version;                           //!< Segment layout version.
+            uint32_t channels;                          //!< Number of channels following the header.
+            uint32_t servicePid;                        //!< Process ID of the service.
+            std::atomic<uint64_t> heartbeat;            //!< Last service heartbeat (monotonic nanoseconds).
+        };
+
+        static_assert(ATOMIC_INT_LOCK_FREE == 2 && ATOMIC_LLONG_LOCK_FREE == 2, "shared memory rings require lock-free atomics");
+
+        // ---------------------------------------------------------------------------
+        //  Global Functions
+        // ---------------------------------------------------------------------------
+
+        /**
+         * @brief Helper to get the length of the segment holding the given number of channels.
+         * @param channels Number of channels.
+         * @returns size_t Length of the segment in bytes.
+         */
+        inline size_t segmentLength(uint32_t channels)
+        {
+            size_t header = (sizeof(Header) + alignof(Channel) - 1U) & ~(alignof(Channel) - 1U);
+            return header + (channels * sizeof(Channel));
+        }
+
+        /**
+         * @brief Helper to get a channel from a mapped segment.
+         * @param hdr Segment header.
+         * @param n Channel number.
+         * @returns Channel* Channel.
+         */
+        inline Channel* channel(Header* hdr, uint32_t n)
+        {
+            size_t header = (sizeof(Header) + alignof(Channel) - 1U) & ~(alignof(Channel) - 1U);
+            return reinterpret_cast<Channel*>(reinterpret_cast<uint8_t*>(hdr) + header) + n;
+        }
+
+        /**
+         * @brief Helper to get the current monotonic time in nanoseconds. (The monotonic clock is shared by
+         *  all processes on the host.)
+         * @returns uint64_t Current monotonic time in nanoseconds.
+         */
+        inline uint64_t now()
+        {
+            return (uint64_t)std::chrono::duration_cast<std::chrono::nanoseconds>(
+                std::chrono::steady_clock::now().time_since_epoch()).count();
+        }
+
+        /**
+         * @brief Helper to get the length of the MBE frame used by a channel type.
+         * @param type Channel type.
+         * @param target Flag indicating the transcode target frame length should be returned.
+         * @returns uint32_t Length of the MBE frame in bytes.
+         */
+        inline uint32_t codewordLength(uint8_t type, bool target = false)
+        {
+            switch (type) {
+            case CHANNEL_DMR_AMBE:
+                return DMR_AMBE_LENGTH;
+            case CHANNEL_IMBE:
+                return IMBE_LENGTH;
+            case CHANNEL_DMR_AMBE_TO_IMBE:
+                return target ? IMBE_LENGTH : DMR_AMBE_LENGTH;
+            case CHANNEL_IMBE_TO_DMR_AMBE:
+                return target ? DMR_AMBE_LENGTH : IMBE_LENGTH;
+            default:
+                return 0U;
+            }
+        }
+    } // namespace shm
+} // namespace vocoder
+
+#endif // __VOCODER_SHM_H__
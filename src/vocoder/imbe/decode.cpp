@@ -63,3 +63,12 @@ void imbe_vocoder::decode(IMBE_PARAM* imbe_param, Word16* frame_vector, Word16*
     for (j = 0; j < FRAME; j++)
         snd[j] = add(snd[j], snd_tmp[j]);
 }
+
+void imbe_vocoder::decode_param(IMBE_PARAM* imbe_param, Word16* frame_vector)
+{
+    decode_frame_vector(imbe_param, frame_vector);
+    v_uv_decode(imbe_param);
+    sa_decode(imbe_param);
+
+    imbe_param->ref_pitch = (imbe_param->b_vec[0] << 7) + 0x13C0;                           // Pitch decode (b0 + 39.5)/2 in Q8.8 format
+}
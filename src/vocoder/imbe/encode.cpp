@@ -89,3 +89,72 @@ void imbe_vocoder::encode(IMBE_PARAM* imbe_param, Word16* frame_vector, Word16*
     sa_encode(imbe_param);
     encode_frame_vector(imbe_param, frame_vector);
 }
+
+void imbe_vocoder::encode_param(IMBE_PARAM* imbe_param, Word16* frame_vector)
+{
+    Word16 i, j, tmp, num_harms, num_bands, src_harms, band_len, voiced, b1_vec, uv_cnt;
+
+    // Pitch encode fix(2*pitch - 39)
+    tmp = shr(sub(imbe_param->ref_pitch, 0x1380), 7);
+    if (tmp < 0)
+        tmp = 0;
+    if (tmp > 207)
+        tmp = 207;
+    imbe_param->b_vec[0] = tmp;
+
+    // Derive the number of harmonics and bands exactly as the decoder will from b0
+    tmp = ((imbe_param->b_vec[0] & 0xFF) << 1) + 0x4F;                                      // b0 + 39.5 in unsigned Q15.1 format
+    tmp = (tmp + 0x2) >> 3;                                                                 // (b0 + 39.5 + 1)/4
+    num_harms = ((UWord32)CNST_0_9254_Q0_16 * tmp) >> 16;
+    if (num_harms < NUM_HARMS_MIN)
+        num_harms = NUM_HARMS_MIN;
+    if (num_harms > NUM_HARMS_MAX)
+        num_harms = NUM_HARMS_MAX;
+
+    if (num_harms <= 36)
+        num_bands = extract_h((UWord32)(num_harms + 2) * CNST_0_33_Q0_16);                 // fix((L+2)/3)
+    else
+        num_bands = NUM_BANDS_MAX;
+
+    // Extend the given harmonics if the decoder will expect more of them
+    src_harms = imbe_param->num_harms;
+    if (src_harms < 1)
+        src_harms = 1;
+    for (i = src_harms; i < num_harms; i++) {
+        imbe_param->sa[i] = imbe_param->sa[src_harms - 1];
+        imbe_param->v_uv_dsn[i] = imbe_param->v_uv_dsn[src_harms - 1];
+    }
+
+    for (i = 0; i < num_harms; i++) {
+        if (imbe_param->sa[i] < 1)
+            imbe_param->sa[i] = 1;
+    }
+
+    imbe_param->num_harms = num_harms;
+    imbe_param->num_bands = num_bands;
+
+    // Voiced/unvoiced decision per band of three harmonics (the last band takes the remainder),
+    // by majority of the harmonics in the band
+    b1_vec = 0;
+    uv_cnt = 0;
+    for (i = 0; i < num_bands; i++) {
+        band_len = (i == num_bands - 1) ? num_harms - i * 3 : 3;
+
+        voiced = 0;
+        for (j = 0; j < band_len; j++)
+            voiced += imbe_param->v_uv_dsn[i * 3 + j] ? 1 : 0;
+
+        voiced = (voiced * 2 >= band_len) ? 1 : 0;
+        b1_vec = (b1_vec << 1) | voiced;
+        for (j = 0; j < band_len; j++)
+            imbe_param->v_uv_dsn[i * 3 + j] = voiced;
+        if (!voiced)
+            uv_cnt += band_len;
+    }
+
+    imbe_param->l_uv = uv_cnt;
+    imbe_param->b_vec[1] = b1_vec;                                                          // Save encoded voiced/unvoiced decision
+
+    sa_encode(imbe_param);
+    encode_frame_vector(imbe_param, frame_vector);
+}
@@ -56,6 +56,21 @@ public:
         decode(&my_imbe_param, frame_vector, snd);
     }
     
+    // imbe_decode_param decodes IMBE codewords (frame_vector) to model
+    // parameters only, without speech synthesis (parameters are read with param())
+    void imbe_decode_param(int16_t *frame_vector)
+    {
+        decode_param(&my_imbe_param, frame_vector);
+    }
+
+    // imbe_encode_param quantizes model parameters (pitch, voiced/unvoiced
+    // decisions and spectral amplitudes) directly to IMBE codewords (frame_vector),
+    // without speech analysis
+    void imbe_encode_param(int16_t *frame_vector, IMBE_PARAM *imbe_param)
+    {
+        encode_param(imbe_param, frame_vector);
+    }
+
     // hack to enable ambe encoder read access to speech parameters
     const IMBE_PARAM* param(void) { return &my_imbe_param; }
     void set_gain_adjust(float gain_adjust) { d_gain_adjust = gain_adjust; }
@@ -93,6 +108,7 @@ private:
     void fft_init(void);
     void fft(Word16 *datam1, Word16 nn, Word16 isign);
     void encode(IMBE_PARAM *imbe_param, Word16 *frame_vector, Word16 *snd);
+    void encode_param(IMBE_PARAM *imbe_param, Word16 *frame_vector);
     void pitch_est_init(void);
     Word32 autocorr(Word16 *sigin, Word16 shift, Word16 scale_shift);
     void e_p(Word16 *sigin, Word16 *res_buf);
@@ -111,6 +127,7 @@ private:
     void v_uv_det(IMBE_PARAM *imbe_param, Cmplx16 *fft_buf);
     void decode_init(IMBE_PARAM *imbe_param);
     void decode(IMBE_PARAM *imbe_param, Word16 *frame_vector, Word16 *snd);
+    void decode_param(IMBE_PARAM *imbe_param, Word16 *frame_vector);
     void encode_init(void);
 };
 
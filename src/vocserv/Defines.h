@@ -0,0 +1,38 @@
+// SPDX-License-Identifier: GPL-2.0-only
+/*
+ * Digital Voice Modem - Vocoder Service
+ * GPLv2 Open Source. Use is subject to license terms.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ *  Copyright (C) 2026 Bryan Biedenkapp, N2PLL
+ *
+ */
+/**
+ * @defgroup vocserv Vocoder Service
+ * @brief Digital Voice Modem - Vocoder Service
+ * @details Shared vocoder service, this provides a pool of MBE vocoder and transcoder channels to other DVM
+ *  processes on the same host over shared memory.
+ * @ingroup vocserv
+ * 
+ * @file Defines.h
+ * @ingroup vocserv
+ */
+#if !defined(__DEFINES_H__)
+#define __DEFINES_H__
+
+#include "common/Defines.h"
+#include "common/GitHash.h"
+
+// ---------------------------------------------------------------------------
+//  Constants
+// ---------------------------------------------------------------------------
+
+#undef __PROG_NAME__
+#define __PROG_NAME__ "Digital Voice Modem (DVM) Vocoder Service"
+#undef __EXE_NAME__ 
+#define __EXE_NAME__ "dvmvocoder"
+
+#define DEFAULT_CHANNELS 32U
+#define DEFAULT_STATS_INTERVAL 60U
+
+#endif // __DEFINES_H__
@@ -0,0 +1,267 @@
+// SPDX-License-Identifier: GPL-2.0-only
+/*
+ * Digital Voice Modem - Vocoder Service
+ * GPLv2 Open Source. Use is subject to license terms.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ *  Copyright (C) 2026 Bryan Biedenkapp, N2PLL
+ *
+ */
+#include "Defines.h"
+#include "common/Log.h"
+#include "common/Thread.h"
+#include "vocoder/VocoderService.h"
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <thread>
+
+#include <signal.h>
+
+using namespace vocoder;
+
+// ---------------------------------------------------------------------------
+//  Macros
+// ---------------------------------------------------------------------------
+
+#define IS(s) (::strcmp(argv[i], s) == 0)
+
+// ---------------------------------------------------------------------------
+//  Global Variables
+// ---------------------------------------------------------------------------
+
+int g_signal = 0;
+std::string g_progExe = std::string(__EXE_NAME__);
+std::string g_shmName = std::string(shm::DEFAULT_SHM_NAME);
+uint32_t g_channels = DEFAULT_CHANNELS;
+uint32_t g_workers = 0U;
+uint32_t g_statsInterval = DEFAULT_STATS_INTERVAL;
+
+bool g_killed = false;
+
+// ---------------------------------------------------------------------------
+//  Global Functions
+// ---------------------------------------------------------------------------
+
+/* Internal signal handler. */
+
+static void sigHandler(int signum)
+{
+    g_signal = signum;
+    g_killed = true;
+}
+
+/* Helper to pring usage the command line arguments. (And optionally an error.) */
+
+void usage(const char* message, const char* arg)
+{
+    ::fprintf(stdout, __PROG_NAME__ " %s (built %s)\r\n", __VER__, __BUILD__);
+    ::fprintf(stdout, "Copyright (c) 2026 Bryan Biedenkapp, N2PLL and DVMProject (https://github.com/dvmproject) Authors.\n");
+    ::fprintf(stdout, HIGHLY_UNNECESSARY_DISCLAIMER_FOR_THE_MENTAL "\n\n");
+    if (message != nullptr) {
+        ::fprintf(stderr, "%s: ", g_progExe.c_str());
+        ::fprintf(stderr, message, arg);
+        ::fprintf(stderr, "\n\n");
+    }
+
+    ::fprintf(stdout,
+        "usage: %s [-vh]"
+        "[-n <channels>]"
+        "[-w <workers>]"
+        "[-s <name>]"
+        "[-i <seconds>]"
+        "\n\n"
+        "  -v           show version information\n"
+        "  -h           show this screen\n"
+        "\n"
+        "  -n <count>   number of vocoder channels (default %u)\n"
+        "  -w <count>   number of worker threads (default: number of CPUs)\n"
+        "  -s <name>    shared memory segment name (default %s)\n"
+        "  -i <seconds> channel statistics logging interval, 0 to disable (default %u)\n"
+        "\n"
+        "  --           stop handling options\n",
+        g_progExe.c_str(), DEFAULT_CHANNELS, shm::DEFAULT_SHM_NAME, DEFAULT_STATS_INTERVAL);
+
+    exit(EXIT_FAILURE);
+}
+
+/* Helper to validate the command line arguments. */
+
+int checkArgs(int argc, char* argv[])
+{
+    int i, p = 0;
+
+    // iterate through arguments
+    for (i = 1; i <= argc; i++)
+    {
+        if (argv[i] == nullptr) {
+            break;
+        }
+
+        if (*argv[i] != '-') {
+            continue;
+        }
+        else if (IS("--")) {
+            ++p;
+            break;
+        }
+        else if (IS("-n")) {
+            if (argc-- <= 0)
+                usage("error: %s", "must specify the number of vocoder channels");
+            g_channels = (uint32_t)::atoi(argv[++i]);
+
+            if (g_channels == 0U)
+                usage("error: %s", "number of vocoder channels must be greater than 0");
+
+            p += 2;
+        }
+        else if (IS("-w")) {
+            if (argc-- <= 0)
+                usage("error: %s", "must specify the number of worker threads");
+            g_workers = (uint32_t)::atoi(argv[++i]);
+
+            p += 2;
+        }
+        else if (IS("-s")) {
+            if (argc-- <= 0)
+                usage("error: %s", "must specify the shared memory segment name");
+            g_shmName = std::string(argv[++i]);
+
+            if (g_shmName.empty())
+                usage("error: %s", "shared memory segment name cannot be blank!");
+            if (g_shmName[0U] != '/')
+                g_shmName = "/" + g_shmName;
+
+            p += 2;
+        }
+        else if (IS("-i")) {
+            if (argc-- <= 0)
+                usage("error: %s", "must specify the statistics logging interval");
+            g_statsInterval = (uint32_t)::atoi(argv[++i]);
+
+            p += 2;
+        }
+        else if (IS("-v")) {
+            ::fprintf(stdout, __PROG_NAME__ " %s (built %s)\r\n", __VER__, __BUILD__);
+            ::fprintf(stdout, "Copyright (c) 2026 Bryan Biedenkapp, N2PLL and DVMProject (https://github.com/dvmproject) Authors.\n");
+            ::fprintf(stdout, HIGHLY_UNNECESSARY_DISCLAIMER_FOR_THE_MENTAL "\n");
+            if (argc == 2)
+                exit(EXIT_SUCCESS);
+        }
+        else if (IS("-h")) {
+            usage(nullptr, nullptr);
+            if (argc == 2)
+                exit(EXIT_SUCCESS);
+        }
+        else {
+            usage("unrecognized option `%s'", argv[i]);
+        }
+    }
+
+    if (p < 0 || p > argc) {
+        p = 0;
+    }
+
+    return ++p;
+}
+
+/* Helper to convert a channel type to a string. */
+
+static const char* channelTypeToString(uint8_t type)
+{
+    switch (type) {
+    case shm::CHANNEL_DMR_AMBE:
+        return "DMR AMBE";
+    case shm::CHANNEL_IMBE:
+        return "IMBE";
+    case shm::CHANNEL_DMR_AMBE_TO_IMBE:
+        return "DMR AMBE -> IMBE";
+    case shm::CHANNEL_IMBE_TO_DMR_AMBE:
+        return "IMBE -> DMR AMBE";
+    default:
+        return "unknown";
+    }
+}
+
+// ---------------------------------------------------------------------------
+//  Program Entry Point
+// ---------------------------------------------------------------------------
+
+int main(int argc, char** argv)
+{
+    if (argv[0] != nullptr && *argv[0] != 0)
+        g_progExe = std::string(argv[0]);
+
+    if (argc > 1) {
+        // check arguments
+        int i = checkArgs(argc, argv);
+        if (i < argc) {
+            argc -= i;
+            argv += i;
+        }
+        else {
+            argc--;
+            argv++;
+        }
+    }
+
+    // initialize system logging
+    bool ret = ::LogInitialise("", "", 0U, 1U);
+    if (!ret) {
+        ::fprintf(stderr, "unable to open the log file\n");
+        return EXIT_FAILURE;
+    }
+
+    ::signal(SIGINT, sigHandler);
+    ::signal(SIGTERM, sigHandler);
+
+    if (g_workers == 0U) {
+        g_workers = std::thread::hardware_concurrency();
+        if (g_workers == 0U)
+            g_workers = 1U;
+    }
+
+    ::LogInfo(__BANNER__ "\r\n" __PROG_NAME__ " %s (built %s)\r\n" \
+        "Copyright (c) 2026 Bryan Biedenkapp, N2PLL and DVMProject (https://github.com/dvmproject) Authors.\r\n" \
+        ">> Vocoder Service\r\n", __VER__, __BUILD__);
+
+    VocoderService* service = new VocoderService(g_shmName, g_channels, g_workers);
+    if (!service->open()) {
+        ::LogError(LOG_HOST, "Failed to start vocoder service, %s", service->getLastError().c_str());
+        delete service;
+        ::LogFinalise();
+        return EXIT_FAILURE;
+    }
+
+    ::LogInfoEx(LOG_HOST, "Vocoder service started, segment %s, %u channels, %u workers", g_shmName.c_str(), g_channels, g_workers);
+
+    uint32_t elapsed = 0U;
+    while (!g_killed) {
+        Thread::sleep(1000U);
+        elapsed++;
+
+        if (g_statsInterval == 0U || elapsed < g_statsInterval)
+            continue;
+        elapsed = 0U;
+
+        std::vector<VocoderService::ChannelStats> stats = service->getStats();
+        ::LogInfoEx(LOG_HOST, "Vocoder service, %u of %u channels in use", (uint32_t)stats.size(), service->getChannelCount());
+        for (auto& s : stats) {
+            ::LogInfoEx(LOG_HOST, "Vocoder channel %u, %s, client PID %u, frames = %llu, latency avg = %uus, max = %uus, pending = %u",
+                s.channel, channelTypeToString(s.type), s.ownerPid, (unsigned long long)s.frames, s.latencyAvg, s.latencyMax, s.pending);
+        }
+    }
+
+    if (g_signal == SIGINT)
+        ::LogInfoEx(LOG_HOST, "Exited on receipt of SIGINT");
+
+    if (g_signal == SIGTERM)
+        ::LogInfoEx(LOG_HOST, "Exited on receipt of SIGTERM");
+
+    service->close();
+    delete service;
+
+    ::LogFinalise();
+    return EXIT_SUCCESS;
+}
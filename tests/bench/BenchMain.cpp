@@ -0,0 +1,336 @@
+// SPDX-License-Identifier: GPL-2.0-only
+/*
+ * Digital Voice Modem - Benchmark Suite
+ * GPLv2 Open Source. Use is subject to license terms.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ *  Copyright (C) 2026 Bryan Biedenkapp, N2PLL
+ *
+ */
+#include "common/json/json.h"
+#include "common/GitHash.h"
+#include "common/Log.h"
+#include "bench/Benchmark.h"
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <ctime>
+#include <exception>
+#include <fstream>
+#include <map>
+#include <ostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+using namespace bench;
+
+// ---------------------------------------------------------------------------
+//  Constants
+// ---------------------------------------------------------------------------
+
+#undef __PROG_NAME__
+#define __PROG_NAME__ "Digital Voice Modem (DVM) Microbenchmark Suite"
+#undef __EXE_NAME__
+#define __EXE_NAME__ "dvmbench"
+
+#define IS(s) (::strcmp(argv[i], s) == 0)
+
+const uint32_t DEFAULT_SAMPLES = 10U;
+const uint32_t DEFAULT_MIN_SAMPLE_MS = 20U;
+const double DEFAULT_THRESHOLD = 10.0;
+
+// ---------------------------------------------------------------------------
+//  Global Variables
+// ---------------------------------------------------------------------------
+
+static std::string g_progExe = std::string(__EXE_NAME__);
+static std::string g_filter = std::string();
+static std::string g_outputFile = std::string();
+static std::string g_compareFile = std::string();
+static uint32_t g_samples = DEFAULT_SAMPLES;
+static uint32_t g_minSampleMs = DEFAULT_MIN_SAMPLE_MS;
+static double g_threshold = DEFAULT_THRESHOLD;
+static bool g_list = false;
+
+// ---------------------------------------------------------------------------
+//  Global Functions
+// ---------------------------------------------------------------------------
+
+/* Helper to print usage the command line arguments. (And optionally an error.) */
+
+void usage(const char* message, const char* arg)
+{
+    ::fprintf(stdout, __PROG_NAME__ " %s (built %s)\r\n", __VER__, __BUILD__);
+    ::fprintf(stdout, "Copyright (c) 2017-2026 Bryan Biedenkapp, N2PLL and DVMProject (https://github.com/dvmproject) Authors.\n\n");
+    if (message != nullptr) {
+        ::fprintf(stderr, "%s: ", g_progExe.c_str());
+        ::fprintf(stderr, message, arg);
+        ::fprintf(stderr, "\n\n");
+    }
+
+    ::fprintf(stdout,
+        "usage: %s [-lvh]"
+        "[-f <filter>]"
+        "[-s <samples>]"
+        "[-t <ms>]"
+        "[-o <file>]"
+        "[-c <file>]"
+        "[-r <percent>]"
+        "\n\n"
+        "  -f <filter>                 only run benchmarks whose group or name contains the filter\n"
+        "  -s <samples>                number of timed samples per benchmark (default %u)\n"
+        "  -t <ms>                     minimum time of a sample (default %ums)\n"
+        "  -o <file>                   write the results as JSON to the file\n"
+        "  -c <file>                   compare the results against a previous JSON result file\n"
+        "  -r <percent>                slowdown (of the median) reported as a regression when comparing (default %.0f%%)\n"
+        "  -l                          list the benchmarks and exit\n"
+        "  -v                          show version information\n"
+        "  -h                          show this screen\n"
+        "\n",
+        g_progExe.c_str(), DEFAULT_SAMPLES, DEFAULT_MIN_SAMPLE_MS, DEFAULT_THRESHOLD);
+
+    exit(EXIT_FAILURE);
+}
+
+/* Helper to validate the command line arguments. */
+
+void checkArgs(int argc, char* argv[])
+{
+    for (int i = 1; i < argc; i++) {
+        if (IS("-f")) {
+            if (i + 1 >= argc)
+                usage("error: %s", "must specify the benchmark filter");
+            g_filter = std::string(argv[++i]);
+        }
+        else if (IS("-s")) {
+            if (i + 1 >= argc)
+                usage("error: %s", "must specify the number of samples");
+            g_samples = (uint32_t)::atoi(argv[++i]);
+
+            if (g_samples == 0U)
+                usage("error: %s", "number of samples cannot be 0!");
+        }
+        else if (IS("-t")) {
+            if (i + 1 >= argc)
+                usage("error: %s", "must specify the minimum sample time");
+            g_minSampleMs = (uint32_t)::atoi(argv[++i]);
+        }
+        else if (IS("-o")) {
+            if (i + 1 >= argc)
+                usage("error: %s", "must specify the output file");
+            g_outputFile = std::string(argv[++i]);
+        }
+        else if (IS("-c")) {
+            if (i + 1 >= argc)
+                usage("error: %s", "must specify the file to compare against");
+            g_compareFile = std::string(argv[++i]);
+        }
+        else if (IS("-r")) {
+            if (i + 1 >= argc)
+                usage("error: %s", "must specify the regression threshold");
+            g_threshold = ::atof(argv[++i]);
+        }
+        else if (IS("-l")) {
+            g_list = true;
+        }
+        else if (IS("-v")) {
+            ::fprintf(stdout, __PROG_NAME__ " %s (built %s)\r\n", __VER__, __BUILD__);
+            ::fprintf(stdout, "Copyright (c) 2017-2026 Bryan Biedenkapp, N2PLL and DVMProject (https://github.com/dvmproject) Authors.\n");
+            if (argc == 2)
+                exit(EXIT_SUCCESS);
+        }
+        else if (IS("-h")) {
+            usage(nullptr, nullptr);
+        }
+        else {
+            usage("unrecognized option `%s'", argv[i]);
+        }
+    }
+}
+
+/* Helper to get the unique key of a benchmark. */
+
+std::string benchmarkKey(const std::string& group, const std::string& name)
+{
+    return group + "/" + name;
+}
+
+/* Helper to format the results as JSON. */
+
+json::object resultsJson(const std::vector<BenchmarkResult>& results)
+{
+    json::object ret = json::object();
+    ret["program"].set<std::string>(std::string(__EXE_NAME__));
+    ret["version"].set<std::string>(std::string(__VER__));
+    ret["gitHash"].set<std::string>(std::string(__GIT_VER_HASH__));
+    ret["build"].set<std::string>(std::string(__BUILD__));
+#if defined(__VERSION__)
+    ret["compiler"].set<std::string>(std::string(__VERSION__));
+#endif // defined(__VERSION__)
+
+    char timestamp[32U];
+    std::time_t now = std::time(nullptr);
+    std::strftime(timestamp, sizeof(timestamp), "%Y-%m-%dT%H:%M:%SZ", std::gmtime(&now));
+    ret["timestamp"].set<std::string>(std::string(timestamp));
+
+    ret["samples"].set<uint32_t>(g_samples);
+    ret["minSampleMs"].set<uint32_t>(g_minSampleMs);
+
+    json::array benchmarks = json::array();
+    for (const BenchmarkResult& result : results) {
+        json::object bench = json::object();
+        bench["group"].set<std::string>(result.group);
+        bench["name"].set<std::string>(result.name);
+        bench["iterations"].set<uint64_t>(result.iterations);
+        bench["samples"].set<uint32_t>(result.samples);
+
+        json::object nsPerOp = json::object();
+        nsPerOp["min"].set<double>(result.min);
+        nsPerOp["median"].set<double>(result.median);
+        nsPerOp["mean"].set<double>(result.mean);
+        nsPerOp["stddev"].set<double>(result.stddev);
+        bench["nsPerOp"].set<json::object>(nsPerOp);
+
+        benchmarks.push_back(json::value(bench));
+    }
+    ret["benchmarks"].set<json::array>(benchmarks);
+
+    return ret;
+}
+
+/* Helper to compare the results against a previous result file. Returns the number of regressions. */
+
+uint32_t compare(const std::vector<BenchmarkResult>& results, const std::string& filename)
+{
+    std::ifstream file(filename, std::ifstream::in);
+    if (!file.is_open()) {
+        ::fprintf(stderr, "%s: failed to open %s\n", g_progExe.c_str(), filename.c_str());
+        exit(EXIT_FAILURE);
+    }
+
+    std::stringstream ss;
+    ss << file.rdbuf();
+
+    json::value v;
+    std::string err = json::parse(v, ss.str());
+    if (!err.empty() || !v.is<json::object>()) {
+        ::fprintf(stderr, "%s: failed to parse %s, %s\n", g_progExe.c_str(), filename.c_str(), err.c_str());
+        exit(EXIT_FAILURE);
+    }
+
+    json::object baseline = v.get<json::object>();
+    std::map<std::string, double> medians;
+    if (baseline["benchmarks"].is<json::array>()) {
+        for (auto& entry : baseline["benchmarks"].get<json::array>()) {
+            if (!entry.is<json::object>())
+                continue;
+
+            json::object bench = entry.get<json::object>();
+            if (!bench["group"].is<std::string>() || !bench["name"].is<std::string>() || !bench["nsPerOp"].is<json::object>())
+                continue;
+
+            json::object nsPerOp = bench["nsPerOp"].get<json::object>();
+            if (nsPerOp["median"].is<double>())
+                medians[benchmarkKey(bench["group"].get<std::string>(), bench["name"].get<std::string>())] = nsPerOp["median"].get<double>();
+        }
+    }
+
+    std::string baseHash = baseline["gitHash"].is<std::string>() ? baseline["gitHash"].get<std::string>() : "unknown";
+    ::fprintf(stdout, "\nComparison against %s (%s), regression threshold %.1f%%\n", filename.c_str(), baseHash.c_str(), g_threshold);
+
+    uint32_t regressions = 0U;
+    for (const BenchmarkResult& result : results) {
+        std::string key = benchmarkKey(result.group, result.name);
+        auto it = medians.find(key);
+        if (it == medians.end() || it->second <= 0.0) {
+            ::fprintf(stdout, "  %-60s %12s -> %12.1f ns  (new)\n", key.c_str(), "", result.median);
+            continue;
+        }
+
+        double change = (result.median - it->second) * 100.0 / it->second;
+        bool regressed = change > g_threshold;
+        if (regressed)
+            regressions++;
+
+        ::fprintf(stdout, "  %-60s %12.1f -> %12.1f ns  %+7.1f%%%s\n", key.c_str(), it->second, result.median, change,
+            regressed ? "  REGRESSION" : "");
+    }
+
+    return regressions;
+}
+
+// ---------------------------------------------------------------------------
+//  Program Entry Point
+// ---------------------------------------------------------------------------
+
+int main(int argc, char** argv)
+{
+    if (argv[0] != nullptr && *argv[0] != 0)
+        g_progExe = std::string(argv[0]);
+
+    checkArgs(argc, argv);
+
+    // the benchmarked code logs; discard the log output so writing it does not skew the measurements
+    g_logDisplayLevel = 0U;
+
+    std::ostream nullStream(nullptr);
+    log_internal::SetInternalOutputStream(nullStream);
+
+    std::vector<BenchmarkCase> cases;
+    for (const BenchmarkCase& bc : Benchmark::cases()) {
+        if (!g_filter.empty() && benchmarkKey(bc.group, bc.name).find(g_filter) == std::string::npos)
+            continue;
+        cases.push_back(bc);
+    }
+
+    if (g_list) {
+        for (const BenchmarkCase& bc : cases)
+            ::fprintf(stdout, "%s\n", benchmarkKey(bc.group, bc.name).c_str());
+        return EXIT_SUCCESS;
+    }
+
+    if (cases.empty()) {
+        ::fprintf(stderr, "%s: no benchmarks match the filter `%s'\n", g_progExe.c_str(), g_filter.c_str());
+        return EXIT_FAILURE;
+    }
+
+    ::fprintf(stdout, "%-60s %12s %12s %12s %12s\n", "benchmark", "median (ns)", "min (ns)", "stddev (ns)", "iterations");
+
+    std::vector<BenchmarkResult> results;
+    uint32_t failed = 0U;
+    for (const BenchmarkCase& bc : cases) {
+        std::string key = benchmarkKey(bc.group, bc.name);
+
+        try {
+            BenchmarkResult result = Benchmark::run(bc, g_samples, (uint64_t)g_minSampleMs * 1000000ULL);
+            ::fprintf(stdout, "%-60s %12.1f %12.1f %12.1f %12llu\n", key.c_str(), result.median, result.min, result.stddev,
+                (unsigned long long)result.iterations);
+            ::fflush(stdout);
+
+            results.push_back(result);
+        }
+        catch (std::exception& e) {
+            ::fprintf(stdout, "%-60s FAILED: %s\n", key.c_str(), e.what());
+            failed++;
+        }
+    }
+
+    if (!g_outputFile.empty()) {
+        std::ofstream file(g_outputFile, std::ofstream::out | std::ofstream::trunc);
+        if (!file.is_open()) {
+            ::fprintf(stderr, "%s: failed to open %s\n", g_progExe.c_str(), g_outputFile.c_str());
+            return EXIT_FAILURE;
+        }
+
+        file << json::value(resultsJson(results)).serialize(true);
+        file.close();
+    }
+
+    uint32_t regressions = 0U;
+    if (!g_compareFile.empty())
+        regressions = compare(results, g_compareFile);
+
+    return (failed > 0U || regressions > 0U) ? EXIT_FAILURE : EXIT_SUCCESS;
+}
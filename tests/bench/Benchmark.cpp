@@ -0,0 +1,114 @@
+// SPDX-License-Identifier: GPL-2.0-only
+/*
+ * Digital Voice Modem - Benchmark Suite
+ * GPLv2 Open Source. Use is subject to license terms.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ *  Copyright (C) 2026 Bryan Biedenkapp, N2PLL
+ *
+ */
+#include "bench/Benchmark.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+
+using namespace bench;
+
+// ---------------------------------------------------------------------------
+//  Constants
+// ---------------------------------------------------------------------------
+
+const uint64_t MAX_ITERATIONS = 1000000000ULL;
+
+// ---------------------------------------------------------------------------
+//  Global Functions
+// ---------------------------------------------------------------------------
+
+/* Helper to time a run of the benchmark body (ns). */
+
+static uint64_t timeRun(const BenchmarkCase& bc, uint64_t iterations)
+{
+    auto start = std::chrono::steady_clock::now();
+    uint64_t result = bc.fn(iterations);
+    auto end = std::chrono::steady_clock::now();
+
+    doNotOptimize(result);
+    return (uint64_t)std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count();
+}
+
+// ---------------------------------------------------------------------------
+//  Public Class Members
+// ---------------------------------------------------------------------------
+
+/* Registers a benchmark. */
+
+void Benchmark::add(const char* group, const char* name, std::function<uint64_t(uint64_t)> fn)
+{
+    BenchmarkCase bc;
+    bc.group = std::string(group);
+    bc.name = std::string(name);
+    bc.fn = fn;
+
+    cases().push_back(bc);
+}
+
+/* Gets the registered benchmarks. */
+
+std::vector<BenchmarkCase>& Benchmark::cases()
+{
+    // function-local so registration does not depend on static initialization order
+    static std::vector<BenchmarkCase> cases;
+    return cases;
+}
+
+/* Measures a benchmark. */
+
+BenchmarkResult Benchmark::run(const BenchmarkCase& bc, uint32_t samples, uint64_t minSampleNs)
+{
+    if (samples == 0U)
+        samples = 1U;
+
+    // the first run warms up the caches and any lazily initialized state of the benchmark, and is discarded
+    timeRun(bc, 1U);
+
+    uint64_t iterations = 1U;
+    uint64_t elapsed = timeRun(bc, iterations);
+    while (elapsed < minSampleNs && iterations < MAX_ITERATIONS) {
+        uint64_t next = iterations * 10U;
+        if (elapsed > 0U) {
+            // aim slightly past the minimum, but never grow by more than 10x in a step
+            next = std::min(next, (uint64_t)((double)iterations * (double)minSampleNs * 1.2 / (double)elapsed) + 1U);
+        }
+
+        iterations = std::max(next, iterations + 1U);
+        elapsed = timeRun(bc, iterations);
+    }
+
+    std::vector<double> perOp;
+    for (uint32_t i = 0U; i < samples; i++)
+        perOp.push_back((double)timeRun(bc, iterations) / (double)iterations);
+
+    BenchmarkResult result;
+    result.group = bc.group;
+    result.name = bc.name;
+    result.iterations = iterations;
+    result.samples = samples;
+
+    double sum = 0.0;
+    for (double v : perOp)
+        sum += v;
+    result.mean = sum / perOp.size();
+
+    double var = 0.0;
+    for (double v : perOp)
+        var += (v - result.mean) * (v - result.mean);
+    result.stddev = (perOp.size() > 1U) ? std::sqrt(var / (perOp.size() - 1U)) : 0.0;
+
+    std::sort(perOp.begin(), perOp.end());
+    result.min = perOp.front();
+    size_t mid = perOp.size() / 2U;
+    result.median = (perOp.size() % 2U == 0U) ? (perOp[mid - 1U] + perOp[mid]) / 2.0 : perOp[mid];
+
+    return result;
+}
@@ -0,0 +1,160 @@
+// SPDX-License-Identifier: GPL-2.0-only
+/*
+ * Digital Voice Modem - Benchmark Suite
+ * GPLv2 Open Source. Use is subject to license terms.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ *  Copyright (C) 2026 Bryan Biedenkapp, N2PLL
+ *
+ */
+/**
+ * @defgroup bench Microbenchmark Suite (dvmbench)
+ * @brief Digital Voice Modem - Microbenchmark Suite
+ * @details Measures the hot paths of the common and vocoder libraries, and writes the results as JSON
+ *  which can be compared across commits.
+ *
+ * @file Benchmark.h
+ * @ingroup bench
+ * @file Benchmark.cpp
+ * @ingroup bench
+ */
+#if !defined(__BENCHMARK_H__)
+#define __BENCHMARK_H__
+
+#include "common/Defines.h"
+
+#include <functional>
+#include <string>
+#include <vector>
+
+namespace bench
+{
+    // ---------------------------------------------------------------------------
+    //  Structure Declaration
+    // ---------------------------------------------------------------------------
+
+    /**
+     * @brief Represents a registered benchmark.
+     * @ingroup bench
+     */
+    struct BenchmarkCase {
+        std::string group;                              //!< Benchmark group (i.e. edac, crypto).
+        std::string name;                               //!< Benchmark name.
+        std::function<uint64_t(uint64_t)> fn;           //!< Benchmark body; runs the operation the given number of times.
+    };
+
+    // ---------------------------------------------------------------------------
+    //  Structure Declaration
+    // ---------------------------------------------------------------------------
+
+    /**
+     * @brief Represents the measured result of a benchmark.
+     * @ingroup bench
+     */
+    struct BenchmarkResult {
+        std::string group;                              //!< Benchmark group.
+        std::string name;                               //!< Benchmark name.
+        uint64_t iterations;                            //!< Operations per sample.
+        uint32_t samples;                               //!< Number of samples.
+
+        double min;                                     //!< Fastest sample (ns per operation).
+        double median;                                  //!< Median sample (ns per operation).
+        double mean;                                    //!< Mean of the samples (ns per operation).
+        double stddev;                                  //!< Standard deviation of the samples (ns per operation).
+    };
+
+    // ---------------------------------------------------------------------------
+    //  Class Declaration
+    // ---------------------------------------------------------------------------
+
+    /**
+     * @brief Implements the registry and runner for benchmarks.
+     * @ingroup bench
+     */
+    class Benchmark {
+    public:
+        /**
+         * @brief Registers a benchmark.
+         * @param group Benchmark group.
+         * @param name Benchmark name.
+         * @param fn Benchmark body.
+         */
+        static void add(const char* group, const char* name, std::function<uint64_t(uint64_t)> fn);
+        /**
+         * @brief Gets the registered benchmarks.
+         * @returns std::vector<BenchmarkCase>& List of registered benchmarks.
+         */
+        static std::vector<BenchmarkCase>& cases();
+
+        /**
+         * @brief Measures a benchmark.
+         *
+         *  The number of operations per sample is first calibrated so that a sample runs for at least
+         *  the given minimum time; the samples are then timed individually.
+         * @param bc Benchmark to measure.
+         * @param samples Number of samples.
+         * @param minSampleNs Minimum time of a sample (ns).
+         * @returns BenchmarkResult Measured result.
+         */
+        static BenchmarkResult run(const BenchmarkCase& bc, uint32_t samples, uint64_t minSampleNs);
+    };
+
+    // ---------------------------------------------------------------------------
+    //  Class Declaration
+    // ---------------------------------------------------------------------------
+
+    /**
+     * @brief Helper to register a benchmark at static initialization.
+     * @ingroup bench
+     */
+    class Registrar {
+    public:
+        /**
+         * @brief Initializes a new instance of the Registrar class.
+         * @param group Benchmark group.
+         * @param name Benchmark name.
+         * @param fn Benchmark body.
+         */
+        Registrar(const char* group, const char* name, uint64_t (*fn)(uint64_t)) { Benchmark::add(group, name, fn); }
+    };
+
+    // ---------------------------------------------------------------------------
+    //  Global Functions
+    // ---------------------------------------------------------------------------
+
+    /**
+     * @brief Helper to prevent the compiler from optimizing away the computation of a value.
+     * @param value Value to keep.
+     */
+    template <typename T>
+    inline void doNotOptimize(const T& value)
+    {
+#if defined(_MSC_VER)
+        const volatile T* sink = &value;
+        (void)sink;
+#else
+        asm volatile("" : : "r,m"(value) : "memory");
+#endif // defined(_MSC_VER)
+    }
+} // namespace bench
+
+// ---------------------------------------------------------------------------
+//  Macros
+// ---------------------------------------------------------------------------
+
+#define BENCH_CONCAT_IMPL(a, b) a##b
+#define BENCH_CONCAT(a, b) BENCH_CONCAT_IMPL(a, b)
+
+/**
+ * @brief Declares and registers a benchmark. The body is given the number of operations to run in
+ *  "iterations", and returns a value derived from the work done (so the work is not optimized away).
+ *  A benchmark that cannot run throws a std::exception, which is reported as a failure.
+ * @param group Benchmark group.
+ * @param name Benchmark name.
+ */
+#define BENCHMARK_CASE(group, name)                                                                             \
+    static uint64_t BENCH_CONCAT(__bench_fn_, __LINE__)(uint64_t iterations);                                   \
+    static bench::Registrar BENCH_CONCAT(__bench_reg_, __LINE__)(group, name, BENCH_CONCAT(__bench_fn_, __LINE__)); \
+    static uint64_t BENCH_CONCAT(__bench_fn_, __LINE__)(uint64_t iterations)
+
+#endif // __BENCHMARK_H__
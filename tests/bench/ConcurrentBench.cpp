@@ -0,0 +1,109 @@
+// SPDX-License-Identifier: GPL-2.0-only
+/*
+ * Digital Voice Modem - Benchmark Suite
+ * GPLv2 Open Source. Use is subject to license terms.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ *  Copyright (C) 2026 Bryan Biedenkapp, N2PLL
+ *
+ */
+#include "common/concurrent/unordered_map.h"
+#include "common/Thread.h"
+#include "bench/Benchmark.h"
+
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+
+namespace {
+    const uint32_t TABLE_CNT = 4096U;
+
+    /**
+     * @brief Sleep based read lock, as the containers used before the reader gate.
+     */
+    class LegacyLock {
+    public:
+        void lock() { m_mutex.lock(); m_locked = true; }
+        void unlock() { m_locked = false; m_mutex.unlock(); }
+        void spinlock() const
+        {
+            while (m_locked)
+                Thread::sleep(1U);
+        }
+
+    private:
+        std::mutex m_mutex;
+        volatile bool m_locked = false;
+    };
+
+    /**
+     * @brief Helper to run the given number of reads while a writer thread changes the table every 200us.
+     *
+     *  Reads stalled by the writer show up in the per-operation time, so a lock that makes readers wait
+     *  out a writer costs far more than its uncontended lookup.
+     */
+    template <typename Read, typename Write>
+    uint64_t readUnderWrites(uint64_t iterations, Read read, Write write)
+    {
+        std::atomic<bool> running(true);
+        std::thread writer([&]() {
+            uint32_t n = 0U;
+            while (running) {
+                write(n++);
+                std::this_thread::sleep_for(std::chrono::microseconds(200));
+            }
+        });
+
+        uint64_t sink = 0U;
+        for (uint64_t i = 0U; i < iterations; i++)
+            sink += read((uint32_t)i);
+
+        running = false;
+        writer.join();
+        return sink;
+    }
+}
+
+// ---------------------------------------------------------------------------
+//  Read Latency Under Concurrent Writes (4096 entry table)
+// ---------------------------------------------------------------------------
+
+BENCHMARK_CASE("concurrent", "find, sleep spinlock, concurrent writes") {
+    static std::unordered_map<uint32_t, uint32_t> map;
+    static LegacyLock lock;
+
+    // the spinlock only holds off readers that arrive while the writer is inside, so never let the
+    // writer rehash the table under a reader
+    map.reserve(TABLE_CNT * 2U);
+    for (uint32_t i = 0U; i < TABLE_CNT; i++)
+        map[i] = i;
+
+    return readUnderWrites(iterations,
+        [&](uint32_t i) -> uint64_t {
+            lock.spinlock();
+            return map.find(i % TABLE_CNT) != map.end() ? 1U : 0U;
+        },
+        [&](uint32_t n) {
+            lock.lock();
+            map[TABLE_CNT + (n % 64U)] = n;
+            map.erase(TABLE_CNT + ((n + 32U) % 64U));
+            lock.unlock();
+        });
+}
+
+BENCHMARK_CASE("concurrent", "concurrent::unordered_map::find, concurrent writes") {
+    static concurrent::unordered_map<uint32_t, uint32_t> map;
+    for (uint32_t i = 0U; i < TABLE_CNT; i++)
+        map.insert(i, i);
+
+    return readUnderWrites(iterations,
+        [&](uint32_t i) -> uint64_t {
+            return map.find(i % TABLE_CNT) != map.end() ? 1U : 0U;
+        },
+        [&](uint32_t n) {
+            map.insert(TABLE_CNT + (n % 64U), n);
+            map.erase(TABLE_CNT + ((n + 32U) % 64U));
+        });
+}
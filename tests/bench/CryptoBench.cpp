@@ -0,0 +1,221 @@
+// SPDX-License-Identifier: GPL-2.0-only
+/*
+ * Digital Voice Modem - Benchmark Suite
+ * GPLv2 Open Source. Use is subject to license terms.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ *  Copyright (C) 2026 Bryan Biedenkapp, N2PLL
+ *
+ */
+#include "common/p25/P25Defines.h"
+#include "common/p25/Crypto.h"
+#include "common/edac/SHA256.h"
+#include "common/AESCrypto.h"
+#include "bench/Benchmark.h"
+
+#include <cstring>
+
+using namespace crypto;
+using namespace edac;
+using namespace p25::defines;
+using namespace p25::crypto;
+
+namespace {
+    const uint8_t KEY[32U] = {
+        0x2BU, 0x7EU, 0x15U, 0x16U, 0x28U, 0xAEU, 0xD2U, 0xA6U, 0xABU, 0xF7U, 0x15U, 0x88U, 0x09U, 0xCFU, 0x4FU, 0x3CU,
+        0x60U, 0x3DU, 0xEBU, 0x10U, 0x15U, 0xCAU, 0x71U, 0xBEU, 0x2BU, 0x73U, 0xAEU, 0xF0U, 0x85U, 0x7DU, 0x77U, 0x81U
+    };
+    const uint8_t MI[MI_LENGTH_BYTES] = { 0x12U, 0x34U, 0x56U, 0x78U, 0x9AU, 0xBCU, 0xDEU, 0xF0U, 0x00U };
+
+    /**
+     * @brief Helper to generate a P25 keystream the given number of times.
+     */
+    uint64_t keystream(uint8_t algoId, uint8_t keyLength, uint64_t iterations)
+    {
+        P25Crypto crypto;
+        crypto.setTEKAlgoId(algoId);
+        crypto.setKey(KEY, keyLength);
+
+        uint8_t mi[MI_LENGTH_BYTES];
+        ::memcpy(mi, MI, MI_LENGTH_BYTES);
+
+        uint64_t sink = 0U;
+        for (uint64_t i = 0U; i < iterations; i++) {
+            mi[0U] = (uint8_t)i;
+            crypto.setMI(mi);
+            crypto.generateKeystream();
+            sink += crypto.hasValidKeystream() ? 1U : 0U;
+        }
+        return sink;
+    }
+
+    /**
+     * @brief Helper to crypt a superframe (two LDUs) of IMBE audio the given number of times.
+     */
+    uint64_t superframe(uint8_t algoId, uint8_t keyLength, uint64_t iterations)
+    {
+        P25Crypto crypto;
+        crypto.setTEKAlgoId(algoId);
+        crypto.setKey(KEY, keyLength);
+        crypto.setMI(MI);
+        crypto.generateKeystream();
+
+        uint8_t imbe[RAW_IMBE_LENGTH_BYTES];
+        ::memset(imbe, 0x00U, RAW_IMBE_LENGTH_BYTES);
+
+        uint64_t sink = 0U;
+        for (uint64_t i = 0U; i < iterations; i++) {
+            for (uint32_t n = 0U; n < 18U; n++) {
+                DUID::E duid = (n < 9U) ? DUID::LDU1 : DUID::LDU2;
+                switch (algoId) {
+                case ALGO_DES:
+                    crypto.cryptDES_IMBE(imbe, duid);
+                    break;
+                case ALGO_ARC4:
+                    crypto.cryptARC4_IMBE(imbe, duid);
+                    break;
+                default:
+                    crypto.cryptAES_IMBE(imbe, duid);
+                    break;
+                }
+            }
+            sink += imbe[0U];
+        }
+        return sink;
+    }
+}
+
+// ---------------------------------------------------------------------------
+//  P25 Keystreams
+// ---------------------------------------------------------------------------
+
+BENCHMARK_CASE("crypto", "P25Crypto::generateKeystream, AES-256") {
+    return keystream(ALGO_AES_256, 32U, iterations);
+}
+
+BENCHMARK_CASE("crypto", "P25Crypto::generateKeystream, DES-OFB") {
+    return keystream(ALGO_DES, 8U, iterations);
+}
+
+BENCHMARK_CASE("crypto", "P25Crypto::generateKeystream, ARC4") {
+    return keystream(ALGO_ARC4, 5U, iterations);
+}
+
+BENCHMARK_CASE("crypto", "P25Crypto::cryptAES_IMBE, superframe") {
+    return superframe(ALGO_AES_256, 32U, iterations);
+}
+
+BENCHMARK_CASE("crypto", "P25Crypto::cryptARC4_IMBE, superframe") {
+    return superframe(ALGO_ARC4, 5U, iterations);
+}
+
+// ---------------------------------------------------------------------------
+//  AES
+// ---------------------------------------------------------------------------
+
+BENCHMARK_CASE("crypto", "AES::encryptECB, AES-256, 16 bytes") {
+    AES aes(AESKeyLength::AES_256);
+    uint8_t block[16U];
+    ::memset(block, 0x00U, 16U);
+    ::memcpy(block, MI, MI_LENGTH_BYTES);
+
+    uint64_t sink = 0U;
+    for (uint64_t i = 0U; i < iterations; i++) {
+        block[15U] = (uint8_t)i;
+        uint8_t* out = aes.encryptECB(block, 16U, KEY);
+        sink += out[0U];
+        delete[] out;
+    }
+    return sink;
+}
+
+BENCHMARK_CASE("crypto", "AES::encryptCBC, AES-256, 512 bytes") {
+    AES aes(AESKeyLength::AES_256);
+    uint8_t data[512U];
+    for (uint32_t i = 0U; i < 512U; i++)
+        data[i] = (uint8_t)i;
+    uint8_t iv[16U];
+    ::memset(iv, 0xA5U, 16U);
+
+    uint64_t sink = 0U;
+    for (uint64_t i = 0U; i < iterations; i++) {
+        data[0U] = (uint8_t)i;
+        uint8_t* out = aes.encryptCBC(data, 512U, KEY, iv);
+        sink += out[511U];
+        delete[] out;
+    }
+    return sink;
+}
+
+BENCHMARK_CASE("crypto", "AES::decryptCBC, AES-256, 512 bytes") {
+    AES aes(AESKeyLength::AES_256);
+    uint8_t data[512U];
+    for (uint32_t i = 0U; i < 512U; i++)
+        data[i] = (uint8_t)i;
+    uint8_t iv[16U];
+    ::memset(iv, 0xA5U, 16U);
+
+    uint8_t* cipher = aes.encryptCBC(data, 512U, KEY, iv);
+
+    uint64_t sink = 0U;
+    for (uint64_t i = 0U; i < iterations; i++) {
+        uint8_t* out = aes.decryptCBC(cipher, 512U, KEY, iv);
+        sink += out[511U];
+        delete[] out;
+    }
+
+    delete[] cipher;
+    return sink;
+}
+
+// ---------------------------------------------------------------------------
+//  SHA-256
+// ---------------------------------------------------------------------------
+
+namespace {
+    /**
+     * @brief Helper to hash a peer login challenge (salt + password) the given number of times.
+     */
+    uint64_t loginChallenge(bool hardware, uint64_t iterations)
+    {
+        bool enabled = SHA256::isHardwareAccelerated();
+        SHA256::setHardwareAcceleration(hardware);
+
+        uint8_t in[4U + 32U];
+        ::memset(in, 0x5AU, sizeof(in));
+        uint8_t out[SHA256_DIGEST_SIZE];
+
+        uint64_t sink = 0U;
+        for (uint64_t i = 0U; i < iterations; i++) {
+            in[0U] = (uint8_t)i;
+            SHA256 sha256;
+            sha256.buffer(in, sizeof(in), out);
+            sink += out[0U];
+        }
+
+        SHA256::setHardwareAcceleration(enabled);
+        return sink;
+    }
+}
+
+BENCHMARK_CASE("crypto", "SHA256::buffer, login challenge, software") {
+    return loginChallenge(false, iterations);
+}
+
+BENCHMARK_CASE("crypto", "SHA256::buffer, login challenge, hardware") {
+    return loginChallenge(true, iterations);
+}
+
+BENCHMARK_CASE("crypto", "SHA256::hmac, 28 byte resumption ticket") {
+    uint8_t ticket[28U];
+    ::memset(ticket, 0xA5U, sizeof(ticket));
+    uint8_t out[SHA256_DIGEST_SIZE];
+
+    uint64_t sink = 0U;
+    for (uint64_t i = 0U; i < iterations; i++) {
+        ticket[0U] = (uint8_t)i;
+        SHA256::hmac(KEY, 16U, ticket, sizeof(ticket), out);
+        sink += out[0U];
+    }
+    return sink;
+}
@@ -0,0 +1,456 @@
+// SPDX-License-Identifier: GPL-2.0-only
+/*
+ * Digital Voice Modem - Benchmark Suite
+ * GPLv2 Open Source. Use is subject to license terms.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ *  Copyright (C) 2026 Bryan Biedenkapp, N2PLL
+ *
+ */
+#include "common/edac/AMBEFEC.h"
+#include "common/edac/BPTC19696.h"
+#include "common/edac/CRC.h"
+#include "common/edac/Golay24128.h"
+#include "common/edac/RS634717.h"
+#include "common/edac/Trellis.h"
+#include "common/nxdn/edac/Convolution.h"
+#include "common/BitManipulation.h"
+#include "bench/Benchmark.h"
+
+#include <cstring>
+
+using namespace edac;
+
+namespace {
+    /**
+     * @brief Helper to fill a buffer with a repeatable pseudo-random pattern.
+     */
+    void fill(uint8_t* data, uint32_t length, uint32_t seed)
+    {
+        uint32_t x = seed * 2654435761U + 1U;
+        for (uint32_t i = 0U; i < length; i++) {
+            x ^= x << 13; x ^= x >> 17; x ^= x << 5;
+            data[i] = (uint8_t)x;
+        }
+    }
+
+    const uint32_t CONV_BITS = 196U; // FACCH1 (80 bits) .. UDCH (203 bits) range
+
+    /**
+     * @brief Helper to build the soft symbols (0, 1 = erased, 2) of a convolutionally encoded NXDN block,
+     *  with a few symbol errors.
+     */
+    void convSymbols(uint8_t* symbols)
+    {
+        uint8_t payload[25U];
+        fill(payload, 25U, 11U);
+
+        uint8_t encoded[52U];
+        ::memset(encoded, 0x00U, sizeof(encoded));
+        nxdn::edac::Convolution conv;
+        conv.encode(payload, encoded, CONV_BITS);
+
+        uint32_t n = (CONV_BITS + 4U) * 2U;
+        for (uint32_t i = 0U; i < CONV_BITS * 2U; i++)
+            symbols[i] = READ_BIT(encoded, i) ? 2U : 0U;
+        for (uint32_t i = CONV_BITS * 2U; i < n; i++)
+            symbols[i] = 0U;
+
+        for (uint32_t i = 0U; i < 6U; i++)
+            symbols[(i * 67U) % n] = (uint8_t)(i % 3U);
+    }
+}
+
+// ---------------------------------------------------------------------------
+//  Golay (24,12,8)
+// ---------------------------------------------------------------------------
+
+BENCHMARK_CASE("edac", "Golay24128::encode24128") {
+    uint64_t sink = 0U;
+    for (uint64_t i = 0U; i < iterations; i++)
+        sink += Golay24128::encode24128((uint32_t)i & 0xFFFU);
+    return sink;
+}
+
+BENCHMARK_CASE("edac", "Golay24128::decode24128, clean") {
+    static const uint32_t code = Golay24128::encode24128(0x5A5U);
+
+    uint64_t sink = 0U;
+    for (uint64_t i = 0U; i < iterations; i++) {
+        uint32_t out = 0U;
+        sink += Golay24128::decode24128(code, out) ? out : 0U;
+    }
+    return sink;
+}
+
+BENCHMARK_CASE("edac", "Golay24128::decode24128, 3 bit errors") {
+    static const uint32_t code = Golay24128::encode24128(0x5A5U) ^ 0x800401U;
+
+    uint64_t sink = 0U;
+    for (uint64_t i = 0U; i < iterations; i++) {
+        uint32_t out = 0U;
+        sink += Golay24128::decode24128(code, out) ? out : 0U;
+    }
+    return sink;
+}
+
+// ---------------------------------------------------------------------------
+//  Reed-Solomon (63,47,17)
+// ---------------------------------------------------------------------------
+
+BENCHMARK_CASE("edac", "RS634717::encode241213") {
+    RS634717 rs;
+    uint8_t data[24U];
+    fill(data, 24U, 1U);
+
+    uint64_t sink = 0U;
+    for (uint64_t i = 0U; i < iterations; i++) {
+        data[0U] = (uint8_t)i;
+        rs.encode241213(data);
+        sink += data[23U];
+    }
+    return sink;
+}
+
+BENCHMARK_CASE("edac", "RS634717::decode241213, clean") {
+    RS634717 rs;
+    uint8_t clean[24U];
+    fill(clean, 24U, 1U);
+    rs.encode241213(clean);
+
+    uint64_t sink = 0U;
+    for (uint64_t i = 0U; i < iterations; i++) {
+        uint8_t data[24U];
+        ::memcpy(data, clean, 24U);
+        sink += rs.decode241213(data) ? 1U : 0U;
+    }
+    return sink;
+}
+
+BENCHMARK_CASE("edac", "RS634717::decode241213, symbol error") {
+    RS634717 rs;
+    uint8_t corrupted[24U];
+    fill(corrupted, 24U, 1U);
+    rs.encode241213(corrupted);
+    corrupted[0U] ^= 0xFCU;
+
+    uint64_t sink = 0U;
+    for (uint64_t i = 0U; i < iterations; i++) {
+        uint8_t data[24U];
+        ::memcpy(data, corrupted, 24U);
+        sink += rs.decode241213(data) ? 1U : 0U;
+    }
+    return sink;
+}
+
+BENCHMARK_CASE("edac", "RS634717::decode362017, clean") {
+    RS634717 rs;
+    uint8_t clean[27U];
+    fill(clean, 27U, 2U);
+    rs.encode362017(clean);
+
+    uint64_t sink = 0U;
+    for (uint64_t i = 0U; i < iterations; i++) {
+        uint8_t data[27U];
+        ::memcpy(data, clean, 27U);
+        sink += rs.decode362017(data) ? 1U : 0U;
+    }
+    return sink;
+}
+
+BENCHMARK_CASE("edac", "RS634717::decode362017, symbol error") {
+    RS634717 rs;
+    uint8_t corrupted[27U];
+    fill(corrupted, 27U, 2U);
+    rs.encode362017(corrupted);
+    corrupted[0U] ^= 0xFCU;
+
+    uint64_t sink = 0U;
+    for (uint64_t i = 0U; i < iterations; i++) {
+        uint8_t data[27U];
+        ::memcpy(data, corrupted, 27U);
+        sink += rs.decode362017(data) ? 1U : 0U;
+    }
+    return sink;
+}
+
+BENCHMARK_CASE("edac", "RS634717::encode362017") {
+    RS634717 rs;
+    uint8_t data[27U];
+    fill(data, 27U, 2U);
+
+    uint64_t sink = 0U;
+    for (uint64_t i = 0U; i < iterations; i++) {
+        data[0U] = (uint8_t)i;
+        rs.encode362017(data);
+        sink += data[26U];
+    }
+    return sink;
+}
+
+BENCHMARK_CASE("edac", "RS634717::encode24169") {
+    RS634717 rs;
+    uint8_t data[24U];
+    fill(data, 24U, 3U);
+
+    uint64_t sink = 0U;
+    for (uint64_t i = 0U; i < iterations; i++) {
+        data[0U] = (uint8_t)i;
+        rs.encode24169(data);
+        sink += data[23U];
+    }
+    return sink;
+}
+
+BENCHMARK_CASE("edac", "RS634717::decode24169, clean") {
+    RS634717 rs;
+    uint8_t clean[24U];
+    fill(clean, 24U, 3U);
+    rs.encode24169(clean);
+
+    uint64_t sink = 0U;
+    for (uint64_t i = 0U; i < iterations; i++) {
+        uint8_t data[24U];
+        ::memcpy(data, clean, 24U);
+        sink += rs.decode24169(data) ? 1U : 0U;
+    }
+    return sink;
+}
+
+BENCHMARK_CASE("edac", "RS634717::decode24169, symbol error") {
+    RS634717 rs;
+    uint8_t corrupted[24U];
+    fill(corrupted, 24U, 3U);
+    rs.encode24169(corrupted);
+    corrupted[0U] ^= 0xFCU;
+
+    uint64_t sink = 0U;
+    for (uint64_t i = 0U; i < iterations; i++) {
+        uint8_t data[24U];
+        ::memcpy(data, corrupted, 24U);
+        sink += rs.decode24169(data) ? 1U : 0U;
+    }
+    return sink;
+}
+
+// ---------------------------------------------------------------------------
+//  BPTC (196,96)
+// ---------------------------------------------------------------------------
+
+BENCHMARK_CASE("edac", "BPTC19696::encode") {
+    BPTC19696 bptc;
+    uint8_t payload[12U];
+    fill(payload, 12U, 3U);
+
+    uint64_t sink = 0U;
+    for (uint64_t i = 0U; i < iterations; i++) {
+        uint8_t data[33U];
+        ::memset(data, 0x00U, 33U);
+        payload[0U] = (uint8_t)i;
+        bptc.encode(payload, data);
+        sink += data[32U];
+    }
+    return sink;
+}
+
+BENCHMARK_CASE("edac", "BPTC19696::decode") {
+    BPTC19696 bptc;
+    uint8_t payload[12U];
+    fill(payload, 12U, 3U);
+    uint8_t data[33U];
+    ::memset(data, 0x00U, 33U);
+    bptc.encode(payload, data);
+
+    uint64_t sink = 0U;
+    for (uint64_t i = 0U; i < iterations; i++) {
+        uint8_t out[12U];
+        bptc.decode(data, out);
+        sink += out[11U];
+    }
+    return sink;
+}
+
+// ---------------------------------------------------------------------------
+//  Trellis (3/4 rate)
+// ---------------------------------------------------------------------------
+
+BENCHMARK_CASE("edac", "Trellis::encode34") {
+    Trellis trellis;
+    uint8_t payload[18U];
+    fill(payload, 18U, 4U);
+
+    uint64_t sink = 0U;
+    for (uint64_t i = 0U; i < iterations; i++) {
+        uint8_t data[25U];
+        ::memset(data, 0x00U, 25U);
+        payload[0U] = (uint8_t)i;
+        trellis.encode34(payload, data, false);
+        sink += data[24U];
+    }
+    return sink;
+}
+
+BENCHMARK_CASE("edac", "Trellis::decode34, clean") {
+    Trellis trellis;
+    uint8_t payload[18U];
+    fill(payload, 18U, 4U);
+    uint8_t data[25U];
+    ::memset(data, 0x00U, 25U);
+    trellis.encode34(payload, data, false);
+
+    uint64_t sink = 0U;
+    for (uint64_t i = 0U; i < iterations; i++) {
+        uint8_t out[18U];
+        sink += trellis.decode34(data, out, false) ? out[17U] : 0U;
+    }
+    return sink;
+}
+
+BENCHMARK_CASE("edac", "Trellis::decode34, symbol error") {
+    Trellis trellis;
+    uint8_t payload[18U];
+    fill(payload, 18U, 4U);
+    uint8_t data[25U];
+    ::memset(data, 0x00U, 25U);
+    trellis.encode34(payload, data, false);
+    data[10U] ^= 0x30U;
+
+    uint64_t sink = 0U;
+    for (uint64_t i = 0U; i < iterations; i++) {
+        uint8_t out[18U];
+        sink += trellis.decode34(data, out, false) ? out[17U] : 0U;
+    }
+    return sink;
+}
+
+// ---------------------------------------------------------------------------
+//  CRC
+// ---------------------------------------------------------------------------
+
+BENCHMARK_CASE("edac", "CRC::checkCCITT162, 12 bytes") {
+    uint8_t data[12U];
+    fill(data, 12U, 5U);
+    CRC::addCCITT162(data, 12U);
+
+    uint64_t sink = 0U;
+    for (uint64_t i = 0U; i < iterations; i++)
+        sink += CRC::checkCCITT162(data, 12U) ? 1U : 0U;
+    return sink;
+}
+
+BENCHMARK_CASE("edac", "CRC::checkCRC32, 512 bytes") {
+    uint8_t data[512U];
+    fill(data, 512U, 6U);
+    CRC::addCRC32(data, 512U);
+
+    uint64_t sink = 0U;
+    for (uint64_t i = 0U; i < iterations; i++)
+        sink += CRC::checkCRC32(data, 512U) ? 1U : 0U;
+    return sink;
+}
+
+BENCHMARK_CASE("edac", "CRC::createCRC16, 512 bytes") {
+    uint8_t data[512U];
+    fill(data, 512U, 7U);
+
+    uint64_t sink = 0U;
+    for (uint64_t i = 0U; i < iterations; i++)
+        sink += CRC::createCRC16(data, 512U * 8U);
+    return sink;
+}
+
+// ---------------------------------------------------------------------------
+//  AMBE/IMBE FEC
+// ---------------------------------------------------------------------------
+
+BENCHMARK_CASE("edac", "AMBEFEC::regenerateDMR") {
+    AMBEFEC fec;
+    uint8_t frame[33U];
+    fill(frame, 33U, 8U);
+
+    uint64_t sink = 0U;
+    for (uint64_t i = 0U; i < iterations; i++) {
+        uint8_t data[33U];
+        ::memcpy(data, frame, 33U);
+        sink += fec.regenerateDMR(data);
+    }
+    return sink;
+}
+
+BENCHMARK_CASE("edac", "AMBEFEC::regenerateIMBE") {
+    AMBEFEC fec;
+    uint8_t frame[18U];
+    fill(frame, 18U, 9U);
+
+    uint64_t sink = 0U;
+    for (uint64_t i = 0U; i < iterations; i++) {
+        uint8_t data[18U];
+        ::memcpy(data, frame, 18U);
+        sink += fec.regenerateIMBE(data);
+    }
+    return sink;
+}
+
+BENCHMARK_CASE("edac", "AMBEFEC::regenerateNXDN") {
+    AMBEFEC fec;
+    uint8_t frame[18U];
+    fill(frame, 18U, 10U);
+
+    uint64_t sink = 0U;
+    for (uint64_t i = 0U; i < iterations; i++) {
+        uint8_t data[18U];
+        ::memcpy(data, frame, 18U);
+        sink += fec.regenerateNXDN(data);
+    }
+    return sink;
+}
+
+// ---------------------------------------------------------------------------
+//  NXDN Convolution (196 bit block)
+// ---------------------------------------------------------------------------
+
+BENCHMARK_CASE("edac", "nxdn::Convolution::encode") {
+    uint8_t payload[25U];
+    fill(payload, 25U, 11U);
+
+    nxdn::edac::Convolution conv;
+    uint64_t sink = 0U;
+    for (uint64_t i = 0U; i < iterations; i++) {
+        uint8_t encoded[52U];
+        ::memset(encoded, 0x00U, sizeof(encoded));
+        payload[0U] = (uint8_t)i;
+        conv.encode(payload, encoded, CONV_BITS);
+        sink += encoded[i % 49U];
+    }
+    return sink;
+}
+
+BENCHMARK_CASE("edac", "nxdn::Convolution::decode, symbol by symbol") {
+    uint8_t symbols[(CONV_BITS + 4U) * 2U];
+    convSymbols(symbols);
+
+    nxdn::edac::Convolution conv;
+    uint64_t sink = 0U;
+    for (uint64_t i = 0U; i < iterations; i++) {
+        conv.start();
+        for (uint32_t n = 0U; n < CONV_BITS + 4U; n++)
+            conv.decode(symbols[n * 2U], symbols[n * 2U + 1U]);
+
+        uint8_t out[25U];
+        sink += conv.chainback(out, CONV_BITS) + out[0U];
+    }
+    return sink;
+}
+
+BENCHMARK_CASE("edac", "nxdn::Convolution::decodeBlock") {
+    uint8_t symbols[(CONV_BITS + 4U) * 2U];
+    convSymbols(symbols);
+
+    nxdn::edac::Convolution conv;
+    uint64_t sink = 0U;
+    for (uint64_t i = 0U; i < iterations; i++) {
+        uint8_t out[25U];
+        sink += conv.decodeBlock(symbols, CONV_BITS, out) ? out[0U] : 0U;
+    }
+    return sink;
+}
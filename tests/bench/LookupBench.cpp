@@ -0,0 +1,255 @@
+// SPDX-License-Identifier: GPL-2.0-only
+/*
+ * Digital Voice Modem - Benchmark Suite
+ * GPLv2 Open Source. Use is subject to license terms.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ *  Copyright (C) 2026 Bryan Biedenkapp, N2PLL
+ *
+ */
+#include "common/ExpiryQueue.h"
+#include "common/Timer.h"
+#include "common/lookups/AffiliationLookup.h"
+#include "common/lookups/ChannelLookup.h"
+#include "common/lookups/RadioIdLookup.h"
+#include "common/lookups/TableFileReader.h"
+#include "common/lookups/TalkgroupRulesLookup.h"
+#include "bench/Benchmark.h"
+
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <unistd.h>
+
+using namespace lookups;
+
+namespace {
+    const uint32_t TG_CNT = 1000U;
+    const uint32_t UNIT_CNT = 1000U;
+
+    /**
+     * @brief Helper to get a talkgroup rules table of TG_CNT talkgroups (TG 1 - 1000).
+     */
+    TalkgroupRulesLookup* rules()
+    {
+        static TalkgroupRulesLookup* lookup = nullptr;
+        if (lookup == nullptr) {
+            lookup = new TalkgroupRulesLookup("bench-talkgroup-rules.yml", 0U, false);
+            for (uint32_t i = 1U; i <= TG_CNT; i++)
+                lookup->addEntry(i, 1U, true);
+        }
+
+        return lookup;
+    }
+
+    /**
+     * @brief Helper to look up a talkgroup the given number of times.
+     */
+    uint64_t find(uint32_t tgId, uint64_t iterations)
+    {
+        TalkgroupRulesLookup* lookup = rules();
+
+        uint64_t sink = 0U;
+        for (uint64_t i = 0U; i < iterations; i++) {
+            TalkgroupRuleGroupVoice entry = lookup->find(tgId);
+            sink += entry.isInvalid() ? 0U : 1U;
+        }
+        return sink;
+    }
+
+    const uint32_t RID_FILE_CNT = 1000000U;
+
+    /**
+     * @brief Helper to get the name of a radio ID table file of RID_FILE_CNT entries; the file is written
+     *  on first use and removed at exit.
+     */
+    const std::string& radioIdFile()
+    {
+        static std::string filename;
+        if (filename.empty()) {
+            filename = "/tmp/dvm-bench-rid-" + std::to_string(::getpid()) + ".dat";
+
+            std::ofstream file(filename, std::ofstream::out | std::ofstream::trunc);
+            file << "# generated radio ID table\n";
+            for (uint32_t i = 1U; i <= RID_FILE_CNT; i++)
+                file << i << "," << (i % 3U != 0U ? 1 : 0) << ",UNIT " << i << ",\n";
+            file.close();
+
+            std::atexit([]() { ::remove(radioIdFile().c_str()); });
+        }
+
+        return filename;
+    }
+}
+
+// ---------------------------------------------------------------------------
+//  Talkgroup Rules
+// ---------------------------------------------------------------------------
+
+BENCHMARK_CASE("lookups", "TalkgroupRulesLookup::find, first of 1000") {
+    return find(1U, iterations);
+}
+
+BENCHMARK_CASE("lookups", "TalkgroupRulesLookup::find, last of 1000") {
+    return find(TG_CNT, iterations);
+}
+
+BENCHMARK_CASE("lookups", "TalkgroupRulesLookup::find, miss") {
+    return find(TG_CNT + 1U, iterations);
+}
+
+// ---------------------------------------------------------------------------
+//  Affiliations
+// ---------------------------------------------------------------------------
+
+BENCHMARK_CASE("lookups", "AffiliationLookup::groupAff, 1000 units") {
+    ChannelLookup chLookup;
+    AffiliationLookup aff("Bench Affiliation", &chLookup, false);
+
+    uint64_t sink = 0U;
+    for (uint64_t i = 0U; i < iterations; i++) {
+        uint32_t srcId = 1000000U + (uint32_t)(i % UNIT_CNT);
+        aff.groupAff(srcId, 1U + (uint32_t)(i % 100U));
+        sink += srcId;
+    }
+    return sink;
+}
+
+BENCHMARK_CASE("lookups", "AffiliationLookup::isGroupAff, 1000 units") {
+    ChannelLookup chLookup;
+    AffiliationLookup aff("Bench Affiliation", &chLookup, false);
+    for (uint32_t i = 0U; i < UNIT_CNT; i++)
+        aff.groupAff(1000000U + i, 1U + (i % 100U));
+
+    uint64_t sink = 0U;
+    for (uint64_t i = 0U; i < iterations; i++) {
+        uint32_t n = (uint32_t)(i % UNIT_CNT);
+        sink += aff.isGroupAff(1000000U + n, 1U + (n % 100U)) ? 1U : 0U;
+    }
+    return sink;
+}
+
+BENCHMARK_CASE("lookups", "AffiliationLookup::hasGroupAff, 1000 units") {
+    ChannelLookup chLookup;
+    AffiliationLookup aff("Bench Affiliation", &chLookup, false);
+    for (uint32_t i = 0U; i < UNIT_CNT; i++)
+        aff.groupAff(1000000U + i, 1U + (i % 100U));
+
+    uint64_t sink = 0U;
+    for (uint64_t i = 0U; i < iterations; i++)
+        sink += aff.hasGroupAff(1U + (uint32_t)(i % 200U)) ? 1U : 0U;
+    return sink;
+}
+
+BENCHMARK_CASE("lookups", "AffiliationLookup::grantCh/releaseGrant") {
+    ChannelLookup chLookup;
+    for (uint32_t chNo = 1U; chNo <= 16U; chNo++)
+        chLookup.addRFCh(chNo);
+
+    AffiliationLookup aff("Bench Affiliation", &chLookup, false);
+
+    uint64_t sink = 0U;
+    for (uint64_t i = 0U; i < iterations; i++) {
+        uint32_t dstId = 1U + (uint32_t)(i % 100U);
+        sink += aff.grantCh(dstId, 1000000U, 5U, true, false) ? 1U : 0U;
+        sink += aff.releaseGrant(dstId, false) ? 1U : 0U;
+    }
+    return sink;
+}
+
+// ---------------------------------------------------------------------------
+//  Expiry
+// ---------------------------------------------------------------------------
+
+BENCHMARK_CASE("lookups", "ExpiryQueue::clock, 10000 idle entries") {
+    ExpiryQueue queue;
+    for (uint32_t i = 0U; i < 10000U; i++)
+        queue.start(i, 43200U * 1000U);
+
+    std::vector<uint32_t> expired;
+
+    uint64_t sink = 0U;
+    for (uint64_t i = 0U; i < iterations; i++) {
+        queue.clock(10U, expired);
+        sink += expired.size();
+    }
+    return sink;
+}
+
+BENCHMARK_CASE("lookups", "Timer::clock, 10000 idle timers") {
+    // the per-entry timers the expiry queue replaced, for comparison
+    std::vector<Timer> timers(10000U, Timer(1000U, 43200U));
+    for (Timer& timer : timers)
+        timer.start();
+
+    uint64_t sink = 0U;
+    for (uint64_t i = 0U; i < iterations; i++) {
+        for (Timer& timer : timers) {
+            timer.clock(10U);
+            if (timer.isRunning() && timer.hasExpired())
+                sink++;
+        }
+    }
+    return sink;
+}
+
+// ---------------------------------------------------------------------------
+//  Table Files (1,000,000 entry radio ID table)
+// ---------------------------------------------------------------------------
+
+BENCHMARK_CASE("lookups", "std::getline parse, 1M entries") {
+    const std::string& filename = radioIdFile();
+
+    uint64_t sink = 0U;
+    for (uint64_t i = 0U; i < iterations; i++) {
+        std::ifstream file(filename, std::ifstream::in);
+        std::string line;
+        while (std::getline(file, line)) {
+            if (line.empty() || line[0] == '#')
+                continue;
+
+            std::stringstream ss(line);
+            std::vector<std::string> fields;
+            std::string field;
+            while (std::getline(ss, field, ','))
+                fields.push_back(field);
+
+            sink += (uint32_t)::atoi(fields[0].c_str()) + fields[2].length();
+        }
+    }
+    return sink;
+}
+
+BENCHMARK_CASE("lookups", "TableFileReader::forEachLine, 1M entries") {
+    const std::string& filename = radioIdFile();
+
+    uint64_t sink = 0U;
+    for (uint64_t i = 0U; i < iterations; i++) {
+        TableFileReader reader(filename);
+        reader.open();
+
+        std::vector<uint64_t> sums(reader.chunks(), 0U);
+        reader.forEachLine([&](uint32_t chunk, const TableFileReader::Line& line) {
+            sums[chunk] += (uint32_t)line.fields[0U].toInt() + line.fields[2U].length;
+        });
+
+        for (uint64_t sum : sums)
+            sink += sum;
+    }
+    return sink;
+}
+
+BENCHMARK_CASE("lookups", "RadioIdLookup::reload, 1M entries") {
+    const std::string& filename = radioIdFile();
+
+    uint64_t sink = 0U;
+    for (uint64_t i = 0U; i < iterations; i++) {
+        RadioIdLookup lookup(filename, 0U, true);
+        sink += lookup.reload() ? 1U : 0U;
+    }
+    return sink;
+}
@@ -0,0 +1,195 @@
+// SPDX-License-Identifier: GPL-2.0-only
+/*
+ * Digital Voice Modem - Benchmark Suite
+ * GPLv2 Open Source. Use is subject to license terms.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ *  Copyright (C) 2026 Bryan Biedenkapp, N2PLL
+ *
+ */
+#include "common/network/udp/Socket.h"
+#include "common/network/FrameQueue.h"
+#include "common/network/PacketBuffer.h"
+#include "bench/Benchmark.h"
+
+#include <chrono>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+using namespace network;
+using namespace network::udp;
+
+namespace {
+    const uint32_t MESSAGE_LENGTH = 181U;       // P25 LDU network frame
+    const uint32_t PEER_ID = 9000100U;
+    const uint32_t STREAM_ID = 0x12345678U;
+
+    const uint16_t RX_PORT = 32190U;
+    const uint16_t TX_PORT = 32191U;
+
+    const uint32_t PAYLOAD_LENGTH = 16384U;     // i.e. a talkgroup list sent over a peer link
+
+    /**
+     * @brief Helper to generate a compressible payload, similar to the structured payloads sent over a
+     *  peer link.
+     */
+    std::string payload()
+    {
+        std::string data;
+        for (uint32_t i = 0U; data.length() < PAYLOAD_LENGTH; i++)
+            data += "{\"source\":{\"tgid\":" + std::to_string(i + 1U) + ",\"slot\":1},\"config\":{\"active\":true,\"affiliated\":false}},";
+
+        return data.substr(0U, PAYLOAD_LENGTH);
+    }
+
+    /**
+     * @brief Helper to fragment the payload the given number of times.
+     */
+    uint64_t encode(bool compression, uint64_t iterations)
+    {
+        static std::string data = payload();
+
+        PacketBuffer buffer(compression, "Bench Packet Buffer");
+
+        uint64_t sink = 0U;
+        for (uint64_t i = 0U; i < iterations; i++) {
+            buffer.encode((uint8_t*)data.data(), PAYLOAD_LENGTH);
+            sink += buffer.fragments.size();
+        }
+        return sink;
+    }
+
+    /**
+     * @brief Helper to reassemble the fragmented payload the given number of times.
+     */
+    uint64_t decode(bool compression, uint64_t iterations)
+    {
+        static std::string data = payload();
+
+        PacketBuffer tx(compression, "Bench Packet Buffer");
+        tx.encode((uint8_t*)data.data(), PAYLOAD_LENGTH);
+
+        std::vector<std::vector<uint8_t>> frags;
+        for (uint8_t i = 0U; i < tx.fragments.size(); i++)
+            frags.push_back(std::vector<uint8_t>(tx.fragments[i]->data, tx.fragments[i]->data + FRAG_SIZE));
+
+        PacketBuffer rx(compression, "Bench Packet Buffer");
+
+        uint64_t sink = 0U;
+        for (uint64_t i = 0U; i < iterations; i++) {
+            for (auto& frag : frags) {
+                uint8_t* message = nullptr;
+                uint32_t length = 0U;
+                if (rx.decode(frag.data(), &message, &length)) {
+                    sink += length;
+                    delete[] message;
+                }
+            }
+        }
+
+        if (sink != iterations * PAYLOAD_LENGTH)
+            throw std::runtime_error("packet buffer failed to reassemble the payload");
+        return sink;
+    }
+}
+
+// ---------------------------------------------------------------------------
+//  Frame Queue
+// ---------------------------------------------------------------------------
+
+BENCHMARK_CASE("network", "FrameQueue::enqueueMessage") {
+    FrameQueue queue(nullptr, PEER_ID, false);
+
+    uint8_t message[MESSAGE_LENGTH];
+    for (uint32_t i = 0U; i < MESSAGE_LENGTH; i++)
+        message[i] = (uint8_t)i;
+
+    sockaddr_storage addr;
+    uint32_t addrLen = 0U;
+    Socket::lookup("127.0.0.1", RX_PORT, addr, addrLen);
+
+    BufferQueue buffers;
+
+    uint64_t sink = 0U;
+    for (uint64_t i = 0U; i < iterations; i++) {
+        queue.enqueueMessage(&buffers, message, MESSAGE_LENGTH, STREAM_ID, PEER_ID, { NET_FUNC::PROTOCOL, NET_SUBFUNC::PROTOCOL_SUBFUNC_P25 },
+            (uint16_t)(i % RTP_END_OF_CALL_SEQ), addr, addrLen);
+
+        while (!buffers.empty()) {
+            UDPDatagram* dgram = buffers.front();
+            buffers.pop();
+
+            sink += dgram->length;
+            delete[] dgram->buffer;
+            delete dgram;
+        }
+    }
+
+    queue.clearTimestamps();
+    return sink;
+}
+
+BENCHMARK_CASE("network", "FrameQueue::write/read, loopback") {
+    Socket rxSocket("127.0.0.1", RX_PORT);
+    Socket txSocket("127.0.0.1", TX_PORT);
+    if (!rxSocket.open(AF_INET) || !txSocket.open(AF_INET))
+        throw std::runtime_error("failed to open the loopback sockets");
+
+    FrameQueue rx(&rxSocket, PEER_ID, false);
+    FrameQueue tx(&txSocket, PEER_ID, false);
+
+    uint8_t message[MESSAGE_LENGTH];
+    for (uint32_t i = 0U; i < MESSAGE_LENGTH; i++)
+        message[i] = (uint8_t)i;
+
+    sockaddr_storage addr;
+    uint32_t addrLen = 0U;
+    Socket::lookup("127.0.0.1", RX_PORT, addr, addrLen);
+
+    uint64_t sink = 0U;
+    for (uint64_t i = 0U; i < iterations; i++) {
+        tx.write(message, MESSAGE_LENGTH, STREAM_ID, PEER_ID, PEER_ID, { NET_FUNC::PROTOCOL, NET_SUBFUNC::PROTOCOL_SUBFUNC_P25 },
+            (uint16_t)(i % RTP_END_OF_CALL_SEQ), addr, addrLen);
+
+        // the sockets are non-blocking, wait for the datagram to arrive
+        auto start = std::chrono::steady_clock::now();
+        while (true) {
+            int length = 0;
+            sockaddr_storage from;
+            uint32_t fromLen = 0U;
+            UInt8Array buffer = rx.read(length, from, fromLen);
+            if (buffer != nullptr && length > 0) {
+                sink += (uint32_t)length;
+                break;
+            }
+
+            if (std::chrono::steady_clock::now() - start > std::chrono::seconds(1))
+                throw std::runtime_error("timed out waiting for the loopback datagram");
+        }
+    }
+
+    tx.clearTimestamps();
+    return sink;
+}
+
+// ---------------------------------------------------------------------------
+//  Packet Buffer (16KB payload)
+// ---------------------------------------------------------------------------
+
+BENCHMARK_CASE("network", "PacketBuffer::encode, compressed") {
+    return encode(true, iterations);
+}
+
+BENCHMARK_CASE("network", "PacketBuffer::encode, uncompressed") {
+    return encode(false, iterations);
+}
+
+BENCHMARK_CASE("network", "PacketBuffer::decode, compressed") {
+    return decode(true, iterations);
+}
+
+BENCHMARK_CASE("network", "PacketBuffer::decode, uncompressed") {
+    return decode(false, iterations);
+}
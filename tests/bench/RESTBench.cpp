@@ -0,0 +1,129 @@
+// SPDX-License-Identifier: GPL-2.0-only
+/*
+ * Digital Voice Modem - Benchmark Suite
+ * GPLv2 Open Source. Use is subject to license terms.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ *  Copyright (C) 2026 Bryan Biedenkapp, N2PLL
+ *
+ */
+#include "common/restapi/RequestDispatcher.h"
+#include "host/restapi/RESTDefines.h"
+#include "bench/Benchmark.h"
+
+#include <string>
+
+using namespace restapi;
+using namespace restapi::http;
+
+namespace {
+    /**
+     * @brief Helper to get a dispatcher with the full dvmhost REST route table registered.
+     */
+    DefaultRequestDispatcher& hostDispatcher()
+    {
+        static DefaultRequestDispatcher* dispatcher = nullptr;
+        if (dispatcher == nullptr) {
+            struct Route {
+                const char* expression;
+                bool regex;
+                bool put;
+            };
+
+            static const Route routes[] = {
+                { PUT_AUTHENTICATE, false, true },
+                { GET_VERSION, false, false },
+                { GET_STATUS, false, false },
+                { GET_VOICE_CH, false, false },
+                { PUT_MDM_MODE, false, true },
+                { PUT_MDM_KILL, false, true },
+                { PUT_SET_SUPERVISOR, false, true },
+                { PUT_PERMIT_TG, false, true },
+                { PUT_GRANT_TG, false, true },
+                { GET_RELEASE_GRNTS, false, false },
+                { GET_RELEASE_AFFS, false, false },
+                { GET_RID_WHITELIST, true, false },
+                { GET_RID_BLACKLIST, true, false },
+                { GET_DMR_BEACON, false, false },
+                { GET_DMR_DEBUG, true, false },
+                { GET_DMR_DUMP_CSBK, true, false },
+                { PUT_DMR_RID, false, true },
+                { GET_DMR_CC_DEDICATED, false, false },
+                { GET_DMR_CC_BCAST, false, false },
+                { GET_DMR_AFFILIATIONS, false, false },
+                { GET_P25_CC, false, false },
+                { GET_P25_DEBUG, true, false },
+                { GET_P25_DUMP_TSBK, true, false },
+                { PUT_P25_RID, false, true },
+                { GET_P25_CC_DEDICATED, false, false },
+                { GET_P25_CC_BCAST, false, false },
+                { PUT_P25_RAW_TSBK, false, true },
+                { GET_P25_AFFILIATIONS, false, false },
+                { GET_NXDN_CC, false, false },
+                { GET_NXDN_DEBUG, false, false },
+                { GET_NXDN_DUMP_RCCH, false, false },
+                { GET_NXDN_CC_DEDICATED, false, false },
+                { GET_NXDN_AFFILIATIONS, false, false },
+            };
+
+            dispatcher = new DefaultRequestDispatcher();
+            for (const Route& route : routes) {
+                auto handler = [](const HTTPPayload& request, HTTPPayload& reply, const RequestMatch& match) {
+                    reply.status = HTTPPayload::OK;
+                };
+
+                if (route.put)
+                    dispatcher->match(route.expression, route.regex).put(handler);
+                else
+                    dispatcher->match(route.expression, route.regex).get(handler);
+            }
+        }
+
+        return *dispatcher;
+    }
+
+    /**
+     * @brief Helper to dispatch the given URI the given number of times.
+     */
+    uint64_t dispatch(const char* uri, uint64_t iterations)
+    {
+        DefaultRequestDispatcher& dispatcher = hostDispatcher();
+
+        HTTPPayload request;
+        request.method = HTTP_GET;
+        request.uri = uri;
+
+        uint64_t sink = 0U;
+        for (uint64_t i = 0U; i < iterations; i++) {
+            HTTPPayload reply;
+            reply.status = HTTPPayload::NOT_FOUND;
+            dispatcher.handleRequest(request, reply);
+            sink += (reply.status == HTTPPayload::OK) ? 1U : 0U;
+        }
+        return sink;
+    }
+}
+
+// ---------------------------------------------------------------------------
+//  Request Dispatcher (dvmhost route table)
+// ---------------------------------------------------------------------------
+
+BENCHMARK_CASE("restapi", "RequestDispatcher::handleRequest, literal route") {
+    return dispatch("/version", iterations);
+}
+
+BENCHMARK_CASE("restapi", "RequestDispatcher::handleRequest, last literal route") {
+    return dispatch("/nxdn/report-affiliations", iterations);
+}
+
+BENCHMARK_CASE("restapi", "RequestDispatcher::handleRequest, numeric path parameter") {
+    return dispatch("/p25/dump-tsbk/1", iterations);
+}
+
+BENCHMARK_CASE("restapi", "RequestDispatcher::handleRequest, two path parameters") {
+    return dispatch("/dmr/debug/1/1", iterations);
+}
+
+BENCHMARK_CASE("restapi", "RequestDispatcher::handleRequest, unknown route") {
+    return dispatch("/does-not-exist", iterations);
+}
@@ -0,0 +1,177 @@
+// SPDX-License-Identifier: GPL-2.0-only
+/*
+ * Digital Voice Modem - Benchmark Suite
+ * GPLv2 Open Source. Use is subject to license terms.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ *  Copyright (C) 2026 Bryan Biedenkapp, N2PLL
+ *
+ */
+#define _USE_MATH_DEFINES
+#include <math.h>
+
+#include "vocoder/MBEDecoder.h"
+#include "vocoder/MBEEncoder.h"
+#include "vocoder/MBETranscoder.h"
+#include "bench/Benchmark.h"
+
+#include <vector>
+
+using namespace vocoder;
+
+namespace {
+    const uint32_t FRAME_CNT = 50U;
+
+    /**
+     * @brief Helper to generate a voiced test signal with a sweeping pitch (160 samples per 20ms frame).
+     */
+    std::vector<int16_t> generateSpeech()
+    {
+        std::vector<int16_t> pcm(FRAME_CNT * 160U);
+
+        double phase = 0.0;
+        for (uint32_t n = 0U; n < pcm.size(); n++) {
+            double f0 = 120.0 + 40.0 * sin(2.0 * M_PI * n / 16000.0);
+            phase += 2.0 * M_PI * f0 / 8000.0;
+
+            double s = 0.0;
+            for (int h = 1; h * f0 < 3500.0; h++)
+                s += sin(h * phase) / h;
+
+            pcm[n] = (int16_t)(6000.0 * s * (0.6 + 0.4 * sin(2.0 * M_PI * n / 5000.0)));
+        }
+
+        return pcm;
+    }
+
+    /**
+     * @brief Helper to encode the test signal to MBE codewords.
+     */
+    std::vector<std::vector<uint8_t>> encodeSpeech(MBE_ENCODER_MODE mode)
+    {
+        std::vector<int16_t> pcm = generateSpeech();
+
+        MBEEncoder encoder(mode);
+        std::vector<std::vector<uint8_t>> frames(FRAME_CNT, std::vector<uint8_t>(11U, 0x00U));
+        for (uint32_t f = 0U; f < FRAME_CNT; f++)
+            encoder.encode(&pcm[f * 160U], frames[f].data());
+
+        return frames;
+    }
+
+    /**
+     * @brief Helper to encode frames of the test signal the given number of times.
+     */
+    uint64_t encode(MBE_ENCODER_MODE mode, uint64_t iterations)
+    {
+        static std::vector<int16_t> pcm = generateSpeech();
+
+        MBEEncoder encoder(mode);
+        uint8_t codeword[11U];
+
+        uint64_t sink = 0U;
+        for (uint64_t i = 0U; i < iterations; i++) {
+            encoder.encode(&pcm[(i % FRAME_CNT) * 160U], codeword);
+            sink += codeword[0U];
+        }
+        return sink;
+    }
+
+    /**
+     * @brief Helper to decode frames of the test signal the given number of times.
+     */
+    uint64_t decode(std::vector<std::vector<uint8_t>>& frames, MBE_DECODER_MODE mode, uint64_t iterations)
+    {
+        MBEDecoder decoder(mode);
+        int16_t samples[160U];
+
+        uint64_t sink = 0U;
+        for (uint64_t i = 0U; i < iterations; i++) {
+            decoder.decode(frames[i % FRAME_CNT].data(), samples);
+            sink += (uint16_t)samples[80U];
+        }
+        return sink;
+    }
+
+    /**
+     * @brief Helper to transcode frames of the test signal the given number of times.
+     */
+    uint64_t transcode(std::vector<std::vector<uint8_t>>& frames, MBE_TRANSCODER_MODE mode, uint64_t iterations)
+    {
+        MBETranscoder transcoder(mode);
+        uint8_t out[11U];
+
+        uint64_t sink = 0U;
+        for (uint64_t i = 0U; i < iterations; i++) {
+            transcoder.transcode(frames[i % FRAME_CNT].data(), out);
+            sink += out[0U];
+        }
+        return sink;
+    }
+
+    /**
+     * @brief Helper to transcode frames of the test signal through PCM the given number of times.
+     */
+    uint64_t transcodePCM(std::vector<std::vector<uint8_t>>& frames, MBE_DECODER_MODE decMode, MBE_ENCODER_MODE encMode,
+        uint64_t iterations)
+    {
+        MBEDecoder decoder(decMode);
+        MBEEncoder encoder(encMode);
+        int16_t samples[160U];
+        uint8_t out[11U];
+
+        uint64_t sink = 0U;
+        for (uint64_t i = 0U; i < iterations; i++) {
+            decoder.decode(frames[i % FRAME_CNT].data(), samples);
+            encoder.encode(samples, out);
+            sink += out[0U];
+        }
+        return sink;
+    }
+}
+
+// ---------------------------------------------------------------------------
+//  MBE Vocoder (one 20ms frame per operation)
+// ---------------------------------------------------------------------------
+
+BENCHMARK_CASE("vocoder", "MBEEncoder::encode, DMR AMBE") {
+    return encode(ENCODE_DMR_AMBE, iterations);
+}
+
+BENCHMARK_CASE("vocoder", "MBEEncoder::encode, IMBE") {
+    return encode(ENCODE_88BIT_IMBE, iterations);
+}
+
+BENCHMARK_CASE("vocoder", "MBEDecoder::decode, DMR AMBE") {
+    static std::vector<std::vector<uint8_t>> frames = encodeSpeech(ENCODE_DMR_AMBE);
+    return decode(frames, DECODE_DMR_AMBE, iterations);
+}
+
+BENCHMARK_CASE("vocoder", "MBEDecoder::decode, IMBE") {
+    static std::vector<std::vector<uint8_t>> frames = encodeSpeech(ENCODE_88BIT_IMBE);
+    return decode(frames, DECODE_88BIT_IMBE, iterations);
+}
+
+// ---------------------------------------------------------------------------
+//  MBE Transcoding (one 20ms frame per operation)
+// ---------------------------------------------------------------------------
+
+BENCHMARK_CASE("vocoder", "MBETranscoder::transcode, IMBE to DMR AMBE") {
+    static std::vector<std::vector<uint8_t>> frames = encodeSpeech(ENCODE_88BIT_IMBE);
+    return transcode(frames, TRANSCODE_IMBE_TO_DMR_AMBE, iterations);
+}
+
+BENCHMARK_CASE("vocoder", "MBETranscoder::transcode, DMR AMBE to IMBE") {
+    static std::vector<std::vector<uint8_t>> frames = encodeSpeech(ENCODE_DMR_AMBE);
+    return transcode(frames, TRANSCODE_DMR_AMBE_TO_IMBE, iterations);
+}
+
+BENCHMARK_CASE("vocoder", "PCM round trip, IMBE to DMR AMBE") {
+    static std::vector<std::vector<uint8_t>> frames = encodeSpeech(ENCODE_88BIT_IMBE);
+    return transcodePCM(frames, DECODE_88BIT_IMBE, ENCODE_DMR_AMBE, iterations);
+}
+
+BENCHMARK_CASE("vocoder", "PCM round trip, DMR AMBE to IMBE") {
+    static std::vector<std::vector<uint8_t>> frames = encodeSpeech(ENCODE_DMR_AMBE);
+    return transcodePCM(frames, DECODE_DMR_AMBE, ENCODE_88BIT_IMBE, iterations);
+}
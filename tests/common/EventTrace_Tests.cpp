@@ -0,0 +1,81 @@
+// SPDX-License-Identifier: GPL-2.0-only
+/*
+ * Digital Voice Modem - Test Suite
+ * GPLv2 Open Source. Use is subject to license terms.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ *  Copyright (C) 2026 Bryan Biedenkapp, N2PLL
+ *
+ */
+#include "host/Defines.h"
+#include "common/json/json.h"
+#include "common/EventTrace.h"
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <string>
+#include <thread>
+
+/**
+ * @brief Helper to count the events with the given name and stream ID in a Chrome trace.
+ */
+static uint32_t countEvents(const std::string& trace, const std::string& name, uint32_t streamId)
+{
+    json::value v;
+    std::string err = json::parse(v, trace);
+    REQUIRE(err.empty());
+
+    uint32_t count = 0U;
+    json::array events = v.get<json::object>()["traceEvents"].get<json::array>();
+    for (auto& entry : events) {
+        json::object event = entry.get<json::object>();
+        if (event["name"].get<std::string>() != name)
+            continue;
+
+        json::object args = event["args"].get<json::object>();
+        if (args["streamId"].get<uint32_t>() == streamId)
+            count++;
+    }
+
+    return count;
+}
+
+TEST_CASE("EventTrace records events from multiple threads", "[trace]") {
+    EventTrace::setEnabled(true);
+
+    std::thread t([]() {
+        EventTraceScope trace(TRACE_EVENT::FNE_P25_FRAME, 1234U, 9000100U);
+        trace.set(1234U, 9000100U, 1U);
+    });
+    t.join();
+    EventTrace::instant(TRACE_EVENT::FNE_WRITE_PEER_QUEUE, 1234U, 9000200U, 0U, 33U);
+
+    EventTrace::setEnabled(false);
+    EventTrace::instant(TRACE_EVENT::FNE_WRITE_PEER_QUEUE, 1234U, 9000200U, 0U, 33U);
+
+    std::string trace = EventTrace::chromeTrace();
+    REQUIRE(countEvents(trace, "fne.p25.frame", 1234U) == 1U);
+    REQUIRE(countEvents(trace, "fne.write_peer_queue", 1234U) == 1U);
+    REQUIRE(trace.find("\"ph\":\"X\"") != std::string::npos);
+}
+
+TEST_CASE("EventTrace ring keeps the newest events", "[trace]") {
+    EventTrace::setEnabled(true);
+
+    std::thread t([]() {
+        for (uint32_t i = 0U; i < TRACE_RING_EVENTS + 100U; i++)
+            EventTrace::instant(TRACE_EVENT::RPC_REQUEST, 5678U, 0U, 0U, i);
+    });
+    t.join();
+
+    EventTrace::setEnabled(false);
+
+    std::string trace = EventTrace::chromeTrace();
+    // the oldest slot may be in the middle of being overwritten while the ring is copied, so it is never reported
+    REQUIRE(countEvents(trace, "rpc.request", 5678U) == TRACE_RING_EVENTS - 1U);
+    REQUIRE(trace.find("\"arg\":100}") == std::string::npos);
+    REQUIRE(trace.find(std::string("\"arg\":") + std::to_string(TRACE_RING_EVENTS + 99U) + "}") != std::string::npos);
+
+    EventTrace::clear();
+    REQUIRE(countEvents(EventTrace::chromeTrace(), "rpc.request", 5678U) == 0U);
+}
@@ -0,0 +1,171 @@
+// SPDX-License-Identifier: GPL-2.0-only
+/*
+ * Digital Voice Modem - Test Suite
+ * GPLv2 Open Source. Use is subject to license terms.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ *  Copyright (C) 2026 Bryan Biedenkapp, N2PLL
+ *
+ */
+#include "host/Defines.h"
+#include "common/json/json.h"
+#include "common/json/writer.h"
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <limits>
+#include <string>
+
+/* Helper to create a JSON integer value of the given type. */
+template <typename T>
+static json::value makeValue(T n)
+{
+    json::value v;
+    v.set<T>(n);
+    return v;
+}
+
+TEST_CASE("JSON writer escapes strings identically to picojson", "[json]") {
+    const std::string cases[] = {
+        "",
+        "plain text",
+        "quote \" inside",
+        "back\\slash",
+        "forward/slash",
+        "\b\f\n\r\t",
+        std::string("nul \0 byte", 10U),
+        "\x01\x02\x1f",
+        "del \x7f char",
+        "caf\xc3\xa9 \xe2\x82\xac \xf0\x9f\x93\xbb",
+        "mixed \"a\"/\\b\\\n\x7f\xc3\xa9 tail"
+    };
+
+    for (const std::string& s : cases) {
+        json::writer w;
+        w.write(s);
+        REQUIRE(w.str() == json::value(s).serialize());
+
+        // keys go through the same escaping
+        json::writer k;
+        k.beginObject().key(s).write(s).endObject();
+
+        json::object o;
+        o[s] = json::value(s);
+        REQUIRE(k.str() == json::value(o).serialize());
+    }
+}
+
+TEST_CASE("JSON writer formats numbers identically to picojson", "[json]") {
+    const int ints[] = { 0, 1, -1, 42, -42, std::numeric_limits<int>::max(), std::numeric_limits<int>::min() };
+    for (int n : ints) {
+        json::writer w;
+        w.write(n);
+        REQUIRE(w.str() == makeValue<int>(n).serialize());
+    }
+
+    const uint32_t uints[] = { 0U, 1U, 9U, 10U, 65535U, std::numeric_limits<uint32_t>::max() };
+    for (uint32_t n : uints) {
+        json::writer w;
+        w.write(n);
+        REQUIRE(w.str() == makeValue<uint32_t>(n).serialize());
+    }
+
+    const uint64_t uint64s[] = { 0U, 1U, 4294967296ULL, (uint64_t)std::numeric_limits<int64_t>::max() };
+    for (uint64_t n : uint64s) {
+        json::writer w;
+        w.write(n);
+        REQUIRE(w.str() == makeValue<uint64_t>(n).serialize());
+    }
+
+    const double doubles[] = { 0.0, 1.0, -1.0, 0.5, -0.25, 3.141592653589793, 1e-9, 123456789.125, 9007199254740993.0, 1e300 };
+    for (double n : doubles) {
+        json::writer w;
+        w.write(n);
+        REQUIRE(w.str() == json::value(n).serialize());
+    }
+}
+
+TEST_CASE("JSON writer emits nested and empty containers identically to picojson", "[json]") {
+    SECTION("Empty") {
+        json::writer a;
+        a.beginArray().endArray();
+        REQUIRE(a.str() == json::value(json::array()).serialize());
+
+        json::writer o;
+        o.beginObject().endObject();
+        REQUIRE(o.str() == json::value(json::object()).serialize());
+    }
+
+    SECTION("Nested") {
+        json::array inner;
+        inner.push_back(makeValue<uint32_t>(1U));
+        inner.push_back(json::value("two"));
+        inner.push_back(json::value(json::array()));
+        inner.push_back(json::value(json::object()));
+        inner.push_back(json::value());
+        inner.push_back(json::value(true));
+
+        json::object child;
+        child["enabled"] = json::value(false);
+        child["list"] = json::value(inner);
+        child["name"] = json::value("peer/1");
+
+        json::object root;
+        root["child"] = json::value(child);
+        root["empty"] = json::value(json::array());
+        root["status"] = makeValue<int>(200);
+
+        // keys are written in the same (sorted) order a json::object iterates in
+        json::writer w;
+        w.beginObject();
+        w.key("child").beginObject();
+        {
+            w.member("enabled", false);
+            w.key("list").beginArray();
+            {
+                w.write(1U);
+                w.write("two");
+                w.beginArray().endArray();
+                w.beginObject().endObject();
+                w.writeNull();
+                w.write(true);
+            }
+            w.endArray();
+            w.member("name", "peer/1");
+        }
+        w.endObject();
+        w.key("empty").beginArray().endArray();
+        w.member("status", 200);
+        w.endObject();
+
+        std::string expected = json::value(root).serialize();
+        REQUIRE(w.str() == expected);
+
+        // writing the DOM inline must produce the same text
+        json::writer inl;
+        inl.write(root);
+        REQUIRE(inl.str() == expected);
+    }
+
+    SECTION("Array Of Objects") {
+        json::array arr;
+        for (uint32_t i = 0U; i < 3U; i++) {
+            json::object entry;
+            entry["id"] = makeValue<uint32_t>(i);
+            entry["tags"] = json::value(json::array());
+            arr.push_back(json::value(entry));
+        }
+
+        json::writer w;
+        w.beginArray();
+        for (uint32_t i = 0U; i < 3U; i++) {
+            w.beginObject();
+            w.member("id", i);
+            w.key("tags").beginArray().endArray();
+            w.endObject();
+        }
+        w.endArray();
+
+        REQUIRE(w.str() == json::value(arr).serialize());
+    }
+}
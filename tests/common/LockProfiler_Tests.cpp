@@ -0,0 +1,101 @@
+// SPDX-License-Identifier: GPL-2.0-only
+/*
+ * Digital Voice Modem - Test Suite
+ * GPLv2 Open Source. Use is subject to license terms.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ *  Copyright (C) 2026 Bryan Biedenkapp, N2PLL
+ *
+ */
+#include "host/Defines.h"
+#include "common/concurrent/unordered_map.h"
+#include "common/LockProfiler.h"
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <chrono>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+TEST_CASE("LockProfiler does not profile locks while disabled", "[locks]") {
+    LockProfiler::setEnabled(false);
+
+    ProfiledMutex<> mutex("test::disabled");
+    {
+        std::lock_guard<ProfiledMutex<>> lock(mutex);
+    }
+
+    json::object status = LockProfiler::status();
+    json::array locks = status["locks"].get<json::array>();
+    for (auto& entry : locks) {
+        json::object lock = entry.get<json::object>();
+        REQUIRE(lock["name"].get<std::string>() != "test::disabled");
+    }
+}
+
+TEST_CASE("LockProfiler records contention and hold time", "[locks]") {
+    LockProfiler::setEnabled(true);
+
+    ProfiledMutex<> mutex("test::contended");
+    std::vector<std::thread> threads;
+    for (uint32_t i = 0U; i < 4U; i++) {
+        threads.push_back(std::thread([&mutex]() {
+            for (uint32_t j = 0U; j < 50U; j++) {
+                std::lock_guard<ProfiledMutex<>> lock(mutex);
+                std::this_thread::sleep_for(std::chrono::microseconds(100));
+            }
+        }));
+    }
+    for (auto& t : threads)
+        t.join();
+
+    LockProfiler::setEnabled(false);
+
+    LockProfile* profile = LockProfiler::profile("test::contended");
+    REQUIRE(profile->acquisitions() == 200U);
+    REQUIRE(profile->contended() > 0U);
+    REQUIRE(profile->holdTime().count() == 200U);
+    REQUIRE(profile->holdTime().percentile(0.5) >= 100000U);
+    REQUIRE(profile->waitTime().max() > 0U);
+    REQUIRE(!profile->topSites(1U).empty());
+
+    profile->reset();
+    REQUIRE(profile->acquisitions() == 0U);
+    REQUIRE(profile->topSites(1U).empty());
+}
+
+TEST_CASE("LockProfiler profiles named concurrent containers", "[locks]") {
+    LockProfiler::setEnabled(true);
+
+    concurrent::unordered_map<uint32_t, uint32_t> map;
+    map.setLockName("test::map");
+    map.insert(1U, 1U);
+    map.lock(false);
+    map.unlock();
+
+    LockProfiler::setEnabled(false);
+
+    LockProfile* profile = LockProfiler::profile("test::map");
+    REQUIRE(profile->acquisitions() == 2U);
+    REQUIRE(profile->holdTime().count() == 2U);
+}
+
+TEST_CASE("LockProfiler stops profiling a lock once disabled", "[locks]") {
+    LockProfiler::setEnabled(true);
+
+    ProfiledMutex<> mutex("test::toggled");
+    {
+        std::lock_guard<ProfiledMutex<>> lock(mutex);
+    }
+
+    // the lock keeps its cached profile, but neither acquisitions nor releases are recorded
+    LockProfiler::setEnabled(false);
+    for (uint32_t i = 0U; i < 10U; i++) {
+        std::lock_guard<ProfiledMutex<>> lock(mutex);
+    }
+
+    LockProfile* profile = LockProfiler::profile("test::toggled");
+    REQUIRE(profile->acquisitions() == 1U);
+    REQUIRE(profile->holdTime().count() == 1U);
+}
@@ -0,0 +1,108 @@
+// SPDX-License-Identifier: GPL-2.0-only
+/*
+ * Digital Voice Modem - Test Suite
+ * GPLv2 Open Source. Use is subject to license terms.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ *  Copyright (C) 2026 Bryan Biedenkapp, N2PLL
+ *
+ */
+#include "host/Defines.h"
+#include "common/Metrics.h"
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace metrics;
+
+TEST_CASE("Metrics counter sums increments from many threads", "[metrics]") {
+    Counter* counter = Registry::counter("dvm_test_threaded", "Test counter.");
+    counter->reset();
+
+    std::vector<std::thread> threads;
+    for (uint32_t i = 0U; i < 8U; i++) {
+        threads.push_back(std::thread([counter]() {
+            for (uint32_t j = 0U; j < 10000U; j++)
+                counter->inc();
+        }));
+    }
+    for (auto& t : threads)
+        t.join();
+
+    REQUIRE(counter->value() == 80000U);
+
+    // registering the same name and labels returns the same counter
+    REQUIRE(Registry::counter("dvm_test_threaded", "Test counter.") == counter);
+    REQUIRE(Registry::counter("dvm_test_threaded", "Test counter.", "peer=\"1\"") != counter);
+}
+
+TEST_CASE("Metrics histogram counts observations into buckets", "[metrics]") {
+    Histogram* histogram = Registry::histogram("dvm_test_latency", "Test histogram.", { 10U, 100U }, "stage=\"rx\"");
+    histogram->observe(5U);
+    histogram->observe(10U);
+    histogram->observe(50U);
+    histogram->observe(500U);
+
+    REQUIRE(histogram->bucket(0U) == 2U);
+    REQUIRE(histogram->bucket(1U) == 1U);
+    REQUIRE(histogram->bucket(2U) == 1U);
+    REQUIRE(histogram->count() == 4U);
+    REQUIRE(histogram->sum() == 565U);
+    REQUIRE(histogram->max() == 500U);
+
+    // quantiles resolve to the bucket upper bound, clamped to the largest observation
+    REQUIRE(histogram->percentile(0.5) == 10U);
+    REQUIRE(histogram->percentile(0.75) == 100U);
+    REQUIRE(histogram->percentile(0.999) == 500U);
+}
+
+TEST_CASE("Metrics log-linear bounds split each power of two", "[metrics]") {
+    std::vector<uint64_t> bounds = Histogram::logLinearBounds(16U, 64U, 4U);
+    std::vector<uint64_t> expected = { 16U, 20U, 24U, 28U, 32U, 40U, 48U, 56U, 64U };
+    REQUIRE(bounds == expected);
+
+    Histogram histogram(Histogram::logLinearBounds(1U, 1000000U, 8U));
+    for (uint64_t i = 1U; i <= 1000U; i++)
+        histogram.observe(i);
+
+    // p99 is within the resolution of one sub-bucket (12.5%)
+    uint64_t p99 = histogram.percentile(0.99);
+    REQUIRE(p99 >= 990U);
+    REQUIRE(p99 <= 990U + 990U / 8U);
+    REQUIRE(histogram.percentile(1.0) == 1000U);
+}
+
+TEST_CASE("Metrics registry exposes OpenMetrics text", "[metrics]") {
+    Registry::counter("dvm_test_frames", "Test frames.", "mode=\"dmr\"")->inc(3U);
+    Registry::gauge("dvm_test_peers", "Test peers.")->set(-2);
+    Registry::histogram("dvm_test_expose", "Test expose.", { 1U })->observe(2U);
+
+    std::string text = Registry::expose();
+    REQUIRE(text.find("# TYPE dvm_test_frames counter\n") != std::string::npos);
+    REQUIRE(text.find("# HELP dvm_test_frames Test frames.\n") != std::string::npos);
+    REQUIRE(text.find("dvm_test_frames_total{mode=\"dmr\"} 3\n") != std::string::npos);
+    REQUIRE(text.find("dvm_test_peers -2\n") != std::string::npos);
+    REQUIRE(text.find("dvm_test_expose_bucket{le=\"1\"} 0\n") != std::string::npos);
+    REQUIRE(text.find("dvm_test_expose_bucket{le=\"+Inf\"} 1\n") != std::string::npos);
+    REQUIRE(text.find("dvm_test_expose_sum 2\n") != std::string::npos);
+    REQUIRE(text.find("dvm_test_expose_count 1\n") != std::string::npos);
+    REQUIRE(text.substr(text.length() - 6U) == "# EOF\n");
+}
+
+TEST_CASE("Metrics registry refuses a name registered as another type", "[metrics]") {
+    Counter* counter = Registry::counter("dvm_test_mismatch", "Test mismatch.");
+    REQUIRE(((uintptr_t)counter % 64U) == 0U);
+
+    // the gauge is usable, but is not registered in place of the counter
+    Gauge* gauge = Registry::gauge("dvm_test_mismatch", "Test mismatch.");
+    REQUIRE(gauge != nullptr);
+    gauge->set(7);
+
+    std::string text = Registry::expose();
+    REQUIRE(text.find("# TYPE dvm_test_mismatch counter\n") != std::string::npos);
+    REQUIRE(text.find("dvm_test_mismatch 7\n") == std::string::npos);
+    REQUIRE(Registry::counter("dvm_test_mismatch", "Test mismatch.") == counter);
+}
@@ -0,0 +1,99 @@
+// SPDX-License-Identifier: GPL-2.0-only
+/*
+ * Digital Voice Modem - Test Suite
+ * GPLv2 Open Source. Use is subject to license terms.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ *  Copyright (C) 2026 Bryan Biedenkapp, N2PLL
+ *
+ */
+#include "host/Defines.h"
+#include "common/ThreadPolicy.h"
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <string>
+#include <vector>
+
+TEST_CASE("ThreadPolicy parses CPU set lists", "[threading]") {
+    std::vector<uint32_t> set;
+
+    SECTION("Singles_And_Ranges") {
+        REQUIRE(ThreadPolicy::parseCPUs("0,2-3", set));
+        REQUIRE(set == std::vector<uint32_t>({ 0U, 2U, 3U }));
+
+        REQUIRE(ThreadPolicy::parseCPUs("5", set));
+        REQUIRE(set == std::vector<uint32_t>({ 5U }));
+
+        REQUIRE(ThreadPolicy::parseCPUs("1-1", set));
+        REQUIRE(set == std::vector<uint32_t>({ 1U }));
+    }
+
+    SECTION("Whitespace_And_Empty_Items") {
+        REQUIRE(ThreadPolicy::parseCPUs(" 1 , 4 - 5 ,, ", set));
+        REQUIRE(set == std::vector<uint32_t>({ 1U, 4U, 5U }));
+
+        REQUIRE(ThreadPolicy::parseCPUs("", set));
+        REQUIRE(set.empty());
+    }
+
+    SECTION("Duplicates_Are_Merged_And_Sorted") {
+        REQUIRE(ThreadPolicy::parseCPUs("3,1,2-4,1,0-1", set));
+        REQUIRE(set == std::vector<uint32_t>({ 0U, 1U, 2U, 3U, 4U }));
+    }
+
+    SECTION("Reversed_Range") {
+        REQUIRE_FALSE(ThreadPolicy::parseCPUs("3-1", set));
+        REQUIRE_FALSE(ThreadPolicy::parseCPUs("0,5-4", set));
+    }
+
+    SECTION("Non_Numeric") {
+        REQUIRE_FALSE(ThreadPolicy::parseCPUs("a", set));
+        REQUIRE_FALSE(ThreadPolicy::parseCPUs("1,x-3", set));
+        REQUIRE_FALSE(ThreadPolicy::parseCPUs("1-", set));
+        REQUIRE_FALSE(ThreadPolicy::parseCPUs("-2", set));
+        REQUIRE_FALSE(ThreadPolicy::parseCPUs("-1", set));
+        REQUIRE_FALSE(ThreadPolicy::parseCPUs("1-2-3", set));
+        REQUIRE_FALSE(ThreadPolicy::parseCPUs("0x1", set));
+    }
+
+    SECTION("CPU_Index_Limit") {
+        REQUIRE(ThreadPolicy::parseCPUs("1023", set));
+        REQUIRE(set == std::vector<uint32_t>({ 1023U }));
+
+        REQUIRE_FALSE(ThreadPolicy::parseCPUs("1024", set));
+        REQUIRE_FALSE(ThreadPolicy::parseCPUs("1020-1024", set));
+        REQUIRE_FALSE(ThreadPolicy::parseCPUs("99999999999", set));
+
+        // would wrap to CPU 0 if narrowed to 32 bits before the range check
+        REQUIRE_FALSE(ThreadPolicy::parseCPUs("4294967296", set));
+        REQUIRE_FALSE(ThreadPolicy::parseCPUs("0-4294967296", set));
+    }
+}
+
+TEST_CASE("ThreadPolicy matches rule names to thread names", "[threading]") {
+    SECTION("Exact") {
+        REQUIRE(ThreadPolicy::matches("host:modem", "host:modem"));
+        REQUIRE_FALSE(ThreadPolicy::matches("host:modem", "host:modem2"));
+        REQUIRE_FALSE(ThreadPolicy::matches("host:modem", "host:mode"));
+        REQUIRE_FALSE(ThreadPolicy::matches("host:modem", "HOST:MODEM"));
+        REQUIRE_FALSE(ThreadPolicy::matches("", "host:modem"));
+    }
+
+    SECTION("Prefix_Wildcard") {
+        REQUIRE(ThreadPolicy::matches("host:*", "host:modem"));
+        REQUIRE(ThreadPolicy::matches("host:*", "host:"));
+        REQUIRE(ThreadPolicy::matches("*", "anything"));
+        REQUIRE(ThreadPolicy::matches("*", ""));
+
+        REQUIRE_FALSE(ThreadPolicy::matches("host:*", "host"));
+        REQUIRE_FALSE(ThreadPolicy::matches("host:*", "fne:host:modem"));
+        REQUIRE_FALSE(ThreadPolicy::matches("host:*", ""));
+    }
+
+    SECTION("Wildcard_Only_Trailing") {
+        // a '*' anywhere but the end is matched literally
+        REQUIRE(ThreadPolicy::matches("*:modem*", "*:modem1"));
+        REQUIRE_FALSE(ThreadPolicy::matches("*:modem", "host:modem"));
+    }
+}
@@ -0,0 +1,124 @@
+// SPDX-License-Identifier: GPL-2.0-only
+/*
+ * Digital Voice Modem - Test Suite
+ * GPLv2 Open Source. Use is subject to license terms.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ *  Copyright (C) 2026 Bryan Biedenkapp, N2PLL
+ *
+ */
+#include "common/Defines.h"
+#include "common/concurrent/reader_gate.h"
+#include "common/concurrent/unordered_map.h"
+#include "common/Thread.h"
+
+using namespace concurrent;
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+// ---------------------------------------------------------------------------
+//  Test Cases
+// ---------------------------------------------------------------------------
+
+TEST_CASE("reader_gate close waits for readers to leave", "[concurrent][gate]") {
+    reader_gate gate;
+    std::atomic<bool> closed(false);
+
+    gate.enter();
+    std::thread writer([&]() {
+        gate.close();
+        closed = true;
+    });
+
+    Thread::sleep(50U);
+    REQUIRE(!closed);
+
+    gate.leave();
+    writer.join();
+    REQUIRE(closed);
+    REQUIRE(gate.isClosed());
+
+    gate.open();
+    REQUIRE(!gate.isClosed());
+}
+
+TEST_CASE("reader_gate holds off readers while closed", "[concurrent][gate]") {
+    reader_gate gate;
+    std::atomic<bool> entered(false);
+
+    gate.close();
+    std::thread reader([&]() {
+        reader_guard guard(gate);
+        entered = true;
+    });
+
+    Thread::sleep(50U);
+    REQUIRE(!entered);
+
+    gate.open();
+    reader.join();
+    REQUIRE(entered);
+}
+
+TEST_CASE("concurrent_lock read locking only blocks lookups when requested", "[concurrent][gate]") {
+    concurrent::unordered_map<uint32_t, uint32_t> map;
+    map.insert(1U, 100U);
+
+    // a change lock without the read lock leaves lookups running
+    map.lock(false);
+    REQUIRE(!map.isReadLocked());
+    REQUIRE(map.find(1U) != map.end());
+    map.unlock();
+
+    std::atomic<bool> found(false);
+    map.lock(true);
+    REQUIRE(map.isReadLocked());
+    std::thread reader([&]() {
+        found = map.find(1U) != map.end();
+    });
+
+    Thread::sleep(50U);
+    REQUIRE(!found);
+
+    map.unlock();
+    reader.join();
+    REQUIRE(found);
+}
+
+TEST_CASE("concurrent::unordered_map survives concurrent lookups and changes", "[concurrent][gate]") {
+    concurrent::unordered_map<uint32_t, uint32_t> map;
+    for (uint32_t i = 0U; i < 64U; i++)
+        map.insert(i, i);
+
+    std::atomic<bool> running(true);
+    std::atomic<uint32_t> mismatches(0U);
+
+    std::vector<std::thread> readers;
+    for (uint32_t n = 0U; n < 2U; n++) {
+        readers.emplace_back([&]() {
+            while (running) {
+                for (uint32_t i = 0U; i < 64U; i++) {
+                    if (map.count(i) > 0U && map.at(i) != i)
+                        mismatches++;
+                }
+            }
+        });
+    }
+
+    for (uint32_t round = 0U; round < 2000U; round++) {
+        uint32_t key = 64U + (round % 1024U);
+        map.insert(key, key);
+        map.erase(key);
+    }
+
+    running = false;
+    for (std::thread& t : readers)
+        t.join();
+
+    REQUIRE(mismatches == 0U);
+    REQUIRE(map.size() == 64U);
+}
@@ -0,0 +1,126 @@
+// SPDX-License-Identifier: GPL-2.0-only
+/*
+ * Digital Voice Modem - Test Suite
+ * GPLv2 Open Source. Use is subject to license terms.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ *  Copyright (C) 2026 Bryan Biedenkapp, N2PLL
+ *
+ */
+#include "host/Defines.h"
+#include "common/edac/SHA256.h"
+
+using namespace edac;
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <vector>
+
+namespace {
+    /* Helper to hash a string and return the digest as hex. */
+    std::string sha256Hex(const uint8_t* data, uint32_t len)
+    {
+        uint8_t out[SHA256_DIGEST_SIZE];
+        SHA256 sha256;
+        sha256.buffer(data, len, out);
+
+        std::string hex;
+        char digit[3U];
+        for (uint32_t i = 0U; i < SHA256_DIGEST_SIZE; i++) {
+            ::snprintf(digit, sizeof(digit), "%02x", out[i]);
+            hex += digit;
+        }
+
+        return hex;
+    }
+
+    std::string sha256Hex(const std::string& str)
+    {
+        return sha256Hex((const uint8_t*)str.data(), (uint32_t)str.size());
+    }
+
+    /* Helper to check the FIPS 180-2 test vectors. */
+    void checkVectors()
+    {
+        REQUIRE(sha256Hex("") == "e3b0c44298fc1c149afbf4c8996fb92427ae41e4649b934ca495991b7852b855");
+        REQUIRE(sha256Hex("abc") == "ba7816bf8f01cfea414140de5dae2223b00361a396177a9cb410ff61f20015ad");
+        REQUIRE(sha256Hex("abcdbcdecdefdefgefghfghighijhijkijkljklmklmnlmnomnopnopq") ==
+            "248d6a61d20638b8e5c026930c3e6039a33ce45964ff2167f6ecedd419db06c1");
+
+        std::string million(1000000U, 'a');
+        REQUIRE(sha256Hex(million) == "cdc76e5c9914fb9281a1c7e284d73e67f1809a48a497200e046d39ccc7112cd0");
+    }
+}
+
+TEST_CASE("SHA256 produces the FIPS 180-2 test vectors", "[sha256]") {
+    bool hardware = SHA256::isHardwareAccelerated();
+
+    SHA256::setHardwareAcceleration(false);
+    REQUIRE(!SHA256::isHardwareAccelerated());
+    checkVectors();
+
+    SHA256::setHardwareAcceleration(true);
+    REQUIRE(SHA256::isHardwareAccelerated() == SHA256::isHardwareSupported());
+    checkVectors();
+
+    SHA256::setHardwareAcceleration(hardware);
+}
+
+TEST_CASE("SHA256 instruction set extensions match the software implementation", "[sha256]") {
+    if (!SHA256::isHardwareSupported()) {
+        WARN("SHA-256 instruction set extensions are not supported, skipping");
+        return;
+    }
+
+    bool hardware = SHA256::isHardwareAccelerated();
+
+    std::vector<uint8_t> data(1024U);
+    uint32_t seed = 0x12345678U;
+    for (uint8_t& b : data) {
+        seed = seed * 1103515245U + 12345U;
+        b = (uint8_t)(seed >> 16);
+    }
+
+    // every length through several blocks, so every padding case is covered
+    for (uint32_t len = 0U; len <= data.size(); len++) {
+        SHA256::setHardwareAcceleration(false);
+        std::string software = sha256Hex(data.data(), len);
+        SHA256::setHardwareAcceleration(true);
+        std::string hw = sha256Hex(data.data(), len);
+        REQUIRE(software == hw);
+    }
+
+    SHA256::setHardwareAcceleration(hardware);
+}
+
+TEST_CASE("SHA256 HMAC produces the RFC 4231 test vectors", "[sha256]") {
+    auto hmacHex = [](const std::vector<uint8_t>& key, const std::string& data) {
+        uint8_t out[SHA256_DIGEST_SIZE];
+        SHA256::hmac(key.data(), (uint32_t)key.size(), (const uint8_t*)data.data(), (uint32_t)data.size(), out);
+
+        std::string hex;
+        char digit[3U];
+        for (uint32_t i = 0U; i < SHA256_DIGEST_SIZE; i++) {
+            ::snprintf(digit, sizeof(digit), "%02x", out[i]);
+            hex += digit;
+        }
+
+        return hex;
+    };
+
+    // test case 1
+    REQUIRE(hmacHex(std::vector<uint8_t>(20U, 0x0BU), "Hi There") ==
+        "b0344c61d8db38535ca8afceaf0bf12b881dc200c9833da726e9376c2e32cff7");
+    // test case 2
+    REQUIRE(hmacHex(std::vector<uint8_t>({ 'J', 'e', 'f', 'e' }), "what do ya want for nothing?") ==
+        "5bdcc146bf60754e6a042426089575c75a003f089d2739839dec58b964ec3843");
+    // test case 3
+    REQUIRE(hmacHex(std::vector<uint8_t>(20U, 0xAAU), std::string(50U, (char)0xDD)) ==
+        "773ea91e36800e46854db8ebd09181a72959098b3ef8c122d9635514ced565fe");
+    // test case 6, key larger than the block size
+    REQUIRE(hmacHex(std::vector<uint8_t>(131U, 0xAAU), "Test Using Larger Than Block-Size Key - Hash Key First") ==
+        "60e431591ee0b67f0d8a26aacbf5b77f8e0bc6213728c5140546040f0ee37f54");
+}
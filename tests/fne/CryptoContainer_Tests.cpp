@@ -0,0 +1,219 @@
+// SPDX-License-Identifier: GPL-2.0-only
+/*
+ * Digital Voice Modem - Test Suite
+ * GPLv2 Open Source. Use is subject to license terms.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ *  Copyright (C) 2026 Bryan Biedenkapp, N2PLL
+ *
+ */
+#include "host/Defines.h"
+#include "common/AESCrypto.h"
+#include "common/zlib/zlib.h"
+#include "fne/CryptoContainer.h"
+
+#include <catch2/catch_test_macros.hpp>
+
+#if defined(ENABLE_SSL)
+#include <openssl/evp.h>
+
+#include <cstdio>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <vector>
+#include <unistd.h>
+
+using namespace crypto;
+
+namespace {
+    const char* PASSWORD = "test-password";
+
+    /**
+     * @brief Represents a key written into a test key container.
+     */
+    struct TestKey {
+        const char* name;
+        uint32_t sln;
+        uint8_t algId;
+        uint32_t kId;
+        const char* key;
+    };
+
+    /**
+     * @brief Helper to get a unique file name for a test key container.
+     */
+    std::string tempFile(const char* name)
+    {
+        return "/tmp/dvm-" + std::string(name) + "-" + std::to_string(::getpid()) + ".ekc";
+    }
+
+    /**
+     * @brief Helper to base64 encode the given buffer.
+     */
+    std::string base64(const uint8_t* data, size_t len)
+    {
+        std::vector<uint8_t> out(4U * ((len + 2U) / 3U) + 1U);
+        int outLen = EVP_EncodeBlock(out.data(), data, (int)len);
+        return std::string((const char*)out.data(), outLen);
+    }
+
+    /**
+     * @brief Helper to write a key container (EKC) file with the given keys.
+     *
+     *  The container is written the same way the key management tooling writes it; a 4 byte length
+     *  header, followed by a GZIP stream of the outer container XML, which carries the key derivation
+     *  parameters and the AES-256-CBC encrypted inner container XML.
+     */
+    void writeContainer(const std::string& filename, const std::vector<TestKey>& keys)
+    {
+        // inner container
+        std::string inner = "<InnerContainer><Keys>";
+        for (const TestKey& k : keys) {
+            inner += "<KeyItem><Name>" + std::string(k.name) + "</Name><KeysetId>1</KeysetId><Sln>" + std::to_string(k.sln) +
+                "</Sln><AlgorithmId>" + std::to_string(k.algId) + "</AlgorithmId><KeyId>" + std::to_string(k.kId) +
+                "</KeyId><Key>" + std::string(k.key) + "</Key></KeyItem>";
+        }
+        inner += "</Keys></InnerContainer>";
+        while (inner.size() % 16U != 0U)
+            inner.push_back(' ');
+
+        // derive the key and IV, and encrypt the inner container
+        const uint8_t salt[16U] = { 0x01U, 0x23U, 0x45U, 0x67U, 0x89U, 0xABU, 0xCDU, 0xEFU,
+                                    0x10U, 0x32U, 0x54U, 0x76U, 0x98U, 0xBAU, 0xDCU, 0xFEU };
+        const int iterations = 1000;
+        const int keyLength = 32;
+
+        uint8_t keyIv[EVP_MAX_KEY_LENGTH + EVP_MAX_IV_LENGTH];
+        REQUIRE(PKCS5_PBKDF2_HMAC(PASSWORD, (int)::strlen(PASSWORD), salt, sizeof(salt), iterations, EVP_sha512(), keyLength + EVP_MAX_IV_LENGTH, keyIv) == 1);
+
+        AES aes = AES(AESKeyLength::AES_256);
+        uint8_t* crypted = aes.encryptCBC((const uint8_t*)inner.data(), (uint32_t)inner.size(), keyIv, keyIv + keyLength);
+        REQUIRE(crypted != nullptr);
+        std::string cipherValue = base64(crypted, inner.size());
+        delete[] crypted;
+
+        // outer container
+        std::string outer = "<?xml version=\"1.0\" encoding=\"utf-8\"?><OuterContainer version=\"1.0\"><KeyDerivation><Salt>" +
+            base64(salt, sizeof(salt)) + "</Salt><IterationCount>" + std::to_string(iterations) + "</IterationCount><KeyLength>" +
+            std::to_string(keyLength) + "</KeyLength></KeyDerivation><EncryptedData><CipherData><CipherValue>" + cipherValue +
+            "</CipherValue></CipherData></EncryptedData></OuterContainer>";
+
+        // compress the outer container
+        z_stream strm;
+        ::memset(&strm, 0x00U, sizeof(strm));
+        REQUIRE(deflateInit2(&strm, Z_DEFAULT_COMPRESSION, Z_DEFLATED, 16 + MAX_WBITS, 8, Z_DEFAULT_STRATEGY) == Z_OK);
+
+        std::vector<uint8_t> compressed(deflateBound(&strm, (uLong)outer.size()));
+        strm.next_in = (Bytef*)outer.data();
+        strm.avail_in = (uInt)outer.size();
+        strm.next_out = compressed.data();
+        strm.avail_out = (uInt)compressed.size();
+        REQUIRE(deflate(&strm, Z_FINISH) == Z_STREAM_END);
+        compressed.resize(strm.total_out);
+        deflateEnd(&strm);
+
+        FILE* fp = ::fopen(filename.c_str(), "wb");
+        REQUIRE(fp != nullptr);
+        uint32_t length = (uint32_t)outer.size();
+        ::fwrite(&length, sizeof(length), 1U, fp);
+        ::fwrite(compressed.data(), 1U, compressed.size(), fp);
+        ::fclose(fp);
+    }
+}
+
+TEST_CASE("CryptoContainer loads keys and finds them by key ID and algorithm", "[fne][crypto]") {
+    std::string filename = tempFile("crypto-find");
+    writeContainer(filename, {
+        { "ARC4 Key", 1U, 0xAAU, 0x0010U, "0102030405" },
+        { "AES Key", 2U, 0x84U, 0x0020U, "000102030405060708090A0B0C0D0E0F101112131415161718191A1B1C1D1E1F" },
+        { "AES Key Same KID", 3U, 0x84U, 0x0010U, "1F1E1D1C1B1A191817161514131211100F0E0D0C0B0A09080706050403020100" }
+    });
+
+    CryptoContainer container(filename, PASSWORD, 0U, true);
+    REQUIRE(container.read());
+    REQUIRE(container.keyCount() == 3U);
+
+    SECTION("By_Key_ID") {
+        // the first key in file order wins for a key ID shared across algorithms
+        std::shared_ptr<const EKCKeyItem> key = container.findKey(0x0010U);
+        REQUIRE(key != nullptr);
+        REQUIRE(key->algId() == 0xAAU);
+        REQUIRE(key->name() == "ARC4 Key");
+
+        uint8_t buffer[32U];
+        REQUIRE(key->getKey(buffer) == 5U);
+        REQUIRE(buffer[0U] == 0x01U);
+        REQUIRE(buffer[4U] == 0x05U);
+
+        REQUIRE(container.find(0x0020U).sln() == 2U);
+        REQUIRE(container.findKey(0x0030U) == nullptr);
+        REQUIRE(container.find(0x0030U).isInvalid());
+    }
+
+    SECTION("By_Key_ID_And_Algorithm") {
+        std::shared_ptr<const EKCKeyItem> key = container.findKey(0x0010U, 0x84U);
+        REQUIRE(key != nullptr);
+        REQUIRE(key->name() == "AES Key Same KID");
+
+        uint8_t buffer[32U];
+        REQUIRE(key->getKey(buffer) == 32U);
+        REQUIRE(buffer[0U] == 0x1FU);
+        REQUIRE(buffer[31U] == 0x00U);
+
+        REQUIRE(container.findKey(0x0010U, 0xAAU)->name() == "ARC4 Key");
+        REQUIRE(container.findKey(0x0020U, 0xAAU) == nullptr);
+    }
+
+    ::remove(filename.c_str());
+}
+
+TEST_CASE("CryptoContainer reload keeps snapshots held by readers valid", "[fne][crypto]") {
+    std::string filename = tempFile("crypto-reload");
+    writeContainer(filename, {
+        { "Old Key", 1U, 0x84U, 0x0010U, "000102030405060708090A0B0C0D0E0F101112131415161718191A1B1C1D1E1F" }
+    });
+
+    CryptoContainer container(filename, PASSWORD, 0U, true);
+    REQUIRE(container.read());
+
+    // a reader holds on to the entry across the reload
+    std::shared_ptr<const EKCKeyItem> held = container.findKey(0x0010U, 0x84U);
+    REQUIRE(held != nullptr);
+
+    writeContainer(filename, {
+        { "New Key", 5U, 0x84U, 0x0010U, "1F1E1D1C1B1A191817161514131211100F0E0D0C0B0A09080706050403020100" },
+        { "Added Key", 6U, 0x81U, 0x0040U, "0001020304050607" }
+    });
+    REQUIRE(container.reload());
+    REQUIRE(container.keyCount() == 2U);
+
+    // lookups see the reloaded table
+    std::shared_ptr<const EKCKeyItem> current = container.findKey(0x0010U, 0x84U);
+    REQUIRE(current != nullptr);
+    REQUIRE(current->name() == "New Key");
+    REQUIRE(container.findKey(0x0040U) != nullptr);
+
+    // while the held entry still refers to the table it was found in
+    REQUIRE(held->name() == "Old Key");
+    REQUIRE(held->sln() == 1U);
+    uint8_t buffer[32U];
+    REQUIRE(held->getKey(buffer) == 32U);
+    REQUIRE(buffer[0U] == 0x00U);
+    REQUIRE(buffer[31U] == 0x1FU);
+
+    SECTION("Failed_Reload") {
+        // a container that cannot be read leaves the loaded keys in place
+        FILE* fp = ::fopen(filename.c_str(), "wb");
+        REQUIRE(fp != nullptr);
+        ::fputs("not a key container", fp);
+        ::fclose(fp);
+
+        REQUIRE_FALSE(container.reload());
+        REQUIRE(container.keyCount() == 2U);
+        REQUIRE(container.findKey(0x0010U, 0x84U)->name() == "New Key");
+    }
+
+    ::remove(filename.c_str());
+}
+#endif // ENABLE_SSL
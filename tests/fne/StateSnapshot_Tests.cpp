@@ -0,0 +1,119 @@
+// SPDX-License-Identifier: GPL-2.0-only
+/*
+ * Digital Voice Modem - Test Suite
+ * GPLv2 Open Source. Use is subject to license terms.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ *  Copyright (C) 2026 Bryan Biedenkapp, N2PLL
+ *
+ */
+#include "host/Defines.h"
+#include "common/StateSnapshot.h"
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <cstdio>
+#include <fstream>
+#include <string>
+#include <vector>
+
+namespace {
+    const char* SNAPSHOT_FILE = "/tmp/dvm_state_snapshot_test.snap";
+
+    /* Helper to write a snapshot with one of each value type. */
+    bool saveSample(uint32_t version)
+    {
+        StateSnapshot snapshot("TEST", version);
+        snapshot.writeUInt8(0xA5U);
+        snapshot.writeUInt16(0x1234U);
+        snapshot.writeUInt32(0xDEADBEEFU);
+        snapshot.writeUInt64(0x0123456789ABCDEFULL);
+        snapshot.writeBool(true);
+        snapshot.writeString("PEER 9000");
+        uint8_t bytes[3U] = { 1U, 2U, 3U };
+        snapshot.writeBytes(bytes, 3U);
+        return snapshot.save(SNAPSHOT_FILE);
+    }
+
+    /* Helper to read the snapshot file. */
+    std::vector<char> readFile()
+    {
+        std::ifstream file(SNAPSHOT_FILE, std::ifstream::in | std::ifstream::binary);
+        return std::vector<char>(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+    }
+
+    /* Helper to overwrite the snapshot file. */
+    void writeFile(const std::vector<char>& data)
+    {
+        std::ofstream file(SNAPSHOT_FILE, std::ofstream::out | std::ofstream::binary | std::ofstream::trunc);
+        file.write(data.data(), data.size());
+    }
+}
+
+TEST_CASE("StateSnapshot round trips values through a file", "[snapshot]") {
+    REQUIRE(saveSample(1U));
+
+    StateSnapshot snapshot("TEST", 1U);
+    REQUIRE(snapshot.load(SNAPSHOT_FILE));
+    REQUIRE(snapshot.timestamp() > 0U);
+
+    uint8_t u8 = 0U;
+    uint16_t u16 = 0U;
+    uint32_t u32 = 0U;
+    uint64_t u64 = 0U;
+    bool b = false;
+    std::string str;
+    uint8_t bytes[3U];
+
+    REQUIRE(snapshot.readUInt8(u8));
+    REQUIRE(u8 == 0xA5U);
+    REQUIRE(snapshot.readUInt16(u16));
+    REQUIRE(u16 == 0x1234U);
+    REQUIRE(snapshot.readUInt32(u32));
+    REQUIRE(u32 == 0xDEADBEEFU);
+    REQUIRE(snapshot.readUInt64(u64));
+    REQUIRE(u64 == 0x0123456789ABCDEFULL);
+    REQUIRE(snapshot.readBool(b));
+    REQUIRE(b);
+    REQUIRE(snapshot.readString(str));
+    REQUIRE(str == "PEER 9000");
+    REQUIRE(snapshot.readBytes(bytes, 3U));
+    REQUIRE(bytes[2U] == 3U);
+
+    // reading past the end of the payload fails
+    REQUIRE(snapshot.eof());
+    REQUIRE(!snapshot.readUInt8(u8));
+
+    ::remove(SNAPSHOT_FILE);
+}
+
+TEST_CASE("StateSnapshot rejects corrupted, truncated and mismatched files", "[snapshot]") {
+    REQUIRE(saveSample(1U));
+    std::vector<char> good = readFile();
+    REQUIRE(good.size() == StateSnapshot::HEADER_LEN + 30U + 4U);
+
+    StateSnapshot snapshot("TEST", 1U);
+
+    // payload corruption fails the CRC-32
+    std::vector<char> corrupt = good;
+    corrupt[StateSnapshot::HEADER_LEN + 5U] ^= 0x01;
+    writeFile(corrupt);
+    REQUIRE(!snapshot.load(SNAPSHOT_FILE));
+
+    // truncated file
+    std::vector<char> truncated(good.begin(), good.end() - 6);
+    writeFile(truncated);
+    REQUIRE(!snapshot.load(SNAPSHOT_FILE));
+
+    // version and tag mismatch
+    writeFile(good);
+    StateSnapshot other("TEST", 2U);
+    REQUIRE(!other.load(SNAPSHOT_FILE));
+    StateSnapshot otherTag("NOPE", 1U);
+    REQUIRE(!otherTag.load(SNAPSHOT_FILE));
+    REQUIRE(snapshot.load(SNAPSHOT_FILE));
+
+    // missing file
+    ::remove(SNAPSHOT_FILE);
+    REQUIRE(!snapshot.load(SNAPSHOT_FILE));
+}
@@ -0,0 +1,167 @@
+// SPDX-License-Identifier: GPL-2.0-only
+/*
+ * Digital Voice Modem - Test Suite
+ * GPLv2 Open Source. Use is subject to license terms.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ *  Copyright (C) 2026 Bryan Biedenkapp, N2PLL
+ *
+ */
+#include "common/Defines.h"
+#include "common/ExpiryQueue.h"
+#include "common/lookups/AffiliationLookup.h"
+#include "common/lookups/ChannelLookup.h"
+
+using namespace lookups;
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <vector>
+
+TEST_CASE("ExpiryQueue expires entries at their deadline", "[lookups][expiry]") {
+    ExpiryQueue queue;
+    std::vector<uint32_t> expired;
+
+    queue.start(1U, 1000U);
+    queue.start(2U, 500U);
+    queue.start(3U, 0U);     // never expires
+
+    queue.clock(499U, expired);
+    REQUIRE(expired.empty());
+
+    queue.clock(1U, expired);
+    REQUIRE(expired == std::vector<uint32_t>({ 2U }));
+    REQUIRE(!queue.isRunning(2U));
+
+    expired.clear();
+    queue.clock(500U, expired);
+    REQUIRE(expired == std::vector<uint32_t>({ 1U }));
+
+    expired.clear();
+    queue.clock(100000U, expired);
+    REQUIRE(expired.empty());
+    REQUIRE(queue.isRunning(3U));
+    REQUIRE(queue.size() == 1U);
+}
+
+TEST_CASE("ExpiryQueue touch, restart and stop", "[lookups][expiry]") {
+    ExpiryQueue queue;
+    std::vector<uint32_t> expired;
+
+    queue.start(1U, 1000U);
+    queue.clock(900U, expired);
+    REQUIRE(queue.touch(1U));
+    REQUIRE(queue.getElapsed(1U) == 0U);
+    REQUIRE(!queue.touch(2U));
+
+    // the stale deadline passes without expiring the touched entry
+    queue.clock(900U, expired);
+    REQUIRE(expired.empty());
+    REQUIRE(queue.getElapsed(1U) == 900U);
+
+    queue.clock(100U, expired);
+    REQUIRE(expired == std::vector<uint32_t>({ 1U }));
+
+    // restarting with an earlier deadline takes effect
+    expired.clear();
+    queue.start(2U, 5000U);
+    queue.start(2U, 100U);
+    REQUIRE(queue.getTimeout(2U) == 100U);
+    queue.clock(100U, expired);
+    REQUIRE(expired == std::vector<uint32_t>({ 2U }));
+
+    // stopped entries never expire, and may be started again
+    expired.clear();
+    queue.start(3U, 100U);
+    queue.stop(3U);
+    queue.start(3U, 200U);
+    queue.clock(100U, expired);
+    REQUIRE(expired.empty());
+    queue.clock(100U, expired);
+    REQUIRE(expired == std::vector<uint32_t>({ 3U }));
+    REQUIRE(queue.size() == 0U);
+}
+
+TEST_CASE("AffiliationLookup releases grants and registrations on timeout", "[lookups][affiliation]") {
+    ChannelLookup chLookup;
+    for (uint32_t chNo = 1U; chNo <= 4U; chNo++)
+        chLookup.addRFCh(chNo);
+
+    AffiliationLookup aff("Test Affiliation", &chLookup, false);
+
+    std::vector<uint32_t> released;
+    aff.setReleaseGrantCallback([&](uint32_t chNo, uint32_t srcId, uint32_t dstId, uint8_t slot) {
+        released.push_back(dstId);
+    });
+    std::vector<uint32_t> deregistered;
+    aff.setUnitDeregCallback([&](uint32_t srcId, bool automatic) {
+        REQUIRE(automatic);
+        deregistered.push_back(srcId);
+    });
+
+    REQUIRE(aff.grantCh(100U, 1U, 5U, true, false));
+    REQUIRE(aff.grantCh(200U, 2U, 5U, true, false));
+    REQUIRE(chLookup.rfChSize() == 2U);
+
+    aff.clock(4000U);
+    aff.touchGrant(200U);
+    aff.clock(1000U);
+
+    REQUIRE(released == std::vector<uint32_t>({ 100U }));
+    REQUIRE(!aff.isGranted(100U));
+    REQUIRE(aff.isGranted(200U));
+    REQUIRE(chLookup.rfChSize() == 3U);
+
+    aff.clock(4000U);
+    REQUIRE(released == std::vector<uint32_t>({ 100U, 200U }));
+    REQUIRE(chLookup.rfChSize() == 4U);
+
+    // unit registrations
+    aff.unitReg(1234U);
+    REQUIRE(aff.unitRegTimeout(1234U) == 43200U);
+
+    aff.setDisableUnitRegTimeout(true);
+    aff.clock(43200U * 1000U);
+    REQUIRE(aff.isUnitReg(1234U));
+    REQUIRE(aff.unitRegTimer(1234U) == 0U);
+
+    aff.setDisableUnitRegTimeout(false);
+    aff.clock(43199U * 1000U);
+    REQUIRE(aff.unitRegTimer(1234U) == 43199U);
+    aff.clock(1000U);
+    REQUIRE(!aff.isUnitReg(1234U));
+    REQUIRE(deregistered == std::vector<uint32_t>({ 1234U }));
+}
+
+TEST_CASE("AffiliationLookup counts group affiliation changes", "[lookups][affiliation]") {
+    ChannelLookup chLookup;
+    AffiliationLookup aff1("Test Affiliation 1", &chLookup, false);
+    AffiliationLookup aff2("Test Affiliation 2", &chLookup, false);
+
+    std::atomic<uint32_t> changes(0U);
+    aff1.setGrpAffChangeCounter(&changes);
+    aff2.setGrpAffChangeCounter(&changes);
+
+    aff1.groupAff(1U, 100U);
+    aff2.groupAff(2U, 100U);
+    REQUIRE(changes.load() == 2U);
+    REQUIRE(aff1.grpAffVersion() == 1U);
+
+    // re-affiliating to the same talkgroup is not a change
+    aff1.groupAff(1U, 100U);
+    REQUIRE(changes.load() == 2U);
+
+    // moving to another talkgroup is
+    aff1.groupAff(1U, 200U);
+    REQUIRE(changes.load() == 3U);
+
+    REQUIRE(aff2.groupUnaff(2U));
+    REQUIRE(!aff2.groupUnaff(2U));
+    REQUIRE(changes.load() == 4U);
+
+    aff1.clearGroupAff(200U, false);
+    REQUIRE(changes.load() == 5U);
+    REQUIRE(aff1.grpAffVersion() == 3U);
+}
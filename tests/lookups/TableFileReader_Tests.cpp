@@ -0,0 +1,176 @@
+// SPDX-License-Identifier: GPL-2.0-only
+/*
+ * Digital Voice Modem - Test Suite
+ * GPLv2 Open Source. Use is subject to license terms.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ *  Copyright (C) 2026 Bryan Biedenkapp, N2PLL
+ *
+ */
+#include "common/Defines.h"
+#include "common/lookups/RadioIdLookup.h"
+#include "common/lookups/TableFileReader.h"
+
+using namespace lookups;
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <cstdio>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include <unistd.h>
+
+// ---------------------------------------------------------------------------
+//  Global Functions
+// ---------------------------------------------------------------------------
+
+/* Helper to generate a temporary file name. */
+
+static std::string tempFile(const char* name)
+{
+    return "/tmp/dvm-" + std::string(name) + "-" + std::to_string(::getpid()) + ".dat";
+}
+
+/* Helper to write a file. */
+
+static void writeFile(const std::string& filename, const std::string& content)
+{
+    std::ofstream file(filename, std::ofstream::out | std::ofstream::binary | std::ofstream::trunc);
+    file << content;
+}
+
+/* Helper to generate a radio ID lookup file. */
+
+static void writeRadioIdFile(const std::string& filename, uint32_t entries)
+{
+    std::ofstream file(filename, std::ofstream::out | std::ofstream::trunc);
+    file << "# generated radio ID table\n";
+    for (uint32_t i = 1U; i <= entries; i++)
+        file << i << "," << (i % 3U != 0U ? 1 : 0) << ",UNIT " << i << ",\n";
+}
+
+/* Helper to collect the lines of a file, in file order. */
+
+static std::vector<std::vector<std::string>> readLines(TableFileReader& reader)
+{
+    std::vector<std::vector<std::vector<std::string>>> chunks(reader.chunks());
+    reader.forEachLine([&](uint32_t chunk, const TableFileReader::Line& line) {
+        std::vector<std::string> fields;
+        for (uint32_t i = 0U; i < line.count; i++)
+            fields.push_back(line.fields[i].str());
+        chunks[chunk].push_back(fields);
+    });
+
+    std::vector<std::vector<std::string>> lines;
+    for (auto& chunk : chunks)
+        lines.insert(lines.end(), chunk.begin(), chunk.end());
+    return lines;
+}
+
+// ---------------------------------------------------------------------------
+//  Test Cases
+// ---------------------------------------------------------------------------
+
+TEST_CASE("TableFileReader splits fields like std::getline", "[lookups][tablefile]") {
+    std::string filename = tempFile("tfr-split");
+    writeFile(filename,
+        "# comment line\n"
+        "1,1,ALPHA,\r\n"
+        "\n"
+        "2,0,,10.0.0.1\n"
+        "3,1\n"
+        "  42abc,-7\n"
+        "4,1,LAST");
+
+    TableFileReader reader(filename, 4U);
+    REQUIRE(reader.open());
+    REQUIRE(reader.chunks() == 1U);
+
+    std::vector<std::vector<std::string>> lines = readLines(reader);
+    REQUIRE(lines.size() == 5U);
+    REQUIRE(lines[0] == std::vector<std::string>({ "1", "1", "ALPHA" }));
+    REQUIRE(lines[1] == std::vector<std::string>({ "2", "0", "", "10.0.0.1" }));
+    REQUIRE(lines[2] == std::vector<std::string>({ "3", "1" }));
+    REQUIRE(lines[4] == std::vector<std::string>({ "4", "1", "LAST" }));
+
+    int32_t values[2U] = { 0, 0 };
+    reader.forEachLine([&](uint32_t, const TableFileReader::Line& line) {
+        if (line.str() == "  42abc,-7") {
+            values[0U] = line.fields[0U].toInt();
+            values[1U] = line.fields[1U].toInt();
+        }
+    });
+    REQUIRE(values[0U] == 42);
+    REQUIRE(values[1U] == -7);
+
+    reader.close();
+    ::remove(filename.c_str());
+}
+
+TEST_CASE("TableFileReader chunked parse matches a single chunk parse", "[lookups][tablefile]") {
+    std::string filename = tempFile("tfr-chunks");
+    writeRadioIdFile(filename, 100000U);
+
+    TableFileReader single(filename, 1U);
+    REQUIRE(single.open());
+    REQUIRE(single.chunks() == 1U);
+
+    TableFileReader chunked(filename, 4U);
+    REQUIRE(chunked.open());
+    REQUIRE(chunked.chunks() > 1U);
+
+    std::vector<std::vector<std::string>> expected = readLines(single);
+    std::vector<std::vector<std::string>> lines = readLines(chunked);
+    REQUIRE(expected.size() == 100000U);
+    REQUIRE(lines == expected);
+
+    ::remove(filename.c_str());
+}
+
+TEST_CASE("TableFileReader is unaffected by the file being truncated after it was opened", "[lookups][tablefile]") {
+    std::string filename = tempFile("tfr-truncate");
+    writeRadioIdFile(filename, 100000U);
+
+    TableFileReader reader(filename, 4U);
+    REQUIRE(reader.open());
+
+    // a lookup table rewritten by an external tool while it is being parsed
+    REQUIRE(::truncate(filename.c_str(), 0) == 0);
+
+    std::vector<std::vector<std::string>> lines = readLines(reader);
+    REQUIRE(lines.size() == 100000U);
+    REQUIRE(lines.back() == std::vector<std::string>({ "100000", "1", "UNIT 100000" }));
+
+    ::remove(filename.c_str());
+}
+
+TEST_CASE("RadioIdLookup skips reloading an unchanged file", "[lookups][tablefile]") {
+    std::string filename = tempFile("tfr-rid");
+    writeFile(filename, "1,1,ALPHA\n2,0,BRAVO\n");
+
+    RadioIdLookup lookup(filename, 0U, true);
+    REQUIRE(lookup.reload());
+    REQUIRE(lookup.find(1U).radioAlias() == "ALPHA");
+    REQUIRE(!lookup.find(2U).radioEnabled());
+
+    // same file, nothing to do
+    uint32_t version = lookup.tableVersion();
+    REQUIRE(lookup.reload());
+    REQUIRE(lookup.tableVersion() == version);
+
+    // same size but different content is still picked up
+    writeFile(filename, "1,1,ALPHX\n2,0,BRAVO\n");
+    REQUIRE(lookup.reload());
+    REQUIRE(lookup.tableVersion() != version);
+    REQUIRE(lookup.find(1U).radioAlias() == "ALPHX");
+
+    // an in-memory change forces the file to be reloaded
+    lookup.addEntry(3U, true, "CHARLIE");
+    REQUIRE(lookup.find(3U).radioEnabled());
+    REQUIRE(lookup.reload());
+    REQUIRE(!lookup.find(3U).radioEnabled());
+
+    ::remove(filename.c_str());
+}
@@ -0,0 +1,70 @@
+// SPDX-License-Identifier: GPL-2.0-only
+/*
+ * Digital Voice Modem - Test Suite
+ * GPLv2 Open Source. Use is subject to license terms.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ *  Copyright (C) 2026 Bryan Biedenkapp, N2PLL
+ *
+ */
+
+#include "common/Log.h"
+#include "common/Thread.h"
+#include "common/Utils.h"
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "common/network/NetRPC.h"
+
+#include <atomic>
+#include <thread>
+
+using namespace network;
+
+namespace {
+    const uint16_t TEST_FUNC = 0x0101U;
+}
+
+TEST_CASE("NetRPC blocking requests complete while another thread clocks the endpoints", "[network][rpc]") {
+    NetRPC cc("127.0.0.1", 39301U, 0U, "PASSWORD", false);
+    NetRPC vc("127.0.0.1", 39302U, 0U, "PASSWORD", false);
+    REQUIRE(cc.open());
+    REQUIRE(vc.open());
+
+    std::atomic<uint32_t> permitted(0U);
+    vc.registerHandler(TEST_FUNC, [&](json::object& req, json::object& reply) {
+        permitted = (uint32_t)req["dstId"].get<int>();
+        vc.defaultResponse(reply, "OK", NetRPC::OK);
+    });
+
+    // the reply handlers are installed by the requesting thread and run on the clocking thread
+    std::atomic<bool> running(true);
+    std::thread clocker([&]() {
+        while (running) {
+            cc.clock(1U);
+            vc.clock(1U);
+            Thread::sleep(1U);
+        }
+    });
+
+    json::object req = json::object();
+    int dstId = 1234;
+    req["dstId"].set<int>(dstId);
+
+    std::atomic<uint32_t> replies(0U);
+    for (uint32_t i = 0U; i < 16U; i++) {
+        cc.req(TEST_FUNC, req, [&](json::object& reply, json::object&) {
+            if (reply["status"].get<int>() == NetRPC::OK)
+                replies++;
+        }, "127.0.0.1", 39302U, true);
+    }
+
+    running = false;
+    clocker.join();
+
+    REQUIRE(permitted == 1234U);
+    REQUIRE(replies == 16U);
+
+    cc.close();
+    vc.close();
+}
@@ -0,0 +1,72 @@
+// SPDX-License-Identifier: GPL-2.0-only
+/*
+ * Digital Voice Modem - Test Suite
+ * GPLv2 Open Source. Use is subject to license terms.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ *  Copyright (C) 2026 Bryan Biedenkapp, N2PLL
+ *
+ */
+
+#include "common/Log.h"
+#include "common/Utils.h"
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "common/network/PacketBuffer.h"
+
+#include <cstring>
+#include <vector>
+
+using namespace network;
+
+namespace {
+    /* Helper to fragment the payload and reassemble it through a second packet buffer. */
+    std::vector<uint8_t> roundTrip(bool compression, const std::vector<uint8_t>& payload, uint32_t& blocks)
+    {
+        PacketBuffer tx(compression, "Test TX Packet Buffer");
+        tx.encode((uint8_t*)payload.data(), (uint32_t)payload.size());
+        blocks = tx.fragments.size();
+
+        PacketBuffer rx(compression, "Test RX Packet Buffer");
+
+        std::vector<uint8_t> out;
+        for (uint8_t i = 0U; i < blocks; i++) {
+            uint8_t* message = nullptr;
+            uint32_t length = 0U;
+            if (rx.decode(tx.fragments[i]->data, &message, &length)) {
+                out.assign(message, message + length);
+                delete[] message;
+            }
+        }
+
+        return out;
+    }
+}
+
+TEST_CASE("PacketBuffer reassembles uncompressed multi-fragment payloads", "[network][packetbuffer]") {
+    // payload lengths that end in a partial block; the last block is still copied whole, so the
+    // reassembly buffer must cover every block (run under ASan to catch an overrun)
+    const uint32_t lengths[] = { FRAG_BLOCK_SIZE + 1U, (FRAG_BLOCK_SIZE * 3U) + 17U, (FRAG_BLOCK_SIZE * 8U) - 1U };
+    for (uint32_t len : lengths) {
+        std::vector<uint8_t> payload(len);
+        for (uint32_t i = 0U; i < len; i++)
+            payload[i] = (uint8_t)(i * 7U);
+
+        uint32_t blocks = 0U;
+        std::vector<uint8_t> out = roundTrip(false, payload, blocks);
+        REQUIRE(blocks > 1U);
+        REQUIRE(out == payload);
+    }
+}
+
+TEST_CASE("PacketBuffer reassembles compressed multi-fragment payloads", "[network][packetbuffer]") {
+    std::vector<uint8_t> payload((FRAG_BLOCK_SIZE * 16U) + 5U);
+    for (uint32_t i = 0U; i < payload.size(); i++)
+        payload[i] = (uint8_t)((i * 2654435761U) >> 24);     // poorly compressible, so it spans several blocks
+
+    uint32_t blocks = 0U;
+    std::vector<uint8_t> out = roundTrip(true, payload, blocks);
+    REQUIRE(blocks > 1U);
+    REQUIRE(out == payload);
+}
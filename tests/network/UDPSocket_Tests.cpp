@@ -0,0 +1,184 @@
+// SPDX-License-Identifier: GPL-2.0-only
+/*
+ * Digital Voice Modem - Test Suite
+ * GPLv2 Open Source. Use is subject to license terms.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ *  Copyright (C) 2026 Bryan Biedenkapp, N2PLL
+ *
+ */
+
+#include "common/Log.h"
+#include "common/Thread.h"
+#include "common/Utils.h"
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "common/network/udp/Socket.h"
+
+#include <chrono>
+#include <cstring>
+#include <thread>
+#include <vector>
+
+using namespace network;
+using namespace network::udp;
+
+namespace {
+    const uint32_t BUFFER_LENGTH = 8192U;
+
+    /* Helper to read a datagram, waiting up to 1 second for it to arrive. */
+    ssize_t readWait(Socket& socket, uint8_t* buffer, uint32_t length, sockaddr_storage& address, uint32_t& addrLen)
+    {
+        auto start = std::chrono::steady_clock::now();
+        while (std::chrono::steady_clock::now() - start < std::chrono::seconds(1)) {
+            ssize_t len = socket.read(buffer, length, address, addrLen);
+            if (len != 0)
+                return len;
+            std::this_thread::yield();
+        }
+
+        return 0;
+    }
+
+    /* Helper to exchange datagrams between two sockets. */
+    void exchange(bool ioUring, uint16_t rxPort, uint16_t txPort, const uint8_t* key)
+    {
+        Socket rx("127.0.0.1", rxPort);
+        Socket tx("127.0.0.1", txPort);
+        rx.setIoUring(ioUring);
+        tx.setIoUring(ioUring);
+        REQUIRE(rx.open(AF_INET));
+        REQUIRE(tx.open(AF_INET));
+        if (key != nullptr) {
+            rx.setPresharedKey(key);
+            tx.setPresharedKey(key);
+        }
+
+        sockaddr_storage rxAddr;
+        uint32_t rxAddrLen = 0U;
+        REQUIRE(Socket::lookup("127.0.0.1", rxPort, rxAddr, rxAddrLen) == 0);
+
+        // single datagram
+        uint8_t data[300U];
+        for (uint32_t i = 0U; i < sizeof(data); i++)
+            data[i] = (uint8_t)i;
+        REQUIRE(tx.write(data, sizeof(data), rxAddr, rxAddrLen));
+
+        uint8_t buffer[BUFFER_LENGTH];
+        sockaddr_storage from;
+        uint32_t fromLen = 0U;
+        ssize_t len = readWait(rx, buffer, BUFFER_LENGTH, from, fromLen);
+        REQUIRE(len >= (ssize_t)sizeof(data));
+        REQUIRE(::memcmp(buffer, data, sizeof(data)) == 0);
+        REQUIRE(Socket::port(from) == txPort);
+
+        // batch of datagrams, in order
+        BufferQueue queue;
+        for (uint32_t i = 0U; i < 32U; i++) {
+            UDPDatagram* dgram = new UDPDatagram;
+            dgram->length = 64U + i;
+            dgram->buffer = new uint8_t[dgram->length];
+            ::memset(dgram->buffer, (int)i, dgram->length);
+            ::memcpy(&dgram->address, &rxAddr, sizeof(sockaddr_storage));
+            dgram->addrLen = rxAddrLen;
+            queue.push(dgram);
+        }
+        REQUIRE(tx.write(&queue));
+
+        for (uint32_t i = 0U; i < 32U; i++) {
+            len = readWait(rx, buffer, BUFFER_LENGTH, from, fromLen);
+            REQUIRE(len >= (ssize_t)(64U + i));
+            REQUIRE(buffer[0U] == (uint8_t)i);
+            REQUIRE(buffer[63U + i] == (uint8_t)i);
+        }
+
+        REQUIRE(rx.read(buffer, BUFFER_LENGTH, from, fromLen) == 0);
+    }
+}
+
+TEST_CASE("UDP socket exchanges datagrams over the socket API", "[network][udp]") {
+    exchange(false, 39311U, 39312U, nullptr);
+}
+
+TEST_CASE("UDP socket exchanges datagrams over io_uring", "[network][udp]") {
+    Socket probe("127.0.0.1", 39313U);
+    probe.setIoUring(true);
+    REQUIRE(probe.open(AF_INET));
+    if (!probe.isIoUring()) {
+        WARN("io_uring is not available, skipping");
+        return;
+    }
+    probe.close();
+
+    exchange(true, 39314U, 39315U, nullptr);
+
+    uint8_t key[AES_WRAPPED_PCKT_KEY_LEN];
+    for (uint32_t i = 0U; i < AES_WRAPPED_PCKT_KEY_LEN; i++)
+        key[i] = (uint8_t)(0xA5U ^ i);
+    exchange(true, 39316U, 39317U, key);
+}
+
+#if defined(__linux__)
+TEST_CASE("UDP socket SO_REUSEPORT group steers datagrams by payload value", "[network][udp]") {
+    const uint32_t count = 4U;
+    std::vector<Socket*> group;
+    for (uint32_t i = 0U; i < count; i++) {
+        Socket* socket = new Socket("127.0.0.1", 39330U);
+        socket->setIoUring(false);
+        socket->setReusePort(true);
+        REQUIRE(socket->open(AF_INET));
+        group.push_back(socket);
+    }
+
+    REQUIRE(group[0U]->setReusePortSteering(4U, count));
+
+    Socket tx("127.0.0.1", 39331U);
+    tx.setIoUring(false);
+    REQUIRE(tx.open(AF_INET));
+
+    sockaddr_storage rxAddr;
+    uint32_t rxAddrLen = 0U;
+    REQUIRE(Socket::lookup("127.0.0.1", 39330U, rxAddr, rxAddrLen) == 0);
+
+    uint8_t buffer[BUFFER_LENGTH];
+    sockaddr_storage from;
+    uint32_t fromLen = 0U;
+    for (uint32_t value = 0U; value < 16U; value++) {
+        uint8_t data[16U];
+        ::memset(data, 0x00U, sizeof(data));
+        SET_UINT32(value * 1001U, data, 4U);
+        REQUIRE(tx.write(data, sizeof(data), rxAddr, rxAddrLen));
+
+        uint32_t expected = (value * 1001U) % count;
+        REQUIRE(readWait(*group[expected], buffer, BUFFER_LENGTH, from, fromLen) == (ssize_t)sizeof(data));
+        for (uint32_t i = 0U; i < count; i++)
+            REQUIRE(group[i]->read(buffer, BUFFER_LENGTH, from, fromLen) == 0);
+    }
+
+    // without the program the kernel hashes the addresses, all datagrams from one source go to one socket
+    REQUIRE(group[0U]->clearReusePortSteering());
+    uint8_t data[16U];
+    ::memset(data, 0x00U, sizeof(data));
+    for (uint32_t value = 0U; value < 16U; value++) {
+        SET_UINT32(value, data, 4U);
+        REQUIRE(tx.write(data, sizeof(data), rxAddr, rxAddrLen));
+    }
+
+    Thread::sleep(50U);
+    uint32_t sockets = 0U;
+    for (uint32_t i = 0U; i < count; i++) {
+        uint32_t received = 0U;
+        while (group[i]->read(buffer, BUFFER_LENGTH, from, fromLen) > 0)
+            received++;
+        if (received > 0U) {
+            REQUIRE(received == 16U);
+            sockets++;
+        }
+    }
+    REQUIRE(sockets == 1U);
+
+    for (Socket* socket : group)
+        delete socket;
+}
+#endif // defined(__linux__)
@@ -0,0 +1,212 @@
+// SPDX-License-Identifier: GPL-2.0-only
+/*
+ * Digital Voice Modem - Test Suite
+ * GPLv2 Open Source. Use is subject to license terms.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ *  Copyright (C) 2026 Bryan Biedenkapp, N2PLL
+ *
+ */
+
+#include "common/Log.h"
+#include "common/Utils.h"
+
+#include <catch2/catch_test_macros.hpp>
+#include <cstdlib>
+#include <cstring>
+#include <random>
+
+#include "common/nxdn/edac/Convolution.h"
+
+using namespace nxdn::edac;
+
+namespace {
+    /**
+     * @brief Reference (original scalar) Viterbi decoder, used to verify the decoder is bit-exact.
+     */
+    class ReferenceViterbi {
+    public:
+        void start()
+        {
+            ::memset(m_metrics1, 0x00U, sizeof(m_metrics1));
+            ::memset(m_metrics2, 0x00U, sizeof(m_metrics2));
+            m_oldMetrics = m_metrics1;
+            m_newMetrics = m_metrics2;
+            m_dp = m_decisions;
+        }
+
+        void decode(uint8_t s0, uint8_t s1)
+        {
+            static const uint8_t BRANCH_TABLE1[] = { 0U, 0U, 0U, 0U, 2U, 2U, 2U, 2U };
+            static const uint8_t BRANCH_TABLE2[] = { 0U, 2U, 2U, 0U, 0U, 2U, 2U, 0U };
+            const uint32_t M = 4U;
+
+            *m_dp = 0U;
+            for (uint8_t i = 0U; i < 8U; i++) {
+                uint8_t j = i * 2U;
+
+                uint16_t metric = std::abs(BRANCH_TABLE1[i] - s0) + std::abs(BRANCH_TABLE2[i] - s1);
+
+                uint16_t m0 = m_oldMetrics[i] + metric;
+                uint16_t m1 = m_oldMetrics[i + 8U] + (M - metric);
+                uint8_t decision0 = (m0 >= m1) ? 1U : 0U;
+                m_newMetrics[j + 0U] = decision0 != 0U ? m1 : m0;
+
+                m0 = m_oldMetrics[i] + (M - metric);
+                m1 = m_oldMetrics[i + 8U] + metric;
+                uint8_t decision1 = (m0 >= m1) ? 1U : 0U;
+                m_newMetrics[j + 1U] = decision1 != 0U ? m1 : m0;
+
+                *m_dp |= (uint64_t(decision1) << (j + 1U)) | (uint64_t(decision0) << (j + 0U));
+            }
+
+            ++m_dp;
+
+            uint16_t* tmp = m_oldMetrics;
+            m_oldMetrics = m_newMetrics;
+            m_newMetrics = tmp;
+        }
+
+        uint32_t chainback(uint8_t* out, uint32_t nBits)
+        {
+            uint32_t state = 0U;
+            while (nBits-- > 0) {
+                --m_dp;
+
+                uint32_t  i = state >> 4;
+                uint8_t bit = uint8_t(*m_dp >> i) & 1;
+                state = (bit << 7) | (state >> 1);
+
+                WRITE_BIT(out, nBits, bit != 0U);
+            }
+
+            uint32_t minCost = m_oldMetrics[0];
+            for (uint32_t i = 0U; i < 16U; i++) {
+                if (m_oldMetrics[i] < minCost)
+                    minCost = m_oldMetrics[i];
+            }
+
+            return minCost / 2U;
+        }
+
+    private:
+        uint16_t m_metrics1[16U];
+        uint16_t m_metrics2[16U];
+        uint16_t* m_oldMetrics;
+        uint16_t* m_newMetrics;
+        uint64_t m_decisions[300U];
+        uint64_t* m_dp;
+    };
+
+    /**
+     * @brief Helper to build soft symbols (0, 1 = erased, 2) for a random payload with random errors.
+     */
+    void makeSymbols(std::mt19937& rng, uint32_t nBits, uint32_t nErrors, uint8_t* symbols)
+    {
+        uint8_t payload[40U];
+        for (uint32_t i = 0U; i < sizeof(payload); i++)
+            payload[i] = (uint8_t)rng();
+
+        uint8_t encoded[80U];
+        ::memset(encoded, 0x00U, sizeof(encoded));
+
+        Convolution conv;
+        conv.encode(payload, encoded, nBits);
+
+        uint32_t n = (nBits + 4U) * 2U;
+        for (uint32_t i = 0U; i < nBits * 2U; i++)
+            symbols[i] = READ_BIT(encoded, i) ? 2U : 0U;
+        for (uint32_t i = nBits * 2U; i < n; i++)
+            symbols[i] = 0U;
+
+        for (uint32_t i = 0U; i < nErrors; i++)
+            symbols[rng() % n] = (uint8_t)(rng() % 3U);
+    }
+}
+
+TEST_CASE("Convolution decode is bit-exact with the reference decoder", "[nxdn][convolution]") {
+    std::mt19937 rng(0x4E58444EU);
+
+    const uint32_t lengths[] = { 26U, 60U, 96U, 155U, 199U, 296U };
+    for (uint32_t nBits : lengths) {
+        for (uint32_t trial = 0U; trial < 200U; trial++) {
+            uint8_t symbols[600U];
+            makeSymbols(rng, nBits, trial % 24U, symbols);
+
+            ReferenceViterbi ref;
+            ref.start();
+            for (uint32_t i = 0U; i < nBits + 4U; i++)
+                ref.decode(symbols[i * 2U], symbols[i * 2U + 1U]);
+
+            uint8_t refOut[40U];
+            ::memset(refOut, 0xA5U, sizeof(refOut));
+            uint32_t refCost = ref.chainback(refOut, nBits);
+
+            // symbol by symbol
+            Convolution conv;
+            conv.start();
+            for (uint32_t i = 0U; i < nBits + 4U; i++)
+                REQUIRE(conv.decode(symbols[i * 2U], symbols[i * 2U + 1U]));
+
+            uint8_t out[40U];
+            ::memset(out, 0xA5U, sizeof(out));
+            uint32_t cost = conv.chainback(out, nBits);
+
+            REQUIRE(cost == refCost);
+            REQUIRE(::memcmp(out, refOut, sizeof(out)) == 0);
+
+            // whole block
+            uint8_t blockOut[40U];
+            ::memset(blockOut, 0xA5U, sizeof(blockOut));
+            REQUIRE(conv.decodeBlock(symbols, nBits, blockOut));
+            REQUIRE(::memcmp(blockOut, refOut, sizeof(blockOut)) == 0);
+        }
+    }
+}
+
+TEST_CASE("Convolution decodes clean encoded data", "[nxdn][convolution]") {
+    const uint32_t nBits = 196U;
+
+    uint8_t payload[25U];
+    for (uint32_t i = 0U; i < sizeof(payload); i++)
+        payload[i] = (uint8_t)(i * 29U + 7U);
+
+    // the last 4 bits flush the encoder (as the NXDN channels do with their 4-bit NULL tail)
+    for (uint32_t i = nBits - 4U; i < sizeof(payload) * 8U; i++)
+        WRITE_BIT(payload, i, false);
+
+    uint8_t encoded[52U];
+    ::memset(encoded, 0x00U, sizeof(encoded));
+
+    Convolution conv;
+    conv.encode(payload, encoded, nBits);
+
+    uint8_t symbols[(nBits + 4U) * 2U];
+    for (uint32_t i = 0U; i < nBits * 2U; i++)
+        symbols[i] = READ_BIT(encoded, i) ? 2U : 0U;
+    for (uint32_t i = nBits * 2U; i < sizeof(symbols); i++)
+        symbols[i] = 0U;
+
+    uint8_t out[25U];
+    ::memset(out, 0x00U, sizeof(out));
+    REQUIRE(conv.decodeBlock(symbols, nBits, out));
+
+    // 196 bits; compare the 24 whole bytes and the upper nibble of the last
+    REQUIRE(::memcmp(out, payload, 24U) == 0);
+    REQUIRE((out[24U] & 0xF0U) == 0x00U);
+}
+
+TEST_CASE("Convolution rejects blocks exceeding the decision buffer", "[nxdn][convolution]") {
+    uint8_t symbols[610U];
+    ::memset(symbols, 0x00U, sizeof(symbols));
+    uint8_t out[40U];
+
+    Convolution conv;
+    REQUIRE(conv.decodeBlock(symbols, 296U, out));
+    REQUIRE(!conv.decodeBlock(symbols, 297U, out));
+
+    conv.start();
+    for (uint32_t i = 0U; i < 300U; i++)
+        REQUIRE(conv.decode(0U, 0U));
+    REQUIRE(!conv.decode(0U, 0U));
+}
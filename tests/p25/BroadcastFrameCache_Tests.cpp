@@ -0,0 +1,166 @@
+// SPDX-License-Identifier: GPL-2.0-only
+/*
+ * Digital Voice Modem - Test Suite
+ * GPLv2 Open Source. Use is subject to license terms.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ *  Copyright (C) 2026 Bryan Biedenkapp, N2PLL
+ *
+ */
+#include "host/Defines.h"
+#include "common/p25/P25Defines.h"
+#include "common/p25/P25Utils.h"
+#include "common/p25/NID.h"
+#include "common/p25/Sync.h"
+#include "common/p25/lc/tsbk/OSP_RFSS_STS_BCAST.h"
+#include "common/BroadcastFrameCache.h"
+#include "common/lookups/ChannelLookup.h"
+#include "common/lookups/IdenTableLookup.h"
+#include "common/lookups/RadioIdLookup.h"
+#include "common/lookups/RSSIInterpolator.h"
+#include "common/lookups/TalkgroupRulesLookup.h"
+#include "p25/Control.h"
+#include "p25/packet/ControlSignaling.h"
+#include "Host.h"
+
+using namespace p25;
+using namespace p25::defines;
+using namespace p25::lc::tsbk;
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <cstring>
+
+namespace {
+    /**
+     * @brief Helper to encode a single-block TSDU frame (sync, NID and TSBK) without status bits.
+     */
+    void encodeTSDU(NID& nid, uint8_t* data)
+    {
+        ::memset(data, 0x00U, P25_TSDU_FRAME_LENGTH_BYTES);
+
+        Sync::addP25Sync(data);
+        nid.encode(data, DUID::TSDU);
+
+        OSP_RFSS_STS_BCAST osp = OSP_RFSS_STS_BCAST();
+        osp.setLastBlock(true);
+        osp.encode(data);
+    }
+
+    /**
+     * @brief Exposes the broadcast cache of the P25 control signaling to the test.
+     */
+    class CtrlCacheHarness : public p25::packet::ControlSignaling {
+    public:
+        CtrlCacheHarness(p25::Control* p25) : p25::packet::ControlSignaling(p25, false, false, false)
+        {
+            m_ctrlTSDUMBF = false; // single-block TSDUs are cached in the frame cache
+        }
+
+        /** @brief Writes a control TSBK through the broadcast cache. */
+        void write(uint8_t lco)
+        {
+            OSP_RFSS_STS_BCAST osp = OSP_RFSS_STS_BCAST();
+            uint64_t key = ctrlCacheKey(lco);
+            REQUIRE(key != 0U);
+            REQUIRE(writeRF_TSDU_Ctrl(&osp, key));
+        }
+
+        using p25::packet::ControlSignaling::invalidateCtrlCache;
+
+        uint64_t hits() const { return m_ctrlFrameCache.hits(); }
+        uint64_t misses() const { return m_ctrlFrameCache.misses(); }
+
+        /** @brief Changes an adjacent site entry without flagging the change. */
+        void setAdjSite(const SiteData& site) { m_adjSiteTable[site.siteId()] = site; }
+    };
+}
+
+TEST_CASE("BroadcastFrameCache returns cached frames until the version changes", "[p25][bcast_cache]") {
+    lc::TSBK::setSiteData(SiteData(1U, 1U, 1U, 1U, 0U, 1U, 1U, 0U, 0));
+    NID nid = NID(0x293U);
+
+    uint8_t encoded[P25_TSDU_FRAME_LENGTH_BYTES];
+    encodeTSDU(nid, encoded);
+
+    BroadcastFrameCache cache(P25_TSDU_FRAME_LENGTH_BYTES);
+    uint64_t version = BroadcastFrameCache::hash(BroadcastFrameCache::INITIAL_VERSION, 0x293U);
+
+    REQUIRE(cache.validate(version));
+    REQUIRE(!cache.validate(version));
+
+    uint8_t data[P25_TSDU_FRAME_LENGTH_BYTES];
+    REQUIRE(!cache.find(1U, data));
+    cache.insert(1U, encoded);
+    REQUIRE(cache.size() == 1U);
+
+    ::memset(data, 0x00U, sizeof(data));
+    REQUIRE(cache.find(1U, data));
+    REQUIRE(::memcmp(data, encoded, sizeof(data)) == 0);
+    REQUIRE(cache.hits() == 1U);
+    REQUIRE(cache.misses() == 1U);
+
+    // status bits are applied to a copy of the cached frame, and must match the direct encode
+    uint8_t direct[P25_TSDU_FRAME_LENGTH_BYTES];
+    encodeTSDU(nid, direct);
+    P25Utils::addStatusBits(direct, P25_TSDU_FRAME_LENGTH_BITS, false, true);
+    P25Utils::addStatusBits(data, P25_TSDU_FRAME_LENGTH_BITS, false, true);
+    REQUIRE(::memcmp(data, direct, sizeof(data)) == 0);
+
+    // a site data change changes the version and flushes the cache
+    uint64_t changed = BroadcastFrameCache::hash(BroadcastFrameCache::INITIAL_VERSION, 0x294U);
+    REQUIRE(changed != version);
+    REQUIRE(cache.validate(changed));
+    REQUIRE(cache.size() == 0U);
+    REQUIRE(!cache.find(1U, data));
+
+    // strings are length delimited
+    REQUIRE(BroadcastFrameCache::hash(BroadcastFrameCache::hash(BroadcastFrameCache::INITIAL_VERSION, std::string("AB")), std::string("C")) !=
+        BroadcastFrameCache::hash(BroadcastFrameCache::hash(BroadcastFrameCache::INITIAL_VERSION, std::string("A")), std::string("BC")));
+}
+
+TEST_CASE("ControlSignaling only rehashes the broadcast cache version when an input changes", "[p25][bcast_cache]") {
+    if (g_RPC == nullptr)
+        g_RPC = new network::NetRPC("127.0.0.1", 9990U, 0U, "test", false);
+
+    ::lookups::ChannelLookup chLookup;
+    ::lookups::RadioIdLookup ridLookup("", 0U, false);
+    ::lookups::TalkgroupRulesLookup tidLookup("", 0U, false);
+    ::lookups::IdenTableLookup idenTable("", 0U);
+    ::lookups::RSSIInterpolator rssiMapper;
+
+    p25::Control p25(false, 0x293U, 3U, 2592U, nullptr, nullptr, 180U, 5U, false, &chLookup, &ridLookup, &tidLookup,
+        &idenTable, &rssiMapper, false, false, false, false, false);
+    CtrlCacheHarness ctrl(&p25);
+
+    // first broadcast encodes, repeats are served from the cache
+    ctrl.write(TSBKO::OSP_RFSS_STS_BCAST);
+    REQUIRE(ctrl.misses() == 1U);
+    for (uint32_t i = 0U; i < 8U; i++)
+        ctrl.write(TSBKO::OSP_RFSS_STS_BCAST);
+    REQUIRE(ctrl.hits() == 8U);
+    REQUIRE(ctrl.misses() == 1U);
+
+    // an invalidation without a changed input rehashes to the same version and keeps the cache
+    ctrl.invalidateCtrlCache();
+    ctrl.write(TSBKO::OSP_RFSS_STS_BCAST);
+    REQUIRE(ctrl.hits() == 9U);
+
+    // the version is not rehashed on every broadcast, only once a change is flagged
+    SiteData adjSite = SiteData(1U, 1U, 2U, 5U, 0U, 1U, 100U, 0U, 0);
+    ctrl.setAdjSite(adjSite);
+    ctrl.write(TSBKO::OSP_RFSS_STS_BCAST);
+    REQUIRE(ctrl.hits() == 10U);
+
+    ctrl.invalidateCtrlCache();
+    ctrl.write(TSBKO::OSP_RFSS_STS_BCAST);
+    REQUIRE(ctrl.misses() == 2U);
+    ctrl.write(TSBKO::OSP_RFSS_STS_BCAST);
+    REQUIRE(ctrl.hits() == 11U);
+
+    // the bandplan is versioned by the lookup table, and needs no invalidation
+    idenTable.clear();
+    ctrl.write(TSBKO::OSP_RFSS_STS_BCAST);
+    REQUIRE(ctrl.misses() == 3U);
+    REQUIRE(ctrl.hits() == 11U);
+}
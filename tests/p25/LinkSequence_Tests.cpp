@@ -0,0 +1,99 @@
+// SPDX-License-Identifier: GPL-2.0-only
+/*
+ * Digital Voice Modem - Test Suite
+ * GPLv2 Open Source. Use is subject to license terms.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ *  Copyright (C) 2026 Bryan Biedenkapp, N2PLL
+ *
+ */
+#include "host/Defines.h"
+#include "common/p25/data/LinkSequence.h"
+
+using namespace p25;
+using namespace p25::data;
+
+#include <catch2/catch_test_macros.hpp>
+
+TEST_CASE("LinkSequence", "[p25][pdu_seq]") {
+    SECTION("Receive_InSequence") {
+        LinkSequence seq;
+        uint8_t expectedNs = 0xFFU;
+
+        // V(R) starts at 0, N(S) == V(R) and N(S) == V(R) + 1 are accepted
+        REQUIRE(seq.receive(1234U, 0U, false, expectedNs));
+        REQUIRE(expectedNs == 0U);
+        REQUIRE(seq.receive(1234U, 2U, false, expectedNs));
+        REQUIRE(expectedNs == 1U);
+
+        // V(R) wraps modulo 8
+        for (uint8_t ns = 3U; ns < 8U; ns++)
+            REQUIRE(seq.receive(1234U, ns, false, expectedNs));
+        REQUIRE(seq.receive(1234U, 0U, false, expectedNs));
+        REQUIRE(expectedNs == 0U);
+    }
+
+    SECTION("Receive_OutOfSequence") {
+        LinkSequence seq;
+        uint8_t expectedNs = 0xFFU;
+
+        REQUIRE(seq.receive(1234U, 0U, false, expectedNs));
+
+        // V(R) is 1; N(S) 4 is out of sequence, and V(R) is left as is
+        REQUIRE(!seq.receive(1234U, 4U, false, expectedNs));
+        REQUIRE(expectedNs == 1U);
+
+        // the NACK for the rejected packet takes the next N(S) right away (this deadlocked while the
+        // receive state lock was still held)
+        bool synchronize = true;
+        REQUIRE(seq.nextSend(1234U, synchronize) == 1U);
+        REQUIRE(!synchronize);
+
+        REQUIRE(!seq.receive(1234U, 4U, false, expectedNs));
+        REQUIRE(expectedNs == 1U);
+        REQUIRE(seq.receive(1234U, 1U, false, expectedNs));
+
+        // other logical links are tracked independently
+        REQUIRE(seq.receive(5678U, 1U, false, expectedNs));
+        REQUIRE(expectedNs == 0U);
+    }
+
+    SECTION("Receive_Synchronize") {
+        LinkSequence seq;
+        uint8_t expectedNs = 0xFFU;
+
+        // the synchronize flag resets the receive window to the received N(S)
+        REQUIRE(seq.receive(1234U, 5U, true, expectedNs));
+        REQUIRE(expectedNs == 0U);
+        REQUIRE(seq.receive(1234U, 6U, false, expectedNs));
+        REQUIRE(expectedNs == 6U);
+    }
+
+    SECTION("Send_Wraps") {
+        LinkSequence seq;
+        bool synchronize = false;
+
+        for (uint8_t i = 1U; i < 8U; i++) {
+            REQUIRE(seq.nextSend(1234U, synchronize) == i);
+            REQUIRE(!synchronize);
+        }
+
+        // V(S) wraps to 0, and the packet sets the synchronize flag
+        REQUIRE(seq.nextSend(1234U, synchronize) == 0U);
+        REQUIRE(synchronize);
+    }
+
+    SECTION("Remove") {
+        LinkSequence seq;
+        uint8_t expectedNs = 0xFFU;
+        bool synchronize = false;
+
+        REQUIRE(seq.receive(1234U, 0U, false, expectedNs));
+        seq.nextSend(1234U, synchronize);
+        seq.remove(1234U);
+
+        REQUIRE(seq.nextSend(1234U, synchronize) == 1U);
+        REQUIRE(seq.receive(1234U, 0U, false, expectedNs));
+        REQUIRE(expectedNs == 0U);
+    }
+}
@@ -0,0 +1,291 @@
+// SPDX-License-Identifier: GPL-2.0-only
+/*
+ * Digital Voice Modem - Test Suite
+ * GPLv2 Open Source. Use is subject to license terms.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ *  Copyright (C) 2026 Bryan Biedenkapp, N2PLL
+ *
+ */
+#include "host/Defines.h"
+#include "common/restapi/RequestDispatcher.h"
+#include "common/restapi/http/HTTPServer.h"
+
+using namespace restapi;
+using namespace restapi::http;
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <string>
+#include <thread>
+
+namespace {
+    const uint16_t TEST_PORT = 18480U;
+
+    /**
+     * @brief Helper to run a HTTP server on the loopback interface, for the lifetime of the instance.
+     */
+    class TestServer {
+    public:
+        /**
+         * @brief Initializes a new instance of the TestServer class.
+         * @param timeout Request timeout (seconds).
+         */
+        TestServer(uint32_t timeout = HTTP_REQUEST_TIMEOUT) :
+            requests(0U),
+            m_server("127.0.0.1", TEST_PORT, false),
+            m_thread()
+        {
+            DefaultRequestDispatcher dispatcher;
+            dispatcher.match("/echo/(\\d+)", true).get([this](const HTTPPayload& request, HTTPPayload& reply, const RequestMatch& match) {
+                requests++;
+                std::string content = match.str(1);
+                reply.payload(content, HTTPPayload::OK, "text/plain");
+            });
+            dispatcher.match("/upload").put([this](const HTTPPayload& request, HTTPPayload& reply, const RequestMatch& match) {
+                requests++;
+                std::string content = std::to_string(request.content.size());
+                reply.payload(content, HTTPPayload::OK, "text/plain");
+            });
+
+            m_server.setHandler(dispatcher);
+            m_server.setWorkers(2U, 0U);
+            m_server.setRequestTimeout(timeout);
+            m_server.open();
+            m_thread = std::thread([this]() { m_server.run(); });
+        }
+        /**
+         * @brief Finalizes a instance of the TestServer class.
+         */
+        ~TestServer()
+        {
+            m_server.stop();
+            m_thread.join();
+        }
+
+        std::atomic<uint32_t> requests;
+
+    private:
+        HTTPServer<DefaultRequestDispatcher> m_server;
+        std::thread m_thread;
+    };
+
+    /**
+     * @brief Represents a reply read by the test client.
+     */
+    struct Reply {
+        uint32_t status;
+        std::string connection;
+        std::string content;
+    };
+
+    /**
+     * @brief Helper to connect a client socket to the test server.
+     */
+    void connect(asio::ip::tcp::socket& socket)
+    {
+        socket.connect(asio::ip::tcp::endpoint(asio::ip::address::from_string("127.0.0.1"), TEST_PORT));
+    }
+
+    /**
+     * @brief Helper to write the given text to the socket.
+     */
+    void send(asio::ip::tcp::socket& socket, const std::string& text)
+    {
+        asio::write(socket, asio::buffer(text));
+    }
+
+    /**
+     * @brief Helper to create a GET request.
+     */
+    std::string get(const std::string& uri, const std::string& connection = "keep-alive")
+    {
+        return "GET " + uri + " HTTP/1.1\r\nHost: 127.0.0.1\r\nConnection: " + connection + "\r\n\r\n";
+    }
+
+    /**
+     * @brief Helper to read the next reply from the socket; any data received past the reply is kept in
+     *  pending for the next call.
+     * @returns bool True, if a complete reply was read, otherwise false (the connection was closed).
+     */
+    bool readReply(asio::ip::tcp::socket& socket, std::string& pending, Reply& reply)
+    {
+        char buffer[4096U];
+        asio::error_code ec;
+
+        size_t headerEnd = std::string::npos;
+        while ((headerEnd = pending.find("\r\n\r\n")) == std::string::npos) {
+            size_t len = socket.read_some(asio::buffer(buffer), ec);
+            if (ec)
+                return false;
+            pending.append(buffer, len);
+        }
+
+        std::string header = pending.substr(0U, headerEnd + 2U);
+        pending.erase(0U, headerEnd + 4U);
+
+        reply.status = (uint32_t)::strtoul(header.c_str() + header.find(' ') + 1U, NULL, 10);
+
+        // header names are matched case sensitively, the server always writes them the same way
+        auto headerValue = [&](const std::string& name) -> std::string {
+            size_t pos = header.find("\r\n" + name + ": ");
+            if (pos == std::string::npos)
+                return std::string();
+            pos += name.size() + 4U;
+            return header.substr(pos, header.find("\r\n", pos) - pos);
+        };
+
+        reply.connection = headerValue("Connection");
+        size_t contentLength = (size_t)::strtoul(headerValue("Content-Length").c_str(), NULL, 10);
+        while (pending.size() < contentLength) {
+            size_t len = socket.read_some(asio::buffer(buffer), ec);
+            if (ec)
+                return false;
+            pending.append(buffer, len);
+        }
+
+        reply.content = pending.substr(0U, contentLength);
+        pending.erase(0U, contentLength);
+        return true;
+    }
+
+    /**
+     * @brief Helper to wait for the server to close the connection.
+     * @returns bool True, if the connection was closed without any further data, otherwise false.
+     */
+    bool waitClosed(asio::ip::tcp::socket& socket)
+    {
+        char buffer[256U];
+        asio::error_code ec;
+        socket.read_some(asio::buffer(buffer), ec);
+        return ec == asio::error::eof || ec == asio::error::connection_reset;
+    }
+}
+
+TEST_CASE("HTTPServer keeps connections alive", "[restapi][http]") {
+    TestServer server;
+
+    asio::io_context io;
+    asio::ip::tcp::socket socket(io);
+    connect(socket);
+
+    std::string pending;
+    for (uint32_t i = 1U; i <= 3U; i++) {
+        send(socket, get("/echo/" + std::to_string(i)));
+
+        Reply reply;
+        REQUIRE(readReply(socket, pending, reply));
+        REQUIRE(reply.status == 200U);
+        REQUIRE(reply.connection == "keep-alive");
+        REQUIRE(reply.content == std::to_string(i));
+    }
+    REQUIRE(server.requests == 3U);
+
+    SECTION("Close_Requested") {
+        send(socket, get("/echo/4", "close"));
+
+        Reply reply;
+        REQUIRE(readReply(socket, pending, reply));
+        REQUIRE(reply.status == 200U);
+        REQUIRE(reply.connection == "close");
+        REQUIRE(waitClosed(socket));
+    }
+}
+
+TEST_CASE("HTTPServer answers pipelined requests in order", "[restapi][http]") {
+    TestServer server;
+
+    asio::io_context io;
+    asio::ip::tcp::socket socket(io);
+    connect(socket);
+
+    // all requests are written before any reply is read, the last one with a body
+    std::string body(1000U, 'x');
+    send(socket, get("/echo/1") + get("/echo/22") +
+        "PUT /upload HTTP/1.1\r\nHost: 127.0.0.1\r\nContent-Length: 1000\r\n\r\n" + body + get("/echo/333"));
+
+    std::string pending;
+    const char* expected[] = { "1", "22", "1000", "333" };
+    for (const char* content : expected) {
+        Reply reply;
+        REQUIRE(readReply(socket, pending, reply));
+        REQUIRE(reply.status == 200U);
+        REQUIRE(reply.content == content);
+    }
+    REQUIRE(pending.empty());
+}
+
+TEST_CASE("HTTPServer limits request bodies to 4 MiB", "[restapi][http]") {
+    TestServer server;
+
+    asio::io_context io;
+    asio::ip::tcp::socket socket(io);
+    connect(socket);
+
+    SECTION("At_Limit") {
+        std::string body(HTTP_MAX_CONTENT_LENGTH, 'x');
+        send(socket, "PUT /upload HTTP/1.1\r\nHost: 127.0.0.1\r\nContent-Length: " + std::to_string(body.size()) + "\r\n\r\n" + body);
+
+        std::string pending;
+        Reply reply;
+        REQUIRE(readReply(socket, pending, reply));
+        REQUIRE(reply.status == 200U);
+        REQUIRE(reply.content == std::to_string(HTTP_MAX_CONTENT_LENGTH));
+    }
+
+    SECTION("Over_Limit") {
+        // the request is refused from its header alone, the body is never sent
+        send(socket, "PUT /upload HTTP/1.1\r\nHost: 127.0.0.1\r\nContent-Length: " + std::to_string(HTTP_MAX_CONTENT_LENGTH + 1U) + "\r\n\r\n");
+
+        std::string pending;
+        Reply reply;
+        REQUIRE(readReply(socket, pending, reply));
+        REQUIRE(reply.status == 400U);
+        REQUIRE(reply.connection == "close");
+        REQUIRE(waitClosed(socket));
+        REQUIRE(server.requests == 0U);
+    }
+}
+
+TEST_CASE("HTTPServer closes connections that miss the request deadline", "[restapi][http]") {
+    TestServer server(1U);
+
+    asio::io_context io;
+    asio::ip::tcp::socket socket(io);
+    connect(socket);
+
+    auto start = std::chrono::steady_clock::now();
+
+    SECTION("Idle") {
+        REQUIRE(waitClosed(socket));
+    }
+
+    SECTION("Partial_Header") {
+        send(socket, "GET /echo/1 HTTP/1.1\r\nHost: 127.0.0.1\r\n");
+        REQUIRE(waitClosed(socket));
+    }
+
+    SECTION("Partial_Body") {
+        send(socket, "PUT /upload HTTP/1.1\r\nHost: 127.0.0.1\r\nContent-Length: 100\r\n\r\nxxxx");
+        REQUIRE(waitClosed(socket));
+    }
+
+    SECTION("Idle_After_Keep_Alive") {
+        send(socket, get("/echo/1"));
+
+        std::string pending;
+        Reply reply;
+        REQUIRE(readReply(socket, pending, reply));
+        REQUIRE(reply.status == 200U);
+
+        start = std::chrono::steady_clock::now();
+        REQUIRE(waitClosed(socket));
+    }
+
+    auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start).count();
+    REQUIRE(elapsed >= 900);
+    REQUIRE(elapsed < 5000);
+}
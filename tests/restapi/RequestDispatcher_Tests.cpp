@@ -0,0 +1,165 @@
+// SPDX-License-Identifier: GPL-2.0-only
+/*
+ * Digital Voice Modem - Test Suite
+ * GPLv2 Open Source. Use is subject to license terms.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ *  Copyright (C) 2025 Bryan Biedenkapp, N2PLL
+ *
+ */
+#include "host/Defines.h"
+#include "common/restapi/RequestDispatcher.h"
+#include "host/restapi/RESTDefines.h"
+
+using namespace restapi;
+using namespace restapi::http;
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <string>
+#include <vector>
+
+// ---------------------------------------------------------------------------
+//  Global Functions
+// ---------------------------------------------------------------------------
+
+/**
+ * @brief Helper to register the full dvmhost REST route table; each handler records the
+ *  expression it was registered for, and the path parameters it was called with.
+ * @param dispatcher Request dispatcher.
+ * @param handled Expression of the last handler called.
+ * @param params Path parameters of the last handler called.
+ */
+static void registerHostRoutes(DefaultRequestDispatcher& dispatcher, std::string& handled, std::vector<uint32_t>& params)
+{
+    struct Route {
+        const char* expression;
+        bool regex;
+        bool put;
+    };
+
+    static const Route routes[] = {
+        { PUT_AUTHENTICATE, false, true },
+        { GET_VERSION, false, false },
+        { GET_STATUS, false, false },
+        { GET_VOICE_CH, false, false },
+        { PUT_MDM_MODE, false, true },
+        { PUT_MDM_KILL, false, true },
+        { PUT_SET_SUPERVISOR, false, true },
+        { PUT_PERMIT_TG, false, true },
+        { PUT_GRANT_TG, false, true },
+        { GET_RELEASE_GRNTS, false, false },
+        { GET_RELEASE_AFFS, false, false },
+        { GET_RID_WHITELIST, true, false },
+        { GET_RID_BLACKLIST, true, false },
+        { GET_DMR_BEACON, false, false },
+        { GET_DMR_DEBUG, true, false },
+        { GET_DMR_DUMP_CSBK, true, false },
+        { PUT_DMR_RID, false, true },
+        { GET_DMR_CC_DEDICATED, false, false },
+        { GET_DMR_CC_BCAST, false, false },
+        { GET_DMR_AFFILIATIONS, false, false },
+        { GET_P25_CC, false, false },
+        { GET_P25_DEBUG, true, false },
+        { GET_P25_DUMP_TSBK, true, false },
+        { PUT_P25_RID, false, true },
+        { GET_P25_CC_DEDICATED, false, false },
+        { GET_P25_CC_BCAST, false, false },
+        { PUT_P25_RAW_TSBK, false, true },
+        { GET_P25_AFFILIATIONS, false, false },
+        { GET_NXDN_CC, false, false },
+        { GET_NXDN_DEBUG, false, false },
+        { GET_NXDN_DUMP_RCCH, false, false },
+        { GET_NXDN_CC_DEDICATED, false, false },
+        { GET_NXDN_AFFILIATIONS, false, false },
+    };
+
+    for (const Route& route : routes) {
+        std::string expression = route.expression;
+        auto handler = [&handled, &params, expression](const HTTPPayload& request, HTTPPayload& reply, const RequestMatch& match) {
+            handled = expression;
+            params.clear();
+            for (size_t i = 1U; i < match.size(); i++)
+                params.push_back(match.uintParam(i));
+            reply.status = HTTPPayload::OK;
+        };
+
+        if (route.put)
+            dispatcher.match(route.expression, route.regex).put(handler);
+        else
+            dispatcher.match(route.expression, route.regex).get(handler);
+    }
+}
+
+/**
+ * @brief Helper to dispatch a request.
+ * @param dispatcher Request dispatcher.
+ * @param method HTTP method.
+ * @param uri Request URI.
+ * @returns HTTPPayload HTTP reply.
+ */
+static HTTPPayload dispatch(DefaultRequestDispatcher& dispatcher, const std::string& method, const std::string& uri)
+{
+    HTTPPayload request;
+    request.method = method;
+    request.uri = uri;
+
+    HTTPPayload reply;
+    reply.status = HTTPPayload::NOT_FOUND;
+    dispatcher.handleRequest(request, reply);
+    return reply;
+}
+
+TEST_CASE("RequestDispatcher", "[restapi][dispatcher]") {
+    DefaultRequestDispatcher dispatcher;
+    std::string handled;
+    std::vector<uint32_t> params;
+    registerHostRoutes(dispatcher, handled, params);
+
+    SECTION("Literal_Route") {
+        HTTPPayload reply = dispatch(dispatcher, HTTP_GET, "/version");
+        REQUIRE(reply.status == HTTPPayload::OK);
+        REQUIRE(handled == GET_VERSION);
+        REQUIRE(params.empty());
+        REQUIRE(reply.headers.find("Access-Control-Allow-Origin") == "*");
+    }
+
+    SECTION("Literal_Route_Exact_Over_Prefix") {
+        dispatch(dispatcher, HTTP_GET, "/p25/cc-enable");
+        REQUIRE(handled == GET_P25_CC_DEDICATED);
+        dispatch(dispatcher, HTTP_GET, "/p25/cc");
+        REQUIRE(handled == GET_P25_CC);
+    }
+
+    SECTION("Literal_Route_Query_String") {
+        dispatch(dispatcher, HTTP_GET, "/dmr/report-affiliations?limit=10");
+        REQUIRE(handled == GET_DMR_AFFILIATIONS);
+    }
+
+    SECTION("Numeric_Path_Parameters") {
+        dispatch(dispatcher, HTTP_GET, "/dmr/debug/1/0");
+        REQUIRE(handled == GET_DMR_DEBUG);
+        REQUIRE(params == std::vector<uint32_t>({ 1U, 0U }));
+
+        dispatch(dispatcher, HTTP_GET, "/rid-whitelist/123456");
+        REQUIRE(handled == GET_RID_WHITELIST);
+        REQUIRE(params == std::vector<uint32_t>({ 123456U }));
+    }
+
+    SECTION("Numeric_Path_Parameter_Rejects_Non_Numeric") {
+        HTTPPayload reply = dispatch(dispatcher, HTTP_GET, "/p25/dump-tsbk/abc");
+        REQUIRE(reply.status == HTTPPayload::BAD_REQUEST);
+    }
+
+    SECTION("Unknown_Endpoint") {
+        HTTPPayload reply = dispatch(dispatcher, HTTP_GET, "/does-not-exist");
+        REQUIRE(reply.status == HTTPPayload::BAD_REQUEST);
+    }
+
+    SECTION("Copied_Dispatcher") {
+        DefaultRequestDispatcher copy = dispatcher;
+        dispatch(copy, HTTP_GET, "/p25/dump-tsbk/2");
+        REQUIRE(handled == GET_P25_DUMP_TSBK);
+    }
+
+}
@@ -0,0 +1,139 @@
+// SPDX-License-Identifier: GPL-2.0-only
+/*
+ * Digital Voice Modem - Test Suite
+ * GPLv2 Open Source. Use is subject to license terms.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ *  Copyright (C) 2026 Bryan Biedenkapp, N2PLL
+ *
+ */
+#define _USE_MATH_DEFINES
+#include <math.h>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "vocoder/MBETranscoder.h"
+
+#include <cstring>
+#include <vector>
+
+using namespace vocoder;
+
+namespace {
+    const uint32_t FRAME_CNT = 100U;
+    const uint32_t WARMUP_FRAMES = 5U;
+
+    /**
+     * @brief Helper to generate a voiced test signal with a sweeping pitch.
+     */
+    std::vector<int16_t> generateSpeech()
+    {
+        std::vector<int16_t> pcm(FRAME_CNT * 160U);
+
+        double phase = 0.0;
+        for (uint32_t n = 0U; n < pcm.size(); n++) {
+            double f0 = 120.0 + 40.0 * sin(2.0 * M_PI * n / 16000.0);
+            phase += 2.0 * M_PI * f0 / 8000.0;
+
+            double s = 0.0;
+            for (int h = 1; h * f0 < 3500.0; h++)
+                s += sin(h * phase) / h;
+
+            pcm[n] = (int16_t)(6000.0 * s * (0.6 + 0.4 * sin(2.0 * M_PI * n / 5000.0)));
+        }
+
+        return pcm;
+    }
+
+    /**
+     * @brief Helper to encode the test signal to MBE codewords.
+     */
+    std::vector<std::vector<uint8_t>> encodeSpeech(MBE_ENCODER_MODE mode)
+    {
+        std::vector<int16_t> pcm = generateSpeech();
+
+        MBEEncoder encoder(mode);
+        std::vector<std::vector<uint8_t>> frames(FRAME_CNT, std::vector<uint8_t>(11U, 0x00U));
+        for (uint32_t f = 0U; f < FRAME_CNT; f++)
+            encoder.encode(&pcm[f * 160U], frames[f].data());
+
+        return frames;
+    }
+
+    /**
+     * @brief Helper to check transcoded frames preserve the pitch of the source frames, and decode at the same
+     *  level as the source frames transcoded through PCM (decode and re-encode).
+     */
+    void checkTranscode(MBE_TRANSCODER_MODE mode, MBE_ENCODER_MODE srcEncMode, MBE_DECODER_MODE srcDecMode,
+        MBE_ENCODER_MODE dstEncMode, MBE_DECODER_MODE dstDecMode)
+    {
+        std::vector<std::vector<uint8_t>> src = encodeSpeech(srcEncMode);
+
+        MBETranscoder transcoder(mode);
+        MBEDecoder pcmDecoder(srcDecMode);
+        MBEEncoder pcmEncoder(dstEncMode);
+        std::vector<std::vector<uint8_t>> dst(FRAME_CNT, std::vector<uint8_t>(11U, 0x00U));
+        std::vector<std::vector<uint8_t>> ref(FRAME_CNT, std::vector<uint8_t>(11U, 0x00U));
+        for (uint32_t f = 0U; f < FRAME_CNT; f++) {
+            REQUIRE(transcoder.transcode(src[f].data(), dst[f].data()) >= 0);
+
+            int16_t samples[160U];
+            pcmDecoder.decode(src[f].data(), samples);
+            pcmEncoder.encode(samples, ref[f].data());
+        }
+
+        MBEDecoder srcDecoder(srcDecMode), dstDecoder(dstDecMode);
+        MBEDecoder dstAudio(dstDecMode), refAudio(dstDecMode);
+
+        double pitchErr = 0.0, dstEnergy = 0.0, refEnergy = 0.0;
+        for (uint32_t f = 0U; f < FRAME_CNT; f++) {
+            mbe_parms srcParms, dstParms;
+            srcDecoder.decodeParms(src[f].data(), &srcParms);
+            dstDecoder.decodeParms(dst[f].data(), &dstParms);
+
+            float dstSamples[160U], refSamples[160U];
+            dstAudio.decodeF(dst[f].data(), dstSamples);
+            refAudio.decodeF(ref[f].data(), refSamples);
+
+            if (f < WARMUP_FRAMES)
+                continue;
+
+            pitchErr += fabs(dstParms.w0 - srcParms.w0) / srcParms.w0;
+            for (uint32_t i = 0U; i < 160U; i++) {
+                dstEnergy += dstSamples[i] * dstSamples[i];
+                refEnergy += refSamples[i] * refSamples[i];
+            }
+        }
+
+        pitchErr /= (FRAME_CNT - WARMUP_FRAMES);
+        double level = 10.0 * log10(dstEnergy / refEnergy);
+
+        INFO("mean relative pitch error " << pitchErr << ", level " << level << "dB");
+        REQUIRE(pitchErr < 0.02);
+        REQUIRE(fabs(level) < 1.5);
+    }
+}
+
+TEST_CASE("MBETranscoder transcodes IMBE to DMR AMBE", "[vocoder][transcoder]") {
+    checkTranscode(TRANSCODE_IMBE_TO_DMR_AMBE, ENCODE_88BIT_IMBE, DECODE_88BIT_IMBE, ENCODE_DMR_AMBE, DECODE_DMR_AMBE);
+}
+
+TEST_CASE("MBETranscoder transcodes DMR AMBE to IMBE", "[vocoder][transcoder]") {
+    checkTranscode(TRANSCODE_DMR_AMBE_TO_IMBE, ENCODE_DMR_AMBE, DECODE_DMR_AMBE, ENCODE_88BIT_IMBE, DECODE_88BIT_IMBE);
+}
+
+TEST_CASE("MBETranscoder repeats the previous frame for invalid IMBE codewords", "[vocoder][transcoder]") {
+    std::vector<std::vector<uint8_t>> src = encodeSpeech(ENCODE_88BIT_IMBE);
+
+    MBETranscoder transcoder(TRANSCODE_IMBE_TO_DMR_AMBE);
+    uint8_t out[11U];
+    for (uint32_t f = 0U; f < WARMUP_FRAMES; f++)
+        REQUIRE(transcoder.transcode(src[f].data(), out) == 0);
+
+    // all ones gives a pitch index (b0) of 255, which is out of range
+    uint8_t invalid[11U];
+    ::memset(invalid, 0xFFU, 11U);
+    REQUIRE(transcoder.transcode(invalid, out) == -1);
+
+    REQUIRE(transcoder.transcode(src[WARMUP_FRAMES].data(), out) == 0);
+}
@@ -0,0 +1,223 @@
+// SPDX-License-Identifier: GPL-2.0-only
+/*
+ * Digital Voice Modem - Test Suite
+ * GPLv2 Open Source. Use is subject to license terms.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ *  Copyright (C) 2026 Bryan Biedenkapp, N2PLL
+ *
+ */
+#define _USE_MATH_DEFINES
+#include <math.h>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "vocoder/VocoderService.h"
+#include "vocoder/VocoderClient.h"
+
+#include <atomic>
+#include <string>
+#include <thread>
+#include <vector>
+#include <unistd.h>
+
+using namespace vocoder;
+
+namespace {
+    const uint32_t FRAME_CNT = 25U;
+
+    /**
+     * @brief Helper to generate a unique shared memory segment name for a test.
+     */
+    std::string segmentName(const char* test)
+    {
+        return std::string("/dvmvocoder-test-") + test + "-" + std::to_string(::getpid());
+    }
+
+    /**
+     * @brief Helper to generate voiced test audio.
+     */
+    std::vector<int16_t> generateSpeech()
+    {
+        std::vector<int16_t> pcm(FRAME_CNT * 160U);
+        for (uint32_t n = 0U; n < pcm.size(); n++) {
+            double s = 0.0;
+            for (int h = 1; h * 140.0 < 3500.0; h++)
+                s += sin(2.0 * M_PI * h * 140.0 * n / 8000.0) / h;
+            pcm[n] = (int16_t)(5000.0 * s);
+        }
+
+        return pcm;
+    }
+}
+
+TEST_CASE("VocoderService encodes and decodes identically to a local vocoder", "[vocoder][service]") {
+    std::string name = segmentName("codec");
+    VocoderService service(name, 4U, 2U);
+    REQUIRE(service.open());
+
+    VocoderClient client(name, 1000U);
+    REQUIRE(client.open(shm::CHANNEL_IMBE, 3.0f, false, 3.0f));
+
+    MBEEncoder encoder(ENCODE_88BIT_IMBE);
+    encoder.setGainAdjust(3.0f);
+    MBEDecoder decoder(DECODE_88BIT_IMBE);
+    decoder.setGainAdjust(3.0f);
+
+    std::vector<int16_t> pcm = generateSpeech();
+    double localEnergy = 0.0, remoteEnergy = 0.0;
+    for (uint32_t f = 0U; f < FRAME_CNT; f++) {
+        uint8_t local[11U], remote[11U];
+        ::memset(local, 0x00U, sizeof(local));
+        encoder.encode(&pcm[f * 160U], local);
+        REQUIRE(client.encode(&pcm[f * 160U], remote));
+        REQUIRE(::memcmp(local, remote, sizeof(local)) == 0);
+
+        // unvoiced synthesis uses random phase, so decoded audio is only compared by level
+        int16_t localSamples[160U], remoteSamples[160U];
+        decoder.decode(local, localSamples);
+        REQUIRE(client.decode(remote, remoteSamples));
+        for (uint32_t i = 0U; i < 160U; i++) {
+            localEnergy += (double)localSamples[i] * localSamples[i];
+            remoteEnergy += (double)remoteSamples[i] * remoteSamples[i];
+        }
+    }
+
+    REQUIRE(localEnergy > 0.0);
+    REQUIRE(fabs(remoteEnergy / localEnergy - 1.0) < 0.1);
+
+    REQUIRE(client.getFrames() == FRAME_CNT * 2U);
+    REQUIRE(client.getTimeouts() == 0U);
+
+    std::vector<VocoderService::ChannelStats> stats = service.getStats();
+    REQUIRE(stats.size() == 1U);
+    REQUIRE(stats[0U].ownerPid == (uint32_t)::getpid());
+    REQUIRE(stats[0U].frames == FRAME_CNT * 2U);
+}
+
+TEST_CASE("VocoderService transcodes on a transcoder channel", "[vocoder][service]") {
+    std::string name = segmentName("transcode");
+    VocoderService service(name, 2U, 1U);
+    REQUIRE(service.open());
+
+    VocoderClient client(name, 1000U);
+    REQUIRE(client.open(shm::CHANNEL_IMBE_TO_DMR_AMBE));
+
+    MBEEncoder encoder(ENCODE_88BIT_IMBE);
+    MBETranscoder transcoder(TRANSCODE_IMBE_TO_DMR_AMBE);
+
+    std::vector<int16_t> pcm = generateSpeech();
+    for (uint32_t f = 0U; f < FRAME_CNT; f++) {
+        uint8_t imbe[11U];
+        ::memset(imbe, 0x00U, sizeof(imbe));
+        encoder.encode(&pcm[f * 160U], imbe);
+
+        uint8_t local[9U], remote[9U];
+        transcoder.transcode(imbe, local);
+        REQUIRE(client.transcode(imbe, remote));
+        REQUIRE(::memcmp(local, remote, sizeof(local)) == 0);
+    }
+
+    // codec operations are not valid on a transcoder channel
+    int16_t samples[160U];
+    REQUIRE(!client.encode(samples, (uint8_t*)samples));
+    REQUIRE(client.isOpen());
+}
+
+TEST_CASE("VocoderClient serializes calls from several threads", "[vocoder][service]") {
+    std::string name = segmentName("threads");
+    VocoderService service(name, 2U, 2U);
+    REQUIRE(service.open());
+
+    VocoderClient client(name, 1000U);
+    REQUIRE(client.open(shm::CHANNEL_IMBE));
+
+    std::vector<int16_t> pcm = generateSpeech();
+    uint8_t imbe[11U];
+    REQUIRE(client.encode(&pcm[0U], imbe));
+
+    // one thread encodes while another decodes on the same channel; every request must receive its
+    // own response
+    std::atomic<uint32_t> failed(0U);
+    std::thread encoder([&]() {
+        for (uint32_t f = 0U; f < FRAME_CNT * 4U; f++) {
+            uint8_t out[11U];
+            if (!client.encode(&pcm[(f % FRAME_CNT) * 160U], out))
+                failed++;
+        }
+    });
+    std::thread decoder([&]() {
+        for (uint32_t f = 0U; f < FRAME_CNT * 4U; f++) {
+            int16_t samples[160U];
+            if (!client.decode(imbe, samples))
+                failed++;
+        }
+    });
+    encoder.join();
+    decoder.join();
+
+    REQUIRE(failed == 0U);
+    REQUIRE(client.getTimeouts() == 0U);
+    REQUIRE(client.getFrames() == (FRAME_CNT * 8U) + 1U);
+
+    // closing while another thread is mid-call must not pull the channel out from under it
+    std::atomic<bool> running(true);
+    std::thread worker([&]() {
+        uint8_t out[11U];
+        while (running)
+            client.encode(&pcm[0U], out);
+    });
+    ::usleep(5000U);
+    client.close();
+    running = false;
+    worker.join();
+
+    REQUIRE(!client.isOpen());
+    REQUIRE(!client.encode(&pcm[0U], imbe));
+}
+
+TEST_CASE("VocoderService reclaims released channels", "[vocoder][service]") {
+    std::string name = segmentName("reclaim");
+    VocoderService service(name, 2U, 1U);
+    REQUIRE(service.open());
+
+    VocoderClient a(name), b(name), c(name);
+    REQUIRE(a.open(shm::CHANNEL_DMR_AMBE));
+    REQUIRE(b.open(shm::CHANNEL_IMBE));
+    REQUIRE(!c.open(shm::CHANNEL_DMR_AMBE));
+
+    uint32_t channelNo = a.getChannelNo();
+    a.close();
+    REQUIRE(!a.isOpen());
+
+    // the service returns the channel to the pool once it has released the vocoder state
+    bool opened = false;
+    for (uint32_t i = 0U; i < 200U && !opened; i++) {
+        opened = c.open(shm::CHANNEL_DMR_AMBE);
+        if (!opened)
+            ::usleep(1000U);
+    }
+    REQUIRE(opened);
+    REQUIRE(c.getChannelNo() == channelNo);
+}
+
+TEST_CASE("VocoderClient fails when no service is running", "[vocoder][service]") {
+    std::string name = segmentName("absent");
+
+    VocoderClient client(name);
+    REQUIRE(!client.open(shm::CHANNEL_DMR_AMBE));
+
+    int16_t samples[160U];
+    uint8_t ambe[9U];
+    ::memset(samples, 0x00U, sizeof(samples));
+    REQUIRE(!client.encode(samples, ambe));
+
+    // the service refuses to start twice on one segment, and the client detaches when it stops
+    VocoderService service(name, 1U, 1U);
+    REQUIRE(service.open());
+    VocoderService second(name, 1U, 1U);
+    REQUIRE(!second.open());
+    REQUIRE(client.open(shm::CHANNEL_DMR_AMBE));
+    service.close();
+    REQUIRE(!client.encode(samples, ambe));
+}